@@ -0,0 +1,46 @@
+#include "AllocationCounter.h"
+
+#ifdef _DEBUG
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+	thread_local uint64_t allocationCount = 0;
+}
+
+void* operator new(std::size_t size)
+{
+	++allocationCount;
+	void* const memory = std::malloc(size != 0 ? size : 1);
+	if (memory == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+	return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+	std::free(memory);
+}
+
+uint64_t AllocationCounter::getCount()
+{
+	return allocationCount;
+}
+
+#else
+
+uint64_t AllocationCounter::getCount()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+
+// Debug builds replace the global operator new to count heap allocations made
+// by the calling thread. Release builds always report zero.
+class AllocationCounter
+{
+private:
+	AllocationCounter() = default;
+
+public:
+	static uint64_t getCount();
+};
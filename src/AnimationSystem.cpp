@@ -0,0 +1,252 @@
+#include "AnimationSystem.h"
+
+#include <initializer_list>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ANIMATION_SYSTEM_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+	// Held objects lean by this many degrees per unit of distance left.
+	constexpr float tiltPerUnit = 100.0f;
+	constexpr float maxTilt = 60.0f;
+
+#ifdef ANIMATION_SYSTEM_SSE2
+	__m128 select(__m128 mask, __m128 a, __m128 b)
+	{
+		return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+	}
+#endif
+}
+
+AnimationSystem::AnimationSystem(int capacity)
+{
+	const size_t size = (static_cast<size_t>(capacity) + 3) & ~static_cast<size_t>(3);
+	for (std::vector<float>* column : {
+		&m_positionX, &m_positionY, &m_positionZ,
+		&m_previousX, &m_previousY, &m_previousZ,
+		&m_targetX, &m_targetY, &m_targetZ,
+		&m_tiltX, &m_tiltZ, &m_previousTiltX, &m_previousTiltZ,
+		&m_speed, &m_held
+	})
+	{
+		column->reserve(size);
+	}
+	m_moving.reserve(size);
+	m_freeSlots.reserve(size);
+}
+
+int AnimationSystem::add(const glm::vec3& position)
+{
+	if (m_freeSlots.empty())
+	{
+		grow();
+	}
+	const int slot = m_freeSlots.back();
+	m_freeSlots.pop_back();
+	setPosition(slot, position);
+	m_speed[slot] = 1.0f;
+	return slot;
+}
+
+int AnimationSystem::duplicate(int slot)
+{
+	const int copy = add(getPosition(slot));
+	m_previousX[copy] = m_previousX[slot];
+	m_previousY[copy] = m_previousY[slot];
+	m_previousZ[copy] = m_previousZ[slot];
+	setTarget(copy, getTarget(slot));
+	m_tiltX[copy] = m_tiltX[slot];
+	m_tiltZ[copy] = m_tiltZ[slot];
+	m_previousTiltX[copy] = m_previousTiltX[slot];
+	m_previousTiltZ[copy] = m_previousTiltZ[slot];
+	m_speed[copy] = m_speed[slot];
+	m_held[copy] = m_held[slot];
+	m_moving[copy] = m_moving[slot];
+	m_movingCount += m_moving[copy];
+	return copy;
+}
+
+void AnimationSystem::remove(int slot)
+{
+	setPosition(slot, glm::vec3(0.0f));
+	m_speed[slot] = 0.0f;
+	m_held[slot] = 0.0f;
+	m_freeSlots.push_back(slot);
+}
+
+void AnimationSystem::grow()
+{
+	const size_t size = m_speed.size() + 4;
+	for (std::vector<float>* column : {
+		&m_positionX, &m_positionY, &m_positionZ,
+		&m_previousX, &m_previousY, &m_previousZ,
+		&m_targetX, &m_targetY, &m_targetZ,
+		&m_tiltX, &m_tiltZ, &m_previousTiltX, &m_previousTiltZ,
+		&m_speed, &m_held
+	})
+	{
+		column->resize(size, 0.0f);
+	}
+	m_moving.resize(size, 0);
+
+	// Lowest slots are handed out first.
+	for (size_t slot = size; slot-- > size - 4;)
+	{
+		m_freeSlots.push_back(static_cast<int>(slot));
+	}
+}
+
+void AnimationSystem::update(float deltaTime)
+{
+	const int size = static_cast<int>(m_speed.size());
+	int movingCount = 0;
+	int slot = 0;
+
+#ifdef ANIMATION_SYSTEM_SSE2
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 step = _mm_set1_ps(deltaTime);
+	const __m128 tiltScale = _mm_set1_ps(tiltPerUnit);
+	const __m128 tiltMax = _mm_set1_ps(maxTilt);
+	const __m128 tiltMin = _mm_set1_ps(-maxTilt);
+	for (; slot + 4 <= size; slot += 4)
+	{
+		const __m128 positionX = _mm_loadu_ps(&m_positionX[slot]);
+		const __m128 positionY = _mm_loadu_ps(&m_positionY[slot]);
+		const __m128 positionZ = _mm_loadu_ps(&m_positionZ[slot]);
+		const __m128 targetX = _mm_loadu_ps(&m_targetX[slot]);
+		const __m128 targetY = _mm_loadu_ps(&m_targetY[slot]);
+		const __m128 targetZ = _mm_loadu_ps(&m_targetZ[slot]);
+
+		const __m128 movementX = _mm_sub_ps(targetX, positionX);
+		const __m128 movementY = _mm_sub_ps(targetY, positionY);
+		const __m128 movementZ = _mm_sub_ps(targetZ, positionZ);
+		const __m128 length = _mm_sqrt_ps(_mm_add_ps(
+			_mm_add_ps(_mm_mul_ps(movementX, movementX), _mm_mul_ps(movementY, movementY)),
+			_mm_mul_ps(movementZ, movementZ)
+		));
+
+		// Lanes already there or about to overshoot snap, their 0 / 0 scale
+		// is never used.
+		const __m128 travel = _mm_mul_ps(
+			_mm_mul_ps(_mm_loadu_ps(&m_speed[slot]), step),
+			_mm_add_ps(one, length)
+		);
+		const __m128 arrived = _mm_cmpge_ps(travel, length);
+		const __m128 scale = _mm_div_ps(travel, length);
+		const __m128 nextX = select(arrived, targetX, _mm_add_ps(positionX, _mm_mul_ps(movementX, scale)));
+		const __m128 nextY = select(arrived, targetY, _mm_add_ps(positionY, _mm_mul_ps(movementY, scale)));
+		const __m128 nextZ = select(arrived, targetZ, _mm_add_ps(positionZ, _mm_mul_ps(movementZ, scale)));
+
+		const __m128 held = _mm_loadu_ps(&m_held[slot]);
+		const __m128 tiltX = _mm_mul_ps(held, _mm_min_ps(tiltMax, _mm_max_ps(tiltMin,
+			_mm_mul_ps(movementZ, tiltScale))));
+		const __m128 tiltZ = _mm_mul_ps(held, _mm_min_ps(tiltMax, _mm_max_ps(tiltMin,
+			_mm_sub_ps(_mm_setzero_ps(), _mm_mul_ps(movementX, tiltScale)))));
+		const __m128 lastTiltX = _mm_loadu_ps(&m_tiltX[slot]);
+		const __m128 lastTiltZ = _mm_loadu_ps(&m_tiltZ[slot]);
+
+		_mm_storeu_ps(&m_previousX[slot], positionX);
+		_mm_storeu_ps(&m_previousY[slot], positionY);
+		_mm_storeu_ps(&m_previousZ[slot], positionZ);
+		_mm_storeu_ps(&m_positionX[slot], nextX);
+		_mm_storeu_ps(&m_positionY[slot], nextY);
+		_mm_storeu_ps(&m_positionZ[slot], nextZ);
+		_mm_storeu_ps(&m_previousTiltX[slot], lastTiltX);
+		_mm_storeu_ps(&m_previousTiltZ[slot], lastTiltZ);
+		_mm_storeu_ps(&m_tiltX[slot], tiltX);
+		_mm_storeu_ps(&m_tiltZ[slot], tiltZ);
+
+		// Moving until a step changes nothing and nothing is left to travel.
+		const __m128 moving = _mm_or_ps(
+			_mm_or_ps(_mm_cmpneq_ps(length, _mm_setzero_ps()), _mm_cmpneq_ps(lastTiltX, tiltX)),
+			_mm_cmpneq_ps(lastTiltZ, tiltZ)
+		);
+		const int mask = _mm_movemask_ps(moving);
+		for (int lane = 0; lane < 4; ++lane)
+		{
+			m_moving[slot + lane] = static_cast<uint8_t>((mask >> lane) & 1);
+			movingCount += (mask >> lane) & 1;
+		}
+	}
+#endif
+
+	for (; slot < size; ++slot)
+	{
+		const glm::vec3 position = {m_positionX[slot], m_positionY[slot], m_positionZ[slot]};
+		const glm::vec3 movement = getTarget(slot) - position;
+		const float length = glm::length(movement);
+		const float travel = m_speed[slot] * deltaTime * (1.0f + length);
+		const glm::vec3 next = travel >= length ? getTarget(slot) : position + movement * (travel / length);
+
+		const float tiltX = m_held[slot] * glm::clamp(movement.z * tiltPerUnit, -maxTilt, maxTilt);
+		const float tiltZ = m_held[slot] * glm::clamp(-movement.x * tiltPerUnit, -maxTilt, maxTilt);
+
+		m_previousX[slot] = position.x;
+		m_previousY[slot] = position.y;
+		m_previousZ[slot] = position.z;
+		m_positionX[slot] = next.x;
+		m_positionY[slot] = next.y;
+		m_positionZ[slot] = next.z;
+		m_previousTiltX[slot] = m_tiltX[slot];
+		m_previousTiltZ[slot] = m_tiltZ[slot];
+
+		const bool moving = length != 0.0f || m_tiltX[slot] != tiltX || m_tiltZ[slot] != tiltZ;
+		m_tiltX[slot] = tiltX;
+		m_tiltZ[slot] = tiltZ;
+		m_moving[slot] = moving ? 1 : 0;
+		movingCount += moving ? 1 : 0;
+	}
+
+	m_movingCount = movingCount;
+}
+
+Transform AnimationSystem::getTransform(int slot, float alpha) const
+{
+	Transform transform;
+	transform.setPosition(glm::mix(
+		glm::vec3(m_previousX[slot], m_previousY[slot], m_previousZ[slot]),
+		getPosition(slot),
+		alpha
+	));
+	const float tiltX = glm::mix(m_previousTiltX[slot], m_tiltX[slot], alpha);
+	const float tiltZ = glm::mix(m_previousTiltZ[slot], m_tiltZ[slot], alpha);
+	if (tiltX != 0.0f || tiltZ != 0.0f)
+	{
+		transform.setRotation(glm::vec3(tiltX, 0.0f, tiltZ));
+	}
+	return transform;
+}
+
+glm::vec3 AnimationSystem::getPosition(int slot) const
+{
+	return {m_positionX[slot], m_positionY[slot], m_positionZ[slot]};
+}
+
+void AnimationSystem::setPosition(int slot, const glm::vec3& position)
+{
+	m_positionX[slot] = m_previousX[slot] = m_targetX[slot] = position.x;
+	m_positionY[slot] = m_previousY[slot] = m_targetY[slot] = position.y;
+	m_positionZ[slot] = m_previousZ[slot] = m_targetZ[slot] = position.z;
+	m_tiltX[slot] = m_tiltZ[slot] = 0.0f;
+	m_previousTiltX[slot] = m_previousTiltZ[slot] = 0.0f;
+	if (m_moving[slot] != 0)
+	{
+		m_moving[slot] = 0;
+		--m_movingCount;
+	}
+}
+
+glm::vec3 AnimationSystem::getTarget(int slot) const
+{
+	return {m_targetX[slot], m_targetY[slot], m_targetZ[slot]};
+}
+
+void AnimationSystem::setTarget(int slot, const glm::vec3& target)
+{
+	m_targetX[slot] = target.x;
+	m_targetY[slot] = target.y;
+	m_targetZ[slot] = target.z;
+}
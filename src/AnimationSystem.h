@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Transform.h"
+
+// Positions, targets and speeds of every animated object in parallel arrays,
+// advanced together in one pass. Objects refer to a slot, which stays valid
+// until it is removed.
+//
+// Positions move towards their target faster the further away they are and
+// snap once the next step would overshoot. Held objects tilt into their
+// movement.
+class AnimationSystem
+{
+public:
+	explicit AnimationSystem(int capacity = 0);
+
+	AnimationSystem(const AnimationSystem&) = delete;
+	AnimationSystem& operator=(const AnimationSystem&) = delete;
+
+public:
+	// A resting slot at position, moving at speed 1.
+	int add(const glm::vec3& position);
+	// A copy of the state of slot.
+	int duplicate(int slot);
+	void remove(int slot);
+
+	void update(float deltaTime);
+
+	// Counted by the last update(), so asking never visits the slots.
+	bool isAnimating() const { return m_movingCount != 0; }
+	int getMovingCount() const { return m_movingCount; }
+	bool isMoving(int slot) const { return m_moving[slot] != 0; }
+
+	// Alpha blends between the states before and after the last update().
+	Transform getTransform(int slot, float alpha) const;
+
+public:
+	glm::vec3 getPosition(int slot) const;
+	// Places the slot at rest, without animating towards it.
+	void setPosition(int slot, const glm::vec3& position);
+
+	glm::vec3 getTarget(int slot) const;
+	void setTarget(int slot, const glm::vec3& target);
+
+	void setSpeed(int slot, float speed) { m_speed[slot] = speed; }
+	void setHeld(int slot, bool held) { m_held[slot] = held ? 1.0f : 0.0f; }
+
+private:
+	void grow();
+
+private:
+	// Columns are padded to whole groups of four for the SIMD pass, padding
+	// and removed slots rest at the origin.
+	std::vector<float> m_positionX, m_positionY, m_positionZ;
+	std::vector<float> m_previousX, m_previousY, m_previousZ;
+	std::vector<float> m_targetX, m_targetY, m_targetZ;
+	std::vector<float> m_tiltX, m_tiltZ;
+	std::vector<float> m_previousTiltX, m_previousTiltZ;
+	std::vector<float> m_speed;
+	std::vector<float> m_held;
+	std::vector<uint8_t> m_moving;
+
+	std::vector<int> m_freeSlots;
+	int m_movingCount = 0;
+};
@@ -0,0 +1,133 @@
+#include "AssetRegistry.h"
+
+#include <cstdio>
+#include <type_traits>
+
+#include "BakedMeshes.h"
+#include "Renderer.h"
+
+AssetRegistry::AssetRegistry(const Renderer& renderer)
+	: m_renderer(renderer)
+{
+}
+
+const Mesh& AssetRegistry::getMesh(MeshAsset asset) const
+{
+	static_assert(
+		std::extent<decltype(BakedMeshes::meshes), 0>::value == MeshAssetCount
+			&& std::extent<decltype(BakedMeshes::meshes), 1>::value == MeshRecipes::maxLevelCount,
+		"BakedMeshes.h is out of date, run tools/meshgen"
+	);
+
+	if (!m_loaded[asset])
+	{
+		std::array<Mesh, MeshRecipes::maxLevelCount>& levels = m_meshes[asset];
+		for (int level = 0; level < MeshRecipes::getLevelCount(asset); ++level)
+		{
+			const BakedMesh& baked = BakedMeshes::meshes[asset][level];
+			levels[level] = {};
+			levels[level].baked = &baked;
+			levels[level].bounds = baked.bounds;
+			m_renderer.uploadMesh(levels[level]);
+			if (level + 1 < MeshRecipes::getLevelCount(asset))
+			{
+				levels[level].lowerDetail = &levels[level + 1];
+				levels[level].lowerDetailBelow = MeshRecipes::getLowerDetailBelow(level);
+			}
+		}
+		m_loaded[asset] = true;
+		++m_loadCount;
+	}
+	return m_meshes[asset][0];
+}
+
+void AssetRegistry::loadAll() const
+{
+	for (int asset = 0; asset < MeshAssetCount; ++asset)
+	{
+		getMesh(static_cast<MeshAsset>(asset));
+	}
+}
+
+void AssetRegistry::release()
+{
+	for (int asset = 0; asset < MeshAssetCount; ++asset)
+	{
+		if (m_loaded[asset])
+		{
+			for (Mesh& mesh : m_meshes[asset])
+			{
+				m_renderer.releaseMesh(mesh);
+				mesh = {};
+			}
+			m_loaded[asset] = false;
+		}
+	}
+}
+
+size_t AssetRegistry::getMemoryUsage(MeshAsset asset) const
+{
+	size_t total = 0;
+	for (const Mesh& mesh : m_meshes[asset])
+	{
+		total += mesh.getVertexCount() * sizeof(Vertex) + mesh.getIndexCount() * sizeof(uint16_t);
+	}
+	return total;
+}
+
+size_t AssetRegistry::getMemoryUsage() const
+{
+	size_t total = 0;
+	for (int asset = 0; asset < MeshAssetCount; ++asset)
+	{
+		total += getMemoryUsage(static_cast<MeshAsset>(asset));
+	}
+	return total;
+}
+
+void AssetRegistry::logMemoryReport() const
+{
+	for (int asset = 0; asset < MeshAssetCount; ++asset)
+	{
+		size_t vertexCount = 0;
+		size_t indexCount = 0;
+		for (const Mesh& mesh : m_meshes[asset])
+		{
+			vertexCount += mesh.getVertexCount();
+			indexCount += mesh.getIndexCount();
+		}
+		std::fprintf(
+			stderr,
+			"%-12s %-8s %d levels %5zu vertices %6zu indices %8zu bytes\n",
+			MeshRecipes::getAssetName(static_cast<MeshAsset>(asset)),
+			m_loaded[asset] ? "loaded" : "unloaded",
+			MeshRecipes::getLevelCount(static_cast<MeshAsset>(asset)),
+			vertexCount,
+			indexCount,
+			getMemoryUsage(static_cast<MeshAsset>(asset))
+		);
+	}
+	std::fprintf(stderr, "total %zu bytes\n", getMemoryUsage());
+}
+
+const std::array<glm::vec3, AssetRegistry::paletteSize>& AssetRegistry::getPalette()
+{
+	static const std::array<glm::vec3, paletteSize> palette = {
+		glm::vec3(1.0f),
+		pieceColorLightNeutral,
+		pieceColorLightNeutral + pieceColorOffsetLightMovable,
+		pieceColorLightNeutral + pieceColorOffsetLightSelected,
+		pieceColorLightNeutral + pieceColorOffsetLightCapture,
+		pieceColorDarkNeutral,
+		pieceColorDarkNeutral + pieceColorOffsetDarkMovable,
+		pieceColorDarkNeutral + pieceColorOffsetDarkSelected,
+		pieceColorDarkNeutral + pieceColorOffsetDarkCapture
+	};
+	return palette;
+}
+
+int AssetRegistry::getPaletteIndex(PieceType type, PieceState state)
+{
+	constexpr int stateCount = 4;
+	return 1 + static_cast<int>(type) * stateCount + static_cast<int>(state);
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include <glm/glm.hpp>
+
+#include "MeshRecipes.h"
+#include "PieceTypes.h"
+
+class Renderer;
+
+// Owns every shared mesh exactly once. A mesh is uploaded from the data baked
+// into BakedMeshes.h the first time it is asked for, references stay valid
+// until release(). Round meshes come with coarser levels of detail chained to
+// them.
+class AssetRegistry
+{
+public:
+	explicit AssetRegistry(const Renderer& renderer);
+
+	AssetRegistry(const AssetRegistry&) = delete;
+	AssetRegistry& operator=(const AssetRegistry&) = delete;
+
+public:
+	const Mesh& getMesh(MeshAsset asset) const;
+
+	// Loads every asset up front, for renderers that may only upload on the
+	// thread owning their context.
+	void loadAll() const;
+	void release();
+
+	bool isLoaded(MeshAsset asset) const { return m_loaded[asset]; }
+	uint64_t getLoadCount() const { return m_loadCount; }
+
+	// Bytes of baked vertex and index data of every loaded level, GPU copies
+	// are the same size.
+	size_t getMemoryUsage(MeshAsset asset) const;
+	size_t getMemoryUsage() const;
+	void logMemoryReport() const;
+
+public:
+	// Entry 0 is white and leaves baked vertex colours untouched, the rest
+	// hold one colour per PieceType and PieceState.
+	static constexpr int paletteSize = 9;
+	static const std::array<glm::vec3, paletteSize>& getPalette();
+	static int getPaletteIndex(PieceType type, PieceState state);
+
+protected:
+	static constexpr glm::vec3 pieceColorLightNeutral = {0.9f, 0.9f, 0.9f};
+	static constexpr glm::vec3 pieceColorOffsetLightMovable = {-0.15f, -0.15f, 0.1f};
+	static constexpr glm::vec3 pieceColorOffsetLightSelected = {0.1f, 0.1f, 0.1f};
+	static constexpr glm::vec3 pieceColorOffsetLightCapture = {0.1f, -0.45f, -0.4f};
+
+	static constexpr glm::vec3 pieceColorDarkNeutral = {0.2f, 0.2f, 0.2f};
+	static constexpr glm::vec3 pieceColorOffsetDarkMovable = {-0.02f, -0.02f, 0.23f};
+	static constexpr glm::vec3 pieceColorOffsetDarkSelected = {0.15f, 0.15f, 0.15f};
+	static constexpr glm::vec3 pieceColorOffsetDarkCapture = {0.23f, -0.02f, -0.02f};
+
+private:
+	const Renderer& m_renderer;
+
+	mutable std::array<std::array<Mesh, MeshRecipes::maxLevelCount>, MeshAssetCount> m_meshes;
+	mutable std::array<bool, MeshAssetCount> m_loaded = {};
+	mutable uint64_t m_loadCount = 0;
+};
@@ -0,0 +1,4260 @@
+#pragma once
+
+// Generated by tools/meshgen from MeshRecipes, do not edit.
+// Include it from AssetRegistry.cpp only.
+
+#include "RenderTypes.h"
+
+namespace BakedMeshes
+{
+	constexpr Vertex tileOddLevel0Vertices[] = {
+		{{-0.5f, 0.0f, -0.5f}, {0.0f, 1.0f, 0.0f}, {0.85f, 0.75f, 0.5f}},
+		{{0.5f, 0.0f, 0.5f}, {0.0f, 1.0f, 0.0f}, {0.85f, 0.75f, 0.5f}},
+		{{0.5f, 0.0f, -0.5f}, {0.0f, 1.0f, 0.0f}, {0.85f, 0.75f, 0.5f}},
+		{{-0.5f, 0.0f, 0.5f}, {0.0f, 1.0f, 0.0f}, {0.85f, 0.75f, 0.5f}},
+	};
+
+	constexpr uint16_t tileOddLevel0Indices[] = {
+		0, 1, 2, 0, 3, 1,
+	};
+
+	constexpr Vertex tileEvenLevel0Vertices[] = {
+		{{-0.5f, 0.0f, -0.5f}, {0.0f, 1.0f, 0.0f}, {0.29f, 0.24f, 0.21f}},
+		{{0.5f, 0.0f, 0.5f}, {0.0f, 1.0f, 0.0f}, {0.29f, 0.24f, 0.21f}},
+		{{0.5f, 0.0f, -0.5f}, {0.0f, 1.0f, 0.0f}, {0.29f, 0.24f, 0.21f}},
+		{{-0.5f, 0.0f, 0.5f}, {0.0f, 1.0f, 0.0f}, {0.29f, 0.24f, 0.21f}},
+	};
+
+	constexpr uint16_t tileEvenLevel0Indices[] = {
+		0, 1, 2, 0, 3, 1,
+	};
+
+	constexpr Vertex tableBorderLevel0Vertices[] = {
+		{{-0.5f, 0.0f, -0.5f}, {0.0f, 1.0f, 0.0f}, {0.36f, 0.22f, 0.13f}},
+		{{0.5f, 0.0f, 0.5f}, {0.0f, 1.0f, 0.0f}, {0.36f, 0.22f, 0.13f}},
+		{{0.5f, 0.0f, -0.5f}, {0.0f, 1.0f, 0.0f}, {0.36f, 0.22f, 0.13f}},
+		{{-0.5f, 0.0f, 0.5f}, {0.0f, 1.0f, 0.0f}, {0.36f, 0.22f, 0.13f}},
+	};
+
+	constexpr uint16_t tableBorderLevel0Indices[] = {
+		0, 1, 2, 0, 3, 1,
+	};
+
+	constexpr Vertex pieceLevel0Vertices[] = {
+		{{0.0f, 0.1f, 0.35f}, {0.0f, 0.0f, 0.35f}, {1.0f, 1.0f, 1.0f}},
+		{{0.0f, -0.1f, 0.35f}, {0.0f, 0.0f, 0.35f}, {1.0f, 1.0f, 1.0f}},
+		{{0.045684163f, 0.1f, 0.3470057f}, {0.045684163f, 0.0f, 0.3470057f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.045684163f, -0.1f, 0.3470057f}, {-0.045684163f, 0.0f, 0.3470057f}, {1.0f, 1.0f, 1.0f}},
+		{{0.045684163f, -0.1f, 0.3470057f}, {0.045684163f, 0.0f, 0.3470057f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.045684163f, 0.1f, 0.3470057f}, {-0.045684163f, 0.0f, 0.3470057f}, {1.0f, 1.0f, 1.0f}},
+		{{0.09058666f, 0.1f, 0.33807403f}, {0.09058666f, 0.0f, 0.33807403f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.09058666f, -0.1f, 0.33807403f}, {-0.09058666f, 0.0f, 0.33807403f}, {1.0f, 1.0f, 1.0f}},
+		{{0.09058666f, -0.1f, 0.33807403f}, {0.09058666f, 0.0f, 0.33807403f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.09058666f, 0.1f, 0.33807403f}, {-0.09058666f, 0.0f, 0.33807403f}, {1.0f, 1.0f, 1.0f}},
+		{{0.13393919f, 0.1f, 0.32335782f}, {0.13393919f, 0.0f, 0.32335782f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.13393919f, -0.1f, 0.32335782f}, {-0.13393919f, 0.0f, 0.32335782f}, {1.0f, 1.0f, 1.0f}},
+		{{0.13393919f, -0.1f, 0.32335782f}, {0.13393919f, 0.0f, 0.32335782f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.13393919f, 0.1f, 0.32335782f}, {-0.13393919f, 0.0f, 0.32335782f}, {1.0f, 1.0f, 1.0f}},
+		{{0.175f, 0.1f, 0.30310887f}, {0.175f, 0.0f, 0.30310887f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.175f, -0.1f, 0.30310887f}, {-0.175f, 0.0f, 0.30310887f}, {1.0f, 1.0f, 1.0f}},
+		{{0.175f, -0.1f, 0.30310887f}, {0.175f, 0.0f, 0.30310887f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.175f, 0.1f, 0.30310887f}, {-0.175f, 0.0f, 0.30310887f}, {1.0f, 1.0f, 1.0f}},
+		{{0.2130665f, 0.1f, 0.27767366f}, {0.2130665f, 0.0f, 0.27767366f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.2130665f, -0.1f, 0.27767366f}, {-0.2130665f, 0.0f, 0.27767366f}, {1.0f, 1.0f, 1.0f}},
+		{{0.2130665f, -0.1f, 0.27767366f}, {0.2130665f, 0.0f, 0.27767366f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.2130665f, 0.1f, 0.27767366f}, {-0.2130665f, 0.0f, 0.27767366f}, {1.0f, 1.0f, 1.0f}},
+		{{0.24748737f, 0.1f, 0.24748737f}, {0.24748737f, 0.0f, 0.24748737f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.24748737f, -0.1f, 0.24748737f}, {-0.24748737f, 0.0f, 0.24748737f}, {1.0f, 1.0f, 1.0f}},
+		{{0.24748737f, -0.1f, 0.24748737f}, {0.24748737f, 0.0f, 0.24748737f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.24748737f, 0.1f, 0.24748737f}, {-0.24748737f, 0.0f, 0.24748737f}, {1.0f, 1.0f, 1.0f}},
+		{{0.27767366f, 0.1f, 0.2130665f}, {0.27767366f, 0.0f, 0.2130665f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.27767366f, -0.1f, 0.2130665f}, {-0.27767366f, 0.0f, 0.2130665f}, {1.0f, 1.0f, 1.0f}},
+		{{0.27767366f, -0.1f, 0.2130665f}, {0.27767366f, 0.0f, 0.2130665f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.27767366f, 0.1f, 0.2130665f}, {-0.27767366f, 0.0f, 0.2130665f}, {1.0f, 1.0f, 1.0f}},
+		{{0.30310887f, 0.1f, 0.175f}, {0.30310887f, 0.0f, 0.175f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.30310887f, -0.1f, 0.175f}, {-0.30310887f, 0.0f, 0.175f}, {1.0f, 1.0f, 1.0f}},
+		{{0.30310887f, -0.1f, 0.175f}, {0.30310887f, 0.0f, 0.175f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.30310887f, 0.1f, 0.175f}, {-0.30310887f, 0.0f, 0.175f}, {1.0f, 1.0f, 1.0f}},
+		{{0.32335782f, 0.1f, 0.13393919f}, {0.32335782f, 0.0f, 0.13393919f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.32335782f, -0.1f, 0.13393919f}, {-0.32335782f, 0.0f, 0.13393919f}, {1.0f, 1.0f, 1.0f}},
+		{{0.32335782f, -0.1f, 0.13393919f}, {0.32335782f, 0.0f, 0.13393919f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.32335782f, 0.1f, 0.13393919f}, {-0.32335782f, 0.0f, 0.13393919f}, {1.0f, 1.0f, 1.0f}},
+		{{0.33807403f, 0.1f, 0.09058666f}, {0.33807403f, 0.0f, 0.09058666f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.33807403f, -0.1f, 0.09058666f}, {-0.33807403f, 0.0f, 0.09058666f}, {1.0f, 1.0f, 1.0f}},
+		{{0.33807403f, -0.1f, 0.09058666f}, {0.33807403f, 0.0f, 0.09058666f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.33807403f, 0.1f, 0.09058666f}, {-0.33807403f, 0.0f, 0.09058666f}, {1.0f, 1.0f, 1.0f}},
+		{{0.3470057f, 0.1f, 0.045684163f}, {0.3470057f, 0.0f, 0.045684163f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.3470057f, -0.1f, 0.045684163f}, {-0.3470057f, 0.0f, 0.045684163f}, {1.0f, 1.0f, 1.0f}},
+		{{0.3470057f, -0.1f, 0.045684163f}, {0.3470057f, 0.0f, 0.045684163f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.3470057f, 0.1f, 0.045684163f}, {-0.3470057f, 0.0f, 0.045684163f}, {1.0f, 1.0f, 1.0f}},
+		{{0.35f, 0.1f, -5.940152e-14f}, {0.35f, 0.0f, -5.940152e-14f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.35f, -0.1f, 0.0f}, {-0.35f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.35f, -0.1f, -5.940152e-14f}, {0.35f, 0.0f, -5.940152e-14f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.35f, 0.1f, 0.0f}, {-0.35f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.3470057f, 0.1f, -0.045684163f}, {0.3470057f, 0.0f, -0.045684163f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.3470057f, -0.1f, -0.045684163f}, {-0.3470057f, 0.0f, -0.045684163f}, {1.0f, 1.0f, 1.0f}},
+		{{0.3470057f, -0.1f, -0.045684163f}, {0.3470057f, 0.0f, -0.045684163f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.3470057f, 0.1f, -0.045684163f}, {-0.3470057f, 0.0f, -0.045684163f}, {1.0f, 1.0f, 1.0f}},
+		{{0.33807403f, 0.1f, -0.09058666f}, {0.33807403f, 0.0f, -0.09058666f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.33807403f, -0.1f, -0.09058666f}, {-0.33807403f, 0.0f, -0.09058666f}, {1.0f, 1.0f, 1.0f}},
+		{{0.33807403f, -0.1f, -0.09058666f}, {0.33807403f, 0.0f, -0.09058666f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.33807403f, 0.1f, -0.09058666f}, {-0.33807403f, 0.0f, -0.09058666f}, {1.0f, 1.0f, 1.0f}},
+		{{0.32335782f, 0.1f, -0.13393919f}, {0.32335782f, 0.0f, -0.13393919f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.32335782f, -0.1f, -0.13393919f}, {-0.32335782f, 0.0f, -0.13393919f}, {1.0f, 1.0f, 1.0f}},
+		{{0.32335782f, -0.1f, -0.13393919f}, {0.32335782f, 0.0f, -0.13393919f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.32335782f, 0.1f, -0.13393919f}, {-0.32335782f, 0.0f, -0.13393919f}, {1.0f, 1.0f, 1.0f}},
+		{{0.30310887f, 0.1f, -0.175f}, {0.30310887f, 0.0f, -0.175f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.30310887f, -0.1f, -0.175f}, {-0.30310887f, 0.0f, -0.175f}, {1.0f, 1.0f, 1.0f}},
+		{{0.30310887f, -0.1f, -0.175f}, {0.30310887f, 0.0f, -0.175f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.30310887f, 0.1f, -0.175f}, {-0.30310887f, 0.0f, -0.175f}, {1.0f, 1.0f, 1.0f}},
+		{{0.27767366f, 0.1f, -0.2130665f}, {0.27767366f, 0.0f, -0.2130665f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.27767366f, -0.1f, -0.2130665f}, {-0.27767366f, 0.0f, -0.2130665f}, {1.0f, 1.0f, 1.0f}},
+		{{0.27767366f, -0.1f, -0.2130665f}, {0.27767366f, 0.0f, -0.2130665f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.27767366f, 0.1f, -0.2130665f}, {-0.27767366f, 0.0f, -0.2130665f}, {1.0f, 1.0f, 1.0f}},
+		{{0.24748737f, 0.1f, -0.24748737f}, {0.24748737f, 0.0f, -0.24748737f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.24748737f, -0.1f, -0.24748737f}, {-0.24748737f, 0.0f, -0.24748737f}, {1.0f, 1.0f, 1.0f}},
+		{{0.24748737f, -0.1f, -0.24748737f}, {0.24748737f, 0.0f, -0.24748737f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.24748737f, 0.1f, -0.24748737f}, {-0.24748737f, 0.0f, -0.24748737f}, {1.0f, 1.0f, 1.0f}},
+		{{0.2130665f, 0.1f, -0.27767366f}, {0.2130665f, 0.0f, -0.27767366f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.2130665f, -0.1f, -0.27767366f}, {-0.2130665f, 0.0f, -0.27767366f}, {1.0f, 1.0f, 1.0f}},
+		{{0.2130665f, -0.1f, -0.27767366f}, {0.2130665f, 0.0f, -0.27767366f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.2130665f, 0.1f, -0.27767366f}, {-0.2130665f, 0.0f, -0.27767366f}, {1.0f, 1.0f, 1.0f}},
+		{{0.175f, 0.1f, -0.30310887f}, {0.175f, 0.0f, -0.30310887f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.175f, -0.1f, -0.30310887f}, {-0.175f, 0.0f, -0.30310887f}, {1.0f, 1.0f, 1.0f}},
+		{{0.175f, -0.1f, -0.30310887f}, {0.175f, 0.0f, -0.30310887f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.175f, 0.1f, -0.30310887f}, {-0.175f, 0.0f, -0.30310887f}, {1.0f, 1.0f, 1.0f}},
+		{{0.13393919f, 0.1f, -0.32335782f}, {0.13393919f, 0.0f, -0.32335782f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.13393919f, -0.1f, -0.32335782f}, {-0.13393919f, 0.0f, -0.32335782f}, {1.0f, 1.0f, 1.0f}},
+		{{0.13393919f, -0.1f, -0.32335782f}, {0.13393919f, 0.0f, -0.32335782f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.13393919f, 0.1f, -0.32335782f}, {-0.13393919f, 0.0f, -0.32335782f}, {1.0f, 1.0f, 1.0f}},
+		{{0.09058666f, 0.1f, -0.33807403f}, {0.09058666f, 0.0f, -0.33807403f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.09058666f, -0.1f, -0.33807403f}, {-0.09058666f, 0.0f, -0.33807403f}, {1.0f, 1.0f, 1.0f}},
+		{{0.09058666f, -0.1f, -0.33807403f}, {0.09058666f, 0.0f, -0.33807403f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.09058666f, 0.1f, -0.33807403f}, {-0.09058666f, 0.0f, -0.33807403f}, {1.0f, 1.0f, 1.0f}},
+		{{0.045684163f, 0.1f, -0.3470057f}, {0.045684163f, 0.0f, -0.3470057f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.045684163f, -0.1f, -0.3470057f}, {-0.045684163f, 0.0f, -0.3470057f}, {1.0f, 1.0f, 1.0f}},
+		{{0.045684163f, -0.1f, -0.3470057f}, {0.045684163f, 0.0f, -0.3470057f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.045684163f, 0.1f, -0.3470057f}, {-0.045684163f, 0.0f, -0.3470057f}, {1.0f, 1.0f, 1.0f}},
+		{{-5.940152e-14f, 0.1f, -0.35f}, {-5.940152e-14f, 0.0f, -0.35f}, {1.0f, 1.0f, 1.0f}},
+		{{-5.940152e-14f, -0.1f, -0.35f}, {-5.940152e-14f, 0.0f, -0.35f}, {1.0f, 1.0f, 1.0f}},
+		{{0.0f, 0.1f, 0.0f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.0f, 0.1f, 0.35f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.045684163f, 0.1f, 0.3470057f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.045684163f, 0.1f, 0.3470057f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.09058666f, 0.1f, 0.33807403f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.09058666f, 0.1f, 0.33807403f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.13393919f, 0.1f, 0.32335782f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.13393919f, 0.1f, 0.32335782f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.175f, 0.1f, 0.30310887f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.175f, 0.1f, 0.30310887f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.2130665f, 0.1f, 0.27767366f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.2130665f, 0.1f, 0.27767366f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.24748737f, 0.1f, 0.24748737f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.24748737f, 0.1f, 0.24748737f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.27767366f, 0.1f, 0.2130665f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.27767366f, 0.1f, 0.2130665f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.30310887f, 0.1f, 0.175f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.30310887f, 0.1f, 0.175f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.32335782f, 0.1f, 0.13393919f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.32335782f, 0.1f, 0.13393919f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.33807403f, 0.1f, 0.09058666f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.33807403f, 0.1f, 0.09058666f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.3470057f, 0.1f, 0.045684163f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.3470057f, 0.1f, 0.045684163f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.35f, 0.1f, -5.940152e-14f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.35f, 0.1f, 0.0f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.3470057f, 0.1f, -0.045684163f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.3470057f, 0.1f, -0.045684163f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.33807403f, 0.1f, -0.09058666f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.33807403f, 0.1f, -0.09058666f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.32335782f, 0.1f, -0.13393919f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.32335782f, 0.1f, -0.13393919f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.30310887f, 0.1f, -0.175f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.30310887f, 0.1f, -0.175f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.27767366f, 0.1f, -0.2130665f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.27767366f, 0.1f, -0.2130665f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.24748737f, 0.1f, -0.24748737f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.24748737f, 0.1f, -0.24748737f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.2130665f, 0.1f, -0.27767366f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.2130665f, 0.1f, -0.27767366f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.175f, 0.1f, -0.30310887f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.175f, 0.1f, -0.30310887f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.13393919f, 0.1f, -0.32335782f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.13393919f, 0.1f, -0.32335782f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.09058666f, 0.1f, -0.33807403f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.09058666f, 0.1f, -0.33807403f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.045684163f, 0.1f, -0.3470057f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.045684163f, 0.1f, -0.3470057f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-5.940152e-14f, 0.1f, -0.35f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.0f, -0.1f, 0.0f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.045684163f, -0.1f, 0.3470057f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.0f, -0.1f, 0.35f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.045684163f, -0.1f, 0.3470057f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.09058666f, -0.1f, 0.33807403f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.09058666f, -0.1f, 0.33807403f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.13393919f, -0.1f, 0.32335782f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.13393919f, -0.1f, 0.32335782f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.175f, -0.1f, 0.30310887f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.175f, -0.1f, 0.30310887f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.2130665f, -0.1f, 0.27767366f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.2130665f, -0.1f, 0.27767366f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.24748737f, -0.1f, 0.24748737f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.24748737f, -0.1f, 0.24748737f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.27767366f, -0.1f, 0.2130665f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.27767366f, -0.1f, 0.2130665f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.30310887f, -0.1f, 0.175f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.30310887f, -0.1f, 0.175f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.32335782f, -0.1f, 0.13393919f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.32335782f, -0.1f, 0.13393919f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.33807403f, -0.1f, 0.09058666f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.33807403f, -0.1f, 0.09058666f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.3470057f, -0.1f, 0.045684163f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.3470057f, -0.1f, 0.045684163f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.35f, -0.1f, -5.940152e-14f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.35f, -0.1f, 0.0f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.3470057f, -0.1f, -0.045684163f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.3470057f, -0.1f, -0.045684163f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.33807403f, -0.1f, -0.09058666f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.33807403f, -0.1f, -0.09058666f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.32335782f, -0.1f, -0.13393919f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.32335782f, -0.1f, -0.13393919f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.30310887f, -0.1f, -0.175f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.30310887f, -0.1f, -0.175f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.27767366f, -0.1f, -0.2130665f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.27767366f, -0.1f, -0.2130665f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.24748737f, -0.1f, -0.24748737f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.24748737f, -0.1f, -0.24748737f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.2130665f, -0.1f, -0.27767366f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.2130665f, -0.1f, -0.27767366f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.175f, -0.1f, -0.30310887f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.175f, -0.1f, -0.30310887f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.13393919f, -0.1f, -0.32335782f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.13393919f, -0.1f, -0.32335782f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.09058666f, -0.1f, -0.33807403f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.09058666f, -0.1f, -0.33807403f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.045684163f, -0.1f, -0.3470057f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.045684163f, -0.1f, -0.3470057f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-5.940152e-14f, -0.1f, -0.35f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+	};
+
+	constexpr uint16_t pieceLevel0Indices[] = {
+		0, 1, 2, 3, 1, 0, 1, 4, 2, 5, 3, 0, 2, 4, 6, 7,
+		3, 5, 4, 8, 6, 9, 7, 5, 6, 8, 10, 11, 7, 9, 8, 12,
+		10, 13, 11, 9, 10, 12, 14, 15, 11, 13, 12, 16, 14, 17, 15, 13,
+		14, 16, 18, 19, 15, 17, 16, 20, 18, 21, 19, 17, 18, 20, 22, 23,
+		19, 21, 20, 24, 22, 25, 23, 21, 22, 24, 26, 27, 23, 25, 24, 28,
+		26, 29, 27, 25, 26, 28, 30, 31, 27, 29, 28, 32, 30, 33, 31, 29,
+		30, 32, 34, 35, 31, 33, 32, 36, 34, 37, 35, 33, 34, 36, 38, 39,
+		35, 37, 36, 40, 38, 41, 39, 37, 38, 40, 42, 43, 39, 41, 40, 44,
+		42, 45, 43, 41, 42, 44, 46, 47, 43, 45, 44, 48, 46, 49, 47, 45,
+		46, 48, 50, 51, 47, 49, 48, 52, 50, 53, 51, 49, 50, 52, 54, 55,
+		51, 53, 52, 56, 54, 57, 55, 53, 54, 56, 58, 59, 55, 57, 56, 60,
+		58, 61, 59, 57, 58, 60, 62, 63, 59, 61, 60, 64, 62, 65, 63, 61,
+		62, 64, 66, 67, 63, 65, 64, 68, 66, 69, 67, 65, 66, 68, 70, 71,
+		67, 69, 68, 72, 70, 73, 71, 69, 70, 72, 74, 75, 71, 73, 72, 76,
+		74, 77, 75, 73, 74, 76, 78, 79, 75, 77, 76, 80, 78, 81, 79, 77,
+		78, 80, 82, 83, 79, 81, 80, 84, 82, 85, 83, 81, 82, 84, 86, 87,
+		83, 85, 84, 88, 86, 89, 87, 85, 86, 88, 90, 91, 87, 89, 88, 92,
+		90, 93, 91, 89, 90, 92, 94, 95, 91, 93, 92, 95, 94, 94, 95, 93,
+		96, 97, 98, 96, 99, 97, 96, 98, 100, 96, 101, 99, 96, 100, 102, 96,
+		103, 101, 96, 102, 104, 96, 105, 103, 96, 104, 106, 96, 107, 105, 96, 106,
+		108, 96, 109, 107, 96, 108, 110, 96, 111, 109, 96, 110, 112, 96, 113, 111,
+		96, 112, 114, 96, 115, 113, 96, 114, 116, 96, 117, 115, 96, 116, 118, 96,
+		119, 117, 96, 118, 120, 96, 121, 119, 96, 120, 122, 96, 123, 121, 96, 122,
+		124, 96, 125, 123, 96, 124, 126, 96, 127, 125, 96, 126, 128, 96, 129, 127,
+		96, 128, 130, 96, 131, 129, 96, 130, 132, 96, 133, 131, 96, 132, 134, 96,
+		135, 133, 96, 134, 136, 96, 137, 135, 96, 136, 138, 96, 139, 137, 96, 138,
+		140, 96, 141, 139, 96, 140, 142, 96, 143, 141, 96, 142, 144, 96, 144, 143,
+		145, 146, 147, 145, 147, 148, 145, 149, 146, 145, 148, 150, 145, 151, 149, 145,
+		150, 152, 145, 153, 151, 145, 152, 154, 145, 155, 153, 145, 154, 156, 145, 157,
+		155, 145, 156, 158, 145, 159, 157, 145, 158, 160, 145, 161, 159, 145, 160, 162,
+		145, 163, 161, 145, 162, 164, 145, 165, 163, 145, 164, 166, 145, 167, 165, 145,
+		166, 168, 145, 169, 167, 145, 168, 170, 145, 171, 169, 145, 170, 172, 145, 173,
+		171, 145, 172, 174, 145, 175, 173, 145, 174, 176, 145, 177, 175, 145, 176, 178,
+		145, 179, 177, 145, 178, 180, 145, 181, 179, 145, 180, 182, 145, 183, 181, 145,
+		182, 184, 145, 185, 183, 145, 184, 186, 145, 187, 185, 145, 186, 188, 145, 189,
+		187, 145, 188, 190, 145, 191, 189, 145, 190, 192, 145, 193, 191, 145, 192, 193,
+	};
+
+	constexpr Vertex pieceLevel1Vertices[] = {
+		{{0.0f, 0.1f, 0.35f}, {0.0f, 0.0f, 0.35f}, {1.0f, 1.0f, 1.0f}},
+		{{0.0f, -0.1f, 0.35f}, {0.0f, 0.0f, 0.35f}, {1.0f, 1.0f, 1.0f}},
+		{{0.10815595f, 0.1f, 0.3328698f}, {0.10815595f, 0.0f, 0.3328698f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.10815595f, -0.1f, 0.3328698f}, {-0.10815595f, 0.0f, 0.3328698f}, {1.0f, 1.0f, 1.0f}},
+		{{0.10815595f, -0.1f, 0.3328698f}, {0.10815595f, 0.0f, 0.3328698f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.10815595f, 0.1f, 0.3328698f}, {-0.10815595f, 0.0f, 0.3328698f}, {1.0f, 1.0f, 1.0f}},
+		{{0.20572484f, 0.1f, 0.28315595f}, {0.20572484f, 0.0f, 0.28315595f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.20572484f, -0.1f, 0.28315595f}, {-0.20572484f, 0.0f, 0.28315595f}, {1.0f, 1.0f, 1.0f}},
+		{{0.20572484f, -0.1f, 0.28315595f}, {0.20572484f, 0.0f, 0.28315595f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.20572484f, 0.1f, 0.28315595f}, {-0.20572484f, 0.0f, 0.28315595f}, {1.0f, 1.0f, 1.0f}},
+		{{0.28315595f, 0.1f, 0.20572484f}, {0.28315595f, 0.0f, 0.20572484f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.28315595f, -0.1f, 0.20572484f}, {-0.28315595f, 0.0f, 0.20572484f}, {1.0f, 1.0f, 1.0f}},
+		{{0.28315595f, -0.1f, 0.20572484f}, {0.28315595f, 0.0f, 0.20572484f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.28315595f, 0.1f, 0.20572484f}, {-0.28315595f, 0.0f, 0.20572484f}, {1.0f, 1.0f, 1.0f}},
+		{{0.3328698f, 0.1f, 0.10815595f}, {0.3328698f, 0.0f, 0.10815595f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.3328698f, -0.1f, 0.10815595f}, {-0.3328698f, 0.0f, 0.10815595f}, {1.0f, 1.0f, 1.0f}},
+		{{0.3328698f, -0.1f, 0.10815595f}, {0.3328698f, 0.0f, 0.10815595f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.3328698f, 0.1f, 0.10815595f}, {-0.3328698f, 0.0f, 0.10815595f}, {1.0f, 1.0f, 1.0f}},
+		{{0.35f, 0.1f, -5.940152e-14f}, {0.35f, 0.0f, -5.940152e-14f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.35f, -0.1f, 0.0f}, {-0.35f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.35f, -0.1f, -5.940152e-14f}, {0.35f, 0.0f, -5.940152e-14f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.35f, 0.1f, 0.0f}, {-0.35f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.3328698f, 0.1f, -0.10815595f}, {0.3328698f, 0.0f, -0.10815595f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.3328698f, -0.1f, -0.10815595f}, {-0.3328698f, 0.0f, -0.10815595f}, {1.0f, 1.0f, 1.0f}},
+		{{0.3328698f, -0.1f, -0.10815595f}, {0.3328698f, 0.0f, -0.10815595f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.3328698f, 0.1f, -0.10815595f}, {-0.3328698f, 0.0f, -0.10815595f}, {1.0f, 1.0f, 1.0f}},
+		{{0.28315595f, 0.1f, -0.20572484f}, {0.28315595f, 0.0f, -0.20572484f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.28315595f, -0.1f, -0.20572484f}, {-0.28315595f, 0.0f, -0.20572484f}, {1.0f, 1.0f, 1.0f}},
+		{{0.28315595f, -0.1f, -0.20572484f}, {0.28315595f, 0.0f, -0.20572484f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.28315595f, 0.1f, -0.20572484f}, {-0.28315595f, 0.0f, -0.20572484f}, {1.0f, 1.0f, 1.0f}},
+		{{0.20572484f, 0.1f, -0.28315595f}, {0.20572484f, 0.0f, -0.28315595f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.20572484f, -0.1f, -0.28315595f}, {-0.20572484f, 0.0f, -0.28315595f}, {1.0f, 1.0f, 1.0f}},
+		{{0.20572484f, -0.1f, -0.28315595f}, {0.20572484f, 0.0f, -0.28315595f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.20572484f, 0.1f, -0.28315595f}, {-0.20572484f, 0.0f, -0.28315595f}, {1.0f, 1.0f, 1.0f}},
+		{{0.10815595f, 0.1f, -0.3328698f}, {0.10815595f, 0.0f, -0.3328698f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.10815595f, -0.1f, -0.3328698f}, {-0.10815595f, 0.0f, -0.3328698f}, {1.0f, 1.0f, 1.0f}},
+		{{0.10815595f, -0.1f, -0.3328698f}, {0.10815595f, 0.0f, -0.3328698f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.10815595f, 0.1f, -0.3328698f}, {-0.10815595f, 0.0f, -0.3328698f}, {1.0f, 1.0f, 1.0f}},
+		{{-5.940152e-14f, 0.1f, -0.35f}, {-5.940152e-14f, 0.0f, -0.35f}, {1.0f, 1.0f, 1.0f}},
+		{{-5.940152e-14f, -0.1f, -0.35f}, {-5.940152e-14f, 0.0f, -0.35f}, {1.0f, 1.0f, 1.0f}},
+		{{0.0f, 0.1f, 0.0f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.0f, 0.1f, 0.35f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.10815595f, 0.1f, 0.3328698f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.10815595f, 0.1f, 0.3328698f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.20572484f, 0.1f, 0.28315595f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.20572484f, 0.1f, 0.28315595f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.28315595f, 0.1f, 0.20572484f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.28315595f, 0.1f, 0.20572484f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.3328698f, 0.1f, 0.10815595f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.3328698f, 0.1f, 0.10815595f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.35f, 0.1f, -5.940152e-14f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.35f, 0.1f, 0.0f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.3328698f, 0.1f, -0.10815595f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.3328698f, 0.1f, -0.10815595f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.28315595f, 0.1f, -0.20572484f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.28315595f, 0.1f, -0.20572484f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.20572484f, 0.1f, -0.28315595f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.20572484f, 0.1f, -0.28315595f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.10815595f, 0.1f, -0.3328698f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.10815595f, 0.1f, -0.3328698f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-5.940152e-14f, 0.1f, -0.35f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.0f, -0.1f, 0.0f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.10815595f, -0.1f, 0.3328698f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.0f, -0.1f, 0.35f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.10815595f, -0.1f, 0.3328698f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.20572484f, -0.1f, 0.28315595f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.20572484f, -0.1f, 0.28315595f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.28315595f, -0.1f, 0.20572484f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.28315595f, -0.1f, 0.20572484f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.3328698f, -0.1f, 0.10815595f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.3328698f, -0.1f, 0.10815595f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.35f, -0.1f, -5.940152e-14f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.35f, -0.1f, 0.0f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.3328698f, -0.1f, -0.10815595f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.3328698f, -0.1f, -0.10815595f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.28315595f, -0.1f, -0.20572484f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.28315595f, -0.1f, -0.20572484f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.20572484f, -0.1f, -0.28315595f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.20572484f, -0.1f, -0.28315595f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.10815595f, -0.1f, -0.3328698f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.10815595f, -0.1f, -0.3328698f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-5.940152e-14f, -0.1f, -0.35f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+	};
+
+	constexpr uint16_t pieceLevel1Indices[] = {
+		0, 1, 2, 3, 1, 0, 1, 4, 2, 5, 3, 0, 2, 4, 6, 7,
+		3, 5, 4, 8, 6, 9, 7, 5, 6, 8, 10, 11, 7, 9, 8, 12,
+		10, 13, 11, 9, 10, 12, 14, 15, 11, 13, 12, 16, 14, 17, 15, 13,
+		14, 16, 18, 19, 15, 17, 16, 20, 18, 21, 19, 17, 18, 20, 22, 23,
+		19, 21, 20, 24, 22, 25, 23, 21, 22, 24, 26, 27, 23, 25, 24, 28,
+		26, 29, 27, 25, 26, 28, 30, 31, 27, 29, 28, 32, 30, 33, 31, 29,
+		30, 32, 34, 35, 31, 33, 32, 36, 34, 37, 35, 33, 34, 36, 38, 39,
+		35, 37, 36, 39, 38, 38, 39, 37, 40, 41, 42, 40, 43, 41, 40, 42,
+		44, 40, 45, 43, 40, 44, 46, 40, 47, 45, 40, 46, 48, 40, 49, 47,
+		40, 48, 50, 40, 51, 49, 40, 50, 52, 40, 53, 51, 40, 52, 54, 40,
+		55, 53, 40, 54, 56, 40, 57, 55, 40, 56, 58, 40, 59, 57, 40, 58,
+		60, 40, 60, 59, 61, 62, 63, 61, 63, 64, 61, 65, 62, 61, 64, 66,
+		61, 67, 65, 61, 66, 68, 61, 69, 67, 61, 68, 70, 61, 71, 69, 61,
+		70, 72, 61, 73, 71, 61, 72, 74, 61, 75, 73, 61, 74, 76, 61, 77,
+		75, 61, 76, 78, 61, 79, 77, 61, 78, 80, 61, 81, 79, 61, 80, 81,
+	};
+
+	constexpr Vertex pieceLevel2Vertices[] = {
+		{{0.0f, 0.1f, 0.0f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.0f, 0.1f, 0.35f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.24748737f, 0.1f, 0.24748737f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.24748737f, 0.1f, 0.24748737f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.35f, 0.1f, -5.940152e-14f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.35f, 0.1f, 0.0f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.24748737f, 0.1f, -0.24748737f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.24748737f, 0.1f, -0.24748737f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-5.940152e-14f, 0.1f, -0.35f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.0f, -0.1f, 0.0f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.24748737f, -0.1f, 0.24748737f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.0f, -0.1f, 0.35f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.24748737f, -0.1f, 0.24748737f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.35f, -0.1f, -5.940152e-14f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.35f, -0.1f, 0.0f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.24748737f, -0.1f, -0.24748737f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.24748737f, -0.1f, -0.24748737f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{-5.940152e-14f, -0.1f, -0.35f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.0f, 0.1f, 0.35f}, {0.0f, 0.0f, 0.35f}, {1.0f, 1.0f, 1.0f}},
+		{{0.0f, -0.1f, 0.35f}, {0.0f, 0.0f, 0.35f}, {1.0f, 1.0f, 1.0f}},
+		{{0.24748737f, 0.1f, 0.24748737f}, {0.24748737f, 0.0f, 0.24748737f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.24748737f, -0.1f, 0.24748737f}, {-0.24748737f, 0.0f, 0.24748737f}, {1.0f, 1.0f, 1.0f}},
+		{{0.24748737f, -0.1f, 0.24748737f}, {0.24748737f, 0.0f, 0.24748737f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.24748737f, 0.1f, 0.24748737f}, {-0.24748737f, 0.0f, 0.24748737f}, {1.0f, 1.0f, 1.0f}},
+		{{0.35f, 0.1f, -5.940152e-14f}, {0.35f, 0.0f, -5.940152e-14f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.35f, -0.1f, 0.0f}, {-0.35f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.35f, -0.1f, -5.940152e-14f}, {0.35f, 0.0f, -5.940152e-14f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.35f, 0.1f, 0.0f}, {-0.35f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+		{{0.24748737f, 0.1f, -0.24748737f}, {0.24748737f, 0.0f, -0.24748737f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.24748737f, -0.1f, -0.24748737f}, {-0.24748737f, 0.0f, -0.24748737f}, {1.0f, 1.0f, 1.0f}},
+		{{0.24748737f, -0.1f, -0.24748737f}, {0.24748737f, 0.0f, -0.24748737f}, {1.0f, 1.0f, 1.0f}},
+		{{-0.24748737f, 0.1f, -0.24748737f}, {-0.24748737f, 0.0f, -0.24748737f}, {1.0f, 1.0f, 1.0f}},
+		{{-5.940152e-14f, 0.1f, -0.35f}, {-5.940152e-14f, 0.0f, -0.35f}, {1.0f, 1.0f, 1.0f}},
+		{{-5.940152e-14f, -0.1f, -0.35f}, {-5.940152e-14f, 0.0f, -0.35f}, {1.0f, 1.0f, 1.0f}},
+	};
+
+	constexpr uint16_t pieceLevel2Indices[] = {
+		0, 1, 2, 0, 3, 1, 0, 2, 4, 0, 5, 3, 0, 4, 6, 0,
+		7, 5, 0, 6, 8, 0, 8, 7, 9, 10, 11, 9, 11, 12, 9, 13,
+		10, 9, 12, 14, 9, 15, 13, 9, 14, 16, 9, 17, 15, 9, 16, 17,
+		18, 19, 20, 21, 19, 18, 19, 22, 20, 23, 21, 18, 20, 22, 24, 25,
+		21, 23, 22, 26, 24, 27, 25, 23, 24, 26, 28, 29, 25, 27, 26, 30,
+		28, 31, 29, 27, 28, 30, 32, 33, 29, 31, 30, 33, 32, 32, 33, 31,
+	};
+
+	constexpr Vertex hintRingLevel0Vertices[] = {
+		{{0.0f, 0.47f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.46957225f, 0.0065263095f}, {0.0f, 0.9914449f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.061347306f, 0.4659791f, 0.0f}, {0.13052619f, 0.9914449f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.06129147f, 0.46555498f, -0.0065263095f}, {0.12940952f, 0.98296297f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.06129147f, 0.46555498f, 0.0065263095f}, {-0.12940952f, 0.98296297f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.121534236f, 0.45357195f, -0.0065263095f}, {0.25660482f, 0.9576622f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.061347306f, 0.4659791f, 0.0f}, {-0.13052619f, 0.9914449f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.46957225f, -0.0065263095f}, {0.0f, 0.9914449f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.061124925f, 0.46428996f, -0.012940953f}, {0.1260786f, 0.9576622f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.06129147f, 0.46555498f, -0.0065263095f}, {-0.12940952f, 0.98296297f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.121203996f, 0.45233947f, -0.012940953f}, {0.25f, 0.93301266f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.4682963f, -0.012940953f}, {0.0f, 0.9659258f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.12065987f, 0.45030877f, -0.019134171f}, {0.23911761f, 0.8923991f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.06085052f, 0.46220562f, -0.019134171f}, {0.12059047f, 0.91597563f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.061124925f, 0.46428996f, -0.012940953f}, {-0.1260786f, 0.9576622f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.46619397f, -0.019134171f}, {0.0f, 0.9238795f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11991119f, 0.44751462f, -0.025f}, {0.22414386f, 0.83651626f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.060472947f, 0.45933765f, -0.025f}, {0.11303899f, 0.8586165f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.06085052f, 0.46220562f, -0.019134171f}, {-0.12059047f, 0.91597563f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.46330124f, -0.025f}, {0.0f, 0.8660254f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11897074f, 0.44400483f, -0.030438071f}, {0.20533495f, 0.76632047f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.059998665f, 0.45573515f, -0.030438071f}, {0.103553385f, 0.7865661f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.060472947f, 0.45933765f, -0.025f}, {-0.11303899f, 0.8586165f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.45966765f, -0.030438071f}, {0.0f, 0.7933533f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.117854625f, 0.43983945f, -0.03535534f}, {0.1830127f, 0.68301266f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.059435792f, 0.4514597f, -0.03535534f}, {0.09229595f, 0.7010574f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.059998665f, 0.45573515f, -0.030438071f}, {-0.103553385f, 0.7865661f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.45535532f, -0.03535534f}, {0.0f, 0.70710677f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11658195f, 0.43508974f, -0.039667666f}, {0.15755905f, 0.58801836f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.058793962f, 0.44658452f, -0.039667666f}, {0.07945931f, 0.6035534f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.059435792f, 0.4514597f, -0.03535534f}, {-0.09229595f, 0.7010574f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.45043805f, -0.039667666f}, {0.0f, 0.6087614f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11517447f, 0.42983696f, -0.04330127f}, {0.12940952f, 0.4829629f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.05808415f, 0.44119295f, -0.04330127f}, {0.06526309f, 0.49572244f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.058793962f, 0.44658452f, -0.039667666f}, {-0.07945931f, 0.6035534f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.445f, -0.04330127f}, {0.0f, 0.5f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11365628f, 0.424171f, -0.046193976f}, {0.09904576f, 0.3696438f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.057318505f, 0.43537733f, -0.046193976f}, {0.04995021f, 0.37940952f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.05808415f, 0.44119295f, -0.04330127f}, {-0.06526309f, 0.49572244f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.43913415f, -0.046193976f}, {0.0f, 0.38268343f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11205336f, 0.4181888f, -0.04829629f}, {0.0669873f, 0.25f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.056510128f, 0.42923707f, -0.04829629f}, {0.03378266f, 0.25660482f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.057318505f, 0.43537733f, -0.046193976f}, {-0.04995021f, 0.37940952f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.43294093f, -0.04829629f}, {0.0f, 0.25881904f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11039313f, 0.41199276f, -0.049572244f}, {0.03378266f, 0.1260786f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.05567285f, 0.4228773f, -0.049572244f}, {0.017037084f, 0.12940952f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.056510128f, 0.42923707f, -0.04829629f}, {-0.03378266f, 0.25660482f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.4265263f, -0.049572244f}, {0.0f, 0.13052619f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.10870399f, 0.40568882f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.054820996f, 0.41640684f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.05567285f, 0.4228773f, -0.049572244f}, {-0.017037084f, 0.12940952f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.42f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.10701486f, 0.3993849f, -0.049572244f}, {-0.03378266f, -0.1260786f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.05396914f, 0.40993637f, -0.049572244f}, {-0.017037084f, -0.12940952f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.054820996f, 0.41640684f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.41347367f, -0.049572244f}, {0.0f, -0.13052619f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.10535463f, 0.39318883f, -0.04829629f}, {-0.0669873f, -0.25f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.053131863f, 0.4035766f, -0.04829629f}, {-0.03378266f, -0.25660482f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.05396914f, 0.40993637f, -0.049572244f}, {0.017037084f, -0.12940952f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.40705904f, -0.04829629f}, {0.0f, -0.25881904f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.103751704f, 0.38720664f, -0.046193976f}, {-0.09904576f, -0.3696438f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.052323487f, 0.39743635f, -0.046193976f}, {-0.04995021f, -0.37940952f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.053131863f, 0.4035766f, -0.04829629f}, {0.03378266f, -0.25660482f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.40086582f, -0.046193976f}, {0.0f, -0.38268343f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.102233514f, 0.3815407f, -0.04330127f}, {-0.12940952f, -0.4829629f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.051557843f, 0.39162073f, -0.04330127f}, {-0.06526309f, -0.49572244f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.052323487f, 0.39743635f, -0.046193976f}, {0.04995021f, -0.37940952f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.39499998f, -0.04330127f}, {0.0f, -0.5f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.10082604f, 0.3762879f, -0.039667666f}, {-0.15755905f, -0.58801836f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.05084803f, 0.38622916f, -0.039667666f}, {-0.07945931f, -0.6035534f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.051557843f, 0.39162073f, -0.04330127f}, {0.06526309f, -0.49572244f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.38956192f, -0.039667666f}, {0.0f, -0.6087614f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.09955336f, 0.3715382f, -0.03535534f}, {-0.1830127f, -0.68301266f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0502062f, 0.38135397f, -0.03535534f}, {-0.09229595f, -0.7010574f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.05084803f, 0.38622916f, -0.039667666f}, {0.07945931f, -0.6035534f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.38464466f, -0.03535534f}, {0.0f, -0.70710677f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.09843725f, 0.3673728f, -0.030438071f}, {-0.20533495f, -0.76632047f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.049643327f, 0.37707853f, -0.030438071f}, {-0.103553385f, -0.7865661f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.0502062f, 0.38135397f, -0.03535534f}, {0.09229595f, -0.7010574f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.38033232f, -0.030438071f}, {0.0f, -0.7933533f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0974968f, 0.36386302f, -0.025f}, {-0.22414386f, -0.83651626f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.049169045f, 0.37347603f, -0.025f}, {-0.11303899f, -0.8586165f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.049643327f, 0.37707853f, -0.030438071f}, {0.103553385f, -0.7865661f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.37669873f, -0.025f}, {0.0f, -0.8660254f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.09674811f, 0.36106887f, -0.019134171f}, {-0.23911761f, -0.8923991f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.048791472f, 0.37060806f, -0.019134171f}, {-0.12059047f, -0.91597563f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.049169045f, 0.37347603f, -0.025f}, {0.11303899f, -0.8586165f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.373806f, -0.019134171f}, {0.0f, -0.9238795f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.09620399f, 0.35903817f, -0.012940953f}, {-0.25f, -0.93301266f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.048517067f, 0.36852372f, -0.012940953f}, {-0.1260786f, -0.9576622f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.048791472f, 0.37060806f, -0.019134171f}, {0.12059047f, -0.91597563f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.37170368f, -0.012940953f}, {0.0f, -0.9659258f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.09587375f, 0.3578057f, -0.0065263095f}, {-0.25660482f, -0.9576622f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.04835052f, 0.3672587f, -0.0065263095f}, {-0.12940952f, -0.98296297f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.048517067f, 0.36852372f, -0.012940953f}, {0.1260786f, -0.9576622f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.37042773f, -0.0065263095f}, {0.0f, -0.9914449f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.09576304f, 0.35739252f, -8.485931e-15f}, {-0.25881904f, -0.9659258f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.048294686f, 0.36683458f, -8.485931e-15f}, {-0.13052619f, -0.9914449f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.04835052f, 0.3672587f, -0.0065263095f}, {0.12940952f, -0.98296297f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.36999997f, -8.485931e-15f}, {0.0f, -1.0f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.09587375f, 0.3578057f, 0.0065263095f}, {-0.25660482f, -0.9576622f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.04835052f, 0.3672587f, 0.0065263095f}, {-0.12940952f, -0.98296297f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.048294686f, 0.36683458f, -8.485931e-15f}, {0.13052619f, -0.9914449f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.37042773f, 0.0065263095f}, {0.0f, -0.9914449f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.09620399f, 0.35903817f, 0.012940953f}, {-0.25f, -0.93301266f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.048517067f, 0.36852372f, 0.012940953f}, {-0.1260786f, -0.9576622f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.04835052f, 0.3672587f, 0.0065263095f}, {0.12940952f, -0.98296297f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.37170368f, 0.012940953f}, {0.0f, -0.9659258f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.09674811f, 0.36106887f, 0.019134171f}, {-0.23911761f, -0.8923991f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.048791472f, 0.37060806f, 0.019134171f}, {-0.12059047f, -0.91597563f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.048517067f, 0.36852372f, 0.012940953f}, {0.1260786f, -0.9576622f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.373806f, 0.019134171f}, {0.0f, -0.9238795f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0974968f, 0.36386302f, 0.025f}, {-0.22414386f, -0.83651626f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.049169045f, 0.37347603f, 0.025f}, {-0.11303899f, -0.8586165f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.048791472f, 0.37060806f, 0.019134171f}, {0.12059047f, -0.91597563f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.37669873f, 0.025f}, {0.0f, -0.8660254f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.09843725f, 0.3673728f, 0.030438071f}, {-0.20533495f, -0.76632047f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.049643327f, 0.37707853f, 0.030438071f}, {-0.103553385f, -0.7865661f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.049169045f, 0.37347603f, 0.025f}, {0.11303899f, -0.8586165f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.38033232f, 0.030438071f}, {0.0f, -0.7933533f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.09955336f, 0.3715382f, 0.03535534f}, {-0.1830127f, -0.68301266f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0502062f, 0.38135397f, 0.03535534f}, {-0.09229595f, -0.7010574f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.049643327f, 0.37707853f, 0.030438071f}, {0.103553385f, -0.7865661f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.38464466f, 0.03535534f}, {0.0f, -0.70710677f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.10082604f, 0.3762879f, 0.039667666f}, {-0.15755905f, -0.58801836f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.05084803f, 0.38622916f, 0.039667666f}, {-0.07945931f, -0.6035534f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.0502062f, 0.38135397f, 0.03535534f}, {0.09229595f, -0.7010574f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.38956192f, 0.039667666f}, {0.0f, -0.6087614f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.102233514f, 0.3815407f, 0.04330127f}, {-0.12940952f, -0.4829629f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.051557843f, 0.39162073f, 0.04330127f}, {-0.06526309f, -0.49572244f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.05084803f, 0.38622916f, 0.039667666f}, {0.07945931f, -0.6035534f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.39499998f, 0.04330127f}, {0.0f, -0.5f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.103751704f, 0.38720664f, 0.046193976f}, {-0.09904576f, -0.3696438f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.052323487f, 0.39743635f, 0.046193976f}, {-0.04995021f, -0.37940952f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.051557843f, 0.39162073f, 0.04330127f}, {0.06526309f, -0.49572244f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.40086582f, 0.046193976f}, {0.0f, -0.38268343f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.10535463f, 0.39318883f, 0.04829629f}, {-0.0669873f, -0.25f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.053131863f, 0.4035766f, 0.04829629f}, {-0.03378266f, -0.25660482f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.052323487f, 0.39743635f, 0.046193976f}, {0.04995021f, -0.37940952f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.40705904f, 0.04829629f}, {0.0f, -0.25881904f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.10701486f, 0.3993849f, 0.049572244f}, {-0.03378266f, -0.1260786f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.05396914f, 0.40993637f, 0.049572244f}, {-0.017037084f, -0.12940952f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.053131863f, 0.4035766f, 0.04829629f}, {0.03378266f, -0.25660482f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.41347367f, 0.049572244f}, {0.0f, -0.13052619f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.10870399f, 0.40568882f, 0.05f}, {-4.392641e-14f, -1.639356e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.054820996f, 0.41640684f, 0.05f}, {-2.2152724e-14f, -1.6826666e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.05396914f, 0.40993637f, 0.049572244f}, {0.017037084f, -0.12940952f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.42f, 0.05f}, {0.0f, -1.6971862e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11039313f, 0.41199276f, 0.049572244f}, {0.03378266f, 0.1260786f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.05567285f, 0.4228773f, 0.049572244f}, {0.017037084f, 0.12940952f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.054820996f, 0.41640684f, 0.05f}, {2.2152724e-14f, -1.6826666e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.4265263f, 0.049572244f}, {0.0f, 0.13052619f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11205336f, 0.4181888f, 0.04829629f}, {0.0669873f, 0.25f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.056510128f, 0.42923707f, 0.04829629f}, {0.03378266f, 0.25660482f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.05567285f, 0.4228773f, 0.049572244f}, {-0.017037084f, 0.12940952f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.43294093f, 0.04829629f}, {0.0f, 0.25881904f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11365628f, 0.424171f, 0.046193976f}, {0.09904576f, 0.3696438f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.057318505f, 0.43537733f, 0.046193976f}, {0.04995021f, 0.37940952f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.056510128f, 0.42923707f, 0.04829629f}, {-0.03378266f, 0.25660482f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.43913415f, 0.046193976f}, {0.0f, 0.38268343f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11517447f, 0.42983696f, 0.04330127f}, {0.12940952f, 0.4829629f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.05808415f, 0.44119295f, 0.04330127f}, {0.06526309f, 0.49572244f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.057318505f, 0.43537733f, 0.046193976f}, {-0.04995021f, 0.37940952f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.445f, 0.04330127f}, {0.0f, 0.5f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11658195f, 0.43508974f, 0.039667666f}, {0.15755905f, 0.58801836f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.058793962f, 0.44658452f, 0.039667666f}, {0.07945931f, 0.6035534f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.05808415f, 0.44119295f, 0.04330127f}, {-0.06526309f, 0.49572244f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.45043805f, 0.039667666f}, {0.0f, 0.6087614f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.117854625f, 0.43983945f, 0.03535534f}, {0.1830127f, 0.68301266f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.059435792f, 0.4514597f, 0.03535534f}, {0.09229595f, 0.7010574f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.058793962f, 0.44658452f, 0.039667666f}, {-0.07945931f, 0.6035534f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.45535532f, 0.03535534f}, {0.0f, 0.70710677f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11897074f, 0.44400483f, 0.030438071f}, {0.20533495f, 0.76632047f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.059998665f, 0.45573515f, 0.030438071f}, {0.103553385f, 0.7865661f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.059435792f, 0.4514597f, 0.03535534f}, {-0.09229595f, 0.7010574f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.45966765f, 0.030438071f}, {0.0f, 0.7933533f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11991119f, 0.44751462f, 0.025f}, {0.22414386f, 0.83651626f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.060472947f, 0.45933765f, 0.025f}, {0.11303899f, 0.8586165f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.059998665f, 0.45573515f, 0.030438071f}, {-0.103553385f, 0.7865661f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.46330124f, 0.025f}, {0.0f, 0.8660254f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.12065987f, 0.45030877f, 0.019134171f}, {0.23911761f, 0.8923991f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.06085052f, 0.46220562f, 0.019134171f}, {0.12059047f, 0.91597563f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.060472947f, 0.45933765f, 0.025f}, {-0.11303899f, 0.8586165f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.46619397f, 0.019134171f}, {0.0f, 0.9238795f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.121203996f, 0.45233947f, 0.012940953f}, {0.25f, 0.93301266f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.061124925f, 0.46428996f, 0.012940953f}, {0.1260786f, 0.9576622f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.06085052f, 0.46220562f, 0.019134171f}, {-0.12059047f, 0.91597563f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.4682963f, 0.012940953f}, {0.0f, 0.9659258f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.121534236f, 0.45357195f, 0.0065263095f}, {0.25660482f, 0.9576622f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.06129147f, 0.46555498f, 0.0065263095f}, {0.12940952f, 0.98296297f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.061124925f, 0.46428996f, 0.012940953f}, {-0.1260786f, 0.9576622f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.121644944f, 0.45398512f, 0.0f}, {0.25881904f, 0.9659258f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.121203996f, 0.45233947f, 0.012940953f}, {-0.25f, 0.93301266f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17969751f, 0.43382815f, -0.0065263095f}, {0.37940952f, 0.91597563f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.121534236f, 0.45357195f, 0.0065263095f}, {-0.25660482f, 0.9576622f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.12065987f, 0.45030877f, 0.019134171f}, {-0.23911761f, 0.8923991f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.121644944f, 0.45398512f, 0.0f}, {-0.25881904f, 0.9659258f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11991119f, 0.44751462f, 0.025f}, {-0.22414386f, 0.83651626f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.121534236f, 0.45357195f, -0.0065263095f}, {-0.25660482f, 0.9576622f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11897074f, 0.44400483f, 0.030438071f}, {-0.20533495f, 0.76632047f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.121203996f, 0.45233947f, -0.012940953f}, {-0.25f, 0.93301266f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.117854625f, 0.43983945f, 0.03535534f}, {-0.1830127f, 0.68301266f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.12065987f, 0.45030877f, -0.019134171f}, {-0.23911761f, 0.8923991f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11658195f, 0.43508974f, 0.039667666f}, {-0.15755905f, 0.58801836f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11991119f, 0.44751462f, -0.025f}, {-0.22414386f, 0.83651626f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11517447f, 0.42983696f, 0.04330127f}, {-0.12940952f, 0.4829629f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11897074f, 0.44400483f, -0.030438071f}, {-0.20533495f, 0.76632047f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11365628f, 0.424171f, 0.046193976f}, {-0.09904576f, 0.3696438f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.117854625f, 0.43983945f, -0.03535534f}, {-0.1830127f, 0.68301266f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11205336f, 0.4181888f, 0.04829629f}, {-0.0669873f, 0.25f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11658195f, 0.43508974f, -0.039667666f}, {-0.15755905f, 0.58801836f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11039313f, 0.41199276f, 0.049572244f}, {-0.03378266f, 0.1260786f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11517447f, 0.42983696f, -0.04330127f}, {-0.12940952f, 0.4829629f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.10870399f, 0.40568882f, 0.05f}, {4.392641e-14f, -1.639356e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11365628f, 0.424171f, -0.046193976f}, {-0.09904576f, 0.3696438f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.10701486f, 0.3993849f, 0.049572244f}, {0.03378266f, -0.1260786f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11205336f, 0.4181888f, -0.04829629f}, {-0.0669873f, 0.25f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.10535463f, 0.39318883f, 0.04829629f}, {0.0669873f, -0.25f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11039313f, 0.41199276f, -0.049572244f}, {-0.03378266f, 0.1260786f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.103751704f, 0.38720664f, 0.046193976f}, {0.09904576f, -0.3696438f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.10870399f, 0.40568882f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.102233514f, 0.3815407f, 0.04330127f}, {0.12940952f, -0.4829629f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.10701486f, 0.3993849f, -0.049572244f}, {0.03378266f, -0.1260786f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.10082604f, 0.3762879f, 0.039667666f}, {0.15755905f, -0.58801836f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.10535463f, 0.39318883f, -0.04829629f}, {0.0669873f, -0.25f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.09955336f, 0.3715382f, 0.03535534f}, {0.1830127f, -0.68301266f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.103751704f, 0.38720664f, -0.046193976f}, {0.09904576f, -0.3696438f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.09843725f, 0.3673728f, 0.030438071f}, {0.20533495f, -0.76632047f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.102233514f, 0.3815407f, -0.04330127f}, {0.12940952f, -0.4829629f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.0974968f, 0.36386302f, 0.025f}, {0.22414386f, -0.83651626f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.10082604f, 0.3762879f, -0.039667666f}, {0.15755905f, -0.58801836f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.09674811f, 0.36106887f, 0.019134171f}, {0.23911761f, -0.8923991f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.09955336f, 0.3715382f, -0.03535534f}, {0.1830127f, -0.68301266f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.09620399f, 0.35903817f, 0.012940953f}, {0.25f, -0.93301266f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.09843725f, 0.3673728f, -0.030438071f}, {0.20533495f, -0.76632047f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.09587375f, 0.3578057f, 0.0065263095f}, {0.25660482f, -0.9576622f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.0974968f, 0.36386302f, -0.025f}, {0.22414386f, -0.83651626f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.09576304f, 0.35739252f, -8.485931e-15f}, {0.25881904f, -0.9659258f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.09674811f, 0.36106887f, -0.019134171f}, {0.23911761f, -0.8923991f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.09587375f, 0.3578057f, -0.0065263095f}, {0.25660482f, -0.9576622f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.09620399f, 0.35903817f, -0.012940953f}, {0.25f, -0.93301266f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14175656f, 0.3422306f, -0.0065263095f}, {0.37940952f, -0.91597563f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14224485f, 0.34340942f, -0.012940953f}, {0.3696438f, -0.8923991f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14304937f, 0.3453517f, -0.019134171f}, {0.35355338f, -0.85355335f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14159286f, 0.34183538f, -8.485931e-15f}, {0.38268343f, -0.9238795f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.18585184f, 0.32190484f, -0.012940953f}, {0.4829629f, -0.83651626f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14175656f, 0.3422306f, 0.0065263095f}, {0.37940952f, -0.91597563f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.18521386f, 0.32079983f, -0.0065263095f}, {0.49572244f, -0.8586165f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.18499999f, 0.32042938f, -8.485931e-15f}, {0.5f, -0.8660254f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14224485f, 0.34340942f, 0.012940953f}, {0.3696438f, -0.8923991f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.18521386f, 0.32079983f, 0.0065263095f}, {0.49572244f, -0.8586165f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14304937f, 0.3453517f, 0.019134171f}, {0.35355338f, -0.85355335f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.18585184f, 0.32190484f, 0.012940953f}, {0.4829629f, -0.83651626f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14415637f, 0.34802422f, 0.025f}, {0.33141357f, -0.8001031f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.186903f, 0.3237255f, 0.019134171f}, {0.46193975f, -0.8001031f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14554688f, 0.3513812f, 0.030438071f}, {0.30360317f, -0.73296285f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.18834937f, 0.32623065f, 0.025f}, {0.4330127f, -0.75f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14719714f, 0.3553653f, 0.03535534f}, {0.27059805f, -0.65328145f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.19016616f, 0.32937744f, 0.030438071f}, {0.39667666f, -0.6870641f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14907889f, 0.35990825f, 0.039667666f}, {0.2329629f, -0.5624222f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.19232233f, 0.33311203f, 0.03535534f}, {0.35355338f, -0.6123724f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.15115996f, 0.3649324f, 0.04330127f}, {0.19134171f, -0.46193975f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.19478096f, 0.33737049f, 0.039667666f}, {0.3043807f, -0.52720284f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.15340471f, 0.3703517f, 0.046193976f}, {0.1464466f, -0.35355338f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.19749999f, 0.34208f, 0.04330127f}, {0.25f, -0.4330127f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.15577476f, 0.37607348f, 0.04829629f}, {0.09904576f, -0.23911761f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.20043291f, 0.34715995f, 0.046193976f}, {0.19134171f, -0.33141357f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.15822953f, 0.38199985f, 0.049572244f}, {0.04995021f, -0.12059047f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.20352952f, 0.35252345f, 0.04829629f}, {0.12940952f, -0.22414386f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.16072704f, 0.38802937f, 0.05f}, {6.49485e-14f, -1.5679955e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.20673683f, 0.3580787f, 0.049572244f}, {0.06526309f, -0.11303899f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.16322455f, 0.39405888f, 0.049572244f}, {-0.04995021f, 0.12059047f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.21f, 0.36373064f, 0.05f}, {8.485931e-14f, -1.4698064e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.16567932f, 0.39998525f, 0.04829629f}, {-0.09904576f, 0.23911761f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.21326315f, 0.3693826f, 0.049572244f}, {-0.06526309f, 0.11303899f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.16804937f, 0.40570703f, 0.046193976f}, {-0.1464466f, 0.35355338f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.21647047f, 0.37493783f, 0.04829629f}, {-0.12940952f, 0.22414386f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17029412f, 0.41112635f, 0.04330127f}, {-0.19134171f, 0.46193975f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.21956708f, 0.38030133f, 0.046193976f}, {-0.19134171f, 0.33141357f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17237519f, 0.41615048f, 0.039667666f}, {-0.2329629f, 0.5624222f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2225f, 0.38538128f, 0.04330127f}, {-0.25f, 0.4330127f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17425694f, 0.42069343f, 0.03535534f}, {-0.27059805f, 0.65328145f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22521903f, 0.3900908f, 0.039667666f}, {-0.3043807f, 0.52720284f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.1759072f, 0.42467752f, 0.030438071f}, {-0.30360317f, 0.73296285f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22767766f, 0.39434925f, 0.03535534f}, {-0.35355338f, 0.6123724f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17729771f, 0.4280345f, 0.025f}, {-0.33141357f, 0.8001031f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22983383f, 0.39808384f, 0.030438071f}, {-0.39667666f, 0.6870641f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.1784047f, 0.43070704f, 0.019134171f}, {-0.35355338f, 0.85355335f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23165062f, 0.40123063f, 0.025f}, {-0.4330127f, 0.75f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17920923f, 0.4326493f, 0.012940953f}, {-0.3696438f, 0.8923991f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23309699f, 0.4037358f, 0.019134171f}, {-0.46193975f, 0.8001031f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17969751f, 0.43382815f, 0.0065263095f}, {-0.37940952f, 0.91597563f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23414814f, 0.40555644f, 0.012940953f}, {-0.4829629f, 0.83651626f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17986122f, 0.43422335f, 0.0f}, {-0.38268343f, 0.9238795f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23478612f, 0.40666145f, 0.0065263095f}, {-0.49572244f, 0.8586165f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17969751f, 0.43382815f, -0.0065263095f}, {-0.37940952f, 0.91597563f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.235f, 0.4070319f, 0.0f}, {-0.5f, 0.8660254f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17920923f, 0.4326493f, -0.012940953f}, {-0.3696438f, 0.8923991f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23478612f, 0.40666145f, -0.0065263095f}, {-0.49572244f, 0.8586165f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.1784047f, 0.43070704f, -0.019134171f}, {-0.35355338f, 0.85355335f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23414814f, 0.40555644f, -0.012940953f}, {-0.4829629f, 0.83651626f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17729771f, 0.4280345f, -0.025f}, {-0.33141357f, 0.8001031f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23309699f, 0.4037358f, -0.019134171f}, {-0.46193975f, 0.8001031f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.1759072f, 0.42467752f, -0.030438071f}, {-0.30360317f, 0.73296285f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23165062f, 0.40123063f, -0.025f}, {-0.4330127f, 0.75f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17425694f, 0.42069343f, -0.03535534f}, {-0.27059805f, 0.65328145f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22983383f, 0.39808384f, -0.030438071f}, {-0.39667666f, 0.6870641f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17237519f, 0.41615048f, -0.039667666f}, {-0.2329629f, 0.5624222f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22767766f, 0.39434925f, -0.03535534f}, {-0.35355338f, 0.6123724f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17029412f, 0.41112635f, -0.04330127f}, {-0.19134171f, 0.46193975f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22521903f, 0.3900908f, -0.039667666f}, {-0.3043807f, 0.52720284f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.16804937f, 0.40570703f, -0.046193976f}, {-0.1464466f, 0.35355338f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2225f, 0.38538128f, -0.04330127f}, {-0.25f, 0.4330127f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.16567932f, 0.39998525f, -0.04829629f}, {-0.09904576f, 0.23911761f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.21956708f, 0.38030133f, -0.046193976f}, {-0.19134171f, 0.33141357f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.16322455f, 0.39405888f, -0.049572244f}, {-0.04995021f, 0.12059047f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.21647047f, 0.37493783f, -0.04829629f}, {-0.12940952f, 0.22414386f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.16072704f, 0.38802937f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.21326315f, 0.3693826f, -0.049572244f}, {-0.06526309f, 0.11303899f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.15822953f, 0.38199985f, -0.049572244f}, {0.04995021f, -0.12059047f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.21f, 0.36373064f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.15577476f, 0.37607348f, -0.04829629f}, {0.09904576f, -0.23911761f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.20673683f, 0.3580787f, -0.049572244f}, {0.06526309f, -0.11303899f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.15340471f, 0.3703517f, -0.046193976f}, {0.1464466f, -0.35355338f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.20352952f, 0.35252345f, -0.04829629f}, {0.12940952f, -0.22414386f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.15115996f, 0.3649324f, -0.04330127f}, {0.19134171f, -0.46193975f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.20043291f, 0.34715995f, -0.046193976f}, {0.19134171f, -0.33141357f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14907889f, 0.35990825f, -0.039667666f}, {0.2329629f, -0.5624222f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.19749999f, 0.34208f, -0.04330127f}, {0.25f, -0.4330127f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14719714f, 0.3553653f, -0.03535534f}, {0.27059805f, -0.65328145f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.19478096f, 0.33737049f, -0.039667666f}, {0.3043807f, -0.52720284f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14554688f, 0.3513812f, -0.030438071f}, {0.30360317f, -0.73296285f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.19232233f, 0.33311203f, -0.03535534f}, {0.35355338f, -0.6123724f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14415637f, 0.34802422f, -0.025f}, {0.33141357f, -0.8001031f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.19016616f, 0.32937744f, -0.030438071f}, {0.39667666f, -0.6870641f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.18834937f, 0.32623065f, -0.025f}, {0.4330127f, -0.75f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.186903f, 0.3237255f, -0.019134171f}, {0.46193975f, -0.8001031f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23153163f, 0.3017379f, -0.030438071f}, {0.4829629f, -0.6294095f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22931965f, 0.2988552f, -0.025f}, {0.52720284f, -0.6870641f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22755867f, 0.29656023f, -0.019134171f}, {0.5624222f, -0.73296285f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23415682f, 0.3051591f, -0.03535534f}, {0.43045932f, -0.5609855f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.26893556f, 0.26893556f, -0.030438071f}, {0.5609855f, -0.5609855f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23715027f, 0.30906025f, -0.039667666f}, {0.37059048f, -0.4829629f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27198482f, 0.27198482f, -0.03535534f}, {0.49999997f, -0.49999997f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27546185f, 0.27546185f, -0.039667666f}, {0.43045932f, -0.43045932f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.24046075f, 0.31337455f, -0.04330127f}, {0.3043807f, -0.39667666f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27930716f, 0.27930716f, -0.04330127f}, {0.35355338f, -0.35355338f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.24403164f, 0.3180282f, -0.046193976f}, {0.2329629f, -0.30360317f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.28345492f, 0.28345492f, -0.046193976f}, {0.27059805f, -0.27059805f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.24780184f, 0.32294163f, -0.04829629f}, {0.15755905f, -0.20533495f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2878342f, 0.2878342f, -0.04829629f}, {0.1830127f, -0.1830127f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2517068f, 0.3280307f, -0.049572244f}, {0.07945931f, -0.103553385f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29237002f, 0.29237002f, -0.049572244f}, {0.09229595f, -0.09229595f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2556798f, 0.33320838f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29698482f, 0.29698482f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.25965276f, 0.33838606f, -0.049572244f}, {-0.07945931f, 0.103553385f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.30159962f, 0.30159962f, -0.049572244f}, {-0.09229595f, 0.09229595f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.26355773f, 0.34347513f, -0.04829629f}, {-0.15755905f, 0.20533495f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.30613545f, 0.30613545f, -0.04829629f}, {-0.1830127f, 0.1830127f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.26732793f, 0.34838855f, -0.046193976f}, {-0.2329629f, 0.30360317f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.31051472f, 0.31051472f, -0.046193976f}, {-0.27059805f, 0.27059805f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27089882f, 0.35304222f, -0.04330127f}, {-0.3043807f, 0.39667666f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3146625f, 0.3146625f, -0.04330127f}, {-0.35355338f, 0.35355338f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27420932f, 0.35735652f, -0.039667666f}, {-0.37059048f, 0.4829629f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3185078f, 0.3185078f, -0.039667666f}, {-0.43045932f, 0.43045932f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27720276f, 0.36125767f, -0.03535534f}, {-0.43045932f, 0.5609855f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32198483f, 0.32198483f, -0.03535534f}, {-0.49999997f, 0.49999997f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27982792f, 0.36467886f, -0.030438071f}, {-0.4829629f, 0.6294095f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32503408f, 0.32503408f, -0.030438071f}, {-0.5609855f, 0.5609855f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.28203994f, 0.36756158f, -0.025f}, {-0.52720284f, 0.6870641f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32760343f, 0.32760343f, -0.025f}, {-0.6123724f, 0.6123724f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2838009f, 0.36985654f, -0.019134171f}, {-0.5624222f, 0.73296285f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32964888f, 0.32964888f, -0.019134171f}, {-0.65328145f, 0.65328145f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2850807f, 0.3715244f, -0.012940953f}, {-0.58801836f, 0.76632047f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33113545f, 0.33113545f, -0.012940953f}, {-0.68301266f, 0.68301266f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.28585747f, 0.3725367f, -0.0065263095f}, {-0.6035534f, 0.7865661f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3320377f, 0.3320377f, -0.0065263095f}, {-0.7010574f, 0.7010574f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.28611785f, 0.37287605f, 0.0f}, {-0.6087614f, 0.7933533f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33234015f, 0.33234015f, 0.0f}, {-0.70710677f, 0.70710677f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.28585747f, 0.3725367f, 0.0065263095f}, {-0.6035534f, 0.7865661f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3320377f, 0.3320377f, 0.0065263095f}, {-0.7010574f, 0.7010574f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2850807f, 0.3715244f, 0.012940953f}, {-0.58801836f, 0.76632047f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33113545f, 0.33113545f, 0.012940953f}, {-0.68301266f, 0.68301266f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2838009f, 0.36985654f, 0.019134171f}, {-0.5624222f, 0.73296285f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32964888f, 0.32964888f, 0.019134171f}, {-0.65328145f, 0.65328145f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.28203994f, 0.36756158f, 0.025f}, {-0.52720284f, 0.6870641f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32760343f, 0.32760343f, 0.025f}, {-0.6123724f, 0.6123724f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27982792f, 0.36467886f, 0.030438071f}, {-0.4829629f, 0.6294095f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32503408f, 0.32503408f, 0.030438071f}, {-0.5609855f, 0.5609855f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27720276f, 0.36125767f, 0.03535534f}, {-0.43045932f, 0.5609855f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32198483f, 0.32198483f, 0.03535534f}, {-0.49999997f, 0.49999997f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27420932f, 0.35735652f, 0.039667666f}, {-0.37059048f, 0.4829629f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3185078f, 0.3185078f, 0.039667666f}, {-0.43045932f, 0.43045932f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27089882f, 0.35304222f, 0.04330127f}, {-0.3043807f, 0.39667666f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3146625f, 0.3146625f, 0.04330127f}, {-0.35355338f, 0.35355338f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.26732793f, 0.34838855f, 0.046193976f}, {-0.2329629f, 0.30360317f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.31051472f, 0.31051472f, 0.046193976f}, {-0.27059805f, 0.27059805f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.26355773f, 0.34347513f, 0.04829629f}, {-0.15755905f, 0.20533495f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.30613545f, 0.30613545f, 0.04829629f}, {-0.1830127f, 0.1830127f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.25965276f, 0.33838606f, 0.049572244f}, {-0.07945931f, 0.103553385f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.30159962f, 0.30159962f, 0.049572244f}, {-0.09229595f, 0.09229595f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2556798f, 0.33320838f, 0.05f}, {1.0331815e-13f, -1.3464684e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29698482f, 0.29698482f, 0.05f}, {1.2000919e-13f, -1.2000919e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2517068f, 0.3280307f, 0.049572244f}, {0.07945931f, -0.103553385f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29237002f, 0.29237002f, 0.049572244f}, {0.09229595f, -0.09229595f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.24780184f, 0.32294163f, 0.04829629f}, {0.15755905f, -0.20533495f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2878342f, 0.2878342f, 0.04829629f}, {0.1830127f, -0.1830127f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.24403164f, 0.3180282f, 0.046193976f}, {0.2329629f, -0.30360317f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.28345492f, 0.28345492f, 0.046193976f}, {0.27059805f, -0.27059805f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.24046075f, 0.31337455f, 0.04330127f}, {0.3043807f, -0.39667666f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27930716f, 0.27930716f, 0.04330127f}, {0.35355338f, -0.35355338f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23715027f, 0.30906025f, 0.039667666f}, {0.37059048f, -0.4829629f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27546185f, 0.27546185f, 0.039667666f}, {0.43045932f, -0.43045932f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23415682f, 0.3051591f, 0.03535534f}, {0.43045932f, -0.5609855f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27198482f, 0.27198482f, 0.03535534f}, {0.49999997f, -0.49999997f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23153163f, 0.3017379f, 0.030438071f}, {0.4829629f, -0.6294095f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.26893556f, 0.26893556f, 0.030438071f}, {0.5609855f, -0.5609855f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22931965f, 0.2988552f, 0.025f}, {0.52720284f, -0.6870641f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2663662f, 0.2663662f, 0.025f}, {0.6123724f, -0.6123724f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22755867f, 0.29656023f, 0.019134171f}, {0.5624222f, -0.73296285f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.26432076f, 0.26432076f, 0.019134171f}, {0.65328145f, -0.65328145f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22627887f, 0.29489237f, 0.012940953f}, {0.58801836f, -0.76632047f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2628342f, 0.2628342f, 0.012940953f}, {0.68301266f, -0.68301266f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22550212f, 0.29388008f, 0.0065263095f}, {0.6035534f, -0.7865661f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.26193196f, 0.26193196f, 0.0065263095f}, {0.7010574f, -0.7010574f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22524172f, 0.29354072f, -8.485931e-15f}, {0.6087614f, -0.7933533f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2616295f, 0.2616295f, -8.485931e-15f}, {0.70710677f, -0.70710677f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22550212f, 0.29388008f, -0.0065263095f}, {0.6035534f, -0.7865661f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.26193196f, 0.26193196f, -0.0065263095f}, {0.7010574f, -0.7010574f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22627887f, 0.29489237f, -0.012940953f}, {0.58801836f, -0.76632047f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2628342f, 0.2628342f, -0.012940953f}, {0.68301266f, -0.68301266f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.26432076f, 0.26432076f, -0.019134171f}, {0.65328145f, -0.65328145f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2663662f, 0.2663662f, -0.025f}, {0.6123724f, -0.6123724f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29656023f, 0.22755867f, -0.019134171f}, {0.73296285f, -0.5624222f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2988552f, 0.22931965f, -0.025f}, {0.6870641f, -0.52720284f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3017379f, 0.23153163f, -0.030438071f}, {0.6294095f, -0.4829629f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29489237f, 0.22627887f, -0.012940953f}, {0.76632047f, -0.58801836f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32623065f, 0.18834937f, -0.025f}, {0.75f, -0.4330127f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29388008f, 0.22550212f, -0.0065263095f}, {0.7865661f, -0.6035534f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3237255f, 0.186903f, -0.019134171f}, {0.8001031f, -0.46193975f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32190484f, 0.18585184f, -0.012940953f}, {0.83651626f, -0.4829629f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29354072f, 0.22524172f, -8.485931e-15f}, {0.7933533f, -0.6087614f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32079983f, 0.18521386f, -0.0065263095f}, {0.8586165f, -0.49572244f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29388008f, 0.22550212f, 0.0065263095f}, {0.7865661f, -0.6035534f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32042938f, 0.18499999f, -8.485931e-15f}, {0.8660254f, -0.5f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29489237f, 0.22627887f, 0.012940953f}, {0.76632047f, -0.58801836f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32079983f, 0.18521386f, 0.0065263095f}, {0.8586165f, -0.49572244f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29656023f, 0.22755867f, 0.019134171f}, {0.73296285f, -0.5624222f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32190484f, 0.18585184f, 0.012940953f}, {0.83651626f, -0.4829629f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2988552f, 0.22931965f, 0.025f}, {0.6870641f, -0.52720284f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3237255f, 0.186903f, 0.019134171f}, {0.8001031f, -0.46193975f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3017379f, 0.23153163f, 0.030438071f}, {0.6294095f, -0.4829629f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32623065f, 0.18834937f, 0.025f}, {0.75f, -0.4330127f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3051591f, 0.23415682f, 0.03535534f}, {0.5609855f, -0.43045932f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32937744f, 0.19016616f, 0.030438071f}, {0.6870641f, -0.39667666f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.30906025f, 0.23715027f, 0.039667666f}, {0.4829629f, -0.37059048f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33311203f, 0.19232233f, 0.03535534f}, {0.6123724f, -0.35355338f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.31337455f, 0.24046075f, 0.04330127f}, {0.39667666f, -0.3043807f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33737049f, 0.19478096f, 0.039667666f}, {0.52720284f, -0.3043807f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3180282f, 0.24403164f, 0.046193976f}, {0.30360317f, -0.2329629f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34208f, 0.19749999f, 0.04330127f}, {0.4330127f, -0.25f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32294163f, 0.24780184f, 0.04829629f}, {0.20533495f, -0.15755905f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34715995f, 0.20043291f, 0.046193976f}, {0.33141357f, -0.19134171f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3280307f, 0.2517068f, 0.049572244f}, {0.103553385f, -0.07945931f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.35252345f, 0.20352952f, 0.04829629f}, {0.22414386f, -0.12940952f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33320838f, 0.2556798f, 0.05f}, {1.3464684e-13f, -1.0331815e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3580787f, 0.20673683f, 0.049572244f}, {0.11303899f, -0.06526309f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33838606f, 0.25965276f, 0.049572244f}, {-0.103553385f, 0.07945931f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36373064f, 0.21f, 0.05f}, {1.4698064e-13f, -8.485931e-14f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34347513f, 0.26355773f, 0.04829629f}, {-0.20533495f, 0.15755905f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3693826f, 0.21326315f, 0.049572244f}, {-0.11303899f, 0.06526309f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34838855f, 0.26732793f, 0.046193976f}, {-0.30360317f, 0.2329629f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37493783f, 0.21647047f, 0.04829629f}, {-0.22414386f, 0.12940952f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.35304222f, 0.27089882f, 0.04330127f}, {-0.39667666f, 0.3043807f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38030133f, 0.21956708f, 0.046193976f}, {-0.33141357f, 0.19134171f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.35735652f, 0.27420932f, 0.039667666f}, {-0.4829629f, 0.37059048f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38538128f, 0.2225f, 0.04330127f}, {-0.4330127f, 0.25f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36125767f, 0.27720276f, 0.03535534f}, {-0.5609855f, 0.43045932f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3900908f, 0.22521903f, 0.039667666f}, {-0.52720284f, 0.3043807f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36467886f, 0.27982792f, 0.030438071f}, {-0.6294095f, 0.4829629f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39434925f, 0.22767766f, 0.03535534f}, {-0.6123724f, 0.35355338f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36756158f, 0.28203994f, 0.025f}, {-0.6870641f, 0.52720284f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39808384f, 0.22983383f, 0.030438071f}, {-0.6870641f, 0.39667666f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36985654f, 0.2838009f, 0.019134171f}, {-0.73296285f, 0.5624222f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40123063f, 0.23165062f, 0.025f}, {-0.75f, 0.4330127f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3715244f, 0.2850807f, 0.012940953f}, {-0.76632047f, 0.58801836f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4037358f, 0.23309699f, 0.019134171f}, {-0.8001031f, 0.46193975f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3725367f, 0.28585747f, 0.0065263095f}, {-0.7865661f, 0.6035534f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40555644f, 0.23414814f, 0.012940953f}, {-0.83651626f, 0.4829629f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37287605f, 0.28611785f, 0.0f}, {-0.7933533f, 0.6087614f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40666145f, 0.23478612f, 0.0065263095f}, {-0.8586165f, 0.49572244f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3725367f, 0.28585747f, -0.0065263095f}, {-0.7865661f, 0.6035534f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4070319f, 0.235f, 0.0f}, {-0.8660254f, 0.5f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3715244f, 0.2850807f, -0.012940953f}, {-0.76632047f, 0.58801836f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40666145f, 0.23478612f, -0.0065263095f}, {-0.8586165f, 0.49572244f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36985654f, 0.2838009f, -0.019134171f}, {-0.73296285f, 0.5624222f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40555644f, 0.23414814f, -0.012940953f}, {-0.83651626f, 0.4829629f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36756158f, 0.28203994f, -0.025f}, {-0.6870641f, 0.52720284f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4037358f, 0.23309699f, -0.019134171f}, {-0.8001031f, 0.46193975f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36467886f, 0.27982792f, -0.030438071f}, {-0.6294095f, 0.4829629f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40123063f, 0.23165062f, -0.025f}, {-0.75f, 0.4330127f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36125767f, 0.27720276f, -0.03535534f}, {-0.5609855f, 0.43045932f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39808384f, 0.22983383f, -0.030438071f}, {-0.6870641f, 0.39667666f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.35735652f, 0.27420932f, -0.039667666f}, {-0.4829629f, 0.37059048f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39434925f, 0.22767766f, -0.03535534f}, {-0.6123724f, 0.35355338f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.35304222f, 0.27089882f, -0.04330127f}, {-0.39667666f, 0.3043807f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3900908f, 0.22521903f, -0.039667666f}, {-0.52720284f, 0.3043807f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34838855f, 0.26732793f, -0.046193976f}, {-0.30360317f, 0.2329629f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38538128f, 0.2225f, -0.04330127f}, {-0.4330127f, 0.25f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34347513f, 0.26355773f, -0.04829629f}, {-0.20533495f, 0.15755905f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38030133f, 0.21956708f, -0.046193976f}, {-0.33141357f, 0.19134171f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33838606f, 0.25965276f, -0.049572244f}, {-0.103553385f, 0.07945931f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37493783f, 0.21647047f, -0.04829629f}, {-0.22414386f, 0.12940952f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33320838f, 0.2556798f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3693826f, 0.21326315f, -0.049572244f}, {-0.11303899f, 0.06526309f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3280307f, 0.2517068f, -0.049572244f}, {0.103553385f, -0.07945931f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36373064f, 0.21f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32294163f, 0.24780184f, -0.04829629f}, {0.20533495f, -0.15755905f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3580787f, 0.20673683f, -0.049572244f}, {0.11303899f, -0.06526309f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3180282f, 0.24403164f, -0.046193976f}, {0.30360317f, -0.2329629f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.35252345f, 0.20352952f, -0.04829629f}, {0.22414386f, -0.12940952f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.31337455f, 0.24046075f, -0.04330127f}, {0.39667666f, -0.3043807f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34715995f, 0.20043291f, -0.046193976f}, {0.33141357f, -0.19134171f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.30906025f, 0.23715027f, -0.039667666f}, {0.4829629f, -0.37059048f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34208f, 0.19749999f, -0.04330127f}, {0.4330127f, -0.25f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3051591f, 0.23415682f, -0.03535534f}, {0.5609855f, -0.43045932f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33737049f, 0.19478096f, -0.039667666f}, {0.52720284f, -0.3043807f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33311203f, 0.19232233f, -0.03535534f}, {0.6123724f, -0.35355338f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32937744f, 0.19016616f, -0.030438071f}, {0.6870641f, -0.39667666f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.35990825f, 0.14907889f, -0.039667666f}, {0.5624222f, -0.2329629f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3553653f, 0.14719714f, -0.03535534f}, {0.65328145f, -0.27059805f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3513812f, 0.14554688f, -0.030438071f}, {0.73296285f, -0.30360317f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3649324f, 0.15115996f, -0.04330127f}, {0.46193975f, -0.19134171f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3762879f, 0.10082604f, -0.039667666f}, {0.58801836f, -0.15755905f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3703517f, 0.15340471f, -0.046193976f}, {0.35355338f, -0.1464466f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3815407f, 0.102233514f, -0.04330127f}, {0.4829629f, -0.12940952f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38720664f, 0.103751704f, -0.046193976f}, {0.3696438f, -0.09904576f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37607348f, 0.15577476f, -0.04829629f}, {0.23911761f, -0.09904576f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39318883f, 0.10535463f, -0.04829629f}, {0.25f, -0.0669873f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38199985f, 0.15822953f, -0.049572244f}, {0.12059047f, -0.04995021f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3993849f, 0.10701486f, -0.049572244f}, {0.1260786f, -0.03378266f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38802937f, 0.16072704f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40568882f, 0.10870399f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39405888f, 0.16322455f, -0.049572244f}, {-0.12059047f, 0.04995021f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.41199276f, 0.11039313f, -0.049572244f}, {-0.1260786f, 0.03378266f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39998525f, 0.16567932f, -0.04829629f}, {-0.23911761f, 0.09904576f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4181888f, 0.11205336f, -0.04829629f}, {-0.25f, 0.0669873f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40570703f, 0.16804937f, -0.046193976f}, {-0.35355338f, 0.1464466f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.424171f, 0.11365628f, -0.046193976f}, {-0.3696438f, 0.09904576f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.41112635f, 0.17029412f, -0.04330127f}, {-0.46193975f, 0.19134171f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.42983696f, 0.11517447f, -0.04330127f}, {-0.4829629f, 0.12940952f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.41615048f, 0.17237519f, -0.039667666f}, {-0.5624222f, 0.2329629f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43508974f, 0.11658195f, -0.039667666f}, {-0.58801836f, 0.15755905f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.42069343f, 0.17425694f, -0.03535534f}, {-0.65328145f, 0.27059805f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43983945f, 0.117854625f, -0.03535534f}, {-0.68301266f, 0.1830127f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.42467752f, 0.1759072f, -0.030438071f}, {-0.73296285f, 0.30360317f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.44400483f, 0.11897074f, -0.030438071f}, {-0.76632047f, 0.20533495f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4280345f, 0.17729771f, -0.025f}, {-0.8001031f, 0.33141357f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.44751462f, 0.11991119f, -0.025f}, {-0.83651626f, 0.22414386f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43070704f, 0.1784047f, -0.019134171f}, {-0.85355335f, 0.35355338f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45030877f, 0.12065987f, -0.019134171f}, {-0.8923991f, 0.23911761f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4326493f, 0.17920923f, -0.012940953f}, {-0.8923991f, 0.3696438f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45233947f, 0.121203996f, -0.012940953f}, {-0.93301266f, 0.25f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43382815f, 0.17969751f, -0.0065263095f}, {-0.91597563f, 0.37940952f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45357195f, 0.121534236f, -0.0065263095f}, {-0.9576622f, 0.25660482f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43422335f, 0.17986122f, 0.0f}, {-0.9238795f, 0.38268343f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45398512f, 0.121644944f, 0.0f}, {-0.9659258f, 0.25881904f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43382815f, 0.17969751f, 0.0065263095f}, {-0.91597563f, 0.37940952f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45357195f, 0.121534236f, 0.0065263095f}, {-0.9576622f, 0.25660482f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4326493f, 0.17920923f, 0.012940953f}, {-0.8923991f, 0.3696438f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45233947f, 0.121203996f, 0.012940953f}, {-0.93301266f, 0.25f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43070704f, 0.1784047f, 0.019134171f}, {-0.85355335f, 0.35355338f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45030877f, 0.12065987f, 0.019134171f}, {-0.8923991f, 0.23911761f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4280345f, 0.17729771f, 0.025f}, {-0.8001031f, 0.33141357f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.44751462f, 0.11991119f, 0.025f}, {-0.83651626f, 0.22414386f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.42467752f, 0.1759072f, 0.030438071f}, {-0.73296285f, 0.30360317f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.44400483f, 0.11897074f, 0.030438071f}, {-0.76632047f, 0.20533495f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.42069343f, 0.17425694f, 0.03535534f}, {-0.65328145f, 0.27059805f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43983945f, 0.117854625f, 0.03535534f}, {-0.68301266f, 0.1830127f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.41615048f, 0.17237519f, 0.039667666f}, {-0.5624222f, 0.2329629f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43508974f, 0.11658195f, 0.039667666f}, {-0.58801836f, 0.15755905f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.41112635f, 0.17029412f, 0.04330127f}, {-0.46193975f, 0.19134171f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.42983696f, 0.11517447f, 0.04330127f}, {-0.4829629f, 0.12940952f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40570703f, 0.16804937f, 0.046193976f}, {-0.35355338f, 0.1464466f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.424171f, 0.11365628f, 0.046193976f}, {-0.3696438f, 0.09904576f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39998525f, 0.16567932f, 0.04829629f}, {-0.23911761f, 0.09904576f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4181888f, 0.11205336f, 0.04829629f}, {-0.25f, 0.0669873f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39405888f, 0.16322455f, 0.049572244f}, {-0.12059047f, 0.04995021f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.41199276f, 0.11039313f, 0.049572244f}, {-0.1260786f, 0.03378266f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38802937f, 0.16072704f, 0.05f}, {1.5679955e-13f, -6.49485e-14f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40568882f, 0.10870399f, 0.05f}, {1.639356e-13f, -4.392641e-14f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38199985f, 0.15822953f, 0.049572244f}, {0.12059047f, -0.04995021f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3993849f, 0.10701486f, 0.049572244f}, {0.1260786f, -0.03378266f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37607348f, 0.15577476f, 0.04829629f}, {0.23911761f, -0.09904576f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39318883f, 0.10535463f, 0.04829629f}, {0.25f, -0.0669873f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3703517f, 0.15340471f, 0.046193976f}, {0.35355338f, -0.1464466f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38720664f, 0.103751704f, 0.046193976f}, {0.3696438f, -0.09904576f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3649324f, 0.15115996f, 0.04330127f}, {0.46193975f, -0.19134171f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3815407f, 0.102233514f, 0.04330127f}, {0.4829629f, -0.12940952f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.35990825f, 0.14907889f, 0.039667666f}, {0.5624222f, -0.2329629f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3762879f, 0.10082604f, 0.039667666f}, {0.58801836f, -0.15755905f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3553653f, 0.14719714f, 0.03535534f}, {0.65328145f, -0.27059805f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3715382f, 0.09955336f, 0.03535534f}, {0.68301266f, -0.1830127f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3513812f, 0.14554688f, 0.030438071f}, {0.73296285f, -0.30360317f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3673728f, 0.09843725f, 0.030438071f}, {0.76632047f, -0.20533495f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34802422f, 0.14415637f, 0.025f}, {0.8001031f, -0.33141357f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36386302f, 0.0974968f, 0.025f}, {0.83651626f, -0.22414386f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3453517f, 0.14304937f, 0.019134171f}, {0.85355335f, -0.35355338f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36106887f, 0.09674811f, 0.019134171f}, {0.8923991f, -0.23911761f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34340942f, 0.14224485f, 0.012940953f}, {0.8923991f, -0.3696438f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.35903817f, 0.09620399f, 0.012940953f}, {0.93301266f, -0.25f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3422306f, 0.14175656f, 0.0065263095f}, {0.91597563f, -0.37940952f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3578057f, 0.09587375f, 0.0065263095f}, {0.9576622f, -0.25660482f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34183538f, 0.14159286f, -8.485931e-15f}, {0.9238795f, -0.38268343f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.35739252f, 0.09576304f, -8.485931e-15f}, {0.9659258f, -0.25881904f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3422306f, 0.14175656f, -0.0065263095f}, {0.91597563f, -0.37940952f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3578057f, 0.09587375f, -0.0065263095f}, {0.9576622f, -0.25660482f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34340942f, 0.14224485f, -0.012940953f}, {0.8923991f, -0.3696438f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.35903817f, 0.09620399f, -0.012940953f}, {0.93301266f, -0.25f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3453517f, 0.14304937f, -0.019134171f}, {0.85355335f, -0.35355338f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36106887f, 0.09674811f, -0.019134171f}, {0.8923991f, -0.23911761f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34802422f, 0.14415637f, -0.025f}, {0.8001031f, -0.33141357f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36386302f, 0.0974968f, -0.025f}, {0.83651626f, -0.22414386f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3673728f, 0.09843725f, -0.030438071f}, {0.76632047f, -0.20533495f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3715382f, 0.09955336f, -0.03535534f}, {0.68301266f, -0.1830127f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37707853f, 0.049643327f, -0.030438071f}, {0.7865661f, -0.103553385f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38135397f, 0.0502062f, -0.03535534f}, {0.7010574f, -0.09229595f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38622916f, 0.05084803f, -0.039667666f}, {0.6035534f, -0.07945931f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37347603f, 0.049169045f, -0.025f}, {0.8586165f, -0.11303899f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38464466f, 0.0f, -0.03535534f}, {0.70710677f, 0.0f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37060806f, 0.048791472f, -0.019134171f}, {0.91597563f, -0.12059047f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38033232f, 0.0f, -0.030438071f}, {0.7933533f, 0.0f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37669873f, 0.0f, -0.025f}, {0.8660254f, 0.0f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36852372f, 0.048517067f, -0.012940953f}, {0.9576622f, -0.1260786f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.373806f, 0.0f, -0.019134171f}, {0.9238795f, 0.0f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3672587f, 0.04835052f, -0.0065263095f}, {0.98296297f, -0.12940952f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37170368f, 0.0f, -0.012940953f}, {0.9659258f, 0.0f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36683458f, 0.048294686f, -8.485931e-15f}, {0.9914449f, -0.13052619f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37042773f, 0.0f, -0.0065263095f}, {0.9914449f, 0.0f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3672587f, 0.04835052f, 0.0065263095f}, {0.98296297f, -0.12940952f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36999997f, 0.0f, -8.485931e-15f}, {1.0f, 0.0f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36852372f, 0.048517067f, 0.012940953f}, {0.9576622f, -0.1260786f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37042773f, 0.0f, 0.0065263095f}, {0.9914449f, 0.0f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37060806f, 0.048791472f, 0.019134171f}, {0.91597563f, -0.12059047f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37170368f, 0.0f, 0.012940953f}, {0.9659258f, 0.0f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37347603f, 0.049169045f, 0.025f}, {0.8586165f, -0.11303899f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.373806f, 0.0f, 0.019134171f}, {0.9238795f, 0.0f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37707853f, 0.049643327f, 0.030438071f}, {0.7865661f, -0.103553385f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37669873f, 0.0f, 0.025f}, {0.8660254f, 0.0f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38135397f, 0.0502062f, 0.03535534f}, {0.7010574f, -0.09229595f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38033232f, 0.0f, 0.030438071f}, {0.7933533f, 0.0f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38622916f, 0.05084803f, 0.039667666f}, {0.6035534f, -0.07945931f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38464466f, 0.0f, 0.03535534f}, {0.70710677f, 0.0f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39162073f, 0.051557843f, 0.04330127f}, {0.49572244f, -0.06526309f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38956192f, 0.0f, 0.039667666f}, {0.6087614f, 0.0f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39743635f, 0.052323487f, 0.046193976f}, {0.37940952f, -0.04995021f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39499998f, 0.0f, 0.04330127f}, {0.5f, 0.0f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4035766f, 0.053131863f, 0.04829629f}, {0.25660482f, -0.03378266f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40086582f, 0.0f, 0.046193976f}, {0.38268343f, 0.0f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40993637f, 0.05396914f, 0.049572244f}, {0.12940952f, -0.017037084f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40705904f, 0.0f, 0.04829629f}, {0.25881904f, 0.0f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.41640684f, 0.054820996f, 0.05f}, {1.6826666e-13f, -2.2152724e-14f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.41347367f, 0.0f, 0.049572244f}, {0.13052619f, 0.0f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4228773f, 0.05567285f, 0.049572244f}, {-0.12940952f, 0.017037084f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.42f, 0.0f, 0.05f}, {1.6971862e-13f, 0.0f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.42923707f, 0.056510128f, 0.04829629f}, {-0.25660482f, 0.03378266f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4265263f, 0.0f, 0.049572244f}, {-0.13052619f, 0.0f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43537733f, 0.057318505f, 0.046193976f}, {-0.37940952f, 0.04995021f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43294093f, 0.0f, 0.04829629f}, {-0.25881904f, 0.0f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.44119295f, 0.05808415f, 0.04330127f}, {-0.49572244f, 0.06526309f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43913415f, 0.0f, 0.046193976f}, {-0.38268343f, 0.0f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.44658452f, 0.058793962f, 0.039667666f}, {-0.6035534f, 0.07945931f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.445f, 0.0f, 0.04330127f}, {-0.5f, 0.0f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4514597f, 0.059435792f, 0.03535534f}, {-0.7010574f, 0.09229595f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45043805f, 0.0f, 0.039667666f}, {-0.6087614f, 0.0f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45573515f, 0.059998665f, 0.030438071f}, {-0.7865661f, 0.103553385f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45535532f, 0.0f, 0.03535534f}, {-0.70710677f, 0.0f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45933765f, 0.060472947f, 0.025f}, {-0.8586165f, 0.11303899f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45966765f, 0.0f, 0.030438071f}, {-0.7933533f, 0.0f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.46220562f, 0.06085052f, 0.019134171f}, {-0.91597563f, 0.12059047f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.46330124f, 0.0f, 0.025f}, {-0.8660254f, 0.0f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.46428996f, 0.061124925f, 0.012940953f}, {-0.9576622f, 0.1260786f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.46619397f, 0.0f, 0.019134171f}, {-0.9238795f, 0.0f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.46555498f, 0.06129147f, 0.0065263095f}, {-0.98296297f, 0.12940952f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4682963f, 0.0f, 0.012940953f}, {-0.9659258f, 0.0f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4659791f, 0.061347306f, 0.0f}, {-0.9914449f, 0.13052619f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.46957225f, 0.0f, 0.0065263095f}, {-0.9914449f, 0.0f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.46555498f, 0.06129147f, -0.0065263095f}, {-0.98296297f, 0.12940952f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.47f, 0.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.46428996f, 0.061124925f, -0.012940953f}, {-0.9576622f, 0.1260786f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.46957225f, 0.0f, -0.0065263095f}, {-0.9914449f, 0.0f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.46220562f, 0.06085052f, -0.019134171f}, {-0.91597563f, 0.12059047f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4682963f, 0.0f, -0.012940953f}, {-0.9659258f, 0.0f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45933765f, 0.060472947f, -0.025f}, {-0.8586165f, 0.11303899f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.46619397f, 0.0f, -0.019134171f}, {-0.9238795f, 0.0f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45573515f, 0.059998665f, -0.030438071f}, {-0.7865661f, 0.103553385f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.46330124f, 0.0f, -0.025f}, {-0.8660254f, 0.0f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4514597f, 0.059435792f, -0.03535534f}, {-0.7010574f, 0.09229595f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45966765f, 0.0f, -0.030438071f}, {-0.7933533f, 0.0f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.44658452f, 0.058793962f, -0.039667666f}, {-0.6035534f, 0.07945931f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45535532f, 0.0f, -0.03535534f}, {-0.70710677f, 0.0f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.44119295f, 0.05808415f, -0.04330127f}, {-0.49572244f, 0.06526309f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45043805f, 0.0f, -0.039667666f}, {-0.6087614f, 0.0f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43537733f, 0.057318505f, -0.046193976f}, {-0.37940952f, 0.04995021f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.445f, 0.0f, -0.04330127f}, {-0.5f, 0.0f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.42923707f, 0.056510128f, -0.04829629f}, {-0.25660482f, 0.03378266f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43913415f, 0.0f, -0.046193976f}, {-0.38268343f, 0.0f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4228773f, 0.05567285f, -0.049572244f}, {-0.12940952f, 0.017037084f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43294093f, 0.0f, -0.04829629f}, {-0.25881904f, 0.0f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.41640684f, 0.054820996f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4265263f, 0.0f, -0.049572244f}, {-0.13052619f, 0.0f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40993637f, 0.05396914f, -0.049572244f}, {0.12940952f, -0.017037084f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.42f, 0.0f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4035766f, 0.053131863f, -0.04829629f}, {0.25660482f, -0.03378266f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.41347367f, 0.0f, -0.049572244f}, {0.13052619f, 0.0f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39743635f, 0.052323487f, -0.046193976f}, {0.37940952f, -0.04995021f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40705904f, 0.0f, -0.04829629f}, {0.25881904f, 0.0f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39162073f, 0.051557843f, -0.04330127f}, {0.49572244f, -0.06526309f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40086582f, 0.0f, -0.046193976f}, {0.38268343f, 0.0f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39499998f, 0.0f, -0.04330127f}, {0.5f, 0.0f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38956192f, 0.0f, -0.039667666f}, {0.6087614f, 0.0f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39743635f, -0.052323487f, -0.046193976f}, {0.37940952f, 0.04995021f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39162073f, -0.051557843f, -0.04330127f}, {0.49572244f, 0.06526309f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38622916f, -0.05084803f, -0.039667666f}, {0.6035534f, 0.07945931f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4035766f, -0.053131863f, -0.04829629f}, {0.25660482f, 0.03378266f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38720664f, -0.103751704f, -0.046193976f}, {0.3696438f, 0.09904576f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40993637f, -0.05396914f, -0.049572244f}, {0.12940952f, 0.017037084f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39318883f, -0.10535463f, -0.04829629f}, {0.25f, 0.0669873f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3993849f, -0.10701486f, -0.049572244f}, {0.1260786f, 0.03378266f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.41640684f, -0.054820996f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40568882f, -0.10870399f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4228773f, -0.05567285f, -0.049572244f}, {-0.12940952f, -0.017037084f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.41199276f, -0.11039313f, -0.049572244f}, {-0.1260786f, -0.03378266f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.42923707f, -0.056510128f, -0.04829629f}, {-0.25660482f, -0.03378266f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4181888f, -0.11205336f, -0.04829629f}, {-0.25f, -0.0669873f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43537733f, -0.057318505f, -0.046193976f}, {-0.37940952f, -0.04995021f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.424171f, -0.11365628f, -0.046193976f}, {-0.3696438f, -0.09904576f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.44119295f, -0.05808415f, -0.04330127f}, {-0.49572244f, -0.06526309f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.42983696f, -0.11517447f, -0.04330127f}, {-0.4829629f, -0.12940952f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.44658452f, -0.058793962f, -0.039667666f}, {-0.6035534f, -0.07945931f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43508974f, -0.11658195f, -0.039667666f}, {-0.58801836f, -0.15755905f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4514597f, -0.059435792f, -0.03535534f}, {-0.7010574f, -0.09229595f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43983945f, -0.117854625f, -0.03535534f}, {-0.68301266f, -0.1830127f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45573515f, -0.059998665f, -0.030438071f}, {-0.7865661f, -0.103553385f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.44400483f, -0.11897074f, -0.030438071f}, {-0.76632047f, -0.20533495f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45933765f, -0.060472947f, -0.025f}, {-0.8586165f, -0.11303899f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.44751462f, -0.11991119f, -0.025f}, {-0.83651626f, -0.22414386f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.46220562f, -0.06085052f, -0.019134171f}, {-0.91597563f, -0.12059047f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45030877f, -0.12065987f, -0.019134171f}, {-0.8923991f, -0.23911761f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.46428996f, -0.061124925f, -0.012940953f}, {-0.9576622f, -0.1260786f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45233947f, -0.121203996f, -0.012940953f}, {-0.93301266f, -0.25f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.46555498f, -0.06129147f, -0.0065263095f}, {-0.98296297f, -0.12940952f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45357195f, -0.121534236f, -0.0065263095f}, {-0.9576622f, -0.25660482f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4659791f, -0.061347306f, 0.0f}, {-0.9914449f, -0.13052619f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45398512f, -0.121644944f, 0.0f}, {-0.9659258f, -0.25881904f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.46555498f, -0.06129147f, 0.0065263095f}, {-0.98296297f, -0.12940952f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45357195f, -0.121534236f, 0.0065263095f}, {-0.9576622f, -0.25660482f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.46428996f, -0.061124925f, 0.012940953f}, {-0.9576622f, -0.1260786f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45233947f, -0.121203996f, 0.012940953f}, {-0.93301266f, -0.25f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.46220562f, -0.06085052f, 0.019134171f}, {-0.91597563f, -0.12059047f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45030877f, -0.12065987f, 0.019134171f}, {-0.8923991f, -0.23911761f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45933765f, -0.060472947f, 0.025f}, {-0.8586165f, -0.11303899f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.44751462f, -0.11991119f, 0.025f}, {-0.83651626f, -0.22414386f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45573515f, -0.059998665f, 0.030438071f}, {-0.7865661f, -0.103553385f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.44400483f, -0.11897074f, 0.030438071f}, {-0.76632047f, -0.20533495f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4514597f, -0.059435792f, 0.03535534f}, {-0.7010574f, -0.09229595f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43983945f, -0.117854625f, 0.03535534f}, {-0.68301266f, -0.1830127f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.44658452f, -0.058793962f, 0.039667666f}, {-0.6035534f, -0.07945931f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43508974f, -0.11658195f, 0.039667666f}, {-0.58801836f, -0.15755905f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.44119295f, -0.05808415f, 0.04330127f}, {-0.49572244f, -0.06526309f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.42983696f, -0.11517447f, 0.04330127f}, {-0.4829629f, -0.12940952f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43537733f, -0.057318505f, 0.046193976f}, {-0.37940952f, -0.04995021f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.424171f, -0.11365628f, 0.046193976f}, {-0.3696438f, -0.09904576f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.42923707f, -0.056510128f, 0.04829629f}, {-0.25660482f, -0.03378266f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4181888f, -0.11205336f, 0.04829629f}, {-0.25f, -0.0669873f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4228773f, -0.05567285f, 0.049572244f}, {-0.12940952f, -0.017037084f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.41199276f, -0.11039313f, 0.049572244f}, {-0.1260786f, -0.03378266f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.41640684f, -0.054820996f, 0.05f}, {1.6826666e-13f, 2.2152724e-14f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40568882f, -0.10870399f, 0.05f}, {1.639356e-13f, 4.392641e-14f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40993637f, -0.05396914f, 0.049572244f}, {0.12940952f, 0.017037084f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3993849f, -0.10701486f, 0.049572244f}, {0.1260786f, 0.03378266f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4035766f, -0.053131863f, 0.04829629f}, {0.25660482f, 0.03378266f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39318883f, -0.10535463f, 0.04829629f}, {0.25f, 0.0669873f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39743635f, -0.052323487f, 0.046193976f}, {0.37940952f, 0.04995021f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38720664f, -0.103751704f, 0.046193976f}, {0.3696438f, 0.09904576f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39162073f, -0.051557843f, 0.04330127f}, {0.49572244f, 0.06526309f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3815407f, -0.102233514f, 0.04330127f}, {0.4829629f, 0.12940952f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38622916f, -0.05084803f, 0.039667666f}, {0.6035534f, 0.07945931f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3762879f, -0.10082604f, 0.039667666f}, {0.58801836f, 0.15755905f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38135397f, -0.0502062f, 0.03535534f}, {0.7010574f, 0.09229595f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3715382f, -0.09955336f, 0.03535534f}, {0.68301266f, 0.1830127f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37707853f, -0.049643327f, 0.030438071f}, {0.7865661f, 0.103553385f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3673728f, -0.09843725f, 0.030438071f}, {0.76632047f, 0.20533495f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37347603f, -0.049169045f, 0.025f}, {0.8586165f, 0.11303899f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36386302f, -0.0974968f, 0.025f}, {0.83651626f, 0.22414386f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37060806f, -0.048791472f, 0.019134171f}, {0.91597563f, 0.12059047f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36106887f, -0.09674811f, 0.019134171f}, {0.8923991f, 0.23911761f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36852372f, -0.048517067f, 0.012940953f}, {0.9576622f, 0.1260786f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.35903817f, -0.09620399f, 0.012940953f}, {0.93301266f, 0.25f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3672587f, -0.04835052f, 0.0065263095f}, {0.98296297f, 0.12940952f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3578057f, -0.09587375f, 0.0065263095f}, {0.9576622f, 0.25660482f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36683458f, -0.048294686f, -8.485931e-15f}, {0.9914449f, 0.13052619f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.35739252f, -0.09576304f, -8.485931e-15f}, {0.9659258f, 0.25881904f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3672587f, -0.04835052f, -0.0065263095f}, {0.98296297f, 0.12940952f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3578057f, -0.09587375f, -0.0065263095f}, {0.9576622f, 0.25660482f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36852372f, -0.048517067f, -0.012940953f}, {0.9576622f, 0.1260786f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.35903817f, -0.09620399f, -0.012940953f}, {0.93301266f, 0.25f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37060806f, -0.048791472f, -0.019134171f}, {0.91597563f, 0.12059047f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36106887f, -0.09674811f, -0.019134171f}, {0.8923991f, 0.23911761f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37347603f, -0.049169045f, -0.025f}, {0.8586165f, 0.11303899f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36386302f, -0.0974968f, -0.025f}, {0.83651626f, 0.22414386f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37707853f, -0.049643327f, -0.030438071f}, {0.7865661f, 0.103553385f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3673728f, -0.09843725f, -0.030438071f}, {0.76632047f, 0.20533495f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38135397f, -0.0502062f, -0.03535534f}, {0.7010574f, 0.09229595f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3715382f, -0.09955336f, -0.03535534f}, {0.68301266f, 0.1830127f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3762879f, -0.10082604f, -0.039667666f}, {0.58801836f, 0.15755905f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3815407f, -0.102233514f, -0.04330127f}, {0.4829629f, 0.12940952f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.35990825f, -0.14907889f, -0.039667666f}, {0.5624222f, 0.2329629f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3649324f, -0.15115996f, -0.04330127f}, {0.46193975f, 0.19134171f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3703517f, -0.15340471f, -0.046193976f}, {0.35355338f, 0.1464466f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3553653f, -0.14719714f, -0.03535534f}, {0.65328145f, 0.27059805f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34208f, -0.19749999f, -0.04330127f}, {0.4330127f, 0.25f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3513812f, -0.14554688f, -0.030438071f}, {0.73296285f, 0.30360317f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33737049f, -0.19478096f, -0.039667666f}, {0.52720284f, 0.3043807f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33311203f, -0.19232233f, -0.03535534f}, {0.6123724f, 0.35355338f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34802422f, -0.14415637f, -0.025f}, {0.8001031f, 0.33141357f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32937744f, -0.19016616f, -0.030438071f}, {0.6870641f, 0.39667666f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3453517f, -0.14304937f, -0.019134171f}, {0.85355335f, 0.35355338f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32623065f, -0.18834937f, -0.025f}, {0.75f, 0.4330127f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34340942f, -0.14224485f, -0.012940953f}, {0.8923991f, 0.3696438f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3237255f, -0.186903f, -0.019134171f}, {0.8001031f, 0.46193975f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3422306f, -0.14175656f, -0.0065263095f}, {0.91597563f, 0.37940952f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32190484f, -0.18585184f, -0.012940953f}, {0.83651626f, 0.4829629f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34183538f, -0.14159286f, -8.485931e-15f}, {0.9238795f, 0.38268343f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32079983f, -0.18521386f, -0.0065263095f}, {0.8586165f, 0.49572244f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3422306f, -0.14175656f, 0.0065263095f}, {0.91597563f, 0.37940952f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32042938f, -0.18499999f, -8.485931e-15f}, {0.8660254f, 0.5f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34340942f, -0.14224485f, 0.012940953f}, {0.8923991f, 0.3696438f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32079983f, -0.18521386f, 0.0065263095f}, {0.8586165f, 0.49572244f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3453517f, -0.14304937f, 0.019134171f}, {0.85355335f, 0.35355338f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32190484f, -0.18585184f, 0.012940953f}, {0.83651626f, 0.4829629f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34802422f, -0.14415637f, 0.025f}, {0.8001031f, 0.33141357f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3237255f, -0.186903f, 0.019134171f}, {0.8001031f, 0.46193975f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3513812f, -0.14554688f, 0.030438071f}, {0.73296285f, 0.30360317f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32623065f, -0.18834937f, 0.025f}, {0.75f, 0.4330127f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3553653f, -0.14719714f, 0.03535534f}, {0.65328145f, 0.27059805f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32937744f, -0.19016616f, 0.030438071f}, {0.6870641f, 0.39667666f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.35990825f, -0.14907889f, 0.039667666f}, {0.5624222f, 0.2329629f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33311203f, -0.19232233f, 0.03535534f}, {0.6123724f, 0.35355338f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3649324f, -0.15115996f, 0.04330127f}, {0.46193975f, 0.19134171f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33737049f, -0.19478096f, 0.039667666f}, {0.52720284f, 0.3043807f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3703517f, -0.15340471f, 0.046193976f}, {0.35355338f, 0.1464466f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34208f, -0.19749999f, 0.04330127f}, {0.4330127f, 0.25f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37607348f, -0.15577476f, 0.04829629f}, {0.23911761f, 0.09904576f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34715995f, -0.20043291f, 0.046193976f}, {0.33141357f, 0.19134171f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38199985f, -0.15822953f, 0.049572244f}, {0.12059047f, 0.04995021f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.35252345f, -0.20352952f, 0.04829629f}, {0.22414386f, 0.12940952f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38802937f, -0.16072704f, 0.05f}, {1.5679955e-13f, 6.49485e-14f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3580787f, -0.20673683f, 0.049572244f}, {0.11303899f, 0.06526309f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39405888f, -0.16322455f, 0.049572244f}, {-0.12059047f, -0.04995021f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36373064f, -0.21f, 0.05f}, {1.4698064e-13f, 8.485931e-14f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39998525f, -0.16567932f, 0.04829629f}, {-0.23911761f, -0.09904576f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3693826f, -0.21326315f, 0.049572244f}, {-0.11303899f, -0.06526309f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40570703f, -0.16804937f, 0.046193976f}, {-0.35355338f, -0.1464466f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37493783f, -0.21647047f, 0.04829629f}, {-0.22414386f, -0.12940952f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.41112635f, -0.17029412f, 0.04330127f}, {-0.46193975f, -0.19134171f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38030133f, -0.21956708f, 0.046193976f}, {-0.33141357f, -0.19134171f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.41615048f, -0.17237519f, 0.039667666f}, {-0.5624222f, -0.2329629f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38538128f, -0.2225f, 0.04330127f}, {-0.4330127f, -0.25f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.42069343f, -0.17425694f, 0.03535534f}, {-0.65328145f, -0.27059805f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3900908f, -0.22521903f, 0.039667666f}, {-0.52720284f, -0.3043807f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.42467752f, -0.1759072f, 0.030438071f}, {-0.73296285f, -0.30360317f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39434925f, -0.22767766f, 0.03535534f}, {-0.6123724f, -0.35355338f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4280345f, -0.17729771f, 0.025f}, {-0.8001031f, -0.33141357f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39808384f, -0.22983383f, 0.030438071f}, {-0.6870641f, -0.39667666f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43070704f, -0.1784047f, 0.019134171f}, {-0.85355335f, -0.35355338f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40123063f, -0.23165062f, 0.025f}, {-0.75f, -0.4330127f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4326493f, -0.17920923f, 0.012940953f}, {-0.8923991f, -0.3696438f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4037358f, -0.23309699f, 0.019134171f}, {-0.8001031f, -0.46193975f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43382815f, -0.17969751f, 0.0065263095f}, {-0.91597563f, -0.37940952f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40555644f, -0.23414814f, 0.012940953f}, {-0.83651626f, -0.4829629f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43422335f, -0.17986122f, 0.0f}, {-0.9238795f, -0.38268343f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40666145f, -0.23478612f, 0.0065263095f}, {-0.8586165f, -0.49572244f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43382815f, -0.17969751f, -0.0065263095f}, {-0.91597563f, -0.37940952f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4070319f, -0.235f, 0.0f}, {-0.8660254f, -0.5f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4326493f, -0.17920923f, -0.012940953f}, {-0.8923991f, -0.3696438f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40666145f, -0.23478612f, -0.0065263095f}, {-0.8586165f, -0.49572244f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43070704f, -0.1784047f, -0.019134171f}, {-0.85355335f, -0.35355338f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40555644f, -0.23414814f, -0.012940953f}, {-0.83651626f, -0.4829629f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4280345f, -0.17729771f, -0.025f}, {-0.8001031f, -0.33141357f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4037358f, -0.23309699f, -0.019134171f}, {-0.8001031f, -0.46193975f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.42467752f, -0.1759072f, -0.030438071f}, {-0.73296285f, -0.30360317f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40123063f, -0.23165062f, -0.025f}, {-0.75f, -0.4330127f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.42069343f, -0.17425694f, -0.03535534f}, {-0.65328145f, -0.27059805f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39808384f, -0.22983383f, -0.030438071f}, {-0.6870641f, -0.39667666f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.41615048f, -0.17237519f, -0.039667666f}, {-0.5624222f, -0.2329629f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39434925f, -0.22767766f, -0.03535534f}, {-0.6123724f, -0.35355338f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.41112635f, -0.17029412f, -0.04330127f}, {-0.46193975f, -0.19134171f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3900908f, -0.22521903f, -0.039667666f}, {-0.52720284f, -0.3043807f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40570703f, -0.16804937f, -0.046193976f}, {-0.35355338f, -0.1464466f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38538128f, -0.2225f, -0.04330127f}, {-0.4330127f, -0.25f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39998525f, -0.16567932f, -0.04829629f}, {-0.23911761f, -0.09904576f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38030133f, -0.21956708f, -0.046193976f}, {-0.33141357f, -0.19134171f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39405888f, -0.16322455f, -0.049572244f}, {-0.12059047f, -0.04995021f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37493783f, -0.21647047f, -0.04829629f}, {-0.22414386f, -0.12940952f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38802937f, -0.16072704f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3693826f, -0.21326315f, -0.049572244f}, {-0.11303899f, -0.06526309f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38199985f, -0.15822953f, -0.049572244f}, {0.12059047f, 0.04995021f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36373064f, -0.21f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37607348f, -0.15577476f, -0.04829629f}, {0.23911761f, 0.09904576f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3580787f, -0.20673683f, -0.049572244f}, {0.11303899f, 0.06526309f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.35252345f, -0.20352952f, -0.04829629f}, {0.22414386f, 0.12940952f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34715995f, -0.20043291f, -0.046193976f}, {0.33141357f, 0.19134171f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3280307f, -0.2517068f, -0.049572244f}, {0.103553385f, 0.07945931f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32294163f, -0.24780184f, -0.04829629f}, {0.20533495f, 0.15755905f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3180282f, -0.24403164f, -0.046193976f}, {0.30360317f, 0.2329629f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33320838f, -0.2556798f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29237002f, -0.29237002f, -0.049572244f}, {0.09229595f, 0.09229595f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33838606f, -0.25965276f, -0.049572244f}, {-0.103553385f, -0.07945931f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29698482f, -0.29698482f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.30159962f, -0.30159962f, -0.049572244f}, {-0.09229595f, -0.09229595f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34347513f, -0.26355773f, -0.04829629f}, {-0.20533495f, -0.15755905f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.30613545f, -0.30613545f, -0.04829629f}, {-0.1830127f, -0.1830127f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34838855f, -0.26732793f, -0.046193976f}, {-0.30360317f, -0.2329629f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.31051472f, -0.31051472f, -0.046193976f}, {-0.27059805f, -0.27059805f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.35304222f, -0.27089882f, -0.04330127f}, {-0.39667666f, -0.3043807f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3146625f, -0.3146625f, -0.04330127f}, {-0.35355338f, -0.35355338f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.35735652f, -0.27420932f, -0.039667666f}, {-0.4829629f, -0.37059048f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3185078f, -0.3185078f, -0.039667666f}, {-0.43045932f, -0.43045932f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36125767f, -0.27720276f, -0.03535534f}, {-0.5609855f, -0.43045932f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32198483f, -0.32198483f, -0.03535534f}, {-0.49999997f, -0.49999997f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36467886f, -0.27982792f, -0.030438071f}, {-0.6294095f, -0.4829629f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32503408f, -0.32503408f, -0.030438071f}, {-0.5609855f, -0.5609855f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36756158f, -0.28203994f, -0.025f}, {-0.6870641f, -0.52720284f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32760343f, -0.32760343f, -0.025f}, {-0.6123724f, -0.6123724f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36985654f, -0.2838009f, -0.019134171f}, {-0.73296285f, -0.5624222f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32964888f, -0.32964888f, -0.019134171f}, {-0.65328145f, -0.65328145f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3715244f, -0.2850807f, -0.012940953f}, {-0.76632047f, -0.58801836f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33113545f, -0.33113545f, -0.012940953f}, {-0.68301266f, -0.68301266f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3725367f, -0.28585747f, -0.0065263095f}, {-0.7865661f, -0.6035534f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3320377f, -0.3320377f, -0.0065263095f}, {-0.7010574f, -0.7010574f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37287605f, -0.28611785f, 0.0f}, {-0.7933533f, -0.6087614f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33234015f, -0.33234015f, 0.0f}, {-0.70710677f, -0.70710677f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3725367f, -0.28585747f, 0.0065263095f}, {-0.7865661f, -0.6035534f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3320377f, -0.3320377f, 0.0065263095f}, {-0.7010574f, -0.7010574f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3715244f, -0.2850807f, 0.012940953f}, {-0.76632047f, -0.58801836f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33113545f, -0.33113545f, 0.012940953f}, {-0.68301266f, -0.68301266f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36985654f, -0.2838009f, 0.019134171f}, {-0.73296285f, -0.5624222f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32964888f, -0.32964888f, 0.019134171f}, {-0.65328145f, -0.65328145f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36756158f, -0.28203994f, 0.025f}, {-0.6870641f, -0.52720284f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32760343f, -0.32760343f, 0.025f}, {-0.6123724f, -0.6123724f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36467886f, -0.27982792f, 0.030438071f}, {-0.6294095f, -0.4829629f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32503408f, -0.32503408f, 0.030438071f}, {-0.5609855f, -0.5609855f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36125767f, -0.27720276f, 0.03535534f}, {-0.5609855f, -0.43045932f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32198483f, -0.32198483f, 0.03535534f}, {-0.49999997f, -0.49999997f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.35735652f, -0.27420932f, 0.039667666f}, {-0.4829629f, -0.37059048f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3185078f, -0.3185078f, 0.039667666f}, {-0.43045932f, -0.43045932f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.35304222f, -0.27089882f, 0.04330127f}, {-0.39667666f, -0.3043807f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3146625f, -0.3146625f, 0.04330127f}, {-0.35355338f, -0.35355338f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34838855f, -0.26732793f, 0.046193976f}, {-0.30360317f, -0.2329629f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.31051472f, -0.31051472f, 0.046193976f}, {-0.27059805f, -0.27059805f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.34347513f, -0.26355773f, 0.04829629f}, {-0.20533495f, -0.15755905f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.30613545f, -0.30613545f, 0.04829629f}, {-0.1830127f, -0.1830127f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33838606f, -0.25965276f, 0.049572244f}, {-0.103553385f, -0.07945931f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.30159962f, -0.30159962f, 0.049572244f}, {-0.09229595f, -0.09229595f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33320838f, -0.2556798f, 0.05f}, {1.3464684e-13f, 1.0331815e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29698482f, -0.29698482f, 0.05f}, {1.2000919e-13f, 1.2000919e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3280307f, -0.2517068f, 0.049572244f}, {0.103553385f, 0.07945931f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29237002f, -0.29237002f, 0.049572244f}, {0.09229595f, 0.09229595f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32294163f, -0.24780184f, 0.04829629f}, {0.20533495f, 0.15755905f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2878342f, -0.2878342f, 0.04829629f}, {0.1830127f, 0.1830127f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3180282f, -0.24403164f, 0.046193976f}, {0.30360317f, 0.2329629f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.28345492f, -0.28345492f, 0.046193976f}, {0.27059805f, 0.27059805f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.31337455f, -0.24046075f, 0.04330127f}, {0.39667666f, 0.3043807f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27930716f, -0.27930716f, 0.04330127f}, {0.35355338f, 0.35355338f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.30906025f, -0.23715027f, 0.039667666f}, {0.4829629f, 0.37059048f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27546185f, -0.27546185f, 0.039667666f}, {0.43045932f, 0.43045932f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3051591f, -0.23415682f, 0.03535534f}, {0.5609855f, 0.43045932f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27198482f, -0.27198482f, 0.03535534f}, {0.49999997f, 0.49999997f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3017379f, -0.23153163f, 0.030438071f}, {0.6294095f, 0.4829629f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.26893556f, -0.26893556f, 0.030438071f}, {0.5609855f, 0.5609855f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2988552f, -0.22931965f, 0.025f}, {0.6870641f, 0.52720284f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2663662f, -0.2663662f, 0.025f}, {0.6123724f, 0.6123724f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29656023f, -0.22755867f, 0.019134171f}, {0.73296285f, 0.5624222f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.26432076f, -0.26432076f, 0.019134171f}, {0.65328145f, 0.65328145f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29489237f, -0.22627887f, 0.012940953f}, {0.76632047f, 0.58801836f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2628342f, -0.2628342f, 0.012940953f}, {0.68301266f, 0.68301266f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29388008f, -0.22550212f, 0.0065263095f}, {0.7865661f, 0.6035534f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.26193196f, -0.26193196f, 0.0065263095f}, {0.7010574f, 0.7010574f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29354072f, -0.22524172f, -8.485931e-15f}, {0.7933533f, 0.6087614f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2616295f, -0.2616295f, -8.485931e-15f}, {0.70710677f, 0.70710677f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29388008f, -0.22550212f, -0.0065263095f}, {0.7865661f, 0.6035534f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.26193196f, -0.26193196f, -0.0065263095f}, {0.7010574f, 0.7010574f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29489237f, -0.22627887f, -0.012940953f}, {0.76632047f, 0.58801836f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2628342f, -0.2628342f, -0.012940953f}, {0.68301266f, 0.68301266f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29656023f, -0.22755867f, -0.019134171f}, {0.73296285f, 0.5624222f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.26432076f, -0.26432076f, -0.019134171f}, {0.65328145f, 0.65328145f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2988552f, -0.22931965f, -0.025f}, {0.6870641f, 0.52720284f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2663662f, -0.2663662f, -0.025f}, {0.6123724f, 0.6123724f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3017379f, -0.23153163f, -0.030438071f}, {0.6294095f, 0.4829629f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.26893556f, -0.26893556f, -0.030438071f}, {0.5609855f, 0.5609855f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3051591f, -0.23415682f, -0.03535534f}, {0.5609855f, 0.43045932f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27198482f, -0.27198482f, -0.03535534f}, {0.49999997f, 0.49999997f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.30906025f, -0.23715027f, -0.039667666f}, {0.4829629f, 0.37059048f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27546185f, -0.27546185f, -0.039667666f}, {0.43045932f, 0.43045932f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.31337455f, -0.24046075f, -0.04330127f}, {0.39667666f, 0.3043807f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27930716f, -0.27930716f, -0.04330127f}, {0.35355338f, 0.35355338f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.28345492f, -0.28345492f, -0.046193976f}, {0.27059805f, 0.27059805f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2878342f, -0.2878342f, -0.04829629f}, {0.1830127f, 0.1830127f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.24403164f, -0.3180282f, -0.046193976f}, {0.2329629f, 0.30360317f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.24780184f, -0.32294163f, -0.04829629f}, {0.15755905f, 0.20533495f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2517068f, -0.3280307f, -0.049572244f}, {0.07945931f, 0.103553385f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.24046075f, -0.31337455f, -0.04330127f}, {0.3043807f, 0.39667666f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.20352952f, -0.35252345f, -0.04829629f}, {0.12940952f, 0.22414386f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23715027f, -0.30906025f, -0.039667666f}, {0.37059048f, 0.4829629f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.20043291f, -0.34715995f, -0.046193976f}, {0.19134171f, 0.33141357f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.19749999f, -0.34208f, -0.04330127f}, {0.25f, 0.4330127f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23415682f, -0.3051591f, -0.03535534f}, {0.43045932f, 0.5609855f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.19478096f, -0.33737049f, -0.039667666f}, {0.3043807f, 0.52720284f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23153163f, -0.3017379f, -0.030438071f}, {0.4829629f, 0.6294095f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.19232233f, -0.33311203f, -0.03535534f}, {0.35355338f, 0.6123724f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22931965f, -0.2988552f, -0.025f}, {0.52720284f, 0.6870641f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.19016616f, -0.32937744f, -0.030438071f}, {0.39667666f, 0.6870641f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22755867f, -0.29656023f, -0.019134171f}, {0.5624222f, 0.73296285f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.18834937f, -0.32623065f, -0.025f}, {0.4330127f, 0.75f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22627887f, -0.29489237f, -0.012940953f}, {0.58801836f, 0.76632047f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.186903f, -0.3237255f, -0.019134171f}, {0.46193975f, 0.8001031f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22550212f, -0.29388008f, -0.0065263095f}, {0.6035534f, 0.7865661f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.18585184f, -0.32190484f, -0.012940953f}, {0.4829629f, 0.83651626f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22524172f, -0.29354072f, -8.485931e-15f}, {0.6087614f, 0.7933533f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.18521386f, -0.32079983f, -0.0065263095f}, {0.49572244f, 0.8586165f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22550212f, -0.29388008f, 0.0065263095f}, {0.6035534f, 0.7865661f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.18499999f, -0.32042938f, -8.485931e-15f}, {0.5f, 0.8660254f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22627887f, -0.29489237f, 0.012940953f}, {0.58801836f, 0.76632047f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.18521386f, -0.32079983f, 0.0065263095f}, {0.49572244f, 0.8586165f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22755867f, -0.29656023f, 0.019134171f}, {0.5624222f, 0.73296285f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.18585184f, -0.32190484f, 0.012940953f}, {0.4829629f, 0.83651626f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22931965f, -0.2988552f, 0.025f}, {0.52720284f, 0.6870641f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.186903f, -0.3237255f, 0.019134171f}, {0.46193975f, 0.8001031f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23153163f, -0.3017379f, 0.030438071f}, {0.4829629f, 0.6294095f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.18834937f, -0.32623065f, 0.025f}, {0.4330127f, 0.75f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23415682f, -0.3051591f, 0.03535534f}, {0.43045932f, 0.5609855f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.19016616f, -0.32937744f, 0.030438071f}, {0.39667666f, 0.6870641f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23715027f, -0.30906025f, 0.039667666f}, {0.37059048f, 0.4829629f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.19232233f, -0.33311203f, 0.03535534f}, {0.35355338f, 0.6123724f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.24046075f, -0.31337455f, 0.04330127f}, {0.3043807f, 0.39667666f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.19478096f, -0.33737049f, 0.039667666f}, {0.3043807f, 0.52720284f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.24403164f, -0.3180282f, 0.046193976f}, {0.2329629f, 0.30360317f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.19749999f, -0.34208f, 0.04330127f}, {0.25f, 0.4330127f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.24780184f, -0.32294163f, 0.04829629f}, {0.15755905f, 0.20533495f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.20043291f, -0.34715995f, 0.046193976f}, {0.19134171f, 0.33141357f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2517068f, -0.3280307f, 0.049572244f}, {0.07945931f, 0.103553385f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.20352952f, -0.35252345f, 0.04829629f}, {0.12940952f, 0.22414386f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2556798f, -0.33320838f, 0.05f}, {1.0331815e-13f, 1.3464684e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.20673683f, -0.3580787f, 0.049572244f}, {0.06526309f, 0.11303899f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.25965276f, -0.33838606f, 0.049572244f}, {-0.07945931f, -0.103553385f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.21f, -0.36373064f, 0.05f}, {8.485931e-14f, 1.4698064e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.26355773f, -0.34347513f, 0.04829629f}, {-0.15755905f, -0.20533495f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.21326315f, -0.3693826f, 0.049572244f}, {-0.06526309f, -0.11303899f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.26732793f, -0.34838855f, 0.046193976f}, {-0.2329629f, -0.30360317f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.21647047f, -0.37493783f, 0.04829629f}, {-0.12940952f, -0.22414386f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27089882f, -0.35304222f, 0.04330127f}, {-0.3043807f, -0.39667666f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.21956708f, -0.38030133f, 0.046193976f}, {-0.19134171f, -0.33141357f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27420932f, -0.35735652f, 0.039667666f}, {-0.37059048f, -0.4829629f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2225f, -0.38538128f, 0.04330127f}, {-0.25f, -0.4330127f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27720276f, -0.36125767f, 0.03535534f}, {-0.43045932f, -0.5609855f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22521903f, -0.3900908f, 0.039667666f}, {-0.3043807f, -0.52720284f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27982792f, -0.36467886f, 0.030438071f}, {-0.4829629f, -0.6294095f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22767766f, -0.39434925f, 0.03535534f}, {-0.35355338f, -0.6123724f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.28203994f, -0.36756158f, 0.025f}, {-0.52720284f, -0.6870641f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22983383f, -0.39808384f, 0.030438071f}, {-0.39667666f, -0.6870641f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2838009f, -0.36985654f, 0.019134171f}, {-0.5624222f, -0.73296285f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23165062f, -0.40123063f, 0.025f}, {-0.4330127f, -0.75f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2850807f, -0.3715244f, 0.012940953f}, {-0.58801836f, -0.76632047f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23309699f, -0.4037358f, 0.019134171f}, {-0.46193975f, -0.8001031f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.28585747f, -0.3725367f, 0.0065263095f}, {-0.6035534f, -0.7865661f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23414814f, -0.40555644f, 0.012940953f}, {-0.4829629f, -0.83651626f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.28611785f, -0.37287605f, 0.0f}, {-0.6087614f, -0.7933533f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23478612f, -0.40666145f, 0.0065263095f}, {-0.49572244f, -0.8586165f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.28585747f, -0.3725367f, -0.0065263095f}, {-0.6035534f, -0.7865661f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.235f, -0.4070319f, 0.0f}, {-0.5f, -0.8660254f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2850807f, -0.3715244f, -0.012940953f}, {-0.58801836f, -0.76632047f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23478612f, -0.40666145f, -0.0065263095f}, {-0.49572244f, -0.8586165f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2838009f, -0.36985654f, -0.019134171f}, {-0.5624222f, -0.73296285f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23414814f, -0.40555644f, -0.012940953f}, {-0.4829629f, -0.83651626f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.28203994f, -0.36756158f, -0.025f}, {-0.52720284f, -0.6870641f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23309699f, -0.4037358f, -0.019134171f}, {-0.46193975f, -0.8001031f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27982792f, -0.36467886f, -0.030438071f}, {-0.4829629f, -0.6294095f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.23165062f, -0.40123063f, -0.025f}, {-0.4330127f, -0.75f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27720276f, -0.36125767f, -0.03535534f}, {-0.43045932f, -0.5609855f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22983383f, -0.39808384f, -0.030438071f}, {-0.39667666f, -0.6870641f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27420932f, -0.35735652f, -0.039667666f}, {-0.37059048f, -0.4829629f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22767766f, -0.39434925f, -0.03535534f}, {-0.35355338f, -0.6123724f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27089882f, -0.35304222f, -0.04330127f}, {-0.3043807f, -0.39667666f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22521903f, -0.3900908f, -0.039667666f}, {-0.3043807f, -0.52720284f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.26732793f, -0.34838855f, -0.046193976f}, {-0.2329629f, -0.30360317f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2225f, -0.38538128f, -0.04330127f}, {-0.25f, -0.4330127f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.26355773f, -0.34347513f, -0.04829629f}, {-0.15755905f, -0.20533495f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.21956708f, -0.38030133f, -0.046193976f}, {-0.19134171f, -0.33141357f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.25965276f, -0.33838606f, -0.049572244f}, {-0.07945931f, -0.103553385f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.21647047f, -0.37493783f, -0.04829629f}, {-0.12940952f, -0.22414386f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2556798f, -0.33320838f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.21326315f, -0.3693826f, -0.049572244f}, {-0.06526309f, -0.11303899f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.21f, -0.36373064f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.20673683f, -0.3580787f, -0.049572244f}, {0.06526309f, 0.11303899f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.16322455f, -0.39405888f, -0.049572244f}, {-0.04995021f, -0.12059047f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.16072704f, -0.38802937f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.15822953f, -0.38199985f, -0.049572244f}, {0.04995021f, 0.12059047f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.16567932f, -0.39998525f, -0.04829629f}, {-0.09904576f, -0.23911761f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11039313f, -0.41199276f, -0.049572244f}, {-0.03378266f, -0.1260786f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.16804937f, -0.40570703f, -0.046193976f}, {-0.1464466f, -0.35355338f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11205336f, -0.4181888f, -0.04829629f}, {-0.0669873f, -0.25f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11365628f, -0.424171f, -0.046193976f}, {-0.09904576f, -0.3696438f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17029412f, -0.41112635f, -0.04330127f}, {-0.19134171f, -0.46193975f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11517447f, -0.42983696f, -0.04330127f}, {-0.12940952f, -0.4829629f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17237519f, -0.41615048f, -0.039667666f}, {-0.2329629f, -0.5624222f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11658195f, -0.43508974f, -0.039667666f}, {-0.15755905f, -0.58801836f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17425694f, -0.42069343f, -0.03535534f}, {-0.27059805f, -0.65328145f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.117854625f, -0.43983945f, -0.03535534f}, {-0.1830127f, -0.68301266f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.1759072f, -0.42467752f, -0.030438071f}, {-0.30360317f, -0.73296285f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11897074f, -0.44400483f, -0.030438071f}, {-0.20533495f, -0.76632047f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17729771f, -0.4280345f, -0.025f}, {-0.33141357f, -0.8001031f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11991119f, -0.44751462f, -0.025f}, {-0.22414386f, -0.83651626f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.1784047f, -0.43070704f, -0.019134171f}, {-0.35355338f, -0.85355335f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.12065987f, -0.45030877f, -0.019134171f}, {-0.23911761f, -0.8923991f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17920923f, -0.4326493f, -0.012940953f}, {-0.3696438f, -0.8923991f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.121203996f, -0.45233947f, -0.012940953f}, {-0.25f, -0.93301266f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17969751f, -0.43382815f, -0.0065263095f}, {-0.37940952f, -0.91597563f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.121534236f, -0.45357195f, -0.0065263095f}, {-0.25660482f, -0.9576622f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17986122f, -0.43422335f, 0.0f}, {-0.38268343f, -0.9238795f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.121644944f, -0.45398512f, 0.0f}, {-0.25881904f, -0.9659258f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17969751f, -0.43382815f, 0.0065263095f}, {-0.37940952f, -0.91597563f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.121534236f, -0.45357195f, 0.0065263095f}, {-0.25660482f, -0.9576622f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17920923f, -0.4326493f, 0.012940953f}, {-0.3696438f, -0.8923991f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.121203996f, -0.45233947f, 0.012940953f}, {-0.25f, -0.93301266f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.1784047f, -0.43070704f, 0.019134171f}, {-0.35355338f, -0.85355335f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.12065987f, -0.45030877f, 0.019134171f}, {-0.23911761f, -0.8923991f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17729771f, -0.4280345f, 0.025f}, {-0.33141357f, -0.8001031f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11991119f, -0.44751462f, 0.025f}, {-0.22414386f, -0.83651626f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.1759072f, -0.42467752f, 0.030438071f}, {-0.30360317f, -0.73296285f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11897074f, -0.44400483f, 0.030438071f}, {-0.20533495f, -0.76632047f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17425694f, -0.42069343f, 0.03535534f}, {-0.27059805f, -0.65328145f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.117854625f, -0.43983945f, 0.03535534f}, {-0.1830127f, -0.68301266f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17237519f, -0.41615048f, 0.039667666f}, {-0.2329629f, -0.5624222f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11658195f, -0.43508974f, 0.039667666f}, {-0.15755905f, -0.58801836f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.17029412f, -0.41112635f, 0.04330127f}, {-0.19134171f, -0.46193975f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11517447f, -0.42983696f, 0.04330127f}, {-0.12940952f, -0.4829629f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.16804937f, -0.40570703f, 0.046193976f}, {-0.1464466f, -0.35355338f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11365628f, -0.424171f, 0.046193976f}, {-0.09904576f, -0.3696438f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.16567932f, -0.39998525f, 0.04829629f}, {-0.09904576f, -0.23911761f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11205336f, -0.4181888f, 0.04829629f}, {-0.0669873f, -0.25f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.16322455f, -0.39405888f, 0.049572244f}, {-0.04995021f, -0.12059047f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11039313f, -0.41199276f, 0.049572244f}, {-0.03378266f, -0.1260786f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.16072704f, -0.38802937f, 0.05f}, {6.49485e-14f, 1.5679955e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.10870399f, -0.40568882f, 0.05f}, {4.392641e-14f, 1.639356e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.15822953f, -0.38199985f, 0.049572244f}, {0.04995021f, 0.12059047f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.10701486f, -0.3993849f, 0.049572244f}, {0.03378266f, 0.1260786f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.15577476f, -0.37607348f, 0.04829629f}, {0.09904576f, 0.23911761f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.10535463f, -0.39318883f, 0.04829629f}, {0.0669873f, 0.25f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.15340471f, -0.3703517f, 0.046193976f}, {0.1464466f, 0.35355338f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.103751704f, -0.38720664f, 0.046193976f}, {0.09904576f, 0.3696438f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.15115996f, -0.3649324f, 0.04330127f}, {0.19134171f, 0.46193975f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.102233514f, -0.3815407f, 0.04330127f}, {0.12940952f, 0.4829629f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14907889f, -0.35990825f, 0.039667666f}, {0.2329629f, 0.5624222f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.10082604f, -0.3762879f, 0.039667666f}, {0.15755905f, 0.58801836f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14719714f, -0.3553653f, 0.03535534f}, {0.27059805f, 0.65328145f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.09955336f, -0.3715382f, 0.03535534f}, {0.1830127f, 0.68301266f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14554688f, -0.3513812f, 0.030438071f}, {0.30360317f, 0.73296285f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.09843725f, -0.3673728f, 0.030438071f}, {0.20533495f, 0.76632047f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14415637f, -0.34802422f, 0.025f}, {0.33141357f, 0.8001031f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.0974968f, -0.36386302f, 0.025f}, {0.22414386f, 0.83651626f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14304937f, -0.3453517f, 0.019134171f}, {0.35355338f, 0.85355335f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.09674811f, -0.36106887f, 0.019134171f}, {0.23911761f, 0.8923991f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14224485f, -0.34340942f, 0.012940953f}, {0.3696438f, 0.8923991f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.09620399f, -0.35903817f, 0.012940953f}, {0.25f, 0.93301266f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14175656f, -0.3422306f, 0.0065263095f}, {0.37940952f, 0.91597563f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.09587375f, -0.3578057f, 0.0065263095f}, {0.25660482f, 0.9576622f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14159286f, -0.34183538f, -8.485931e-15f}, {0.38268343f, 0.9238795f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.09576304f, -0.35739252f, -8.485931e-15f}, {0.25881904f, 0.9659258f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14175656f, -0.3422306f, -0.0065263095f}, {0.37940952f, 0.91597563f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.09587375f, -0.3578057f, -0.0065263095f}, {0.25660482f, 0.9576622f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14224485f, -0.34340942f, -0.012940953f}, {0.3696438f, 0.8923991f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.09620399f, -0.35903817f, -0.012940953f}, {0.25f, 0.93301266f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14304937f, -0.3453517f, -0.019134171f}, {0.35355338f, 0.85355335f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.09674811f, -0.36106887f, -0.019134171f}, {0.23911761f, 0.8923991f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14415637f, -0.34802422f, -0.025f}, {0.33141357f, 0.8001031f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.0974968f, -0.36386302f, -0.025f}, {0.22414386f, 0.83651626f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14554688f, -0.3513812f, -0.030438071f}, {0.30360317f, 0.73296285f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.09843725f, -0.3673728f, -0.030438071f}, {0.20533495f, 0.76632047f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14719714f, -0.3553653f, -0.03535534f}, {0.27059805f, 0.65328145f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.09955336f, -0.3715382f, -0.03535534f}, {0.1830127f, 0.68301266f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14907889f, -0.35990825f, -0.039667666f}, {0.2329629f, 0.5624222f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.10082604f, -0.3762879f, -0.039667666f}, {0.15755905f, 0.58801836f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.15115996f, -0.3649324f, -0.04330127f}, {0.19134171f, 0.46193975f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.102233514f, -0.3815407f, -0.04330127f}, {0.12940952f, 0.4829629f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.15340471f, -0.3703517f, -0.046193976f}, {0.1464466f, 0.35355338f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.103751704f, -0.38720664f, -0.046193976f}, {0.09904576f, 0.3696438f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.15577476f, -0.37607348f, -0.04829629f}, {0.09904576f, 0.23911761f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.10535463f, -0.39318883f, -0.04829629f}, {0.0669873f, 0.25f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.10701486f, -0.3993849f, -0.049572244f}, {0.03378266f, 0.1260786f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.10870399f, -0.40568882f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.05396914f, -0.40993637f, -0.049572244f}, {0.017037084f, 0.12940952f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.054820996f, -0.41640684f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.05567285f, -0.4228773f, -0.049572244f}, {-0.017037084f, -0.12940952f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.053131863f, -0.4035766f, -0.04829629f}, {0.03378266f, 0.25660482f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.128182e-14f, -0.42f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.052323487f, -0.39743635f, -0.046193976f}, {0.04995021f, 0.37940952f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.0174186e-14f, -0.41347367f, -0.049572244f}, {2.2152724e-14f, 0.13052619f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.90855e-14f, -0.40705904f, -0.04829629f}, {4.392641e-14f, 0.25881904f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.051557843f, -0.39162073f, -0.04330127f}, {0.06526309f, 0.49572244f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.80344e-14f, -0.40086582f, -0.046193976f}, {6.49485e-14f, 0.38268343f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.05084803f, -0.38622916f, -0.039667666f}, {0.07945931f, 0.6035534f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.7038856e-14f, -0.39499998f, -0.04330127f}, {8.485931e-14f, 0.5f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.0502062f, -0.38135397f, -0.03535534f}, {0.09229595f, 0.7010574f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.6115916e-14f, -0.38956192f, -0.039667666f}, {1.0331815e-13f, 0.6087614f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.049643327f, -0.37707853f, -0.030438071f}, {0.103553385f, 0.7865661f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.528136e-14f, -0.38464466f, -0.03535534f}, {1.2000919e-13f, 0.70710677f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.049169045f, -0.37347603f, -0.025f}, {0.11303899f, 0.8586165f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.454948e-14f, -0.38033232f, -0.030438071f}, {1.3464684e-13f, 0.7933533f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.048791472f, -0.37060806f, -0.019134171f}, {0.12059047f, 0.91597563f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.3932786e-14f, -0.37669873f, -0.025f}, {1.4698064e-13f, 0.8660254f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.048517067f, -0.36852372f, -0.012940953f}, {0.1260786f, 0.9576622f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.3441846e-14f, -0.373806f, -0.019134171f}, {1.5679955e-13f, 0.9238795f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.04835052f, -0.3672587f, -0.0065263095f}, {0.12940952f, 0.98296297f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.308504e-14f, -0.37170368f, -0.012940953f}, {1.639356e-13f, 0.9659258f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.048294686f, -0.36683458f, -8.485931e-15f}, {0.13052619f, 0.9914449f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.2868486e-14f, -0.37042773f, -0.0065263095f}, {1.6826666e-13f, 0.9914449f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.04835052f, -0.3672587f, 0.0065263095f}, {0.12940952f, 0.98296297f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.279589e-14f, -0.36999997f, -8.485931e-15f}, {1.6971862e-13f, 1.0f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.048517067f, -0.36852372f, 0.012940953f}, {0.1260786f, 0.9576622f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.2868486e-14f, -0.37042773f, 0.0065263095f}, {1.6826666e-13f, 0.9914449f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.048791472f, -0.37060806f, 0.019134171f}, {0.12059047f, 0.91597563f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.308504e-14f, -0.37170368f, 0.012940953f}, {1.639356e-13f, 0.9659258f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.049169045f, -0.37347603f, 0.025f}, {0.11303899f, 0.8586165f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.3441846e-14f, -0.373806f, 0.019134171f}, {1.5679955e-13f, 0.9238795f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.049643327f, -0.37707853f, 0.030438071f}, {0.103553385f, 0.7865661f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.3932786e-14f, -0.37669873f, 0.025f}, {1.4698064e-13f, 0.8660254f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.0502062f, -0.38135397f, 0.03535534f}, {0.09229595f, 0.7010574f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.454948e-14f, -0.38033232f, 0.030438071f}, {1.3464684e-13f, 0.7933533f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.05084803f, -0.38622916f, 0.039667666f}, {0.07945931f, 0.6035534f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.528136e-14f, -0.38464466f, 0.03535534f}, {1.2000919e-13f, 0.70710677f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.051557843f, -0.39162073f, 0.04330127f}, {0.06526309f, 0.49572244f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.6115916e-14f, -0.38956192f, 0.039667666f}, {1.0331815e-13f, 0.6087614f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.052323487f, -0.39743635f, 0.046193976f}, {0.04995021f, 0.37940952f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.7038856e-14f, -0.39499998f, 0.04330127f}, {8.485931e-14f, 0.5f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.053131863f, -0.4035766f, 0.04829629f}, {0.03378266f, 0.25660482f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.80344e-14f, -0.40086582f, 0.046193976f}, {6.49485e-14f, 0.38268343f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.05396914f, -0.40993637f, 0.049572244f}, {0.017037084f, 0.12940952f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.90855e-14f, -0.40705904f, 0.04829629f}, {4.392641e-14f, 0.25881904f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.054820996f, -0.41640684f, 0.05f}, {2.2152724e-14f, 1.6826666e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.0174186e-14f, -0.41347367f, 0.049572244f}, {2.2152724e-14f, 0.13052619f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.05567285f, -0.4228773f, 0.049572244f}, {-0.017037084f, -0.12940952f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.128182e-14f, -0.42f, 0.05f}, {2.8804412e-26f, 1.6971862e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.056510128f, -0.42923707f, 0.04829629f}, {-0.03378266f, -0.25660482f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.2389455e-14f, -0.4265263f, 0.049572244f}, {-2.2152724e-14f, -0.13052619f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.057318505f, -0.43537733f, 0.046193976f}, {-0.04995021f, -0.37940952f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.347814e-14f, -0.43294093f, 0.04829629f}, {-4.392641e-14f, -0.25881904f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.05808415f, -0.44119295f, 0.04330127f}, {-0.06526309f, -0.49572244f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.452924e-14f, -0.43913415f, 0.046193976f}, {-6.49485e-14f, -0.38268343f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.058793962f, -0.44658452f, 0.039667666f}, {-0.07945931f, -0.6035534f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.5524785e-14f, -0.445f, 0.04330127f}, {-8.485931e-14f, -0.5f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.059435792f, -0.4514597f, 0.03535534f}, {-0.09229595f, -0.7010574f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.6447725e-14f, -0.45043805f, 0.039667666f}, {-1.0331815e-13f, -0.6087614f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.059998665f, -0.45573515f, 0.030438071f}, {-0.103553385f, -0.7865661f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.728228e-14f, -0.45535532f, 0.03535534f}, {-1.2000919e-13f, -0.70710677f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.060472947f, -0.45933765f, 0.025f}, {-0.11303899f, -0.8586165f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.801416e-14f, -0.45966765f, 0.030438071f}, {-1.3464684e-13f, -0.7933533f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.06085052f, -0.46220562f, 0.019134171f}, {-0.12059047f, -0.91597563f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.8630855e-14f, -0.46330124f, 0.025f}, {-1.4698064e-13f, -0.8660254f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.061124925f, -0.46428996f, 0.012940953f}, {-0.1260786f, -0.9576622f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.9121795e-14f, -0.46619397f, 0.019134171f}, {-1.5679955e-13f, -0.9238795f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.06129147f, -0.46555498f, 0.0065263095f}, {-0.12940952f, -0.98296297f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.94786e-14f, -0.4682963f, 0.012940953f}, {-1.639356e-13f, -0.9659258f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.061347306f, -0.4659791f, 0.0f}, {-0.13052619f, -0.9914449f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.9695155e-14f, -0.46957225f, 0.0065263095f}, {-1.6826666e-13f, -0.9914449f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.06129147f, -0.46555498f, -0.0065263095f}, {-0.12940952f, -0.98296297f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.976775e-14f, -0.47f, 0.0f}, {-1.6971862e-13f, -1.0f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.061124925f, -0.46428996f, -0.012940953f}, {-0.1260786f, -0.9576622f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.9695155e-14f, -0.46957225f, -0.0065263095f}, {-1.6826666e-13f, -0.9914449f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.06085052f, -0.46220562f, -0.019134171f}, {-0.12059047f, -0.91597563f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.94786e-14f, -0.4682963f, -0.012940953f}, {-1.639356e-13f, -0.9659258f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.060472947f, -0.45933765f, -0.025f}, {-0.11303899f, -0.8586165f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.9121795e-14f, -0.46619397f, -0.019134171f}, {-1.5679955e-13f, -0.9238795f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.059998665f, -0.45573515f, -0.030438071f}, {-0.103553385f, -0.7865661f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.8630855e-14f, -0.46330124f, -0.025f}, {-1.4698064e-13f, -0.8660254f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.059435792f, -0.4514597f, -0.03535534f}, {-0.09229595f, -0.7010574f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.801416e-14f, -0.45966765f, -0.030438071f}, {-1.3464684e-13f, -0.7933533f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.058793962f, -0.44658452f, -0.039667666f}, {-0.07945931f, -0.6035534f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.728228e-14f, -0.45535532f, -0.03535534f}, {-1.2000919e-13f, -0.70710677f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.05808415f, -0.44119295f, -0.04330127f}, {-0.06526309f, -0.49572244f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.6447725e-14f, -0.45043805f, -0.039667666f}, {-1.0331815e-13f, -0.6087614f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.057318505f, -0.43537733f, -0.046193976f}, {-0.04995021f, -0.37940952f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.5524785e-14f, -0.445f, -0.04330127f}, {-8.485931e-14f, -0.5f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.056510128f, -0.42923707f, -0.04829629f}, {-0.03378266f, -0.25660482f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.452924e-14f, -0.43913415f, -0.046193976f}, {-6.49485e-14f, -0.38268343f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.347814e-14f, -0.43294093f, -0.04829629f}, {-4.392641e-14f, -0.25881904f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.2389455e-14f, -0.4265263f, -0.049572244f}, {-2.2152724e-14f, -0.13052619f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.057318505f, -0.43537733f, -0.046193976f}, {0.04995021f, -0.37940952f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.056510128f, -0.42923707f, -0.04829629f}, {0.03378266f, -0.25660482f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.05567285f, -0.4228773f, -0.049572244f}, {0.017037084f, -0.12940952f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.05808415f, -0.44119295f, -0.04330127f}, {0.06526309f, -0.49572244f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11365628f, -0.424171f, -0.046193976f}, {0.09904576f, -0.3696438f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.058793962f, -0.44658452f, -0.039667666f}, {0.07945931f, -0.6035534f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11517447f, -0.42983696f, -0.04330127f}, {0.12940952f, -0.4829629f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11658195f, -0.43508974f, -0.039667666f}, {0.15755905f, -0.58801836f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.059435792f, -0.4514597f, -0.03535534f}, {0.09229595f, -0.7010574f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.117854625f, -0.43983945f, -0.03535534f}, {0.1830127f, -0.68301266f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.059998665f, -0.45573515f, -0.030438071f}, {0.103553385f, -0.7865661f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11897074f, -0.44400483f, -0.030438071f}, {0.20533495f, -0.76632047f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.060472947f, -0.45933765f, -0.025f}, {0.11303899f, -0.8586165f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11991119f, -0.44751462f, -0.025f}, {0.22414386f, -0.83651626f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.06085052f, -0.46220562f, -0.019134171f}, {0.12059047f, -0.91597563f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.12065987f, -0.45030877f, -0.019134171f}, {0.23911761f, -0.8923991f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.061124925f, -0.46428996f, -0.012940953f}, {0.1260786f, -0.9576622f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.121203996f, -0.45233947f, -0.012940953f}, {0.25f, -0.93301266f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.06129147f, -0.46555498f, -0.0065263095f}, {0.12940952f, -0.98296297f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.121534236f, -0.45357195f, -0.0065263095f}, {0.25660482f, -0.9576622f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.061347306f, -0.4659791f, 0.0f}, {0.13052619f, -0.9914449f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.121644944f, -0.45398512f, 0.0f}, {0.25881904f, -0.9659258f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.06129147f, -0.46555498f, 0.0065263095f}, {0.12940952f, -0.98296297f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.121534236f, -0.45357195f, 0.0065263095f}, {0.25660482f, -0.9576622f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.061124925f, -0.46428996f, 0.012940953f}, {0.1260786f, -0.9576622f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.121203996f, -0.45233947f, 0.012940953f}, {0.25f, -0.93301266f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.06085052f, -0.46220562f, 0.019134171f}, {0.12059047f, -0.91597563f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.12065987f, -0.45030877f, 0.019134171f}, {0.23911761f, -0.8923991f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.060472947f, -0.45933765f, 0.025f}, {0.11303899f, -0.8586165f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11991119f, -0.44751462f, 0.025f}, {0.22414386f, -0.83651626f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.059998665f, -0.45573515f, 0.030438071f}, {0.103553385f, -0.7865661f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11897074f, -0.44400483f, 0.030438071f}, {0.20533495f, -0.76632047f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.059435792f, -0.4514597f, 0.03535534f}, {0.09229595f, -0.7010574f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.117854625f, -0.43983945f, 0.03535534f}, {0.1830127f, -0.68301266f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.058793962f, -0.44658452f, 0.039667666f}, {0.07945931f, -0.6035534f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11658195f, -0.43508974f, 0.039667666f}, {0.15755905f, -0.58801836f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.05808415f, -0.44119295f, 0.04330127f}, {0.06526309f, -0.49572244f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11517447f, -0.42983696f, 0.04330127f}, {0.12940952f, -0.4829629f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.057318505f, -0.43537733f, 0.046193976f}, {0.04995021f, -0.37940952f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11365628f, -0.424171f, 0.046193976f}, {0.09904576f, -0.3696438f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.056510128f, -0.42923707f, 0.04829629f}, {0.03378266f, -0.25660482f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11205336f, -0.4181888f, 0.04829629f}, {0.0669873f, -0.25f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.05567285f, -0.4228773f, 0.049572244f}, {0.017037084f, -0.12940952f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11039313f, -0.41199276f, 0.049572244f}, {0.03378266f, -0.1260786f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.054820996f, -0.41640684f, 0.05f}, {-2.2152724e-14f, 1.6826666e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.10870399f, -0.40568882f, 0.05f}, {-4.392641e-14f, 1.639356e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.05396914f, -0.40993637f, 0.049572244f}, {-0.017037084f, 0.12940952f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.10701486f, -0.3993849f, 0.049572244f}, {-0.03378266f, 0.1260786f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.053131863f, -0.4035766f, 0.04829629f}, {-0.03378266f, 0.25660482f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.10535463f, -0.39318883f, 0.04829629f}, {-0.0669873f, 0.25f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.052323487f, -0.39743635f, 0.046193976f}, {-0.04995021f, 0.37940952f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.103751704f, -0.38720664f, 0.046193976f}, {-0.09904576f, 0.3696438f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.051557843f, -0.39162073f, 0.04330127f}, {-0.06526309f, 0.49572244f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.102233514f, -0.3815407f, 0.04330127f}, {-0.12940952f, 0.4829629f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.05084803f, -0.38622916f, 0.039667666f}, {-0.07945931f, 0.6035534f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.10082604f, -0.3762879f, 0.039667666f}, {-0.15755905f, 0.58801836f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0502062f, -0.38135397f, 0.03535534f}, {-0.09229595f, 0.7010574f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.09955336f, -0.3715382f, 0.03535534f}, {-0.1830127f, 0.68301266f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.049643327f, -0.37707853f, 0.030438071f}, {-0.103553385f, 0.7865661f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.09843725f, -0.3673728f, 0.030438071f}, {-0.20533495f, 0.76632047f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.049169045f, -0.37347603f, 0.025f}, {-0.11303899f, 0.8586165f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0974968f, -0.36386302f, 0.025f}, {-0.22414386f, 0.83651626f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.048791472f, -0.37060806f, 0.019134171f}, {-0.12059047f, 0.91597563f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.09674811f, -0.36106887f, 0.019134171f}, {-0.23911761f, 0.8923991f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.048517067f, -0.36852372f, 0.012940953f}, {-0.1260786f, 0.9576622f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.09620399f, -0.35903817f, 0.012940953f}, {-0.25f, 0.93301266f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.04835052f, -0.3672587f, 0.0065263095f}, {-0.12940952f, 0.98296297f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.09587375f, -0.3578057f, 0.0065263095f}, {-0.25660482f, 0.9576622f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.048294686f, -0.36683458f, -8.485931e-15f}, {-0.13052619f, 0.9914449f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.09576304f, -0.35739252f, -8.485931e-15f}, {-0.25881904f, 0.9659258f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.04835052f, -0.3672587f, -0.0065263095f}, {-0.12940952f, 0.98296297f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.09587375f, -0.3578057f, -0.0065263095f}, {-0.25660482f, 0.9576622f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.048517067f, -0.36852372f, -0.012940953f}, {-0.1260786f, 0.9576622f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.09620399f, -0.35903817f, -0.012940953f}, {-0.25f, 0.93301266f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.048791472f, -0.37060806f, -0.019134171f}, {-0.12059047f, 0.91597563f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.09674811f, -0.36106887f, -0.019134171f}, {-0.23911761f, 0.8923991f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.049169045f, -0.37347603f, -0.025f}, {-0.11303899f, 0.8586165f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0974968f, -0.36386302f, -0.025f}, {-0.22414386f, 0.83651626f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.049643327f, -0.37707853f, -0.030438071f}, {-0.103553385f, 0.7865661f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.09843725f, -0.3673728f, -0.030438071f}, {-0.20533495f, 0.76632047f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0502062f, -0.38135397f, -0.03535534f}, {-0.09229595f, 0.7010574f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.09955336f, -0.3715382f, -0.03535534f}, {-0.1830127f, 0.68301266f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.05084803f, -0.38622916f, -0.039667666f}, {-0.07945931f, 0.6035534f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.10082604f, -0.3762879f, -0.039667666f}, {-0.15755905f, 0.58801836f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.051557843f, -0.39162073f, -0.04330127f}, {-0.06526309f, 0.49572244f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.102233514f, -0.3815407f, -0.04330127f}, {-0.12940952f, 0.4829629f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.052323487f, -0.39743635f, -0.046193976f}, {-0.04995021f, 0.37940952f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.103751704f, -0.38720664f, -0.046193976f}, {-0.09904576f, 0.3696438f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.053131863f, -0.4035766f, -0.04829629f}, {-0.03378266f, 0.25660482f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.10535463f, -0.39318883f, -0.04829629f}, {-0.0669873f, 0.25f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.05396914f, -0.40993637f, -0.049572244f}, {-0.017037084f, 0.12940952f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.10701486f, -0.3993849f, -0.049572244f}, {-0.03378266f, 0.1260786f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.054820996f, -0.41640684f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.10870399f, -0.40568882f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11039313f, -0.41199276f, -0.049572244f}, {0.03378266f, -0.1260786f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11205336f, -0.4181888f, -0.04829629f}, {0.0669873f, -0.25f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.16322455f, -0.39405888f, -0.049572244f}, {0.04995021f, -0.12059047f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.16567932f, -0.39998525f, -0.04829629f}, {0.09904576f, -0.23911761f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.16804937f, -0.40570703f, -0.046193976f}, {0.1464466f, -0.35355338f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.16072704f, -0.38802937f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.21647047f, -0.37493783f, -0.04829629f}, {0.12940952f, -0.22414386f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.15822953f, -0.38199985f, -0.049572244f}, {-0.04995021f, 0.12059047f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.21326315f, -0.3693826f, -0.049572244f}, {0.06526309f, -0.11303899f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.21f, -0.36373064f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.15577476f, -0.37607348f, -0.04829629f}, {-0.09904576f, 0.23911761f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.20673683f, -0.3580787f, -0.049572244f}, {-0.06526309f, 0.11303899f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.15340471f, -0.3703517f, -0.046193976f}, {-0.1464466f, 0.35355338f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.20352952f, -0.35252345f, -0.04829629f}, {-0.12940952f, 0.22414386f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.15115996f, -0.3649324f, -0.04330127f}, {-0.19134171f, 0.46193975f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.20043291f, -0.34715995f, -0.046193976f}, {-0.19134171f, 0.33141357f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14907889f, -0.35990825f, -0.039667666f}, {-0.2329629f, 0.5624222f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.19749999f, -0.34208f, -0.04330127f}, {-0.25f, 0.4330127f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14719714f, -0.3553653f, -0.03535534f}, {-0.27059805f, 0.65328145f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.19478096f, -0.33737049f, -0.039667666f}, {-0.3043807f, 0.52720284f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14554688f, -0.3513812f, -0.030438071f}, {-0.30360317f, 0.73296285f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.19232233f, -0.33311203f, -0.03535534f}, {-0.35355338f, 0.6123724f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14415637f, -0.34802422f, -0.025f}, {-0.33141357f, 0.8001031f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.19016616f, -0.32937744f, -0.030438071f}, {-0.39667666f, 0.6870641f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14304937f, -0.3453517f, -0.019134171f}, {-0.35355338f, 0.85355335f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.18834937f, -0.32623065f, -0.025f}, {-0.4330127f, 0.75f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14224485f, -0.34340942f, -0.012940953f}, {-0.3696438f, 0.8923991f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.186903f, -0.3237255f, -0.019134171f}, {-0.46193975f, 0.8001031f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14175656f, -0.3422306f, -0.0065263095f}, {-0.37940952f, 0.91597563f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.18585184f, -0.32190484f, -0.012940953f}, {-0.4829629f, 0.83651626f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14159286f, -0.34183538f, -8.485931e-15f}, {-0.38268343f, 0.9238795f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.18521386f, -0.32079983f, -0.0065263095f}, {-0.49572244f, 0.8586165f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14175656f, -0.3422306f, 0.0065263095f}, {-0.37940952f, 0.91597563f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.18499999f, -0.32042938f, -8.485931e-15f}, {-0.5f, 0.8660254f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14224485f, -0.34340942f, 0.012940953f}, {-0.3696438f, 0.8923991f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.18521386f, -0.32079983f, 0.0065263095f}, {-0.49572244f, 0.8586165f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14304937f, -0.3453517f, 0.019134171f}, {-0.35355338f, 0.85355335f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.18585184f, -0.32190484f, 0.012940953f}, {-0.4829629f, 0.83651626f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14415637f, -0.34802422f, 0.025f}, {-0.33141357f, 0.8001031f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.186903f, -0.3237255f, 0.019134171f}, {-0.46193975f, 0.8001031f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14554688f, -0.3513812f, 0.030438071f}, {-0.30360317f, 0.73296285f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.18834937f, -0.32623065f, 0.025f}, {-0.4330127f, 0.75f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14719714f, -0.3553653f, 0.03535534f}, {-0.27059805f, 0.65328145f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.19016616f, -0.32937744f, 0.030438071f}, {-0.39667666f, 0.6870641f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14907889f, -0.35990825f, 0.039667666f}, {-0.2329629f, 0.5624222f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.19232233f, -0.33311203f, 0.03535534f}, {-0.35355338f, 0.6123724f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.15115996f, -0.3649324f, 0.04330127f}, {-0.19134171f, 0.46193975f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.19478096f, -0.33737049f, 0.039667666f}, {-0.3043807f, 0.52720284f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.15340471f, -0.3703517f, 0.046193976f}, {-0.1464466f, 0.35355338f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.19749999f, -0.34208f, 0.04330127f}, {-0.25f, 0.4330127f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.15577476f, -0.37607348f, 0.04829629f}, {-0.09904576f, 0.23911761f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.20043291f, -0.34715995f, 0.046193976f}, {-0.19134171f, 0.33141357f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.15822953f, -0.38199985f, 0.049572244f}, {-0.04995021f, 0.12059047f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.20352952f, -0.35252345f, 0.04829629f}, {-0.12940952f, 0.22414386f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.16072704f, -0.38802937f, 0.05f}, {-6.49485e-14f, 1.5679955e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.20673683f, -0.3580787f, 0.049572244f}, {-0.06526309f, 0.11303899f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.16322455f, -0.39405888f, 0.049572244f}, {0.04995021f, -0.12059047f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.21f, -0.36373064f, 0.05f}, {-8.485931e-14f, 1.4698064e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.16567932f, -0.39998525f, 0.04829629f}, {0.09904576f, -0.23911761f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.21326315f, -0.3693826f, 0.049572244f}, {0.06526309f, -0.11303899f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.16804937f, -0.40570703f, 0.046193976f}, {0.1464466f, -0.35355338f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.21647047f, -0.37493783f, 0.04829629f}, {0.12940952f, -0.22414386f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17029412f, -0.41112635f, 0.04330127f}, {0.19134171f, -0.46193975f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.21956708f, -0.38030133f, 0.046193976f}, {0.19134171f, -0.33141357f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17237519f, -0.41615048f, 0.039667666f}, {0.2329629f, -0.5624222f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2225f, -0.38538128f, 0.04330127f}, {0.25f, -0.4330127f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17425694f, -0.42069343f, 0.03535534f}, {0.27059805f, -0.65328145f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22521903f, -0.3900908f, 0.039667666f}, {0.3043807f, -0.52720284f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.1759072f, -0.42467752f, 0.030438071f}, {0.30360317f, -0.73296285f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22767766f, -0.39434925f, 0.03535534f}, {0.35355338f, -0.6123724f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17729771f, -0.4280345f, 0.025f}, {0.33141357f, -0.8001031f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22983383f, -0.39808384f, 0.030438071f}, {0.39667666f, -0.6870641f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.1784047f, -0.43070704f, 0.019134171f}, {0.35355338f, -0.85355335f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23165062f, -0.40123063f, 0.025f}, {0.4330127f, -0.75f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17920923f, -0.4326493f, 0.012940953f}, {0.3696438f, -0.8923991f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23309699f, -0.4037358f, 0.019134171f}, {0.46193975f, -0.8001031f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17969751f, -0.43382815f, 0.0065263095f}, {0.37940952f, -0.91597563f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23414814f, -0.40555644f, 0.012940953f}, {0.4829629f, -0.83651626f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17986122f, -0.43422335f, 0.0f}, {0.38268343f, -0.9238795f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23478612f, -0.40666145f, 0.0065263095f}, {0.49572244f, -0.8586165f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17969751f, -0.43382815f, -0.0065263095f}, {0.37940952f, -0.91597563f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.235f, -0.4070319f, 0.0f}, {0.5f, -0.8660254f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17920923f, -0.4326493f, -0.012940953f}, {0.3696438f, -0.8923991f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23478612f, -0.40666145f, -0.0065263095f}, {0.49572244f, -0.8586165f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.1784047f, -0.43070704f, -0.019134171f}, {0.35355338f, -0.85355335f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23414814f, -0.40555644f, -0.012940953f}, {0.4829629f, -0.83651626f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17729771f, -0.4280345f, -0.025f}, {0.33141357f, -0.8001031f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23309699f, -0.4037358f, -0.019134171f}, {0.46193975f, -0.8001031f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.1759072f, -0.42467752f, -0.030438071f}, {0.30360317f, -0.73296285f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23165062f, -0.40123063f, -0.025f}, {0.4330127f, -0.75f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17425694f, -0.42069343f, -0.03535534f}, {0.27059805f, -0.65328145f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22983383f, -0.39808384f, -0.030438071f}, {0.39667666f, -0.6870641f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17237519f, -0.41615048f, -0.039667666f}, {0.2329629f, -0.5624222f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22767766f, -0.39434925f, -0.03535534f}, {0.35355338f, -0.6123724f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17029412f, -0.41112635f, -0.04330127f}, {0.19134171f, -0.46193975f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22521903f, -0.3900908f, -0.039667666f}, {0.3043807f, -0.52720284f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2225f, -0.38538128f, -0.04330127f}, {0.25f, -0.4330127f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.21956708f, -0.38030133f, -0.046193976f}, {0.19134171f, -0.33141357f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27420932f, -0.35735652f, -0.039667666f}, {0.37059048f, -0.4829629f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27089882f, -0.35304222f, -0.04330127f}, {0.3043807f, -0.39667666f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.26732793f, -0.34838855f, -0.046193976f}, {0.2329629f, -0.30360317f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27720276f, -0.36125767f, -0.03535534f}, {0.43045932f, -0.5609855f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3185078f, -0.3185078f, -0.039667666f}, {0.43045932f, -0.43045932f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27982792f, -0.36467886f, -0.030438071f}, {0.4829629f, -0.6294095f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32198483f, -0.32198483f, -0.03535534f}, {0.49999997f, -0.49999997f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32503408f, -0.32503408f, -0.030438071f}, {0.5609855f, -0.5609855f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.28203994f, -0.36756158f, -0.025f}, {0.52720284f, -0.6870641f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32760343f, -0.32760343f, -0.025f}, {0.6123724f, -0.6123724f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2838009f, -0.36985654f, -0.019134171f}, {0.5624222f, -0.73296285f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32964888f, -0.32964888f, -0.019134171f}, {0.65328145f, -0.65328145f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2850807f, -0.3715244f, -0.012940953f}, {0.58801836f, -0.76632047f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33113545f, -0.33113545f, -0.012940953f}, {0.68301266f, -0.68301266f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.28585747f, -0.3725367f, -0.0065263095f}, {0.6035534f, -0.7865661f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3320377f, -0.3320377f, -0.0065263095f}, {0.7010574f, -0.7010574f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.28611785f, -0.37287605f, 0.0f}, {0.6087614f, -0.7933533f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33234015f, -0.33234015f, 0.0f}, {0.70710677f, -0.70710677f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.28585747f, -0.3725367f, 0.0065263095f}, {0.6035534f, -0.7865661f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3320377f, -0.3320377f, 0.0065263095f}, {0.7010574f, -0.7010574f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2850807f, -0.3715244f, 0.012940953f}, {0.58801836f, -0.76632047f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33113545f, -0.33113545f, 0.012940953f}, {0.68301266f, -0.68301266f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2838009f, -0.36985654f, 0.019134171f}, {0.5624222f, -0.73296285f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32964888f, -0.32964888f, 0.019134171f}, {0.65328145f, -0.65328145f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.28203994f, -0.36756158f, 0.025f}, {0.52720284f, -0.6870641f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32760343f, -0.32760343f, 0.025f}, {0.6123724f, -0.6123724f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27982792f, -0.36467886f, 0.030438071f}, {0.4829629f, -0.6294095f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32503408f, -0.32503408f, 0.030438071f}, {0.5609855f, -0.5609855f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27720276f, -0.36125767f, 0.03535534f}, {0.43045932f, -0.5609855f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32198483f, -0.32198483f, 0.03535534f}, {0.49999997f, -0.49999997f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27420932f, -0.35735652f, 0.039667666f}, {0.37059048f, -0.4829629f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3185078f, -0.3185078f, 0.039667666f}, {0.43045932f, -0.43045932f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27089882f, -0.35304222f, 0.04330127f}, {0.3043807f, -0.39667666f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3146625f, -0.3146625f, 0.04330127f}, {0.35355338f, -0.35355338f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.26732793f, -0.34838855f, 0.046193976f}, {0.2329629f, -0.30360317f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.31051472f, -0.31051472f, 0.046193976f}, {0.27059805f, -0.27059805f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.26355773f, -0.34347513f, 0.04829629f}, {0.15755905f, -0.20533495f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.30613545f, -0.30613545f, 0.04829629f}, {0.1830127f, -0.1830127f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.25965276f, -0.33838606f, 0.049572244f}, {0.07945931f, -0.103553385f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.30159962f, -0.30159962f, 0.049572244f}, {0.09229595f, -0.09229595f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2556798f, -0.33320838f, 0.05f}, {-1.0331815e-13f, 1.3464684e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29698482f, -0.29698482f, 0.05f}, {-1.2000919e-13f, 1.2000919e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2517068f, -0.3280307f, 0.049572244f}, {-0.07945931f, 0.103553385f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29237002f, -0.29237002f, 0.049572244f}, {-0.09229595f, 0.09229595f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.24780184f, -0.32294163f, 0.04829629f}, {-0.15755905f, 0.20533495f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2878342f, -0.2878342f, 0.04829629f}, {-0.1830127f, 0.1830127f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.24403164f, -0.3180282f, 0.046193976f}, {-0.2329629f, 0.30360317f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.28345492f, -0.28345492f, 0.046193976f}, {-0.27059805f, 0.27059805f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.24046075f, -0.31337455f, 0.04330127f}, {-0.3043807f, 0.39667666f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27930716f, -0.27930716f, 0.04330127f}, {-0.35355338f, 0.35355338f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23715027f, -0.30906025f, 0.039667666f}, {-0.37059048f, 0.4829629f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27546185f, -0.27546185f, 0.039667666f}, {-0.43045932f, 0.43045932f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23415682f, -0.3051591f, 0.03535534f}, {-0.43045932f, 0.5609855f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27198482f, -0.27198482f, 0.03535534f}, {-0.49999997f, 0.49999997f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23153163f, -0.3017379f, 0.030438071f}, {-0.4829629f, 0.6294095f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.26893556f, -0.26893556f, 0.030438071f}, {-0.5609855f, 0.5609855f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22931965f, -0.2988552f, 0.025f}, {-0.52720284f, 0.6870641f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2663662f, -0.2663662f, 0.025f}, {-0.6123724f, 0.6123724f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22755867f, -0.29656023f, 0.019134171f}, {-0.5624222f, 0.73296285f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.26432076f, -0.26432076f, 0.019134171f}, {-0.65328145f, 0.65328145f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22627887f, -0.29489237f, 0.012940953f}, {-0.58801836f, 0.76632047f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2628342f, -0.2628342f, 0.012940953f}, {-0.68301266f, 0.68301266f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22550212f, -0.29388008f, 0.0065263095f}, {-0.6035534f, 0.7865661f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.26193196f, -0.26193196f, 0.0065263095f}, {-0.7010574f, 0.7010574f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22524172f, -0.29354072f, -8.485931e-15f}, {-0.6087614f, 0.7933533f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2616295f, -0.2616295f, -8.485931e-15f}, {-0.70710677f, 0.70710677f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22550212f, -0.29388008f, -0.0065263095f}, {-0.6035534f, 0.7865661f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.26193196f, -0.26193196f, -0.0065263095f}, {-0.7010574f, 0.7010574f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22627887f, -0.29489237f, -0.012940953f}, {-0.58801836f, 0.76632047f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2628342f, -0.2628342f, -0.012940953f}, {-0.68301266f, 0.68301266f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22755867f, -0.29656023f, -0.019134171f}, {-0.5624222f, 0.73296285f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.26432076f, -0.26432076f, -0.019134171f}, {-0.65328145f, 0.65328145f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22931965f, -0.2988552f, -0.025f}, {-0.52720284f, 0.6870641f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2663662f, -0.2663662f, -0.025f}, {-0.6123724f, 0.6123724f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23153163f, -0.3017379f, -0.030438071f}, {-0.4829629f, 0.6294095f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.26893556f, -0.26893556f, -0.030438071f}, {-0.5609855f, 0.5609855f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23415682f, -0.3051591f, -0.03535534f}, {-0.43045932f, 0.5609855f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27198482f, -0.27198482f, -0.03535534f}, {-0.49999997f, 0.49999997f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23715027f, -0.30906025f, -0.039667666f}, {-0.37059048f, 0.4829629f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27546185f, -0.27546185f, -0.039667666f}, {-0.43045932f, 0.43045932f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.24046075f, -0.31337455f, -0.04330127f}, {-0.3043807f, 0.39667666f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27930716f, -0.27930716f, -0.04330127f}, {-0.35355338f, 0.35355338f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.24403164f, -0.3180282f, -0.046193976f}, {-0.2329629f, 0.30360317f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.28345492f, -0.28345492f, -0.046193976f}, {-0.27059805f, 0.27059805f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.24780184f, -0.32294163f, -0.04829629f}, {-0.15755905f, 0.20533495f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2878342f, -0.2878342f, -0.04829629f}, {-0.1830127f, 0.1830127f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2517068f, -0.3280307f, -0.049572244f}, {-0.07945931f, 0.103553385f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29237002f, -0.29237002f, -0.049572244f}, {-0.09229595f, 0.09229595f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2556798f, -0.33320838f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29698482f, -0.29698482f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.25965276f, -0.33838606f, -0.049572244f}, {0.07945931f, -0.103553385f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.30159962f, -0.30159962f, -0.049572244f}, {0.09229595f, -0.09229595f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.26355773f, -0.34347513f, -0.04829629f}, {0.15755905f, -0.20533495f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.30613545f, -0.30613545f, -0.04829629f}, {0.1830127f, -0.1830127f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.31051472f, -0.31051472f, -0.046193976f}, {0.27059805f, -0.27059805f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3146625f, -0.3146625f, -0.04330127f}, {0.35355338f, -0.35355338f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34838855f, -0.26732793f, -0.046193976f}, {0.30360317f, -0.2329629f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.35304222f, -0.27089882f, -0.04330127f}, {0.39667666f, -0.3043807f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.35735652f, -0.27420932f, -0.039667666f}, {0.4829629f, -0.37059048f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34347513f, -0.26355773f, -0.04829629f}, {0.20533495f, -0.15755905f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38538128f, -0.2225f, -0.04330127f}, {0.4330127f, -0.25f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33838606f, -0.25965276f, -0.049572244f}, {0.103553385f, -0.07945931f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38030133f, -0.21956708f, -0.046193976f}, {0.33141357f, -0.19134171f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37493783f, -0.21647047f, -0.04829629f}, {0.22414386f, -0.12940952f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33320838f, -0.2556798f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3693826f, -0.21326315f, -0.049572244f}, {0.11303899f, -0.06526309f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3280307f, -0.2517068f, -0.049572244f}, {-0.103553385f, 0.07945931f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36373064f, -0.21f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32294163f, -0.24780184f, -0.04829629f}, {-0.20533495f, 0.15755905f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3580787f, -0.20673683f, -0.049572244f}, {-0.11303899f, 0.06526309f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3180282f, -0.24403164f, -0.046193976f}, {-0.30360317f, 0.2329629f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.35252345f, -0.20352952f, -0.04829629f}, {-0.22414386f, 0.12940952f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.31337455f, -0.24046075f, -0.04330127f}, {-0.39667666f, 0.3043807f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34715995f, -0.20043291f, -0.046193976f}, {-0.33141357f, 0.19134171f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.30906025f, -0.23715027f, -0.039667666f}, {-0.4829629f, 0.37059048f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34208f, -0.19749999f, -0.04330127f}, {-0.4330127f, 0.25f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3051591f, -0.23415682f, -0.03535534f}, {-0.5609855f, 0.43045932f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33737049f, -0.19478096f, -0.039667666f}, {-0.52720284f, 0.3043807f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3017379f, -0.23153163f, -0.030438071f}, {-0.6294095f, 0.4829629f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33311203f, -0.19232233f, -0.03535534f}, {-0.6123724f, 0.35355338f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2988552f, -0.22931965f, -0.025f}, {-0.6870641f, 0.52720284f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32937744f, -0.19016616f, -0.030438071f}, {-0.6870641f, 0.39667666f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29656023f, -0.22755867f, -0.019134171f}, {-0.73296285f, 0.5624222f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32623065f, -0.18834937f, -0.025f}, {-0.75f, 0.4330127f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29489237f, -0.22627887f, -0.012940953f}, {-0.76632047f, 0.58801836f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3237255f, -0.186903f, -0.019134171f}, {-0.8001031f, 0.46193975f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29388008f, -0.22550212f, -0.0065263095f}, {-0.7865661f, 0.6035534f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32190484f, -0.18585184f, -0.012940953f}, {-0.83651626f, 0.4829629f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29354072f, -0.22524172f, -8.485931e-15f}, {-0.7933533f, 0.6087614f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32079983f, -0.18521386f, -0.0065263095f}, {-0.8586165f, 0.49572244f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29388008f, -0.22550212f, 0.0065263095f}, {-0.7865661f, 0.6035534f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32042938f, -0.18499999f, -8.485931e-15f}, {-0.8660254f, 0.5f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29489237f, -0.22627887f, 0.012940953f}, {-0.76632047f, 0.58801836f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32079983f, -0.18521386f, 0.0065263095f}, {-0.8586165f, 0.49572244f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29656023f, -0.22755867f, 0.019134171f}, {-0.73296285f, 0.5624222f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32190484f, -0.18585184f, 0.012940953f}, {-0.83651626f, 0.4829629f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2988552f, -0.22931965f, 0.025f}, {-0.6870641f, 0.52720284f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3237255f, -0.186903f, 0.019134171f}, {-0.8001031f, 0.46193975f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3017379f, -0.23153163f, 0.030438071f}, {-0.6294095f, 0.4829629f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32623065f, -0.18834937f, 0.025f}, {-0.75f, 0.4330127f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3051591f, -0.23415682f, 0.03535534f}, {-0.5609855f, 0.43045932f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32937744f, -0.19016616f, 0.030438071f}, {-0.6870641f, 0.39667666f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.30906025f, -0.23715027f, 0.039667666f}, {-0.4829629f, 0.37059048f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33311203f, -0.19232233f, 0.03535534f}, {-0.6123724f, 0.35355338f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.31337455f, -0.24046075f, 0.04330127f}, {-0.39667666f, 0.3043807f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33737049f, -0.19478096f, 0.039667666f}, {-0.52720284f, 0.3043807f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3180282f, -0.24403164f, 0.046193976f}, {-0.30360317f, 0.2329629f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34208f, -0.19749999f, 0.04330127f}, {-0.4330127f, 0.25f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32294163f, -0.24780184f, 0.04829629f}, {-0.20533495f, 0.15755905f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34715995f, -0.20043291f, 0.046193976f}, {-0.33141357f, 0.19134171f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3280307f, -0.2517068f, 0.049572244f}, {-0.103553385f, 0.07945931f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.35252345f, -0.20352952f, 0.04829629f}, {-0.22414386f, 0.12940952f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33320838f, -0.2556798f, 0.05f}, {-1.3464684e-13f, 1.0331815e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3580787f, -0.20673683f, 0.049572244f}, {-0.11303899f, 0.06526309f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33838606f, -0.25965276f, 0.049572244f}, {0.103553385f, -0.07945931f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36373064f, -0.21f, 0.05f}, {-1.4698064e-13f, 8.485931e-14f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34347513f, -0.26355773f, 0.04829629f}, {0.20533495f, -0.15755905f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3693826f, -0.21326315f, 0.049572244f}, {0.11303899f, -0.06526309f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34838855f, -0.26732793f, 0.046193976f}, {0.30360317f, -0.2329629f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37493783f, -0.21647047f, 0.04829629f}, {0.22414386f, -0.12940952f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.35304222f, -0.27089882f, 0.04330127f}, {0.39667666f, -0.3043807f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38030133f, -0.21956708f, 0.046193976f}, {0.33141357f, -0.19134171f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.35735652f, -0.27420932f, 0.039667666f}, {0.4829629f, -0.37059048f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38538128f, -0.2225f, 0.04330127f}, {0.4330127f, -0.25f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36125767f, -0.27720276f, 0.03535534f}, {0.5609855f, -0.43045932f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3900908f, -0.22521903f, 0.039667666f}, {0.52720284f, -0.3043807f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36467886f, -0.27982792f, 0.030438071f}, {0.6294095f, -0.4829629f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39434925f, -0.22767766f, 0.03535534f}, {0.6123724f, -0.35355338f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36756158f, -0.28203994f, 0.025f}, {0.6870641f, -0.52720284f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39808384f, -0.22983383f, 0.030438071f}, {0.6870641f, -0.39667666f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36985654f, -0.2838009f, 0.019134171f}, {0.73296285f, -0.5624222f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40123063f, -0.23165062f, 0.025f}, {0.75f, -0.4330127f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3715244f, -0.2850807f, 0.012940953f}, {0.76632047f, -0.58801836f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4037358f, -0.23309699f, 0.019134171f}, {0.8001031f, -0.46193975f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3725367f, -0.28585747f, 0.0065263095f}, {0.7865661f, -0.6035534f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40555644f, -0.23414814f, 0.012940953f}, {0.83651626f, -0.4829629f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37287605f, -0.28611785f, 0.0f}, {0.7933533f, -0.6087614f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40666145f, -0.23478612f, 0.0065263095f}, {0.8586165f, -0.49572244f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3725367f, -0.28585747f, -0.0065263095f}, {0.7865661f, -0.6035534f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4070319f, -0.235f, 0.0f}, {0.8660254f, -0.5f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3715244f, -0.2850807f, -0.012940953f}, {0.76632047f, -0.58801836f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40666145f, -0.23478612f, -0.0065263095f}, {0.8586165f, -0.49572244f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36985654f, -0.2838009f, -0.019134171f}, {0.73296285f, -0.5624222f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40555644f, -0.23414814f, -0.012940953f}, {0.83651626f, -0.4829629f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36756158f, -0.28203994f, -0.025f}, {0.6870641f, -0.52720284f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4037358f, -0.23309699f, -0.019134171f}, {0.8001031f, -0.46193975f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36467886f, -0.27982792f, -0.030438071f}, {0.6294095f, -0.4829629f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40123063f, -0.23165062f, -0.025f}, {0.75f, -0.4330127f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36125767f, -0.27720276f, -0.03535534f}, {0.5609855f, -0.43045932f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39808384f, -0.22983383f, -0.030438071f}, {0.6870641f, -0.39667666f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39434925f, -0.22767766f, -0.03535534f}, {0.6123724f, -0.35355338f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3900908f, -0.22521903f, -0.039667666f}, {0.52720284f, -0.3043807f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.42467752f, -0.1759072f, -0.030438071f}, {0.73296285f, -0.30360317f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.42069343f, -0.17425694f, -0.03535534f}, {0.65328145f, -0.27059805f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.41615048f, -0.17237519f, -0.039667666f}, {0.5624222f, -0.2329629f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4280345f, -0.17729771f, -0.025f}, {0.8001031f, -0.33141357f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.44400483f, -0.11897074f, -0.030438071f}, {0.76632047f, -0.20533495f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43070704f, -0.1784047f, -0.019134171f}, {0.85355335f, -0.35355338f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.44751462f, -0.11991119f, -0.025f}, {0.83651626f, -0.22414386f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45030877f, -0.12065987f, -0.019134171f}, {0.8923991f, -0.23911761f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4326493f, -0.17920923f, -0.012940953f}, {0.8923991f, -0.3696438f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45233947f, -0.121203996f, -0.012940953f}, {0.93301266f, -0.25f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43382815f, -0.17969751f, -0.0065263095f}, {0.91597563f, -0.37940952f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45357195f, -0.121534236f, -0.0065263095f}, {0.9576622f, -0.25660482f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43422335f, -0.17986122f, 0.0f}, {0.9238795f, -0.38268343f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45398512f, -0.121644944f, 0.0f}, {0.9659258f, -0.25881904f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43382815f, -0.17969751f, 0.0065263095f}, {0.91597563f, -0.37940952f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45357195f, -0.121534236f, 0.0065263095f}, {0.9576622f, -0.25660482f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4326493f, -0.17920923f, 0.012940953f}, {0.8923991f, -0.3696438f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45233947f, -0.121203996f, 0.012940953f}, {0.93301266f, -0.25f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43070704f, -0.1784047f, 0.019134171f}, {0.85355335f, -0.35355338f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45030877f, -0.12065987f, 0.019134171f}, {0.8923991f, -0.23911761f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4280345f, -0.17729771f, 0.025f}, {0.8001031f, -0.33141357f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.44751462f, -0.11991119f, 0.025f}, {0.83651626f, -0.22414386f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.42467752f, -0.1759072f, 0.030438071f}, {0.73296285f, -0.30360317f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.44400483f, -0.11897074f, 0.030438071f}, {0.76632047f, -0.20533495f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.42069343f, -0.17425694f, 0.03535534f}, {0.65328145f, -0.27059805f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43983945f, -0.117854625f, 0.03535534f}, {0.68301266f, -0.1830127f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.41615048f, -0.17237519f, 0.039667666f}, {0.5624222f, -0.2329629f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43508974f, -0.11658195f, 0.039667666f}, {0.58801836f, -0.15755905f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.41112635f, -0.17029412f, 0.04330127f}, {0.46193975f, -0.19134171f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.42983696f, -0.11517447f, 0.04330127f}, {0.4829629f, -0.12940952f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40570703f, -0.16804937f, 0.046193976f}, {0.35355338f, -0.1464466f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.424171f, -0.11365628f, 0.046193976f}, {0.3696438f, -0.09904576f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39998525f, -0.16567932f, 0.04829629f}, {0.23911761f, -0.09904576f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4181888f, -0.11205336f, 0.04829629f}, {0.25f, -0.0669873f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39405888f, -0.16322455f, 0.049572244f}, {0.12059047f, -0.04995021f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.41199276f, -0.11039313f, 0.049572244f}, {0.1260786f, -0.03378266f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38802937f, -0.16072704f, 0.05f}, {-1.5679955e-13f, 6.49485e-14f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40568882f, -0.10870399f, 0.05f}, {-1.639356e-13f, 4.392641e-14f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38199985f, -0.15822953f, 0.049572244f}, {-0.12059047f, 0.04995021f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3993849f, -0.10701486f, 0.049572244f}, {-0.1260786f, 0.03378266f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37607348f, -0.15577476f, 0.04829629f}, {-0.23911761f, 0.09904576f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39318883f, -0.10535463f, 0.04829629f}, {-0.25f, 0.0669873f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3703517f, -0.15340471f, 0.046193976f}, {-0.35355338f, 0.1464466f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38720664f, -0.103751704f, 0.046193976f}, {-0.3696438f, 0.09904576f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3649324f, -0.15115996f, 0.04330127f}, {-0.46193975f, 0.19134171f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3815407f, -0.102233514f, 0.04330127f}, {-0.4829629f, 0.12940952f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.35990825f, -0.14907889f, 0.039667666f}, {-0.5624222f, 0.2329629f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3762879f, -0.10082604f, 0.039667666f}, {-0.58801836f, 0.15755905f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3553653f, -0.14719714f, 0.03535534f}, {-0.65328145f, 0.27059805f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3715382f, -0.09955336f, 0.03535534f}, {-0.68301266f, 0.1830127f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3513812f, -0.14554688f, 0.030438071f}, {-0.73296285f, 0.30360317f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3673728f, -0.09843725f, 0.030438071f}, {-0.76632047f, 0.20533495f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34802422f, -0.14415637f, 0.025f}, {-0.8001031f, 0.33141357f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36386302f, -0.0974968f, 0.025f}, {-0.83651626f, 0.22414386f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3453517f, -0.14304937f, 0.019134171f}, {-0.85355335f, 0.35355338f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36106887f, -0.09674811f, 0.019134171f}, {-0.8923991f, 0.23911761f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34340942f, -0.14224485f, 0.012940953f}, {-0.8923991f, 0.3696438f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.35903817f, -0.09620399f, 0.012940953f}, {-0.93301266f, 0.25f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3422306f, -0.14175656f, 0.0065263095f}, {-0.91597563f, 0.37940952f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3578057f, -0.09587375f, 0.0065263095f}, {-0.9576622f, 0.25660482f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34183538f, -0.14159286f, -8.485931e-15f}, {-0.9238795f, 0.38268343f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.35739252f, -0.09576304f, -8.485931e-15f}, {-0.9659258f, 0.25881904f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3422306f, -0.14175656f, -0.0065263095f}, {-0.91597563f, 0.37940952f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3578057f, -0.09587375f, -0.0065263095f}, {-0.9576622f, 0.25660482f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34340942f, -0.14224485f, -0.012940953f}, {-0.8923991f, 0.3696438f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.35903817f, -0.09620399f, -0.012940953f}, {-0.93301266f, 0.25f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3453517f, -0.14304937f, -0.019134171f}, {-0.85355335f, 0.35355338f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36106887f, -0.09674811f, -0.019134171f}, {-0.8923991f, 0.23911761f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34802422f, -0.14415637f, -0.025f}, {-0.8001031f, 0.33141357f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36386302f, -0.0974968f, -0.025f}, {-0.83651626f, 0.22414386f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3513812f, -0.14554688f, -0.030438071f}, {-0.73296285f, 0.30360317f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3673728f, -0.09843725f, -0.030438071f}, {-0.76632047f, 0.20533495f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3553653f, -0.14719714f, -0.03535534f}, {-0.65328145f, 0.27059805f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3715382f, -0.09955336f, -0.03535534f}, {-0.68301266f, 0.1830127f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.35990825f, -0.14907889f, -0.039667666f}, {-0.5624222f, 0.2329629f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3762879f, -0.10082604f, -0.039667666f}, {-0.58801836f, 0.15755905f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3649324f, -0.15115996f, -0.04330127f}, {-0.46193975f, 0.19134171f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3815407f, -0.102233514f, -0.04330127f}, {-0.4829629f, 0.12940952f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3703517f, -0.15340471f, -0.046193976f}, {-0.35355338f, 0.1464466f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38720664f, -0.103751704f, -0.046193976f}, {-0.3696438f, 0.09904576f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37607348f, -0.15577476f, -0.04829629f}, {-0.23911761f, 0.09904576f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39318883f, -0.10535463f, -0.04829629f}, {-0.25f, 0.0669873f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38199985f, -0.15822953f, -0.049572244f}, {-0.12059047f, 0.04995021f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3993849f, -0.10701486f, -0.049572244f}, {-0.1260786f, 0.03378266f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38802937f, -0.16072704f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40568882f, -0.10870399f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39405888f, -0.16322455f, -0.049572244f}, {0.12059047f, -0.04995021f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.41199276f, -0.11039313f, -0.049572244f}, {0.1260786f, -0.03378266f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39998525f, -0.16567932f, -0.04829629f}, {0.23911761f, -0.09904576f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4181888f, -0.11205336f, -0.04829629f}, {0.25f, -0.0669873f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40570703f, -0.16804937f, -0.046193976f}, {0.35355338f, -0.1464466f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.424171f, -0.11365628f, -0.046193976f}, {0.3696438f, -0.09904576f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.41112635f, -0.17029412f, -0.04330127f}, {0.46193975f, -0.19134171f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.42983696f, -0.11517447f, -0.04330127f}, {0.4829629f, -0.12940952f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43508974f, -0.11658195f, -0.039667666f}, {0.58801836f, -0.15755905f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43983945f, -0.117854625f, -0.03535534f}, {0.68301266f, -0.1830127f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.44658452f, -0.058793962f, -0.039667666f}, {0.6035534f, -0.07945931f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4514597f, -0.059435792f, -0.03535534f}, {0.7010574f, -0.09229595f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45573515f, -0.059998665f, -0.030438071f}, {0.7865661f, -0.103553385f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.44119295f, -0.05808415f, -0.04330127f}, {0.49572244f, -0.06526309f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45535532f, -7.728228e-14f, -0.03535534f}, {0.70710677f, -1.2000919e-13f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43537733f, -0.057318505f, -0.046193976f}, {0.37940952f, -0.04995021f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45043805f, -7.6447725e-14f, -0.039667666f}, {0.6087614f, -1.0331815e-13f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.445f, -7.5524785e-14f, -0.04330127f}, {0.5f, -8.485931e-14f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.42923707f, -0.056510128f, -0.04829629f}, {0.25660482f, -0.03378266f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43913415f, -7.452924e-14f, -0.046193976f}, {0.38268343f, -6.49485e-14f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4228773f, -0.05567285f, -0.049572244f}, {0.12940952f, -0.017037084f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43294093f, -7.347814e-14f, -0.04829629f}, {0.25881904f, -4.392641e-14f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.41640684f, -0.054820996f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4265263f, -7.2389455e-14f, -0.049572244f}, {0.13052619f, -2.2152724e-14f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40993637f, -0.05396914f, -0.049572244f}, {-0.12940952f, 0.017037084f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.42f, -7.128182e-14f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4035766f, -0.053131863f, -0.04829629f}, {-0.25660482f, 0.03378266f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.41347367f, -7.0174186e-14f, -0.049572244f}, {-0.13052619f, 2.2152724e-14f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39743635f, -0.052323487f, -0.046193976f}, {-0.37940952f, 0.04995021f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40705904f, -6.90855e-14f, -0.04829629f}, {-0.25881904f, 4.392641e-14f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39162073f, -0.051557843f, -0.04330127f}, {-0.49572244f, 0.06526309f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40086582f, -6.80344e-14f, -0.046193976f}, {-0.38268343f, 6.49485e-14f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38622916f, -0.05084803f, -0.039667666f}, {-0.6035534f, 0.07945931f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39499998f, -6.7038856e-14f, -0.04330127f}, {-0.5f, 8.485931e-14f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38135397f, -0.0502062f, -0.03535534f}, {-0.7010574f, 0.09229595f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38956192f, -6.6115916e-14f, -0.039667666f}, {-0.6087614f, 1.0331815e-13f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37707853f, -0.049643327f, -0.030438071f}, {-0.7865661f, 0.103553385f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38464466f, -6.528136e-14f, -0.03535534f}, {-0.70710677f, 1.2000919e-13f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37347603f, -0.049169045f, -0.025f}, {-0.8586165f, 0.11303899f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38033232f, -6.454948e-14f, -0.030438071f}, {-0.7933533f, 1.3464684e-13f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37060806f, -0.048791472f, -0.019134171f}, {-0.91597563f, 0.12059047f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37669873f, -6.3932786e-14f, -0.025f}, {-0.8660254f, 1.4698064e-13f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36852372f, -0.048517067f, -0.012940953f}, {-0.9576622f, 0.1260786f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.373806f, -6.3441846e-14f, -0.019134171f}, {-0.9238795f, 1.5679955e-13f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3672587f, -0.04835052f, -0.0065263095f}, {-0.98296297f, 0.12940952f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37170368f, -6.308504e-14f, -0.012940953f}, {-0.9659258f, 1.639356e-13f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36683458f, -0.048294686f, -8.485931e-15f}, {-0.9914449f, 0.13052619f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37042773f, -6.2868486e-14f, -0.0065263095f}, {-0.9914449f, 1.6826666e-13f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3672587f, -0.04835052f, 0.0065263095f}, {-0.98296297f, 0.12940952f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36999997f, -6.279589e-14f, -8.485931e-15f}, {-1.0f, 1.6971862e-13f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36852372f, -0.048517067f, 0.012940953f}, {-0.9576622f, 0.1260786f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37042773f, -6.2868486e-14f, 0.0065263095f}, {-0.9914449f, 1.6826666e-13f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37060806f, -0.048791472f, 0.019134171f}, {-0.91597563f, 0.12059047f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37170368f, -6.308504e-14f, 0.012940953f}, {-0.9659258f, 1.639356e-13f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37347603f, -0.049169045f, 0.025f}, {-0.8586165f, 0.11303899f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.373806f, -6.3441846e-14f, 0.019134171f}, {-0.9238795f, 1.5679955e-13f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37707853f, -0.049643327f, 0.030438071f}, {-0.7865661f, 0.103553385f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37669873f, -6.3932786e-14f, 0.025f}, {-0.8660254f, 1.4698064e-13f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38135397f, -0.0502062f, 0.03535534f}, {-0.7010574f, 0.09229595f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38033232f, -6.454948e-14f, 0.030438071f}, {-0.7933533f, 1.3464684e-13f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38622916f, -0.05084803f, 0.039667666f}, {-0.6035534f, 0.07945931f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38464466f, -6.528136e-14f, 0.03535534f}, {-0.70710677f, 1.2000919e-13f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39162073f, -0.051557843f, 0.04330127f}, {-0.49572244f, 0.06526309f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38956192f, -6.6115916e-14f, 0.039667666f}, {-0.6087614f, 1.0331815e-13f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39743635f, -0.052323487f, 0.046193976f}, {-0.37940952f, 0.04995021f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39499998f, -6.7038856e-14f, 0.04330127f}, {-0.5f, 8.485931e-14f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4035766f, -0.053131863f, 0.04829629f}, {-0.25660482f, 0.03378266f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40086582f, -6.80344e-14f, 0.046193976f}, {-0.38268343f, 6.49485e-14f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40993637f, -0.05396914f, 0.049572244f}, {-0.12940952f, 0.017037084f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40705904f, -6.90855e-14f, 0.04829629f}, {-0.25881904f, 4.392641e-14f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.41640684f, -0.054820996f, 0.05f}, {-1.6826666e-13f, 2.2152724e-14f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.41347367f, -7.0174186e-14f, 0.049572244f}, {-0.13052619f, 2.2152724e-14f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4228773f, -0.05567285f, 0.049572244f}, {0.12940952f, -0.017037084f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.42f, -7.128182e-14f, 0.05f}, {-1.6971862e-13f, 2.8804412e-26f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.42923707f, -0.056510128f, 0.04829629f}, {0.25660482f, -0.03378266f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4265263f, -7.2389455e-14f, 0.049572244f}, {0.13052619f, -2.2152724e-14f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43537733f, -0.057318505f, 0.046193976f}, {0.37940952f, -0.04995021f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43294093f, -7.347814e-14f, 0.04829629f}, {0.25881904f, -4.392641e-14f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.44119295f, -0.05808415f, 0.04330127f}, {0.49572244f, -0.06526309f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43913415f, -7.452924e-14f, 0.046193976f}, {0.38268343f, -6.49485e-14f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.44658452f, -0.058793962f, 0.039667666f}, {0.6035534f, -0.07945931f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.445f, -7.5524785e-14f, 0.04330127f}, {0.5f, -8.485931e-14f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4514597f, -0.059435792f, 0.03535534f}, {0.7010574f, -0.09229595f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45043805f, -7.6447725e-14f, 0.039667666f}, {0.6087614f, -1.0331815e-13f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45573515f, -0.059998665f, 0.030438071f}, {0.7865661f, -0.103553385f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45535532f, -7.728228e-14f, 0.03535534f}, {0.70710677f, -1.2000919e-13f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45933765f, -0.060472947f, 0.025f}, {0.8586165f, -0.11303899f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45966765f, -7.801416e-14f, 0.030438071f}, {0.7933533f, -1.3464684e-13f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.46220562f, -0.06085052f, 0.019134171f}, {0.91597563f, -0.12059047f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.46330124f, -7.8630855e-14f, 0.025f}, {0.8660254f, -1.4698064e-13f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.46428996f, -0.061124925f, 0.012940953f}, {0.9576622f, -0.1260786f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.46619397f, -7.9121795e-14f, 0.019134171f}, {0.9238795f, -1.5679955e-13f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.46555498f, -0.06129147f, 0.0065263095f}, {0.98296297f, -0.12940952f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4682963f, -7.94786e-14f, 0.012940953f}, {0.9659258f, -1.639356e-13f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4659791f, -0.061347306f, 0.0f}, {0.9914449f, -0.13052619f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.46957225f, -7.9695155e-14f, 0.0065263095f}, {0.9914449f, -1.6826666e-13f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.46555498f, -0.06129147f, -0.0065263095f}, {0.98296297f, -0.12940952f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.47f, -7.976775e-14f, 0.0f}, {1.0f, -1.6971862e-13f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.46428996f, -0.061124925f, -0.012940953f}, {0.9576622f, -0.1260786f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.46957225f, -7.9695155e-14f, -0.0065263095f}, {0.9914449f, -1.6826666e-13f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.46220562f, -0.06085052f, -0.019134171f}, {0.91597563f, -0.12059047f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4682963f, -7.94786e-14f, -0.012940953f}, {0.9659258f, -1.639356e-13f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45933765f, -0.060472947f, -0.025f}, {0.8586165f, -0.11303899f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.46619397f, -7.9121795e-14f, -0.019134171f}, {0.9238795f, -1.5679955e-13f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.46330124f, -7.8630855e-14f, -0.025f}, {0.8660254f, -1.4698064e-13f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45966765f, -7.801416e-14f, -0.030438071f}, {0.7933533f, -1.3464684e-13f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.46220562f, 0.06085052f, -0.019134171f}, {0.91597563f, 0.12059047f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45933765f, 0.060472947f, -0.025f}, {0.8586165f, 0.11303899f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45573515f, 0.059998665f, -0.030438071f}, {0.7865661f, 0.103553385f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.46428996f, 0.061124925f, -0.012940953f}, {0.9576622f, 0.1260786f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45030877f, 0.12065987f, -0.019134171f}, {0.8923991f, 0.23911761f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.46555498f, 0.06129147f, -0.0065263095f}, {0.98296297f, 0.12940952f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45233947f, 0.121203996f, -0.012940953f}, {0.93301266f, 0.25f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45357195f, 0.121534236f, -0.0065263095f}, {0.9576622f, 0.25660482f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4659791f, 0.061347306f, 0.0f}, {0.9914449f, 0.13052619f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45398512f, 0.121644944f, 0.0f}, {0.9659258f, 0.25881904f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.46555498f, 0.06129147f, 0.0065263095f}, {0.98296297f, 0.12940952f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45357195f, 0.121534236f, 0.0065263095f}, {0.9576622f, 0.25660482f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.46428996f, 0.061124925f, 0.012940953f}, {0.9576622f, 0.1260786f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45233947f, 0.121203996f, 0.012940953f}, {0.93301266f, 0.25f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.46220562f, 0.06085052f, 0.019134171f}, {0.91597563f, 0.12059047f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45030877f, 0.12065987f, 0.019134171f}, {0.8923991f, 0.23911761f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45933765f, 0.060472947f, 0.025f}, {0.8586165f, 0.11303899f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.44751462f, 0.11991119f, 0.025f}, {0.83651626f, 0.22414386f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45573515f, 0.059998665f, 0.030438071f}, {0.7865661f, 0.103553385f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.44400483f, 0.11897074f, 0.030438071f}, {0.76632047f, 0.20533495f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4514597f, 0.059435792f, 0.03535534f}, {0.7010574f, 0.09229595f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43983945f, 0.117854625f, 0.03535534f}, {0.68301266f, 0.1830127f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.44658452f, 0.058793962f, 0.039667666f}, {0.6035534f, 0.07945931f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43508974f, 0.11658195f, 0.039667666f}, {0.58801836f, 0.15755905f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.44119295f, 0.05808415f, 0.04330127f}, {0.49572244f, 0.06526309f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.42983696f, 0.11517447f, 0.04330127f}, {0.4829629f, 0.12940952f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43537733f, 0.057318505f, 0.046193976f}, {0.37940952f, 0.04995021f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.424171f, 0.11365628f, 0.046193976f}, {0.3696438f, 0.09904576f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.42923707f, 0.056510128f, 0.04829629f}, {0.25660482f, 0.03378266f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4181888f, 0.11205336f, 0.04829629f}, {0.25f, 0.0669873f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4228773f, 0.05567285f, 0.049572244f}, {0.12940952f, 0.017037084f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.41199276f, 0.11039313f, 0.049572244f}, {0.1260786f, 0.03378266f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.41640684f, 0.054820996f, 0.05f}, {-1.6826666e-13f, -2.2152724e-14f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40568882f, 0.10870399f, 0.05f}, {-1.639356e-13f, -4.392641e-14f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40993637f, 0.05396914f, 0.049572244f}, {-0.12940952f, -0.017037084f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3993849f, 0.10701486f, 0.049572244f}, {-0.1260786f, -0.03378266f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4035766f, 0.053131863f, 0.04829629f}, {-0.25660482f, -0.03378266f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39318883f, 0.10535463f, 0.04829629f}, {-0.25f, -0.0669873f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39743635f, 0.052323487f, 0.046193976f}, {-0.37940952f, -0.04995021f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38720664f, 0.103751704f, 0.046193976f}, {-0.3696438f, -0.09904576f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39162073f, 0.051557843f, 0.04330127f}, {-0.49572244f, -0.06526309f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3815407f, 0.102233514f, 0.04330127f}, {-0.4829629f, -0.12940952f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38622916f, 0.05084803f, 0.039667666f}, {-0.6035534f, -0.07945931f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3762879f, 0.10082604f, 0.039667666f}, {-0.58801836f, -0.15755905f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38135397f, 0.0502062f, 0.03535534f}, {-0.7010574f, -0.09229595f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3715382f, 0.09955336f, 0.03535534f}, {-0.68301266f, -0.1830127f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37707853f, 0.049643327f, 0.030438071f}, {-0.7865661f, -0.103553385f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3673728f, 0.09843725f, 0.030438071f}, {-0.76632047f, -0.20533495f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37347603f, 0.049169045f, 0.025f}, {-0.8586165f, -0.11303899f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36386302f, 0.0974968f, 0.025f}, {-0.83651626f, -0.22414386f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37060806f, 0.048791472f, 0.019134171f}, {-0.91597563f, -0.12059047f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36106887f, 0.09674811f, 0.019134171f}, {-0.8923991f, -0.23911761f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36852372f, 0.048517067f, 0.012940953f}, {-0.9576622f, -0.1260786f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.35903817f, 0.09620399f, 0.012940953f}, {-0.93301266f, -0.25f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3672587f, 0.04835052f, 0.0065263095f}, {-0.98296297f, -0.12940952f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3578057f, 0.09587375f, 0.0065263095f}, {-0.9576622f, -0.25660482f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36683458f, 0.048294686f, -8.485931e-15f}, {-0.9914449f, -0.13052619f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.35739252f, 0.09576304f, -8.485931e-15f}, {-0.9659258f, -0.25881904f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3672587f, 0.04835052f, -0.0065263095f}, {-0.98296297f, -0.12940952f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3578057f, 0.09587375f, -0.0065263095f}, {-0.9576622f, -0.25660482f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36852372f, 0.048517067f, -0.012940953f}, {-0.9576622f, -0.1260786f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.35903817f, 0.09620399f, -0.012940953f}, {-0.93301266f, -0.25f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37060806f, 0.048791472f, -0.019134171f}, {-0.91597563f, -0.12059047f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36106887f, 0.09674811f, -0.019134171f}, {-0.8923991f, -0.23911761f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37347603f, 0.049169045f, -0.025f}, {-0.8586165f, -0.11303899f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36386302f, 0.0974968f, -0.025f}, {-0.83651626f, -0.22414386f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37707853f, 0.049643327f, -0.030438071f}, {-0.7865661f, -0.103553385f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3673728f, 0.09843725f, -0.030438071f}, {-0.76632047f, -0.20533495f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38135397f, 0.0502062f, -0.03535534f}, {-0.7010574f, -0.09229595f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3715382f, 0.09955336f, -0.03535534f}, {-0.68301266f, -0.1830127f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38622916f, 0.05084803f, -0.039667666f}, {-0.6035534f, -0.07945931f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3762879f, 0.10082604f, -0.039667666f}, {-0.58801836f, -0.15755905f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39162073f, 0.051557843f, -0.04330127f}, {-0.49572244f, -0.06526309f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3815407f, 0.102233514f, -0.04330127f}, {-0.4829629f, -0.12940952f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39743635f, 0.052323487f, -0.046193976f}, {-0.37940952f, -0.04995021f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38720664f, 0.103751704f, -0.046193976f}, {-0.3696438f, -0.09904576f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4035766f, 0.053131863f, -0.04829629f}, {-0.25660482f, -0.03378266f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39318883f, 0.10535463f, -0.04829629f}, {-0.25f, -0.0669873f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40993637f, 0.05396914f, -0.049572244f}, {-0.12940952f, -0.017037084f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3993849f, 0.10701486f, -0.049572244f}, {-0.1260786f, -0.03378266f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.41640684f, 0.054820996f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40568882f, 0.10870399f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4228773f, 0.05567285f, -0.049572244f}, {0.12940952f, 0.017037084f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.41199276f, 0.11039313f, -0.049572244f}, {0.1260786f, 0.03378266f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.42923707f, 0.056510128f, -0.04829629f}, {0.25660482f, 0.03378266f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4181888f, 0.11205336f, -0.04829629f}, {0.25f, 0.0669873f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43537733f, 0.057318505f, -0.046193976f}, {0.37940952f, 0.04995021f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.424171f, 0.11365628f, -0.046193976f}, {0.3696438f, 0.09904576f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.44119295f, 0.05808415f, -0.04330127f}, {0.49572244f, 0.06526309f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.42983696f, 0.11517447f, -0.04330127f}, {0.4829629f, 0.12940952f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.44658452f, 0.058793962f, -0.039667666f}, {0.6035534f, 0.07945931f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43508974f, 0.11658195f, -0.039667666f}, {0.58801836f, 0.15755905f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4514597f, 0.059435792f, -0.03535534f}, {0.7010574f, 0.09229595f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43983945f, 0.117854625f, -0.03535534f}, {0.68301266f, 0.1830127f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.44400483f, 0.11897074f, -0.030438071f}, {0.76632047f, 0.20533495f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.44751462f, 0.11991119f, -0.025f}, {0.83651626f, 0.22414386f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.42467752f, 0.1759072f, -0.030438071f}, {0.73296285f, 0.30360317f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4280345f, 0.17729771f, -0.025f}, {0.8001031f, 0.33141357f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43070704f, 0.1784047f, -0.019134171f}, {0.85355335f, 0.35355338f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.42069343f, 0.17425694f, -0.03535534f}, {0.65328145f, 0.27059805f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40123063f, 0.23165062f, -0.025f}, {0.75f, 0.4330127f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.41615048f, 0.17237519f, -0.039667666f}, {0.5624222f, 0.2329629f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39808384f, 0.22983383f, -0.030438071f}, {0.6870641f, 0.39667666f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39434925f, 0.22767766f, -0.03535534f}, {0.6123724f, 0.35355338f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.41112635f, 0.17029412f, -0.04330127f}, {0.46193975f, 0.19134171f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3900908f, 0.22521903f, -0.039667666f}, {0.52720284f, 0.3043807f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40570703f, 0.16804937f, -0.046193976f}, {0.35355338f, 0.1464466f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38538128f, 0.2225f, -0.04330127f}, {0.4330127f, 0.25f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39998525f, 0.16567932f, -0.04829629f}, {0.23911761f, 0.09904576f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38030133f, 0.21956708f, -0.046193976f}, {0.33141357f, 0.19134171f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39405888f, 0.16322455f, -0.049572244f}, {0.12059047f, 0.04995021f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37493783f, 0.21647047f, -0.04829629f}, {0.22414386f, 0.12940952f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38802937f, 0.16072704f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3693826f, 0.21326315f, -0.049572244f}, {0.11303899f, 0.06526309f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38199985f, 0.15822953f, -0.049572244f}, {-0.12059047f, -0.04995021f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36373064f, 0.21f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37607348f, 0.15577476f, -0.04829629f}, {-0.23911761f, -0.09904576f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3580787f, 0.20673683f, -0.049572244f}, {-0.11303899f, -0.06526309f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3703517f, 0.15340471f, -0.046193976f}, {-0.35355338f, -0.1464466f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.35252345f, 0.20352952f, -0.04829629f}, {-0.22414386f, -0.12940952f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3649324f, 0.15115996f, -0.04330127f}, {-0.46193975f, -0.19134171f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34715995f, 0.20043291f, -0.046193976f}, {-0.33141357f, -0.19134171f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.35990825f, 0.14907889f, -0.039667666f}, {-0.5624222f, -0.2329629f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34208f, 0.19749999f, -0.04330127f}, {-0.4330127f, -0.25f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3553653f, 0.14719714f, -0.03535534f}, {-0.65328145f, -0.27059805f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33737049f, 0.19478096f, -0.039667666f}, {-0.52720284f, -0.3043807f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3513812f, 0.14554688f, -0.030438071f}, {-0.73296285f, -0.30360317f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33311203f, 0.19232233f, -0.03535534f}, {-0.6123724f, -0.35355338f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34802422f, 0.14415637f, -0.025f}, {-0.8001031f, -0.33141357f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32937744f, 0.19016616f, -0.030438071f}, {-0.6870641f, -0.39667666f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3453517f, 0.14304937f, -0.019134171f}, {-0.85355335f, -0.35355338f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32623065f, 0.18834937f, -0.025f}, {-0.75f, -0.4330127f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34340942f, 0.14224485f, -0.012940953f}, {-0.8923991f, -0.3696438f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3237255f, 0.186903f, -0.019134171f}, {-0.8001031f, -0.46193975f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3422306f, 0.14175656f, -0.0065263095f}, {-0.91597563f, -0.37940952f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32190484f, 0.18585184f, -0.012940953f}, {-0.83651626f, -0.4829629f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34183538f, 0.14159286f, -8.485931e-15f}, {-0.9238795f, -0.38268343f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32079983f, 0.18521386f, -0.0065263095f}, {-0.8586165f, -0.49572244f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3422306f, 0.14175656f, 0.0065263095f}, {-0.91597563f, -0.37940952f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32042938f, 0.18499999f, -8.485931e-15f}, {-0.8660254f, -0.5f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34340942f, 0.14224485f, 0.012940953f}, {-0.8923991f, -0.3696438f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32079983f, 0.18521386f, 0.0065263095f}, {-0.8586165f, -0.49572244f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3453517f, 0.14304937f, 0.019134171f}, {-0.85355335f, -0.35355338f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32190484f, 0.18585184f, 0.012940953f}, {-0.83651626f, -0.4829629f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34802422f, 0.14415637f, 0.025f}, {-0.8001031f, -0.33141357f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3237255f, 0.186903f, 0.019134171f}, {-0.8001031f, -0.46193975f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3513812f, 0.14554688f, 0.030438071f}, {-0.73296285f, -0.30360317f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32623065f, 0.18834937f, 0.025f}, {-0.75f, -0.4330127f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3553653f, 0.14719714f, 0.03535534f}, {-0.65328145f, -0.27059805f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32937744f, 0.19016616f, 0.030438071f}, {-0.6870641f, -0.39667666f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.35990825f, 0.14907889f, 0.039667666f}, {-0.5624222f, -0.2329629f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33311203f, 0.19232233f, 0.03535534f}, {-0.6123724f, -0.35355338f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3649324f, 0.15115996f, 0.04330127f}, {-0.46193975f, -0.19134171f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33737049f, 0.19478096f, 0.039667666f}, {-0.52720284f, -0.3043807f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3703517f, 0.15340471f, 0.046193976f}, {-0.35355338f, -0.1464466f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34208f, 0.19749999f, 0.04330127f}, {-0.4330127f, -0.25f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37607348f, 0.15577476f, 0.04829629f}, {-0.23911761f, -0.09904576f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34715995f, 0.20043291f, 0.046193976f}, {-0.33141357f, -0.19134171f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38199985f, 0.15822953f, 0.049572244f}, {-0.12059047f, -0.04995021f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.35252345f, 0.20352952f, 0.04829629f}, {-0.22414386f, -0.12940952f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38802937f, 0.16072704f, 0.05f}, {-1.5679955e-13f, -6.49485e-14f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3580787f, 0.20673683f, 0.049572244f}, {-0.11303899f, -0.06526309f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39405888f, 0.16322455f, 0.049572244f}, {0.12059047f, 0.04995021f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36373064f, 0.21f, 0.05f}, {-1.4698064e-13f, -8.485931e-14f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39998525f, 0.16567932f, 0.04829629f}, {0.23911761f, 0.09904576f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3693826f, 0.21326315f, 0.049572244f}, {0.11303899f, 0.06526309f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40570703f, 0.16804937f, 0.046193976f}, {0.35355338f, 0.1464466f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37493783f, 0.21647047f, 0.04829629f}, {0.22414386f, 0.12940952f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.41112635f, 0.17029412f, 0.04330127f}, {0.46193975f, 0.19134171f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38030133f, 0.21956708f, 0.046193976f}, {0.33141357f, 0.19134171f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.41615048f, 0.17237519f, 0.039667666f}, {0.5624222f, 0.2329629f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38538128f, 0.2225f, 0.04330127f}, {0.4330127f, 0.25f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.42069343f, 0.17425694f, 0.03535534f}, {0.65328145f, 0.27059805f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3900908f, 0.22521903f, 0.039667666f}, {0.52720284f, 0.3043807f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.42467752f, 0.1759072f, 0.030438071f}, {0.73296285f, 0.30360317f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39434925f, 0.22767766f, 0.03535534f}, {0.6123724f, 0.35355338f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4280345f, 0.17729771f, 0.025f}, {0.8001031f, 0.33141357f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39808384f, 0.22983383f, 0.030438071f}, {0.6870641f, 0.39667666f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43070704f, 0.1784047f, 0.019134171f}, {0.85355335f, 0.35355338f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40123063f, 0.23165062f, 0.025f}, {0.75f, 0.4330127f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4326493f, 0.17920923f, 0.012940953f}, {0.8923991f, 0.3696438f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4037358f, 0.23309699f, 0.019134171f}, {0.8001031f, 0.46193975f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43382815f, 0.17969751f, 0.0065263095f}, {0.91597563f, 0.37940952f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40555644f, 0.23414814f, 0.012940953f}, {0.83651626f, 0.4829629f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43422335f, 0.17986122f, 0.0f}, {0.9238795f, 0.38268343f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40666145f, 0.23478612f, 0.0065263095f}, {0.8586165f, 0.49572244f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43382815f, 0.17969751f, -0.0065263095f}, {0.91597563f, 0.37940952f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4070319f, 0.235f, 0.0f}, {0.8660254f, 0.5f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4326493f, 0.17920923f, -0.012940953f}, {0.8923991f, 0.3696438f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40666145f, 0.23478612f, -0.0065263095f}, {0.8586165f, 0.49572244f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40555644f, 0.23414814f, -0.012940953f}, {0.83651626f, 0.4829629f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4037358f, 0.23309699f, -0.019134171f}, {0.8001031f, 0.46193975f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3725367f, 0.28585747f, -0.0065263095f}, {0.7865661f, 0.6035534f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3715244f, 0.2850807f, -0.012940953f}, {0.76632047f, 0.58801836f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36985654f, 0.2838009f, -0.019134171f}, {0.73296285f, 0.5624222f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37287605f, 0.28611785f, 0.0f}, {0.7933533f, 0.6087614f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3320377f, 0.3320377f, -0.0065263095f}, {0.7010574f, 0.7010574f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3725367f, 0.28585747f, 0.0065263095f}, {0.7865661f, 0.6035534f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33234015f, 0.33234015f, 0.0f}, {0.70710677f, 0.70710677f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3320377f, 0.3320377f, 0.0065263095f}, {0.7010574f, 0.7010574f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3715244f, 0.2850807f, 0.012940953f}, {0.76632047f, 0.58801836f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33113545f, 0.33113545f, 0.012940953f}, {0.68301266f, 0.68301266f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36985654f, 0.2838009f, 0.019134171f}, {0.73296285f, 0.5624222f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32964888f, 0.32964888f, 0.019134171f}, {0.65328145f, 0.65328145f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36756158f, 0.28203994f, 0.025f}, {0.6870641f, 0.52720284f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32760343f, 0.32760343f, 0.025f}, {0.6123724f, 0.6123724f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36467886f, 0.27982792f, 0.030438071f}, {0.6294095f, 0.4829629f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32503408f, 0.32503408f, 0.030438071f}, {0.5609855f, 0.5609855f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36125767f, 0.27720276f, 0.03535534f}, {0.5609855f, 0.43045932f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32198483f, 0.32198483f, 0.03535534f}, {0.49999997f, 0.49999997f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.35735652f, 0.27420932f, 0.039667666f}, {0.4829629f, 0.37059048f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3185078f, 0.3185078f, 0.039667666f}, {0.43045932f, 0.43045932f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.35304222f, 0.27089882f, 0.04330127f}, {0.39667666f, 0.3043807f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3146625f, 0.3146625f, 0.04330127f}, {0.35355338f, 0.35355338f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34838855f, 0.26732793f, 0.046193976f}, {0.30360317f, 0.2329629f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.31051472f, 0.31051472f, 0.046193976f}, {0.27059805f, 0.27059805f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34347513f, 0.26355773f, 0.04829629f}, {0.20533495f, 0.15755905f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.30613545f, 0.30613545f, 0.04829629f}, {0.1830127f, 0.1830127f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33838606f, 0.25965276f, 0.049572244f}, {0.103553385f, 0.07945931f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.30159962f, 0.30159962f, 0.049572244f}, {0.09229595f, 0.09229595f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33320838f, 0.2556798f, 0.05f}, {-1.3464684e-13f, -1.0331815e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29698482f, 0.29698482f, 0.05f}, {-1.2000919e-13f, -1.2000919e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3280307f, 0.2517068f, 0.049572244f}, {-0.103553385f, -0.07945931f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29237002f, 0.29237002f, 0.049572244f}, {-0.09229595f, -0.09229595f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32294163f, 0.24780184f, 0.04829629f}, {-0.20533495f, -0.15755905f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2878342f, 0.2878342f, 0.04829629f}, {-0.1830127f, -0.1830127f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3180282f, 0.24403164f, 0.046193976f}, {-0.30360317f, -0.2329629f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.28345492f, 0.28345492f, 0.046193976f}, {-0.27059805f, -0.27059805f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.31337455f, 0.24046075f, 0.04330127f}, {-0.39667666f, -0.3043807f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27930716f, 0.27930716f, 0.04330127f}, {-0.35355338f, -0.35355338f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.30906025f, 0.23715027f, 0.039667666f}, {-0.4829629f, -0.37059048f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27546185f, 0.27546185f, 0.039667666f}, {-0.43045932f, -0.43045932f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3051591f, 0.23415682f, 0.03535534f}, {-0.5609855f, -0.43045932f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27198482f, 0.27198482f, 0.03535534f}, {-0.49999997f, -0.49999997f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3017379f, 0.23153163f, 0.030438071f}, {-0.6294095f, -0.4829629f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.26893556f, 0.26893556f, 0.030438071f}, {-0.5609855f, -0.5609855f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2988552f, 0.22931965f, 0.025f}, {-0.6870641f, -0.52720284f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2663662f, 0.2663662f, 0.025f}, {-0.6123724f, -0.6123724f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29656023f, 0.22755867f, 0.019134171f}, {-0.73296285f, -0.5624222f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.26432076f, 0.26432076f, 0.019134171f}, {-0.65328145f, -0.65328145f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29489237f, 0.22627887f, 0.012940953f}, {-0.76632047f, -0.58801836f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2628342f, 0.2628342f, 0.012940953f}, {-0.68301266f, -0.68301266f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29388008f, 0.22550212f, 0.0065263095f}, {-0.7865661f, -0.6035534f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.26193196f, 0.26193196f, 0.0065263095f}, {-0.7010574f, -0.7010574f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29354072f, 0.22524172f, -8.485931e-15f}, {-0.7933533f, -0.6087614f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2616295f, 0.2616295f, -8.485931e-15f}, {-0.70710677f, -0.70710677f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29388008f, 0.22550212f, -0.0065263095f}, {-0.7865661f, -0.6035534f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.26193196f, 0.26193196f, -0.0065263095f}, {-0.7010574f, -0.7010574f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29489237f, 0.22627887f, -0.012940953f}, {-0.76632047f, -0.58801836f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2628342f, 0.2628342f, -0.012940953f}, {-0.68301266f, -0.68301266f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29656023f, 0.22755867f, -0.019134171f}, {-0.73296285f, -0.5624222f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.26432076f, 0.26432076f, -0.019134171f}, {-0.65328145f, -0.65328145f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2988552f, 0.22931965f, -0.025f}, {-0.6870641f, -0.52720284f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2663662f, 0.2663662f, -0.025f}, {-0.6123724f, -0.6123724f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3017379f, 0.23153163f, -0.030438071f}, {-0.6294095f, -0.4829629f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.26893556f, 0.26893556f, -0.030438071f}, {-0.5609855f, -0.5609855f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3051591f, 0.23415682f, -0.03535534f}, {-0.5609855f, -0.43045932f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27198482f, 0.27198482f, -0.03535534f}, {-0.49999997f, -0.49999997f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.30906025f, 0.23715027f, -0.039667666f}, {-0.4829629f, -0.37059048f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27546185f, 0.27546185f, -0.039667666f}, {-0.43045932f, -0.43045932f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.31337455f, 0.24046075f, -0.04330127f}, {-0.39667666f, -0.3043807f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27930716f, 0.27930716f, -0.04330127f}, {-0.35355338f, -0.35355338f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3180282f, 0.24403164f, -0.046193976f}, {-0.30360317f, -0.2329629f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.28345492f, 0.28345492f, -0.046193976f}, {-0.27059805f, -0.27059805f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32294163f, 0.24780184f, -0.04829629f}, {-0.20533495f, -0.15755905f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2878342f, 0.2878342f, -0.04829629f}, {-0.1830127f, -0.1830127f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3280307f, 0.2517068f, -0.049572244f}, {-0.103553385f, -0.07945931f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29237002f, 0.29237002f, -0.049572244f}, {-0.09229595f, -0.09229595f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33320838f, 0.2556798f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29698482f, 0.29698482f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33838606f, 0.25965276f, -0.049572244f}, {0.103553385f, 0.07945931f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.30159962f, 0.30159962f, -0.049572244f}, {0.09229595f, 0.09229595f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34347513f, 0.26355773f, -0.04829629f}, {0.20533495f, 0.15755905f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.30613545f, 0.30613545f, -0.04829629f}, {0.1830127f, 0.1830127f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.34838855f, 0.26732793f, -0.046193976f}, {0.30360317f, 0.2329629f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.31051472f, 0.31051472f, -0.046193976f}, {0.27059805f, 0.27059805f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.35304222f, 0.27089882f, -0.04330127f}, {0.39667666f, 0.3043807f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3146625f, 0.3146625f, -0.04330127f}, {0.35355338f, 0.35355338f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.35735652f, 0.27420932f, -0.039667666f}, {0.4829629f, 0.37059048f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3185078f, 0.3185078f, -0.039667666f}, {0.43045932f, 0.43045932f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36125767f, 0.27720276f, -0.03535534f}, {0.5609855f, 0.43045932f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32198483f, 0.32198483f, -0.03535534f}, {0.49999997f, 0.49999997f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36467886f, 0.27982792f, -0.030438071f}, {0.6294095f, 0.4829629f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32503408f, 0.32503408f, -0.030438071f}, {0.5609855f, 0.5609855f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36756158f, 0.28203994f, -0.025f}, {0.6870641f, 0.52720284f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32760343f, 0.32760343f, -0.025f}, {0.6123724f, 0.6123724f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32964888f, 0.32964888f, -0.019134171f}, {0.65328145f, 0.65328145f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33113545f, 0.33113545f, -0.012940953f}, {0.68301266f, 0.68301266f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2838009f, 0.36985654f, -0.019134171f}, {0.5624222f, 0.73296285f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2850807f, 0.3715244f, -0.012940953f}, {0.58801836f, 0.76632047f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.28585747f, 0.3725367f, -0.0065263095f}, {0.6035534f, 0.7865661f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.28203994f, 0.36756158f, -0.025f}, {0.52720284f, 0.6870641f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23414814f, 0.40555644f, -0.012940953f}, {0.4829629f, 0.83651626f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27982792f, 0.36467886f, -0.030438071f}, {0.4829629f, 0.6294095f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23309699f, 0.4037358f, -0.019134171f}, {0.46193975f, 0.8001031f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23165062f, 0.40123063f, -0.025f}, {0.4330127f, 0.75f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27720276f, 0.36125767f, -0.03535534f}, {0.43045932f, 0.5609855f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22983383f, 0.39808384f, -0.030438071f}, {0.39667666f, 0.6870641f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27420932f, 0.35735652f, -0.039667666f}, {0.37059048f, 0.4829629f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22767766f, 0.39434925f, -0.03535534f}, {0.35355338f, 0.6123724f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27089882f, 0.35304222f, -0.04330127f}, {0.3043807f, 0.39667666f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22521903f, 0.3900908f, -0.039667666f}, {0.3043807f, 0.52720284f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.26732793f, 0.34838855f, -0.046193976f}, {0.2329629f, 0.30360317f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2225f, 0.38538128f, -0.04330127f}, {0.25f, 0.4330127f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.26355773f, 0.34347513f, -0.04829629f}, {0.15755905f, 0.20533495f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.21956708f, 0.38030133f, -0.046193976f}, {0.19134171f, 0.33141357f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.25965276f, 0.33838606f, -0.049572244f}, {0.07945931f, 0.103553385f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.21647047f, 0.37493783f, -0.04829629f}, {0.12940952f, 0.22414386f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2556798f, 0.33320838f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.21326315f, 0.3693826f, -0.049572244f}, {0.06526309f, 0.11303899f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2517068f, 0.3280307f, -0.049572244f}, {-0.07945931f, -0.103553385f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.21f, 0.36373064f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.24780184f, 0.32294163f, -0.04829629f}, {-0.15755905f, -0.20533495f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.20673683f, 0.3580787f, -0.049572244f}, {-0.06526309f, -0.11303899f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.24403164f, 0.3180282f, -0.046193976f}, {-0.2329629f, -0.30360317f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.20352952f, 0.35252345f, -0.04829629f}, {-0.12940952f, -0.22414386f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.24046075f, 0.31337455f, -0.04330127f}, {-0.3043807f, -0.39667666f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.20043291f, 0.34715995f, -0.046193976f}, {-0.19134171f, -0.33141357f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23715027f, 0.30906025f, -0.039667666f}, {-0.37059048f, -0.4829629f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.19749999f, 0.34208f, -0.04330127f}, {-0.25f, -0.4330127f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23415682f, 0.3051591f, -0.03535534f}, {-0.43045932f, -0.5609855f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.19478096f, 0.33737049f, -0.039667666f}, {-0.3043807f, -0.52720284f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23153163f, 0.3017379f, -0.030438071f}, {-0.4829629f, -0.6294095f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.19232233f, 0.33311203f, -0.03535534f}, {-0.35355338f, -0.6123724f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22931965f, 0.2988552f, -0.025f}, {-0.52720284f, -0.6870641f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.19016616f, 0.32937744f, -0.030438071f}, {-0.39667666f, -0.6870641f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22755867f, 0.29656023f, -0.019134171f}, {-0.5624222f, -0.73296285f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.18834937f, 0.32623065f, -0.025f}, {-0.4330127f, -0.75f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22627887f, 0.29489237f, -0.012940953f}, {-0.58801836f, -0.76632047f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.186903f, 0.3237255f, -0.019134171f}, {-0.46193975f, -0.8001031f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22550212f, 0.29388008f, -0.0065263095f}, {-0.6035534f, -0.7865661f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.18585184f, 0.32190484f, -0.012940953f}, {-0.4829629f, -0.83651626f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22524172f, 0.29354072f, -8.485931e-15f}, {-0.6087614f, -0.7933533f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.18521386f, 0.32079983f, -0.0065263095f}, {-0.49572244f, -0.8586165f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22550212f, 0.29388008f, 0.0065263095f}, {-0.6035534f, -0.7865661f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.18499999f, 0.32042938f, -8.485931e-15f}, {-0.5f, -0.8660254f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22627887f, 0.29489237f, 0.012940953f}, {-0.58801836f, -0.76632047f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.18521386f, 0.32079983f, 0.0065263095f}, {-0.49572244f, -0.8586165f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22755867f, 0.29656023f, 0.019134171f}, {-0.5624222f, -0.73296285f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.18585184f, 0.32190484f, 0.012940953f}, {-0.4829629f, -0.83651626f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22931965f, 0.2988552f, 0.025f}, {-0.52720284f, -0.6870641f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.186903f, 0.3237255f, 0.019134171f}, {-0.46193975f, -0.8001031f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23153163f, 0.3017379f, 0.030438071f}, {-0.4829629f, -0.6294095f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.18834937f, 0.32623065f, 0.025f}, {-0.4330127f, -0.75f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23415682f, 0.3051591f, 0.03535534f}, {-0.43045932f, -0.5609855f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.19016616f, 0.32937744f, 0.030438071f}, {-0.39667666f, -0.6870641f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23715027f, 0.30906025f, 0.039667666f}, {-0.37059048f, -0.4829629f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.19232233f, 0.33311203f, 0.03535534f}, {-0.35355338f, -0.6123724f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.24046075f, 0.31337455f, 0.04330127f}, {-0.3043807f, -0.39667666f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.19478096f, 0.33737049f, 0.039667666f}, {-0.3043807f, -0.52720284f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.24403164f, 0.3180282f, 0.046193976f}, {-0.2329629f, -0.30360317f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.19749999f, 0.34208f, 0.04330127f}, {-0.25f, -0.4330127f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.24780184f, 0.32294163f, 0.04829629f}, {-0.15755905f, -0.20533495f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.20043291f, 0.34715995f, 0.046193976f}, {-0.19134171f, -0.33141357f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2517068f, 0.3280307f, 0.049572244f}, {-0.07945931f, -0.103553385f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.20352952f, 0.35252345f, 0.04829629f}, {-0.12940952f, -0.22414386f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2556798f, 0.33320838f, 0.05f}, {-1.0331815e-13f, -1.3464684e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.20673683f, 0.3580787f, 0.049572244f}, {-0.06526309f, -0.11303899f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.25965276f, 0.33838606f, 0.049572244f}, {0.07945931f, 0.103553385f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.21f, 0.36373064f, 0.05f}, {-8.485931e-14f, -1.4698064e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.26355773f, 0.34347513f, 0.04829629f}, {0.15755905f, 0.20533495f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.21326315f, 0.3693826f, 0.049572244f}, {0.06526309f, 0.11303899f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.26732793f, 0.34838855f, 0.046193976f}, {0.2329629f, 0.30360317f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.21647047f, 0.37493783f, 0.04829629f}, {0.12940952f, 0.22414386f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27089882f, 0.35304222f, 0.04330127f}, {0.3043807f, 0.39667666f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.21956708f, 0.38030133f, 0.046193976f}, {0.19134171f, 0.33141357f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27420932f, 0.35735652f, 0.039667666f}, {0.37059048f, 0.4829629f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2225f, 0.38538128f, 0.04330127f}, {0.25f, 0.4330127f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27720276f, 0.36125767f, 0.03535534f}, {0.43045932f, 0.5609855f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22521903f, 0.3900908f, 0.039667666f}, {0.3043807f, 0.52720284f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27982792f, 0.36467886f, 0.030438071f}, {0.4829629f, 0.6294095f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22767766f, 0.39434925f, 0.03535534f}, {0.35355338f, 0.6123724f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.28203994f, 0.36756158f, 0.025f}, {0.52720284f, 0.6870641f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22983383f, 0.39808384f, 0.030438071f}, {0.39667666f, 0.6870641f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2838009f, 0.36985654f, 0.019134171f}, {0.5624222f, 0.73296285f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23165062f, 0.40123063f, 0.025f}, {0.4330127f, 0.75f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2850807f, 0.3715244f, 0.012940953f}, {0.58801836f, 0.76632047f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23309699f, 0.4037358f, 0.019134171f}, {0.46193975f, 0.8001031f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.28585747f, 0.3725367f, 0.0065263095f}, {0.6035534f, 0.7865661f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23414814f, 0.40555644f, 0.012940953f}, {0.4829629f, 0.83651626f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.28611785f, 0.37287605f, 0.0f}, {0.6087614f, 0.7933533f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23478612f, 0.40666145f, 0.0065263095f}, {0.49572244f, 0.8586165f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.235f, 0.4070319f, 0.0f}, {0.5f, 0.8660254f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.23478612f, 0.40666145f, -0.0065263095f}, {0.49572244f, 0.8586165f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17969751f, 0.43382815f, 0.0065263095f}, {0.37940952f, 0.91597563f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17986122f, 0.43422335f, 0.0f}, {0.38268343f, 0.9238795f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17920923f, 0.4326493f, -0.012940953f}, {0.3696438f, 0.8923991f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.1784047f, 0.43070704f, -0.019134171f}, {0.35355338f, 0.85355335f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17729771f, 0.4280345f, -0.025f}, {0.33141357f, 0.8001031f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.1759072f, 0.42467752f, -0.030438071f}, {0.30360317f, 0.73296285f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17425694f, 0.42069343f, -0.03535534f}, {0.27059805f, 0.65328145f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17237519f, 0.41615048f, -0.039667666f}, {0.2329629f, 0.5624222f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17029412f, 0.41112635f, -0.04330127f}, {0.19134171f, 0.46193975f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.16804937f, 0.40570703f, -0.046193976f}, {0.1464466f, 0.35355338f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.16567932f, 0.39998525f, -0.04829629f}, {0.09904576f, 0.23911761f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.16322455f, 0.39405888f, -0.049572244f}, {0.04995021f, 0.12059047f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.16072704f, 0.38802937f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.15822953f, 0.38199985f, -0.049572244f}, {-0.04995021f, -0.12059047f, -0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.15577476f, 0.37607348f, -0.04829629f}, {-0.09904576f, -0.23911761f, -0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.15340471f, 0.3703517f, -0.046193976f}, {-0.1464466f, -0.35355338f, -0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.15115996f, 0.3649324f, -0.04330127f}, {-0.19134171f, -0.46193975f, -0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14907889f, 0.35990825f, -0.039667666f}, {-0.2329629f, -0.5624222f, -0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14719714f, 0.3553653f, -0.03535534f}, {-0.27059805f, -0.65328145f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14554688f, 0.3513812f, -0.030438071f}, {-0.30360317f, -0.73296285f, -0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14415637f, 0.34802422f, -0.025f}, {-0.33141357f, -0.8001031f, -0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14304937f, 0.3453517f, -0.019134171f}, {-0.35355338f, -0.85355335f, -0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14224485f, 0.34340942f, -0.012940953f}, {-0.3696438f, -0.8923991f, -0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14175656f, 0.3422306f, -0.0065263095f}, {-0.37940952f, -0.91597563f, -0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14159286f, 0.34183538f, -8.485931e-15f}, {-0.38268343f, -0.9238795f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14175656f, 0.3422306f, 0.0065263095f}, {-0.37940952f, -0.91597563f, 0.13052619f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14224485f, 0.34340942f, 0.012940953f}, {-0.3696438f, -0.8923991f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14304937f, 0.3453517f, 0.019134171f}, {-0.35355338f, -0.85355335f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14415637f, 0.34802422f, 0.025f}, {-0.33141357f, -0.8001031f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14554688f, 0.3513812f, 0.030438071f}, {-0.30360317f, -0.73296285f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14719714f, 0.3553653f, 0.03535534f}, {-0.27059805f, -0.65328145f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14907889f, 0.35990825f, 0.039667666f}, {-0.2329629f, -0.5624222f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.15115996f, 0.3649324f, 0.04330127f}, {-0.19134171f, -0.46193975f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.15340471f, 0.3703517f, 0.046193976f}, {-0.1464466f, -0.35355338f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.15577476f, 0.37607348f, 0.04829629f}, {-0.09904576f, -0.23911761f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.15822953f, 0.38199985f, 0.049572244f}, {-0.04995021f, -0.12059047f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.16072704f, 0.38802937f, 0.05f}, {-6.49485e-14f, -1.5679955e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.16322455f, 0.39405888f, 0.049572244f}, {0.04995021f, 0.12059047f, 0.9914449f}, {0.95f, 0.75f, 0.2f}},
+		{{0.16567932f, 0.39998525f, 0.04829629f}, {0.09904576f, 0.23911761f, 0.9659258f}, {0.95f, 0.75f, 0.2f}},
+		{{0.16804937f, 0.40570703f, 0.046193976f}, {0.1464466f, 0.35355338f, 0.9238795f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17029412f, 0.41112635f, 0.04330127f}, {0.19134171f, 0.46193975f, 0.8660254f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17237519f, 0.41615048f, 0.039667666f}, {0.2329629f, 0.5624222f, 0.7933533f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17425694f, 0.42069343f, 0.03535534f}, {0.27059805f, 0.65328145f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.1759072f, 0.42467752f, 0.030438071f}, {0.30360317f, 0.73296285f, 0.6087614f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17729771f, 0.4280345f, 0.025f}, {0.33141357f, 0.8001031f, 0.5f}, {0.95f, 0.75f, 0.2f}},
+		{{0.1784047f, 0.43070704f, 0.019134171f}, {0.35355338f, 0.85355335f, 0.38268343f}, {0.95f, 0.75f, 0.2f}},
+		{{0.17920923f, 0.4326493f, 0.012940953f}, {0.3696438f, 0.8923991f, 0.25881904f}, {0.95f, 0.75f, 0.2f}},
+	};
+
+	constexpr uint16_t hintRingLevel0Indices[] = {
+		0, 1, 2, 3, 0, 2, 0, 4, 1, 3, 2, 5, 6, 4, 0, 7,
+		0, 3, 7, 6, 0, 8, 7, 3, 9, 6, 7, 8, 3, 10, 10, 3,
+		5, 11, 7, 8, 11, 9, 7, 12, 8, 10, 13, 11, 8, 13, 8, 12,
+		14, 9, 11, 15, 11, 13, 15, 14, 11, 16, 13, 12, 17, 15, 13, 17,
+		13, 16, 18, 14, 15, 19, 15, 17, 19, 18, 15, 20, 17, 16, 21, 19,
+		17, 21, 17, 20, 22, 18, 19, 23, 19, 21, 23, 22, 19, 24, 21, 20,
+		25, 23, 21, 25, 21, 24, 26, 22, 23, 27, 23, 25, 27, 26, 23, 28,
+		25, 24, 29, 27, 25, 29, 25, 28, 30, 26, 27, 31, 27, 29, 31, 30,
+		27, 32, 29, 28, 33, 31, 29, 33, 29, 32, 34, 30, 31, 35, 31, 33,
+		35, 34, 31, 36, 33, 32, 37, 35, 33, 37, 33, 36, 38, 34, 35, 39,
+		35, 37, 39, 38, 35, 40, 37, 36, 41, 39, 37, 41, 37, 40, 42, 38,
+		39, 43, 39, 41, 43, 42, 39, 44, 41, 40, 45, 43, 41, 45, 41, 44,
+		46, 42, 43, 47, 43, 45, 47, 46, 43, 48, 45, 44, 49, 47, 45, 49,
+		45, 48, 50, 46, 47, 51, 47, 49, 51, 50, 47, 52, 49, 48, 53, 51,
+		49, 53, 49, 52, 54, 50, 51, 55, 51, 53, 55, 54, 51, 56, 53, 52,
+		57, 55, 53, 57, 53, 56, 58, 54, 55, 59, 55, 57, 59, 58, 55, 60,
+		57, 56, 61, 59, 57, 61, 57, 60, 62, 58, 59, 63, 59, 61, 63, 62,
+		59, 64, 61, 60, 65, 63, 61, 65, 61, 64, 66, 62, 63, 67, 63, 65,
+		67, 66, 63, 68, 65, 64, 69, 67, 65, 69, 65, 68, 70, 66, 67, 71,
+		67, 69, 71, 70, 67, 72, 69, 68, 73, 71, 69, 73, 69, 72, 74, 70,
+		71, 75, 71, 73, 75, 74, 71, 76, 73, 72, 77, 75, 73, 77, 73, 76,
+		78, 74, 75, 79, 75, 77, 79, 78, 75, 80, 77, 76, 81, 79, 77, 81,
+		77, 80, 82, 78, 79, 83, 79, 81, 83, 82, 79, 84, 81, 80, 85, 83,
+		81, 85, 81, 84, 86, 82, 83, 87, 83, 85, 87, 86, 83, 88, 85, 84,
+		89, 87, 85, 89, 85, 88, 90, 86, 87, 91, 87, 89, 91, 90, 87, 92,
+		89, 88, 93, 91, 89, 93, 89, 92, 94, 90, 91, 95, 91, 93, 95, 94,
+		91, 96, 93, 92, 97, 95, 93, 97, 93, 96, 98, 94, 95, 99, 95, 97,
+		99, 98, 95, 100, 97, 96, 101, 99, 97, 101, 97, 100, 102, 98, 99, 103,
+		99, 101, 103, 102, 99, 104, 101, 100, 105, 103, 101, 105, 101, 104, 106, 102,
+		103, 107, 103, 105, 107, 106, 103, 108, 105, 104, 109, 107, 105, 109, 105, 108,
+		110, 106, 107, 111, 107, 109, 111, 110, 107, 112, 109, 108, 113, 111, 109, 113,
+		109, 112, 114, 110, 111, 115, 111, 113, 115, 114, 111, 116, 113, 112, 117, 115,
+		113, 117, 113, 116, 118, 114, 115, 119, 115, 117, 119, 118, 115, 120, 117, 116,
+		121, 119, 117, 121, 117, 120, 122, 118, 119, 123, 119, 121, 123, 122, 119, 124,
+		121, 120, 125, 123, 121, 125, 121, 124, 126, 122, 123, 127, 123, 125, 127, 126,
+		123, 128, 125, 124, 129, 127, 125, 129, 125, 128, 130, 126, 127, 131, 127, 129,
+		131, 130, 127, 132, 129, 128, 133, 131, 129, 133, 129, 132, 134, 130, 131, 135,
+		131, 133, 135, 134, 131, 136, 133, 132, 137, 135, 133, 137, 133, 136, 138, 134,
+		135, 139, 135, 137, 139, 138, 135, 140, 137, 136, 141, 139, 137, 141, 137, 140,
+		142, 138, 139, 143, 139, 141, 143, 142, 139, 144, 141, 140, 145, 143, 141, 145,
+		141, 144, 146, 142, 143, 147, 143, 145, 147, 146, 143, 148, 145, 144, 149, 147,
+		145, 149, 145, 148, 150, 146, 147, 151, 147, 149, 151, 150, 147, 152, 149, 148,
+		153, 151, 149, 153, 149, 152, 154, 150, 151, 155, 151, 153, 155, 154, 151, 156,
+		153, 152, 157, 155, 153, 157, 153, 156, 158, 154, 155, 159, 155, 157, 159, 158,
+		155, 160, 157, 156, 161, 159, 157, 161, 157, 160, 162, 158, 159, 163, 159, 161,
+		163, 162, 159, 164, 161, 160, 165, 163, 161, 165, 161, 164, 166, 162, 163, 167,
+		163, 165, 167, 166, 163, 168, 165, 164, 169, 167, 165, 169, 165, 168, 170, 166,
+		167, 171, 167, 169, 171, 170, 167, 172, 169, 168, 173, 171, 169, 173, 169, 172,
+		174, 170, 171, 175, 171, 173, 175, 174, 171, 176, 173, 172, 177, 175, 173, 177,
+		173, 176, 178, 174, 175, 179, 175, 177, 179, 178, 175, 180, 177, 176, 181, 179,
+		177, 181, 177, 180, 182, 178, 179, 183, 179, 181, 183, 182, 179, 184, 181, 180,
+		185, 183, 181, 185, 181, 184, 186, 182, 183, 187, 183, 185, 187, 186, 183, 188,
+		185, 184, 189, 187, 185, 189, 185, 188, 1, 187, 189, 2, 1, 189, 1, 190,
+		187, 190, 186, 187, 4, 190, 1, 2, 189, 191, 191, 189, 188, 5, 2, 191,
+		4, 192, 190, 5, 191, 193, 194, 192, 4, 6, 194, 4, 192, 195, 190, 190,
+		195, 186, 196, 194, 6, 9, 196, 6, 195, 197, 186, 186, 197, 182, 198, 196,
+		9, 14, 198, 9, 197, 199, 182, 182, 199, 178, 200, 198, 14, 18, 200, 14,
+		199, 201, 178, 178, 201, 174, 202, 200, 18, 22, 202, 18, 201, 203, 174, 174,
+		203, 170, 204, 202, 22, 26, 204, 22, 203, 205, 170, 170, 205, 166, 206, 204,
+		26, 30, 206, 26, 205, 207, 166, 166, 207, 162, 208, 206, 30, 34, 208, 30,
+		207, 209, 162, 162, 209, 158, 210, 208, 34, 38, 210, 34, 209, 211, 158, 158,
+		211, 154, 212, 210, 38, 42, 212, 38, 211, 213, 154, 154, 213, 150, 214, 212,
+		42, 46, 214, 42, 213, 215, 150, 150, 215, 146, 216, 214, 46, 50, 216, 46,
+		215, 217, 146, 146, 217, 142, 218, 216, 50, 54, 218, 50, 217, 219, 142, 142,
+		219, 138, 220, 218, 54, 58, 220, 54, 219, 221, 138, 138, 221, 134, 222, 220,
+		58, 62, 222, 58, 221, 223, 134, 134, 223, 130, 224, 222, 62, 66, 224, 62,
+		223, 225, 130, 130, 225, 126, 226, 224, 66, 70, 226, 66, 225, 227, 126, 126,
+		227, 122, 228, 226, 70, 74, 228, 70, 227, 229, 122, 122, 229, 118, 230, 228,
+		74, 78, 230, 74, 229, 231, 118, 118, 231, 114, 232, 230, 78, 82, 232, 78,
+		231, 233, 114, 114, 233, 110, 234, 232, 82, 86, 234, 82, 233, 235, 110, 110,
+		235, 106, 236, 234, 86, 90, 236, 86, 235, 237, 106, 106, 237, 102, 238, 236,
+		90, 94, 238, 90, 237, 239, 102, 102, 239, 98, 98, 240, 94, 239, 240, 98,
+		240, 238, 94, 237, 241, 239, 239, 242, 240, 241, 242, 239, 240, 243, 238, 242,
+		243, 240, 244, 241, 237, 235, 244, 237, 241, 245, 242, 246, 244, 235, 233, 246,
+		235, 244, 247, 241, 247, 245, 241, 246, 248, 244, 248, 247, 244, 249, 246, 233,
+		231, 249, 233, 250, 248, 246, 249, 250, 246, 251, 249, 231, 229, 251, 231, 252,
+		250, 249, 251, 252, 249, 253, 251, 229, 227, 253, 229, 254, 252, 251, 253, 254,
+		251, 255, 253, 227, 225, 255, 227, 256, 254, 253, 255, 256, 253, 257, 255, 225,
+		223, 257, 225, 258, 256, 255, 257, 258, 255, 259, 257, 223, 221, 259, 223, 260,
+		258, 257, 259, 260, 257, 261, 259, 221, 219, 261, 221, 262, 260, 259, 261, 262,
+		259, 263, 261, 219, 217, 263, 219, 264, 262, 261, 263, 264, 261, 265, 263, 217,
+		215, 265, 217, 266, 264, 263, 265, 266, 263, 267, 265, 215, 213, 267, 215, 268,
+		266, 265, 267, 268, 265, 269, 267, 213, 211, 269, 213, 270, 268, 267, 269, 270,
+		267, 271, 269, 211, 209, 271, 211, 272, 270, 269, 271, 272, 269, 273, 271, 209,
+		207, 273, 209, 274, 272, 271, 273, 274, 271, 275, 273, 207, 205, 275, 207, 276,
+		274, 273, 275, 276, 273, 277, 275, 205, 203, 277, 205, 278, 276, 275, 277, 278,
+		275, 279, 277, 203, 201, 279, 203, 280, 278, 277, 279, 280, 277, 281, 279, 201,
+		199, 281, 201, 282, 280, 279, 281, 282, 279, 283, 281, 199, 197, 283, 199, 284,
+		282, 281, 283, 284, 281, 285, 283, 197, 195, 285, 197, 286, 284, 283, 285, 286,
+		283, 287, 285, 195, 192, 287, 195, 288, 286, 285, 287, 288, 285, 289, 287, 192,
+		194, 289, 192, 290, 288, 287, 289, 290, 287, 291, 289, 194, 196, 291, 194, 292,
+		290, 289, 291, 292, 289, 293, 291, 196, 198, 293, 196, 294, 292, 291, 293, 294,
+		291, 295, 293, 198, 200, 295, 198, 296, 294, 293, 295, 296, 293, 297, 295, 200,
+		202, 297, 200, 298, 296, 295, 297, 298, 295, 299, 297, 202, 204, 299, 202, 300,
+		298, 297, 299, 300, 297, 301, 299, 204, 206, 301, 204, 302, 300, 299, 301, 302,
+		299, 303, 301, 206, 208, 303, 206, 304, 302, 301, 303, 304, 301, 305, 303, 208,
+		210, 305, 208, 306, 304, 303, 305, 306, 303, 307, 305, 210, 212, 307, 210, 308,
+		306, 305, 307, 308, 305, 309, 307, 212, 214, 309, 212, 310, 308, 307, 309, 310,
+		307, 311, 309, 214, 216, 311, 214, 312, 310, 309, 311, 312, 309, 313, 311, 216,
+		218, 313, 216, 314, 312, 311, 313, 314, 311, 315, 313, 218, 220, 315, 218, 316,
+		314, 313, 315, 316, 313, 317, 315, 220, 222, 317, 220, 318, 316, 315, 317, 318,
+		315, 319, 317, 222, 224, 319, 222, 320, 318, 317, 319, 320, 317, 321, 319, 224,
+		226, 321, 224, 322, 320, 319, 321, 322, 319, 323, 321, 226, 228, 323, 226, 324,
+		322, 321, 323, 324, 321, 325, 323, 228, 230, 325, 228, 326, 324, 323, 325, 326,
+		323, 327, 325, 230, 232, 327, 230, 328, 326, 325, 327, 328, 325, 329, 327, 232,
+		234, 329, 232, 330, 328, 327, 329, 330, 327, 331, 329, 234, 236, 331, 234, 332,
+		330, 329, 331, 332, 329, 333, 331, 236, 238, 333, 236, 243, 333, 238, 333, 334,
+		331, 334, 332, 331, 243, 335, 333, 335, 334, 333, 336, 335, 243, 242, 336, 243,
+		245, 336, 242, 335, 337, 334, 336, 338, 335, 338, 337, 335, 245, 339, 336, 339,
+		338, 336, 337, 340, 334, 334, 340, 332, 338, 341, 337, 340, 342, 332, 332, 342,
+		330, 337, 343, 340, 341, 343, 337, 340, 344, 342, 343, 344, 340, 342, 345, 330,
+		330, 345, 328, 344, 346, 342, 342, 346, 345, 345, 347, 328, 328, 347, 326, 346,
+		348, 345, 345, 348, 347, 347, 349, 326, 326, 349, 324, 348, 350, 347, 347, 350,
+		349, 349, 351, 324, 324, 351, 322, 350, 352, 349, 349, 352, 351, 351, 353, 322,
+		322, 353, 320, 352, 354, 351, 351, 354, 353, 353, 355, 320, 320, 355, 318, 354,
+		356, 353, 353, 356, 355, 355, 357, 318, 318, 357, 316, 356, 358, 355, 355, 358,
+		357, 357, 359, 316, 316, 359, 314, 358, 360, 357, 357, 360, 359, 359, 361, 314,
+		314, 361, 312, 360, 362, 359, 359, 362, 361, 361, 363, 312, 312, 363, 310, 362,
+		364, 361, 361, 364, 363, 363, 365, 310, 310, 365, 308, 364, 366, 363, 363, 366,
+		365, 365, 367, 308, 308, 367, 306, 366, 368, 365, 365, 368, 367, 367, 369, 306,
+		306, 369, 304, 368, 370, 367, 367, 370, 369, 369, 371, 304, 304, 371, 302, 370,
+		372, 369, 369, 372, 371, 371, 373, 302, 302, 373, 300, 372, 374, 371, 371, 374,
+		373, 373, 375, 300, 300, 375, 298, 374, 376, 373, 373, 376, 375, 375, 377, 298,
+		298, 377, 296, 376, 378, 375, 375, 378, 377, 377, 379, 296, 296, 379, 294, 378,
+		380, 377, 377, 380, 379, 379, 381, 294, 294, 381, 292, 380, 382, 379, 379, 382,
+		381, 381, 383, 292, 292, 383, 290, 382, 384, 381, 381, 384, 383, 383, 385, 290,
+		290, 385, 288, 384, 386, 383, 383, 386, 385, 385, 387, 288, 288, 387, 286, 386,
+		388, 385, 385, 388, 387, 387, 389, 286, 286, 389, 284, 388, 390, 387, 387, 390,
+		389, 389, 391, 284, 284, 391, 282, 390, 392, 389, 389, 392, 391, 391, 393, 282,
+		282, 393, 280, 392, 394, 391, 391, 394, 393, 393, 395, 280, 280, 395, 278, 394,
+		396, 393, 393, 396, 395, 395, 397, 278, 278, 397, 276, 396, 398, 395, 395, 398,
+		397, 397, 399, 276, 276, 399, 274, 398, 400, 397, 397, 400, 399, 399, 401, 274,
+		274, 401, 272, 400, 402, 399, 399, 402, 401, 401, 403, 272, 272, 403, 270, 402,
+		404, 401, 401, 404, 403, 403, 405, 270, 270, 405, 268, 404, 406, 403, 403, 406,
+		405, 405, 407, 268, 268, 407, 266, 406, 408, 405, 405, 408, 407, 407, 409, 266,
+		266, 409, 264, 408, 410, 407, 407, 410, 409, 409, 411, 264, 264, 411, 262, 410,
+		412, 409, 409, 412, 411, 411, 413, 262, 262, 413, 260, 412, 414, 411, 411, 414,
+		413, 413, 415, 260, 260, 415, 258, 414, 416, 413, 413, 416, 415, 415, 417, 258,
+		258, 417, 256, 416, 418, 415, 415, 418, 417, 417, 419, 256, 256, 419, 254, 418,
+		420, 417, 417, 420, 419, 419, 421, 254, 254, 421, 252, 420, 422, 419, 419, 422,
+		421, 421, 423, 252, 252, 423, 250, 422, 424, 421, 421, 424, 423, 423, 425, 250,
+		250, 425, 248, 424, 426, 423, 423, 426, 425, 425, 427, 248, 248, 427, 247, 426,
+		428, 425, 425, 428, 427, 427, 429, 247, 247, 429, 245, 429, 339, 245, 427, 430,
+		429, 428, 430, 427, 429, 431, 339, 430, 431, 429, 431, 432, 339, 339, 432, 338,
+		432, 341, 338, 430, 433, 431, 431, 434, 432, 433, 434, 431, 432, 435, 341, 434,
+		435, 432, 436, 433, 430, 428, 436, 430, 433, 437, 434, 438, 436, 428, 426, 438,
+		428, 436, 439, 433, 439, 437, 433, 438, 440, 436, 440, 439, 436, 441, 438, 426,
+		424, 441, 426, 442, 440, 438, 441, 442, 438, 443, 441, 424, 422, 443, 424, 444,
+		442, 441, 443, 444, 441, 445, 443, 422, 420, 445, 422, 446, 444, 443, 445, 446,
+		443, 447, 445, 420, 418, 447, 420, 448, 446, 445, 447, 448, 445, 449, 447, 418,
+		416, 449, 418, 450, 448, 447, 449, 450, 447, 451, 449, 416, 414, 451, 416, 452,
+		450, 449, 451, 452, 449, 453, 451, 414, 412, 453, 414, 454, 452, 451, 453, 454,
+		451, 455, 453, 412, 410, 455, 412, 456, 454, 453, 455, 456, 453, 457, 455, 410,
+		408, 457, 410, 458, 456, 455, 457, 458, 455, 459, 457, 408, 406, 459, 408, 460,
+		458, 457, 459, 460, 457, 461, 459, 406, 404, 461, 406, 462, 460, 459, 461, 462,
+		459, 463, 461, 404, 402, 463, 404, 464, 462, 461, 463, 464, 461, 465, 463, 402,
+		400, 465, 402, 466, 464, 463, 465, 466, 463, 467, 465, 400, 398, 467, 400, 468,
+		466, 465, 467, 468, 465, 469, 467, 398, 396, 469, 398, 470, 468, 467, 469, 470,
+		467, 471, 469, 396, 394, 471, 396, 472, 470, 469, 471, 472, 469, 473, 471, 394,
+		392, 473, 394, 474, 472, 471, 473, 474, 471, 475, 473, 392, 390, 475, 392, 476,
+		474, 473, 475, 476, 473, 477, 475, 390, 388, 477, 390, 478, 476, 475, 477, 478,
+		475, 479, 477, 388, 386, 479, 388, 480, 478, 477, 479, 480, 477, 481, 479, 386,
+		384, 481, 386, 482, 480, 479, 481, 482, 479, 483, 481, 384, 382, 483, 384, 484,
+		482, 481, 483, 484, 481, 485, 483, 382, 380, 485, 382, 486, 484, 483, 485, 486,
+		483, 487, 485, 380, 378, 487, 380, 488, 486, 485, 487, 488, 485, 489, 487, 378,
+		376, 489, 378, 490, 488, 487, 489, 490, 487, 491, 489, 376, 374, 491, 376, 492,
+		490, 489, 491, 492, 489, 493, 491, 374, 372, 493, 374, 494, 492, 491, 493, 494,
+		491, 495, 493, 372, 370, 495, 372, 496, 494, 493, 495, 496, 493, 497, 495, 370,
+		368, 497, 370, 498, 496, 495, 497, 498, 495, 499, 497, 368, 366, 499, 368, 500,
+		498, 497, 499, 500, 497, 501, 499, 366, 364, 501, 366, 502, 500, 499, 501, 502,
+		499, 503, 501, 364, 362, 503, 364, 504, 502, 501, 503, 504, 501, 505, 503, 362,
+		360, 505, 362, 506, 504, 503, 505, 506, 503, 507, 505, 360, 358, 507, 360, 508,
+		506, 505, 507, 508, 505, 509, 507, 358, 356, 509, 358, 510, 508, 507, 509, 510,
+		507, 511, 509, 356, 354, 511, 356, 512, 510, 509, 511, 512, 509, 513, 511, 354,
+		352, 513, 354, 514, 512, 511, 513, 514, 511, 515, 513, 352, 350, 515, 352, 516,
+		514, 513, 515, 516, 513, 517, 515, 350, 348, 517, 350, 518, 516, 515, 517, 518,
+		515, 519, 517, 348, 346, 519, 348, 520, 518, 517, 519, 520, 517, 521, 519, 346,
+		344, 521, 346, 522, 520, 519, 521, 522, 519, 523, 521, 344, 343, 523, 344, 524,
+		522, 521, 523, 524, 521, 525, 523, 343, 341, 525, 343, 435, 525, 341, 525, 526,
+		523, 526, 524, 523, 435, 527, 525, 527, 526, 525, 528, 527, 435, 434, 528, 435,
+		437, 528, 434, 527, 529, 526, 528, 530, 527, 530, 529, 527, 437, 531, 528, 531,
+		530, 528, 529, 532, 526, 526, 532, 524, 530, 533, 529, 532, 534, 524, 524, 534,
+		522, 529, 535, 532, 533, 535, 529, 532, 536, 534, 535, 536, 532, 534, 537, 522,
+		522, 537, 520, 536, 538, 534, 534, 538, 537, 537, 539, 520, 520, 539, 518, 538,
+		540, 537, 537, 540, 539, 539, 541, 518, 518, 541, 516, 540, 542, 539, 539, 542,
+		541, 541, 543, 516, 516, 543, 514, 542, 544, 541, 541, 544, 543, 543, 545, 514,
+		514, 545, 512, 544, 546, 543, 543, 546, 545, 545, 547, 512, 512, 547, 510, 546,
+		548, 545, 545, 548, 547, 547, 549, 510, 510, 549, 508, 548, 550, 547, 547, 550,
+		549, 549, 551, 508, 508, 551, 506, 550, 552, 549, 549, 552, 551, 551, 553, 506,
+		506, 553, 504, 552, 554, 551, 551, 554, 553, 553, 555, 504, 504, 555, 502, 554,
+		556, 553, 553, 556, 555, 555, 557, 502, 502, 557, 500, 556, 558, 555, 555, 558,
+		557, 557, 559, 500, 500, 559, 498, 558, 560, 557, 557, 560, 559, 559, 561, 498,
+		498, 561, 496, 560, 562, 559, 559, 562, 561, 561, 563, 496, 496, 563, 494, 562,
+		564, 561, 561, 564, 563, 563, 565, 494, 494, 565, 492, 564, 566, 563, 563, 566,
+		565, 565, 567, 492, 492, 567, 490, 566, 568, 565, 565, 568, 567, 567, 569, 490,
+		490, 569, 488, 568, 570, 567, 567, 570, 569, 569, 571, 488, 488, 571, 486, 570,
+		572, 569, 569, 572, 571, 571, 573, 486, 486, 573, 484, 572, 574, 571, 571, 574,
+		573, 573, 575, 484, 484, 575, 482, 574, 576, 573, 573, 576, 575, 575, 577, 482,
+		482, 577, 480, 576, 578, 575, 575, 578, 577, 577, 579, 480, 480, 579, 478, 578,
+		580, 577, 577, 580, 579, 579, 581, 478, 478, 581, 476, 580, 582, 579, 579, 582,
+		581, 581, 583, 476, 476, 583, 474, 582, 584, 581, 581, 584, 583, 583, 585, 474,
+		474, 585, 472, 584, 586, 583, 583, 586, 585, 585, 587, 472, 472, 587, 470, 586,
+		588, 585, 585, 588, 587, 587, 589, 470, 470, 589, 468, 588, 590, 587, 587, 590,
+		589, 589, 591, 468, 468, 591, 466, 590, 592, 589, 589, 592, 591, 591, 593, 466,
+		466, 593, 464, 592, 594, 591, 591, 594, 593, 593, 595, 464, 464, 595, 462, 594,
+		596, 593, 593, 596, 595, 595, 597, 462, 462, 597, 460, 596, 598, 595, 595, 598,
+		597, 597, 599, 460, 460, 599, 458, 598, 600, 597, 597, 600, 599, 599, 601, 458,
+		458, 601, 456, 600, 602, 599, 599, 602, 601, 601, 603, 456, 456, 603, 454, 602,
+		604, 601, 601, 604, 603, 603, 605, 454, 454, 605, 452, 604, 606, 603, 603, 606,
+		605, 605, 607, 452, 452, 607, 450, 606, 608, 605, 605, 608, 607, 607, 609, 450,
+		450, 609, 448, 608, 610, 607, 607, 610, 609, 609, 611, 448, 448, 611, 446, 610,
+		612, 609, 609, 612, 611, 611, 613, 446, 446, 613, 444, 612, 614, 611, 611, 614,
+		613, 613, 615, 444, 444, 615, 442, 614, 616, 613, 613, 616, 615, 615, 617, 442,
+		442, 617, 440, 616, 618, 615, 615, 618, 617, 617, 619, 440, 440, 619, 439, 618,
+		620, 617, 617, 620, 619, 619, 621, 439, 439, 621, 437, 621, 531, 437, 619, 622,
+		621, 620, 622, 619, 621, 623, 531, 622, 623, 621, 623, 624, 531, 531, 624, 530,
+		624, 533, 530, 622, 625, 623, 623, 626, 624, 625, 626, 623, 624, 627, 533, 626,
+		627, 624, 628, 625, 622, 620, 628, 622, 625, 629, 626, 630, 628, 620, 618, 630,
+		620, 628, 631, 625, 631, 629, 625, 630, 632, 628, 632, 631, 628, 633, 630, 618,
+		616, 633, 618, 634, 632, 630, 633, 634, 630, 635, 633, 616, 614, 635, 616, 636,
+		634, 633, 635, 636, 633, 637, 635, 614, 612, 637, 614, 638, 636, 635, 637, 638,
+		635, 639, 637, 612, 610, 639, 612, 640, 638, 637, 639, 640, 637, 641, 639, 610,
+		608, 641, 610, 642, 640, 639, 641, 642, 639, 643, 641, 608, 606, 643, 608, 644,
+		642, 641, 643, 644, 641, 645, 643, 606, 604, 645, 606, 646, 644, 643, 645, 646,
+		643, 647, 645, 604, 602, 647, 604, 648, 646, 645, 647, 648, 645, 649, 647, 602,
+		600, 649, 602, 650, 648, 647, 649, 650, 647, 651, 649, 600, 598, 651, 600, 652,
+		650, 649, 651, 652, 649, 653, 651, 598, 596, 653, 598, 654, 652, 651, 653, 654,
+		651, 655, 653, 596, 594, 655, 596, 656, 654, 653, 655, 656, 653, 657, 655, 594,
+		592, 657, 594, 658, 656, 655, 657, 658, 655, 659, 657, 592, 590, 659, 592, 660,
+		658, 657, 659, 660, 657, 661, 659, 590, 588, 661, 590, 662, 660, 659, 661, 662,
+		659, 663, 661, 588, 586, 663, 588, 664, 662, 661, 663, 664, 661, 665, 663, 586,
+		584, 665, 586, 666, 664, 663, 665, 666, 663, 667, 665, 584, 582, 667, 584, 668,
+		666, 665, 667, 668, 665, 669, 667, 582, 580, 669, 582, 670, 668, 667, 669, 670,
+		667, 671, 669, 580, 578, 671, 580, 672, 670, 669, 671, 672, 669, 673, 671, 578,
+		576, 673, 578, 674, 672, 671, 673, 674, 671, 675, 673, 576, 574, 675, 576, 676,
+		674, 673, 675, 676, 673, 677, 675, 574, 572, 677, 574, 678, 676, 675, 677, 678,
+		675, 679, 677, 572, 570, 679, 572, 680, 678, 677, 679, 680, 677, 681, 679, 570,
+		568, 681, 570, 682, 680, 679, 681, 682, 679, 683, 681, 568, 566, 683, 568, 684,
+		682, 681, 683, 684, 681, 685, 683, 566, 564, 685, 566, 686, 684, 683, 685, 686,
+		683, 687, 685, 564, 562, 687, 564, 688, 686, 685, 687, 688, 685, 689, 687, 562,
+		560, 689, 562, 690, 688, 687, 689, 690, 687, 691, 689, 560, 558, 691, 560, 692,
+		690, 689, 691, 692, 689, 693, 691, 558, 556, 693, 558, 694, 692, 691, 693, 694,
+		691, 695, 693, 556, 554, 695, 556, 696, 694, 693, 695, 696, 693, 697, 695, 554,
+		552, 697, 554, 698, 696, 695, 697, 698, 695, 699, 697, 552, 550, 699, 552, 700,
+		698, 697, 699, 700, 697, 701, 699, 550, 548, 701, 550, 702, 700, 699, 701, 702,
+		699, 703, 701, 548, 546, 703, 548, 704, 702, 701, 703, 704, 701, 705, 703, 546,
+		544, 705, 546, 706, 704, 703, 705, 706, 703, 707, 705, 544, 542, 707, 544, 708,
+		706, 705, 707, 708, 705, 709, 707, 542, 540, 709, 542, 710, 708, 707, 709, 710,
+		707, 711, 709, 540, 538, 711, 540, 712, 710, 709, 711, 712, 709, 713, 711, 538,
+		536, 713, 538, 714, 712, 711, 713, 714, 711, 715, 713, 536, 535, 715, 536, 716,
+		714, 713, 715, 716, 713, 717, 715, 535, 533, 717, 535, 627, 717, 533, 717, 718,
+		715, 718, 716, 715, 627, 719, 717, 719, 718, 717, 720, 719, 627, 626, 720, 627,
+		629, 720, 626, 719, 721, 718, 720, 722, 719, 722, 721, 719, 629, 723, 720, 723,
+		722, 720, 721, 724, 718, 718, 724, 716, 722, 725, 721, 724, 726, 716, 716, 726,
+		714, 721, 727, 724, 725, 727, 721, 724, 728, 726, 727, 728, 724, 726, 729, 714,
+		714, 729, 712, 728, 730, 726, 726, 730, 729, 729, 731, 712, 712, 731, 710, 730,
+		732, 729, 729, 732, 731, 731, 733, 710, 710, 733, 708, 732, 734, 731, 731, 734,
+		733, 733, 735, 708, 708, 735, 706, 734, 736, 733, 733, 736, 735, 735, 737, 706,
+		706, 737, 704, 736, 738, 735, 735, 738, 737, 737, 739, 704, 704, 739, 702, 738,
+		740, 737, 737, 740, 739, 739, 741, 702, 702, 741, 700, 740, 742, 739, 739, 742,
+		741, 741, 743, 700, 700, 743, 698, 742, 744, 741, 741, 744, 743, 743, 745, 698,
+		698, 745, 696, 744, 746, 743, 743, 746, 745, 745, 747, 696, 696, 747, 694, 746,
+		748, 745, 745, 748, 747, 747, 749, 694, 694, 749, 692, 748, 750, 747, 747, 750,
+		749, 749, 751, 692, 692, 751, 690, 750, 752, 749, 749, 752, 751, 751, 753, 690,
+		690, 753, 688, 752, 754, 751, 751, 754, 753, 753, 755, 688, 688, 755, 686, 754,
+		756, 753, 753, 756, 755, 755, 757, 686, 686, 757, 684, 756, 758, 755, 755, 758,
+		757, 757, 759, 684, 684, 759, 682, 758, 760, 757, 757, 760, 759, 759, 761, 682,
+		682, 761, 680, 760, 762, 759, 759, 762, 761, 761, 763, 680, 680, 763, 678, 762,
+		764, 761, 761, 764, 763, 763, 765, 678, 678, 765, 676, 764, 766, 763, 763, 766,
+		765, 765, 767, 676, 676, 767, 674, 766, 768, 765, 765, 768, 767, 767, 769, 674,
+		674, 769, 672, 768, 770, 767, 767, 770, 769, 769, 771, 672, 672, 771, 670, 770,
+		772, 769, 769, 772, 771, 771, 773, 670, 670, 773, 668, 772, 774, 771, 771, 774,
+		773, 773, 775, 668, 668, 775, 666, 774, 776, 773, 773, 776, 775, 775, 777, 666,
+		666, 777, 664, 776, 778, 775, 775, 778, 777, 777, 779, 664, 664, 779, 662, 778,
+		780, 777, 777, 780, 779, 779, 781, 662, 662, 781, 660, 780, 782, 779, 779, 782,
+		781, 781, 783, 660, 660, 783, 658, 782, 784, 781, 781, 784, 783, 783, 785, 658,
+		658, 785, 656, 784, 786, 783, 783, 786, 785, 785, 787, 656, 656, 787, 654, 786,
+		788, 785, 785, 788, 787, 787, 789, 654, 654, 789, 652, 788, 790, 787, 787, 790,
+		789, 789, 791, 652, 652, 791, 650, 790, 792, 789, 789, 792, 791, 791, 793, 650,
+		650, 793, 648, 792, 794, 791, 791, 794, 793, 793, 795, 648, 648, 795, 646, 794,
+		796, 793, 793, 796, 795, 795, 797, 646, 646, 797, 644, 796, 798, 795, 795, 798,
+		797, 797, 799, 644, 644, 799, 642, 798, 800, 797, 797, 800, 799, 799, 801, 642,
+		642, 801, 640, 800, 802, 799, 799, 802, 801, 801, 803, 640, 640, 803, 638, 802,
+		804, 801, 801, 804, 803, 803, 805, 638, 638, 805, 636, 804, 806, 803, 803, 806,
+		805, 805, 807, 636, 636, 807, 634, 806, 808, 805, 805, 808, 807, 807, 809, 634,
+		634, 809, 632, 808, 810, 807, 807, 810, 809, 809, 811, 632, 632, 811, 631, 810,
+		812, 809, 809, 812, 811, 811, 813, 631, 631, 813, 629, 813, 723, 629, 811, 814,
+		813, 812, 814, 811, 813, 815, 723, 814, 815, 813, 815, 816, 723, 723, 816, 722,
+		816, 725, 722, 814, 817, 815, 815, 818, 816, 817, 818, 815, 816, 819, 725, 818,
+		819, 816, 820, 817, 814, 812, 820, 814, 817, 821, 818, 822, 820, 812, 810, 822,
+		812, 820, 823, 817, 823, 821, 817, 822, 824, 820, 824, 823, 820, 825, 822, 810,
+		808, 825, 810, 826, 824, 822, 825, 826, 822, 827, 825, 808, 806, 827, 808, 828,
+		826, 825, 827, 828, 825, 829, 827, 806, 804, 829, 806, 830, 828, 827, 829, 830,
+		827, 831, 829, 804, 802, 831, 804, 832, 830, 829, 831, 832, 829, 833, 831, 802,
+		800, 833, 802, 834, 832, 831, 833, 834, 831, 835, 833, 800, 798, 835, 800, 836,
+		834, 833, 835, 836, 833, 837, 835, 798, 796, 837, 798, 838, 836, 835, 837, 838,
+		835, 839, 837, 796, 794, 839, 796, 840, 838, 837, 839, 840, 837, 841, 839, 794,
+		792, 841, 794, 842, 840, 839, 841, 842, 839, 843, 841, 792, 790, 843, 792, 844,
+		842, 841, 843, 844, 841, 845, 843, 790, 788, 845, 790, 846, 844, 843, 845, 846,
+		843, 847, 845, 788, 786, 847, 788, 848, 846, 845, 847, 848, 845, 849, 847, 786,
+		784, 849, 786, 850, 848, 847, 849, 850, 847, 851, 849, 784, 782, 851, 784, 852,
+		850, 849, 851, 852, 849, 853, 851, 782, 780, 853, 782, 854, 852, 851, 853, 854,
+		851, 855, 853, 780, 778, 855, 780, 856, 854, 853, 855, 856, 853, 857, 855, 778,
+		776, 857, 778, 858, 856, 855, 857, 858, 855, 859, 857, 776, 774, 859, 776, 860,
+		858, 857, 859, 860, 857, 861, 859, 774, 772, 861, 774, 862, 860, 859, 861, 862,
+		859, 863, 861, 772, 770, 863, 772, 864, 862, 861, 863, 864, 861, 865, 863, 770,
+		768, 865, 770, 866, 864, 863, 865, 866, 863, 867, 865, 768, 766, 867, 768, 868,
+		866, 865, 867, 868, 865, 869, 867, 766, 764, 869, 766, 870, 868, 867, 869, 870,
+		867, 871, 869, 764, 762, 871, 764, 872, 870, 869, 871, 872, 869, 873, 871, 762,
+		760, 873, 762, 874, 872, 871, 873, 874, 871, 875, 873, 760, 758, 875, 760, 876,
+		874, 873, 875, 876, 873, 877, 875, 758, 756, 877, 758, 878, 876, 875, 877, 878,
+		875, 879, 877, 756, 754, 879, 756, 880, 878, 877, 879, 880, 877, 881, 879, 754,
+		752, 881, 754, 882, 880, 879, 881, 882, 879, 883, 881, 752, 750, 883, 752, 884,
+		882, 881, 883, 884, 881, 885, 883, 750, 748, 885, 750, 886, 884, 883, 885, 886,
+		883, 887, 885, 748, 746, 887, 748, 888, 886, 885, 887, 888, 885, 889, 887, 746,
+		744, 889, 746, 890, 888, 887, 889, 890, 887, 891, 889, 744, 742, 891, 744, 892,
+		890, 889, 891, 892, 889, 893, 891, 742, 740, 893, 742, 894, 892, 891, 893, 894,
+		891, 895, 893, 740, 738, 895, 740, 896, 894, 893, 895, 896, 893, 897, 895, 738,
+		736, 897, 738, 898, 896, 895, 897, 898, 895, 899, 897, 736, 734, 899, 736, 900,
+		898, 897, 899, 900, 897, 901, 899, 734, 732, 901, 734, 902, 900, 899, 901, 902,
+		899, 903, 901, 732, 730, 903, 732, 904, 902, 901, 903, 904, 901, 905, 903, 730,
+		728, 905, 730, 906, 904, 903, 905, 906, 903, 907, 905, 728, 727, 907, 728, 908,
+		906, 905, 907, 908, 905, 909, 907, 727, 725, 909, 727, 819, 909, 725, 909, 910,
+		907, 910, 908, 907, 819, 911, 909, 911, 910, 909, 912, 911, 819, 818, 912, 819,
+		821, 912, 818, 911, 913, 910, 912, 914, 911, 914, 913, 911, 821, 915, 912, 915,
+		914, 912, 913, 916, 910, 910, 916, 908, 914, 917, 913, 916, 918, 908, 908, 918,
+		906, 913, 919, 916, 917, 919, 913, 916, 920, 918, 919, 920, 916, 918, 921, 906,
+		906, 921, 904, 920, 922, 918, 918, 922, 921, 921, 923, 904, 904, 923, 902, 922,
+		924, 921, 921, 924, 923, 923, 925, 902, 902, 925, 900, 924, 926, 923, 923, 926,
+		925, 925, 927, 900, 900, 927, 898, 926, 928, 925, 925, 928, 927, 927, 929, 898,
+		898, 929, 896, 928, 930, 927, 927, 930, 929, 929, 931, 896, 896, 931, 894, 930,
+		932, 929, 929, 932, 931, 931, 933, 894, 894, 933, 892, 932, 934, 931, 931, 934,
+		933, 933, 935, 892, 892, 935, 890, 934, 936, 933, 933, 936, 935, 935, 937, 890,
+		890, 937, 888, 936, 938, 935, 935, 938, 937, 937, 939, 888, 888, 939, 886, 938,
+		940, 937, 937, 940, 939, 939, 941, 886, 886, 941, 884, 940, 942, 939, 939, 942,
+		941, 941, 943, 884, 884, 943, 882, 942, 944, 941, 941, 944, 943, 943, 945, 882,
+		882, 945, 880, 944, 946, 943, 943, 946, 945, 945, 947, 880, 880, 947, 878, 946,
+		948, 945, 945, 948, 947, 947, 949, 878, 878, 949, 876, 948, 950, 947, 947, 950,
+		949, 949, 951, 876, 876, 951, 874, 950, 952, 949, 949, 952, 951, 951, 953, 874,
+		874, 953, 872, 952, 954, 951, 951, 954, 953, 953, 955, 872, 872, 955, 870, 954,
+		956, 953, 953, 956, 955, 955, 957, 870, 870, 957, 868, 956, 958, 955, 955, 958,
+		957, 957, 959, 868, 868, 959, 866, 958, 960, 957, 957, 960, 959, 959, 961, 866,
+		866, 961, 864, 960, 962, 959, 959, 962, 961, 961, 963, 864, 864, 963, 862, 962,
+		964, 961, 961, 964, 963, 963, 965, 862, 862, 965, 860, 964, 966, 963, 963, 966,
+		965, 965, 967, 860, 860, 967, 858, 966, 968, 965, 965, 968, 967, 967, 969, 858,
+		858, 969, 856, 968, 970, 967, 967, 970, 969, 969, 971, 856, 856, 971, 854, 970,
+		972, 969, 969, 972, 971, 971, 973, 854, 854, 973, 852, 972, 974, 971, 971, 974,
+		973, 973, 975, 852, 852, 975, 850, 974, 976, 973, 973, 976, 975, 975, 977, 850,
+		850, 977, 848, 976, 978, 975, 975, 978, 977, 977, 979, 848, 848, 979, 846, 978,
+		980, 977, 977, 980, 979, 979, 981, 846, 846, 981, 844, 980, 982, 979, 979, 982,
+		981, 981, 983, 844, 844, 983, 842, 982, 984, 981, 981, 984, 983, 983, 985, 842,
+		842, 985, 840, 984, 986, 983, 983, 986, 985, 985, 987, 840, 840, 987, 838, 986,
+		988, 985, 985, 988, 987, 987, 989, 838, 838, 989, 836, 988, 990, 987, 987, 990,
+		989, 989, 991, 836, 836, 991, 834, 990, 992, 989, 989, 992, 991, 991, 993, 834,
+		834, 993, 832, 992, 994, 991, 991, 994, 993, 993, 995, 832, 832, 995, 830, 994,
+		996, 993, 993, 996, 995, 995, 997, 830, 830, 997, 828, 996, 998, 995, 995, 998,
+		997, 997, 999, 828, 828, 999, 826, 998, 1000, 997, 997, 1000, 999, 999, 1001, 826,
+		826, 1001, 824, 1000, 1002, 999, 999, 1002, 1001, 1001, 1003, 824, 824, 1003, 823, 1002,
+		1004, 1001, 1001, 1004, 1003, 1003, 1005, 823, 823, 1005, 821, 1005, 915, 821, 1003, 1006,
+		1005, 1004, 1006, 1003, 1005, 1007, 915, 1006, 1007, 1005, 1007, 1008, 915, 915, 1008, 914,
+		1008, 917, 914, 1006, 1009, 1007, 1007, 1010, 1008, 1009, 1010, 1007, 1008, 1011, 917, 1010,
+		1011, 1008, 1012, 1009, 1006, 1004, 1012, 1006, 1009, 1013, 1010, 1014, 1012, 1004, 1002, 1014,
+		1004, 1012, 1015, 1009, 1015, 1013, 1009, 1014, 1016, 1012, 1016, 1015, 1012, 1017, 1014, 1002,
+		1000, 1017, 1002, 1018, 1016, 1014, 1017, 1018, 1014, 1019, 1017, 1000, 998, 1019, 1000, 1020,
+		1018, 1017, 1019, 1020, 1017, 1021, 1019, 998, 996, 1021, 998, 1022, 1020, 1019, 1021, 1022,
+		1019, 1023, 1021, 996, 994, 1023, 996, 1024, 1022, 1021, 1023, 1024, 1021, 1025, 1023, 994,
+		992, 1025, 994, 1026, 1024, 1023, 1025, 1026, 1023, 1027, 1025, 992, 990, 1027, 992, 1028,
+		1026, 1025, 1027, 1028, 1025, 1029, 1027, 990, 988, 1029, 990, 1030, 1028, 1027, 1029, 1030,
+		1027, 1031, 1029, 988, 986, 1031, 988, 1032, 1030, 1029, 1031, 1032, 1029, 1033, 1031, 986,
+		984, 1033, 986, 1034, 1032, 1031, 1033, 1034, 1031, 1035, 1033, 984, 982, 1035, 984, 1036,
+		1034, 1033, 1035, 1036, 1033, 1037, 1035, 982, 980, 1037, 982, 1038, 1036, 1035, 1037, 1038,
+		1035, 1039, 1037, 980, 978, 1039, 980, 1040, 1038, 1037, 1039, 1040, 1037, 1041, 1039, 978,
+		976, 1041, 978, 1042, 1040, 1039, 1041, 1042, 1039, 1043, 1041, 976, 974, 1043, 976, 1044,
+		1042, 1041, 1043, 1044, 1041, 1045, 1043, 974, 972, 1045, 974, 1046, 1044, 1043, 1045, 1046,
+		1043, 1047, 1045, 972, 970, 1047, 972, 1048, 1046, 1045, 1047, 1048, 1045, 1049, 1047, 970,
+		968, 1049, 970, 1050, 1048, 1047, 1049, 1050, 1047, 1051, 1049, 968, 966, 1051, 968, 1052,
+		1050, 1049, 1051, 1052, 1049, 1053, 1051, 966, 964, 1053, 966, 1054, 1052, 1051, 1053, 1054,
+		1051, 1055, 1053, 964, 962, 1055, 964, 1056, 1054, 1053, 1055, 1056, 1053, 1057, 1055, 962,
+		960, 1057, 962, 1058, 1056, 1055, 1057, 1058, 1055, 1059, 1057, 960, 958, 1059, 960, 1060,
+		1058, 1057, 1059, 1060, 1057, 1061, 1059, 958, 956, 1061, 958, 1062, 1060, 1059, 1061, 1062,
+		1059, 1063, 1061, 956, 954, 1063, 956, 1064, 1062, 1061, 1063, 1064, 1061, 1065, 1063, 954,
+		952, 1065, 954, 1066, 1064, 1063, 1065, 1066, 1063, 1067, 1065, 952, 950, 1067, 952, 1068,
+		1066, 1065, 1067, 1068, 1065, 1069, 1067, 950, 948, 1069, 950, 1070, 1068, 1067, 1069, 1070,
+		1067, 1071, 1069, 948, 946, 1071, 948, 1072, 1070, 1069, 1071, 1072, 1069, 1073, 1071, 946,
+		944, 1073, 946, 1074, 1072, 1071, 1073, 1074, 1071, 1075, 1073, 944, 942, 1075, 944, 1076,
+		1074, 1073, 1075, 1076, 1073, 1077, 1075, 942, 940, 1077, 942, 1078, 1076, 1075, 1077, 1078,
+		1075, 1079, 1077, 940, 938, 1079, 940, 1080, 1078, 1077, 1079, 1080, 1077, 1081, 1079, 938,
+		936, 1081, 938, 1082, 1080, 1079, 1081, 1082, 1079, 1083, 1081, 936, 934, 1083, 936, 1084,
+		1082, 1081, 1083, 1084, 1081, 1085, 1083, 934, 932, 1085, 934, 1086, 1084, 1083, 1085, 1086,
+		1083, 1087, 1085, 932, 930, 1087, 932, 1088, 1086, 1085, 1087, 1088, 1085, 1089, 1087, 930,
+		928, 1089, 930, 1090, 1088, 1087, 1089, 1090, 1087, 1091, 1089, 928, 926, 1091, 928, 1092,
+		1090, 1089, 1091, 1092, 1089, 1093, 1091, 926, 924, 1093, 926, 1094, 1092, 1091, 1093, 1094,
+		1091, 1095, 1093, 924, 922, 1095, 924, 1096, 1094, 1093, 1095, 1096, 1093, 1097, 1095, 922,
+		920, 1097, 922, 1098, 1096, 1095, 1097, 1098, 1095, 1099, 1097, 920, 919, 1099, 920, 1100,
+		1098, 1097, 1099, 1100, 1097, 1101, 1099, 919, 917, 1101, 919, 1011, 1101, 917, 1101, 1102,
+		1099, 1102, 1100, 1099, 1011, 1103, 1101, 1103, 1102, 1101, 1104, 1103, 1011, 1010, 1104, 1011,
+		1013, 1104, 1010, 1103, 1105, 1102, 1104, 1106, 1103, 1106, 1105, 1103, 1013, 1107, 1104, 1107,
+		1106, 1104, 1105, 1108, 1102, 1102, 1108, 1100, 1106, 1109, 1105, 1108, 1110, 1100, 1100, 1110,
+		1098, 1105, 1111, 1108, 1109, 1111, 1105, 1108, 1112, 1110, 1111, 1112, 1108, 1110, 1113, 1098,
+		1098, 1113, 1096, 1112, 1114, 1110, 1110, 1114, 1113, 1113, 1115, 1096, 1096, 1115, 1094, 1114,
+		1116, 1113, 1113, 1116, 1115, 1115, 1117, 1094, 1094, 1117, 1092, 1116, 1118, 1115, 1115, 1118,
+		1117, 1117, 1119, 1092, 1092, 1119, 1090, 1118, 1120, 1117, 1117, 1120, 1119, 1119, 1121, 1090,
+		1090, 1121, 1088, 1120, 1122, 1119, 1119, 1122, 1121, 1121, 1123, 1088, 1088, 1123, 1086, 1122,
+		1124, 1121, 1121, 1124, 1123, 1123, 1125, 1086, 1086, 1125, 1084, 1124, 1126, 1123, 1123, 1126,
+		1125, 1125, 1127, 1084, 1084, 1127, 1082, 1126, 1128, 1125, 1125, 1128, 1127, 1127, 1129, 1082,
+		1082, 1129, 1080, 1128, 1130, 1127, 1127, 1130, 1129, 1129, 1131, 1080, 1080, 1131, 1078, 1130,
+		1132, 1129, 1129, 1132, 1131, 1131, 1133, 1078, 1078, 1133, 1076, 1132, 1134, 1131, 1131, 1134,
+		1133, 1133, 1135, 1076, 1076, 1135, 1074, 1134, 1136, 1133, 1133, 1136, 1135, 1135, 1137, 1074,
+		1074, 1137, 1072, 1136, 1138, 1135, 1135, 1138, 1137, 1137, 1139, 1072, 1072, 1139, 1070, 1138,
+		1140, 1137, 1137, 1140, 1139, 1139, 1141, 1070, 1070, 1141, 1068, 1140, 1142, 1139, 1139, 1142,
+		1141, 1141, 1143, 1068, 1068, 1143, 1066, 1142, 1144, 1141, 1141, 1144, 1143, 1143, 1145, 1066,
+		1066, 1145, 1064, 1144, 1146, 1143, 1143, 1146, 1145, 1145, 1147, 1064, 1064, 1147, 1062, 1146,
+		1148, 1145, 1145, 1148, 1147, 1147, 1149, 1062, 1062, 1149, 1060, 1148, 1150, 1147, 1147, 1150,
+		1149, 1149, 1151, 1060, 1060, 1151, 1058, 1150, 1152, 1149, 1149, 1152, 1151, 1151, 1153, 1058,
+		1058, 1153, 1056, 1152, 1154, 1151, 1151, 1154, 1153, 1153, 1155, 1056, 1056, 1155, 1054, 1154,
+		1156, 1153, 1153, 1156, 1155, 1155, 1157, 1054, 1054, 1157, 1052, 1156, 1158, 1155, 1155, 1158,
+		1157, 1157, 1159, 1052, 1052, 1159, 1050, 1158, 1160, 1157, 1157, 1160, 1159, 1159, 1161, 1050,
+		1050, 1161, 1048, 1160, 1162, 1159, 1159, 1162, 1161, 1161, 1163, 1048, 1048, 1163, 1046, 1162,
+		1164, 1161, 1161, 1164, 1163, 1163, 1165, 1046, 1046, 1165, 1044, 1164, 1166, 1163, 1163, 1166,
+		1165, 1165, 1167, 1044, 1044, 1167, 1042, 1166, 1168, 1165, 1165, 1168, 1167, 1167, 1169, 1042,
+		1042, 1169, 1040, 1168, 1170, 1167, 1167, 1170, 1169, 1169, 1171, 1040, 1040, 1171, 1038, 1170,
+		1172, 1169, 1169, 1172, 1171, 1171, 1173, 1038, 1038, 1173, 1036, 1172, 1174, 1171, 1171, 1174,
+		1173, 1173, 1175, 1036, 1036, 1175, 1034, 1174, 1176, 1173, 1173, 1176, 1175, 1175, 1177, 1034,
+		1034, 1177, 1032, 1176, 1178, 1175, 1175, 1178, 1177, 1177, 1179, 1032, 1032, 1179, 1030, 1178,
+		1180, 1177, 1177, 1180, 1179, 1179, 1181, 1030, 1030, 1181, 1028, 1180, 1182, 1179, 1179, 1182,
+		1181, 1181, 1183, 1028, 1028, 1183, 1026, 1182, 1184, 1181, 1181, 1184, 1183, 1183, 1185, 1026,
+		1026, 1185, 1024, 1184, 1186, 1183, 1183, 1186, 1185, 1185, 1187, 1024, 1024, 1187, 1022, 1186,
+		1188, 1185, 1185, 1188, 1187, 1187, 1189, 1022, 1022, 1189, 1020, 1188, 1190, 1187, 1187, 1190,
+		1189, 1189, 1191, 1020, 1020, 1191, 1018, 1190, 1192, 1189, 1189, 1192, 1191, 1191, 1193, 1018,
+		1018, 1193, 1016, 1192, 1194, 1191, 1191, 1194, 1193, 1193, 1195, 1016, 1016, 1195, 1015, 1194,
+		1196, 1193, 1193, 1196, 1195, 1195, 1197, 1015, 1015, 1197, 1013, 1197, 1107, 1013, 1195, 1198,
+		1197, 1196, 1198, 1195, 1197, 1199, 1107, 1198, 1199, 1197, 1199, 1200, 1107, 1107, 1200, 1106,
+		1200, 1109, 1106, 1198, 1201, 1199, 1199, 1202, 1200, 1201, 1202, 1199, 1200, 1203, 1109, 1202,
+		1203, 1200, 1204, 1201, 1198, 1196, 1204, 1198, 1201, 1205, 1202, 1206, 1204, 1196, 1194, 1206,
+		1196, 1204, 1207, 1201, 1207, 1205, 1201, 1206, 1208, 1204, 1208, 1207, 1204, 1209, 1206, 1194,
+		1192, 1209, 1194, 1210, 1208, 1206, 1209, 1210, 1206, 1211, 1209, 1192, 1190, 1211, 1192, 1212,
+		1210, 1209, 1211, 1212, 1209, 1213, 1211, 1190, 1188, 1213, 1190, 1214, 1212, 1211, 1213, 1214,
+		1211, 1215, 1213, 1188, 1186, 1215, 1188, 1216, 1214, 1213, 1215, 1216, 1213, 1217, 1215, 1186,
+		1184, 1217, 1186, 1218, 1216, 1215, 1217, 1218, 1215, 1219, 1217, 1184, 1182, 1219, 1184, 1220,
+		1218, 1217, 1219, 1220, 1217, 1221, 1219, 1182, 1180, 1221, 1182, 1222, 1220, 1219, 1221, 1222,
+		1219, 1223, 1221, 1180, 1178, 1223, 1180, 1224, 1222, 1221, 1223, 1224, 1221, 1225, 1223, 1178,
+		1176, 1225, 1178, 1226, 1224, 1223, 1225, 1226, 1223, 1227, 1225, 1176, 1174, 1227, 1176, 1228,
+		1226, 1225, 1227, 1228, 1225, 1229, 1227, 1174, 1172, 1229, 1174, 1230, 1228, 1227, 1229, 1230,
+		1227, 1231, 1229, 1172, 1170, 1231, 1172, 1232, 1230, 1229, 1231, 1232, 1229, 1233, 1231, 1170,
+		1168, 1233, 1170, 1234, 1232, 1231, 1233, 1234, 1231, 1235, 1233, 1168, 1166, 1235, 1168, 1236,
+		1234, 1233, 1235, 1236, 1233, 1237, 1235, 1166, 1164, 1237, 1166, 1238, 1236, 1235, 1237, 1238,
+		1235, 1239, 1237, 1164, 1162, 1239, 1164, 1240, 1238, 1237, 1239, 1240, 1237, 1241, 1239, 1162,
+		1160, 1241, 1162, 1242, 1240, 1239, 1241, 1242, 1239, 1243, 1241, 1160, 1158, 1243, 1160, 1244,
+		1242, 1241, 1243, 1244, 1241, 1245, 1243, 1158, 1156, 1245, 1158, 1246, 1244, 1243, 1245, 1246,
+		1243, 1247, 1245, 1156, 1154, 1247, 1156, 1248, 1246, 1245, 1247, 1248, 1245, 1249, 1247, 1154,
+		1152, 1249, 1154, 1250, 1248, 1247, 1249, 1250, 1247, 1251, 1249, 1152, 1150, 1251, 1152, 1252,
+		1250, 1249, 1251, 1252, 1249, 1253, 1251, 1150, 1148, 1253, 1150, 1254, 1252, 1251, 1253, 1254,
+		1251, 1255, 1253, 1148, 1146, 1255, 1148, 1256, 1254, 1253, 1255, 1256, 1253, 1257, 1255, 1146,
+		1144, 1257, 1146, 1258, 1256, 1255, 1257, 1258, 1255, 1259, 1257, 1144, 1142, 1259, 1144, 1260,
+		1258, 1257, 1259, 1260, 1257, 1261, 1259, 1142, 1140, 1261, 1142, 1262, 1260, 1259, 1261, 1262,
+		1259, 1263, 1261, 1140, 1138, 1263, 1140, 1264, 1262, 1261, 1263, 1264, 1261, 1265, 1263, 1138,
+		1136, 1265, 1138, 1266, 1264, 1263, 1265, 1266, 1263, 1267, 1265, 1136, 1134, 1267, 1136, 1268,
+		1266, 1265, 1267, 1268, 1265, 1269, 1267, 1134, 1132, 1269, 1134, 1270, 1268, 1267, 1269, 1270,
+		1267, 1271, 1269, 1132, 1130, 1271, 1132, 1272, 1270, 1269, 1271, 1272, 1269, 1273, 1271, 1130,
+		1128, 1273, 1130, 1274, 1272, 1271, 1273, 1274, 1271, 1275, 1273, 1128, 1126, 1275, 1128, 1276,
+		1274, 1273, 1275, 1276, 1273, 1277, 1275, 1126, 1124, 1277, 1126, 1278, 1276, 1275, 1277, 1278,
+		1275, 1279, 1277, 1124, 1122, 1279, 1124, 1280, 1278, 1277, 1279, 1280, 1277, 1281, 1279, 1122,
+		1120, 1281, 1122, 1282, 1280, 1279, 1281, 1282, 1279, 1283, 1281, 1120, 1118, 1283, 1120, 1284,
+		1282, 1281, 1283, 1284, 1281, 1285, 1283, 1118, 1116, 1285, 1118, 1286, 1284, 1283, 1285, 1286,
+		1283, 1287, 1285, 1116, 1114, 1287, 1116, 1288, 1286, 1285, 1287, 1288, 1285, 1289, 1287, 1114,
+		1112, 1289, 1114, 1290, 1288, 1287, 1289, 1290, 1287, 1291, 1289, 1112, 1111, 1291, 1112, 1292,
+		1290, 1289, 1291, 1292, 1289, 1293, 1291, 1111, 1109, 1293, 1111, 1203, 1293, 1109, 1293, 1294,
+		1291, 1294, 1292, 1291, 1203, 1295, 1293, 1295, 1294, 1293, 1296, 1295, 1203, 1202, 1296, 1203,
+		1205, 1296, 1202, 1295, 1297, 1294, 1296, 1298, 1295, 1298, 1297, 1295, 1205, 1299, 1296, 1299,
+		1298, 1296, 1297, 1300, 1294, 1294, 1300, 1292, 1298, 1301, 1297, 1300, 1302, 1292, 1292, 1302,
+		1290, 1297, 1303, 1300, 1301, 1303, 1297, 1300, 1304, 1302, 1303, 1304, 1300, 1302, 1305, 1290,
+		1290, 1305, 1288, 1304, 1306, 1302, 1302, 1306, 1305, 1305, 1307, 1288, 1288, 1307, 1286, 1306,
+		1308, 1305, 1305, 1308, 1307, 1307, 1309, 1286, 1286, 1309, 1284, 1308, 1310, 1307, 1307, 1310,
+		1309, 1309, 1311, 1284, 1284, 1311, 1282, 1310, 1312, 1309, 1309, 1312, 1311, 1311, 1313, 1282,
+		1282, 1313, 1280, 1312, 1314, 1311, 1311, 1314, 1313, 1313, 1315, 1280, 1280, 1315, 1278, 1314,
+		1316, 1313, 1313, 1316, 1315, 1315, 1317, 1278, 1278, 1317, 1276, 1316, 1318, 1315, 1315, 1318,
+		1317, 1317, 1319, 1276, 1276, 1319, 1274, 1318, 1320, 1317, 1317, 1320, 1319, 1319, 1321, 1274,
+		1274, 1321, 1272, 1320, 1322, 1319, 1319, 1322, 1321, 1321, 1323, 1272, 1272, 1323, 1270, 1322,
+		1324, 1321, 1321, 1324, 1323, 1323, 1325, 1270, 1270, 1325, 1268, 1324, 1326, 1323, 1323, 1326,
+		1325, 1325, 1327, 1268, 1268, 1327, 1266, 1326, 1328, 1325, 1325, 1328, 1327, 1327, 1329, 1266,
+		1266, 1329, 1264, 1328, 1330, 1327, 1327, 1330, 1329, 1329, 1331, 1264, 1264, 1331, 1262, 1330,
+		1332, 1329, 1329, 1332, 1331, 1331, 1333, 1262, 1262, 1333, 1260, 1332, 1334, 1331, 1331, 1334,
+		1333, 1333, 1335, 1260, 1260, 1335, 1258, 1334, 1336, 1333, 1333, 1336, 1335, 1335, 1337, 1258,
+		1258, 1337, 1256, 1336, 1338, 1335, 1335, 1338, 1337, 1337, 1339, 1256, 1256, 1339, 1254, 1338,
+		1340, 1337, 1337, 1340, 1339, 1339, 1341, 1254, 1254, 1341, 1252, 1340, 1342, 1339, 1339, 1342,
+		1341, 1341, 1343, 1252, 1252, 1343, 1250, 1342, 1344, 1341, 1341, 1344, 1343, 1343, 1345, 1250,
+		1250, 1345, 1248, 1344, 1346, 1343, 1343, 1346, 1345, 1345, 1347, 1248, 1248, 1347, 1246, 1346,
+		1348, 1345, 1345, 1348, 1347, 1347, 1349, 1246, 1246, 1349, 1244, 1348, 1350, 1347, 1347, 1350,
+		1349, 1349, 1351, 1244, 1244, 1351, 1242, 1350, 1352, 1349, 1349, 1352, 1351, 1351, 1353, 1242,
+		1242, 1353, 1240, 1352, 1354, 1351, 1351, 1354, 1353, 1353, 1355, 1240, 1240, 1355, 1238, 1354,
+		1356, 1353, 1353, 1356, 1355, 1355, 1357, 1238, 1238, 1357, 1236, 1356, 1358, 1355, 1355, 1358,
+		1357, 1357, 1359, 1236, 1236, 1359, 1234, 1358, 1360, 1357, 1357, 1360, 1359, 1359, 1361, 1234,
+		1234, 1361, 1232, 1360, 1362, 1359, 1359, 1362, 1361, 1361, 1363, 1232, 1232, 1363, 1230, 1362,
+		1364, 1361, 1361, 1364, 1363, 1363, 1365, 1230, 1230, 1365, 1228, 1364, 1366, 1363, 1363, 1366,
+		1365, 1365, 1367, 1228, 1228, 1367, 1226, 1366, 1368, 1365, 1365, 1368, 1367, 1367, 1369, 1226,
+		1226, 1369, 1224, 1368, 1370, 1367, 1367, 1370, 1369, 1369, 1371, 1224, 1224, 1371, 1222, 1370,
+		1372, 1369, 1369, 1372, 1371, 1371, 1373, 1222, 1222, 1373, 1220, 1372, 1374, 1371, 1371, 1374,
+		1373, 1373, 1375, 1220, 1220, 1375, 1218, 1374, 1376, 1373, 1373, 1376, 1375, 1375, 1377, 1218,
+		1218, 1377, 1216, 1376, 1378, 1375, 1375, 1378, 1377, 1377, 1379, 1216, 1216, 1379, 1214, 1378,
+		1380, 1377, 1377, 1380, 1379, 1379, 1381, 1214, 1214, 1381, 1212, 1380, 1382, 1379, 1379, 1382,
+		1381, 1381, 1383, 1212, 1212, 1383, 1210, 1382, 1384, 1381, 1381, 1384, 1383, 1383, 1385, 1210,
+		1210, 1385, 1208, 1384, 1386, 1383, 1383, 1386, 1385, 1385, 1387, 1208, 1208, 1387, 1207, 1386,
+		1388, 1385, 1385, 1388, 1387, 1387, 1389, 1207, 1207, 1389, 1205, 1389, 1299, 1205, 1387, 1390,
+		1389, 1388, 1390, 1387, 1389, 1391, 1299, 1390, 1391, 1389, 1391, 1392, 1299, 1299, 1392, 1298,
+		1392, 1301, 1298, 1390, 1393, 1391, 1391, 1394, 1392, 1393, 1394, 1391, 1392, 1395, 1301, 1394,
+		1395, 1392, 1396, 1393, 1390, 1388, 1396, 1390, 1393, 1397, 1394, 1398, 1396, 1388, 1386, 1398,
+		1388, 1396, 1399, 1393, 1399, 1397, 1393, 1398, 1400, 1396, 1400, 1399, 1396, 1401, 1398, 1386,
+		1384, 1401, 1386, 1402, 1400, 1398, 1401, 1402, 1398, 1403, 1401, 1384, 1382, 1403, 1384, 1404,
+		1402, 1401, 1403, 1404, 1401, 1405, 1403, 1382, 1380, 1405, 1382, 1406, 1404, 1403, 1405, 1406,
+		1403, 1407, 1405, 1380, 1378, 1407, 1380, 1408, 1406, 1405, 1407, 1408, 1405, 1409, 1407, 1378,
+		1376, 1409, 1378, 1410, 1408, 1407, 1409, 1410, 1407, 1411, 1409, 1376, 1374, 1411, 1376, 1412,
+		1410, 1409, 1411, 1412, 1409, 1413, 1411, 1374, 1372, 1413, 1374, 1414, 1412, 1411, 1413, 1414,
+		1411, 1415, 1413, 1372, 1370, 1415, 1372, 1416, 1414, 1413, 1415, 1416, 1413, 1417, 1415, 1370,
+		1368, 1417, 1370, 1418, 1416, 1415, 1417, 1418, 1415, 1419, 1417, 1368, 1366, 1419, 1368, 1420,
+		1418, 1417, 1419, 1420, 1417, 1421, 1419, 1366, 1364, 1421, 1366, 1422, 1420, 1419, 1421, 1422,
+		1419, 1423, 1421, 1364, 1362, 1423, 1364, 1424, 1422, 1421, 1423, 1424, 1421, 1425, 1423, 1362,
+		1360, 1425, 1362, 1426, 1424, 1423, 1425, 1426, 1423, 1427, 1425, 1360, 1358, 1427, 1360, 1428,
+		1426, 1425, 1427, 1428, 1425, 1429, 1427, 1358, 1356, 1429, 1358, 1430, 1428, 1427, 1429, 1430,
+		1427, 1431, 1429, 1356, 1354, 1431, 1356, 1432, 1430, 1429, 1431, 1432, 1429, 1433, 1431, 1354,
+		1352, 1433, 1354, 1434, 1432, 1431, 1433, 1434, 1431, 1435, 1433, 1352, 1350, 1435, 1352, 1436,
+		1434, 1433, 1435, 1436, 1433, 1437, 1435, 1350, 1348, 1437, 1350, 1438, 1436, 1435, 1437, 1438,
+		1435, 1439, 1437, 1348, 1346, 1439, 1348, 1440, 1438, 1437, 1439, 1440, 1437, 1441, 1439, 1346,
+		1344, 1441, 1346, 1442, 1440, 1439, 1441, 1442, 1439, 1443, 1441, 1344, 1342, 1443, 1344, 1444,
+		1442, 1441, 1443, 1444, 1441, 1445, 1443, 1342, 1340, 1445, 1342, 1446, 1444, 1443, 1445, 1446,
+		1443, 1447, 1445, 1340, 1338, 1447, 1340, 1448, 1446, 1445, 1447, 1448, 1445, 1449, 1447, 1338,
+		1336, 1449, 1338, 1450, 1448, 1447, 1449, 1450, 1447, 1451, 1449, 1336, 1334, 1451, 1336, 1452,
+		1450, 1449, 1451, 1452, 1449, 1453, 1451, 1334, 1332, 1453, 1334, 1454, 1452, 1451, 1453, 1454,
+		1451, 1455, 1453, 1332, 1330, 1455, 1332, 1456, 1454, 1453, 1455, 1456, 1453, 1457, 1455, 1330,
+		1328, 1457, 1330, 1458, 1456, 1455, 1457, 1458, 1455, 1459, 1457, 1328, 1326, 1459, 1328, 1460,
+		1458, 1457, 1459, 1460, 1457, 1461, 1459, 1326, 1324, 1461, 1326, 1462, 1460, 1459, 1461, 1462,
+		1459, 1463, 1461, 1324, 1322, 1463, 1324, 1464, 1462, 1461, 1463, 1464, 1461, 1465, 1463, 1322,
+		1320, 1465, 1322, 1466, 1464, 1463, 1465, 1466, 1463, 1467, 1465, 1320, 1318, 1467, 1320, 1468,
+		1466, 1465, 1467, 1468, 1465, 1469, 1467, 1318, 1316, 1469, 1318, 1470, 1468, 1467, 1469, 1470,
+		1467, 1471, 1469, 1316, 1314, 1471, 1316, 1472, 1470, 1469, 1471, 1472, 1469, 1473, 1471, 1314,
+		1312, 1473, 1314, 1474, 1472, 1471, 1473, 1474, 1471, 1475, 1473, 1312, 1310, 1475, 1312, 1476,
+		1474, 1473, 1475, 1476, 1473, 1477, 1475, 1310, 1308, 1477, 1310, 1478, 1476, 1475, 1477, 1478,
+		1475, 1479, 1477, 1308, 1306, 1479, 1308, 1480, 1478, 1477, 1479, 1480, 1477, 1481, 1479, 1306,
+		1304, 1481, 1306, 1482, 1480, 1479, 1481, 1482, 1479, 1483, 1481, 1304, 1303, 1483, 1304, 1484,
+		1482, 1481, 1483, 1484, 1481, 1485, 1483, 1303, 1301, 1485, 1303, 1395, 1485, 1301, 1485, 1486,
+		1483, 1486, 1484, 1483, 1395, 1487, 1485, 1487, 1486, 1485, 1488, 1487, 1395, 1394, 1488, 1395,
+		1397, 1488, 1394, 1487, 1489, 1486, 1488, 1490, 1487, 1490, 1489, 1487, 1397, 1491, 1488, 1491,
+		1490, 1488, 1489, 1492, 1486, 1486, 1492, 1484, 1490, 1493, 1489, 1492, 1494, 1484, 1484, 1494,
+		1482, 1489, 1495, 1492, 1493, 1495, 1489, 1492, 1496, 1494, 1495, 1496, 1492, 1494, 1497, 1482,
+		1482, 1497, 1480, 1496, 1498, 1494, 1494, 1498, 1497, 1497, 1499, 1480, 1480, 1499, 1478, 1498,
+		1500, 1497, 1497, 1500, 1499, 1499, 1501, 1478, 1478, 1501, 1476, 1500, 1502, 1499, 1499, 1502,
+		1501, 1501, 1503, 1476, 1476, 1503, 1474, 1502, 1504, 1501, 1501, 1504, 1503, 1503, 1505, 1474,
+		1474, 1505, 1472, 1504, 1506, 1503, 1503, 1506, 1505, 1505, 1507, 1472, 1472, 1507, 1470, 1506,
+		1508, 1505, 1505, 1508, 1507, 1507, 1509, 1470, 1470, 1509, 1468, 1508, 1510, 1507, 1507, 1510,
+		1509, 1509, 1511, 1468, 1468, 1511, 1466, 1510, 1512, 1509, 1509, 1512, 1511, 1511, 1513, 1466,
+		1466, 1513, 1464, 1512, 1514, 1511, 1511, 1514, 1513, 1513, 1515, 1464, 1464, 1515, 1462, 1514,
+		1516, 1513, 1513, 1516, 1515, 1515, 1517, 1462, 1462, 1517, 1460, 1516, 1518, 1515, 1515, 1518,
+		1517, 1517, 1519, 1460, 1460, 1519, 1458, 1518, 1520, 1517, 1517, 1520, 1519, 1519, 1521, 1458,
+		1458, 1521, 1456, 1520, 1522, 1519, 1519, 1522, 1521, 1521, 1523, 1456, 1456, 1523, 1454, 1522,
+		1524, 1521, 1521, 1524, 1523, 1523, 1525, 1454, 1454, 1525, 1452, 1524, 1526, 1523, 1523, 1526,
+		1525, 1525, 1527, 1452, 1452, 1527, 1450, 1526, 1528, 1525, 1525, 1528, 1527, 1527, 1529, 1450,
+		1450, 1529, 1448, 1528, 1530, 1527, 1527, 1530, 1529, 1529, 1531, 1448, 1448, 1531, 1446, 1530,
+		1532, 1529, 1529, 1532, 1531, 1531, 1533, 1446, 1446, 1533, 1444, 1532, 1534, 1531, 1531, 1534,
+		1533, 1533, 1535, 1444, 1444, 1535, 1442, 1534, 1536, 1533, 1533, 1536, 1535, 1535, 1537, 1442,
+		1442, 1537, 1440, 1536, 1538, 1535, 1535, 1538, 1537, 1537, 1539, 1440, 1440, 1539, 1438, 1538,
+		1540, 1537, 1537, 1540, 1539, 1539, 1541, 1438, 1438, 1541, 1436, 1540, 1542, 1539, 1539, 1542,
+		1541, 1541, 1543, 1436, 1436, 1543, 1434, 1542, 1544, 1541, 1541, 1544, 1543, 1543, 1545, 1434,
+		1434, 1545, 1432, 1544, 1546, 1543, 1543, 1546, 1545, 1545, 1547, 1432, 1432, 1547, 1430, 1546,
+		1548, 1545, 1545, 1548, 1547, 1547, 1549, 1430, 1430, 1549, 1428, 1548, 1550, 1547, 1547, 1550,
+		1549, 1549, 1551, 1428, 1428, 1551, 1426, 1550, 1552, 1549, 1549, 1552, 1551, 1551, 1553, 1426,
+		1426, 1553, 1424, 1552, 1554, 1551, 1551, 1554, 1553, 1553, 1555, 1424, 1424, 1555, 1422, 1554,
+		1556, 1553, 1553, 1556, 1555, 1555, 1557, 1422, 1422, 1557, 1420, 1556, 1558, 1555, 1555, 1558,
+		1557, 1557, 1559, 1420, 1420, 1559, 1418, 1558, 1560, 1557, 1557, 1560, 1559, 1559, 1561, 1418,
+		1418, 1561, 1416, 1560, 1562, 1559, 1559, 1562, 1561, 1561, 1563, 1416, 1416, 1563, 1414, 1562,
+		1564, 1561, 1561, 1564, 1563, 1563, 1565, 1414, 1414, 1565, 1412, 1564, 1566, 1563, 1563, 1566,
+		1565, 1565, 1567, 1412, 1412, 1567, 1410, 1566, 1568, 1565, 1565, 1568, 1567, 1567, 1569, 1410,
+		1410, 1569, 1408, 1568, 1570, 1567, 1567, 1570, 1569, 1569, 1571, 1408, 1408, 1571, 1406, 1570,
+		1572, 1569, 1569, 1572, 1571, 1571, 1573, 1406, 1406, 1573, 1404, 1572, 1574, 1571, 1571, 1574,
+		1573, 1573, 1575, 1404, 1404, 1575, 1402, 1574, 1576, 1573, 1573, 1576, 1575, 1575, 1577, 1402,
+		1402, 1577, 1400, 1576, 1578, 1575, 1575, 1578, 1577, 1577, 1579, 1400, 1400, 1579, 1399, 1578,
+		1580, 1577, 1577, 1580, 1579, 1579, 1581, 1399, 1399, 1581, 1397, 1581, 1491, 1397, 1579, 1582,
+		1581, 1580, 1582, 1579, 1581, 1583, 1491, 1582, 1583, 1581, 1583, 1584, 1491, 1491, 1584, 1490,
+		1584, 1493, 1490, 1582, 1585, 1583, 1583, 1586, 1584, 1585, 1586, 1583, 1584, 1587, 1493, 1586,
+		1587, 1584, 1588, 1585, 1582, 1580, 1588, 1582, 1585, 1589, 1586, 1590, 1588, 1580, 1578, 1590,
+		1580, 1588, 1591, 1585, 1591, 1589, 1585, 1590, 1592, 1588, 1592, 1591, 1588, 1593, 1590, 1578,
+		1576, 1593, 1578, 1594, 1592, 1590, 1593, 1594, 1590, 1595, 1593, 1576, 1574, 1595, 1576, 1596,
+		1594, 1593, 1595, 1596, 1593, 1597, 1595, 1574, 1572, 1597, 1574, 1598, 1596, 1595, 1597, 1598,
+		1595, 1599, 1597, 1572, 1570, 1599, 1572, 1600, 1598, 1597, 1599, 1600, 1597, 1601, 1599, 1570,
+		1568, 1601, 1570, 1602, 1600, 1599, 1601, 1602, 1599, 1603, 1601, 1568, 1566, 1603, 1568, 1604,
+		1602, 1601, 1603, 1604, 1601, 1605, 1603, 1566, 1564, 1605, 1566, 1606, 1604, 1603, 1605, 1606,
+		1603, 1607, 1605, 1564, 1562, 1607, 1564, 1608, 1606, 1605, 1607, 1608, 1605, 1609, 1607, 1562,
+		1560, 1609, 1562, 1610, 1608, 1607, 1609, 1610, 1607, 1611, 1609, 1560, 1558, 1611, 1560, 1612,
+		1610, 1609, 1611, 1612, 1609, 1613, 1611, 1558, 1556, 1613, 1558, 1614, 1612, 1611, 1613, 1614,
+		1611, 1615, 1613, 1556, 1554, 1615, 1556, 1616, 1614, 1613, 1615, 1616, 1613, 1617, 1615, 1554,
+		1552, 1617, 1554, 1618, 1616, 1615, 1617, 1618, 1615, 1619, 1617, 1552, 1550, 1619, 1552, 1620,
+		1618, 1617, 1619, 1620, 1617, 1621, 1619, 1550, 1548, 1621, 1550, 1622, 1620, 1619, 1621, 1622,
+		1619, 1623, 1621, 1548, 1546, 1623, 1548, 1624, 1622, 1621, 1623, 1624, 1621, 1625, 1623, 1546,
+		1544, 1625, 1546, 1626, 1624, 1623, 1625, 1626, 1623, 1627, 1625, 1544, 1542, 1627, 1544, 1628,
+		1626, 1625, 1627, 1628, 1625, 1629, 1627, 1542, 1540, 1629, 1542, 1630, 1628, 1627, 1629, 1630,
+		1627, 1631, 1629, 1540, 1538, 1631, 1540, 1632, 1630, 1629, 1631, 1632, 1629, 1633, 1631, 1538,
+		1536, 1633, 1538, 1634, 1632, 1631, 1633, 1634, 1631, 1635, 1633, 1536, 1534, 1635, 1536, 1636,
+		1634, 1633, 1635, 1636, 1633, 1637, 1635, 1534, 1532, 1637, 1534, 1638, 1636, 1635, 1637, 1638,
+		1635, 1639, 1637, 1532, 1530, 1639, 1532, 1640, 1638, 1637, 1639, 1640, 1637, 1641, 1639, 1530,
+		1528, 1641, 1530, 1642, 1640, 1639, 1641, 1642, 1639, 1643, 1641, 1528, 1526, 1643, 1528, 1644,
+		1642, 1641, 1643, 1644, 1641, 1645, 1643, 1526, 1524, 1645, 1526, 1646, 1644, 1643, 1645, 1646,
+		1643, 1647, 1645, 1524, 1522, 1647, 1524, 1648, 1646, 1645, 1647, 1648, 1645, 1649, 1647, 1522,
+		1520, 1649, 1522, 1650, 1648, 1647, 1649, 1650, 1647, 1651, 1649, 1520, 1518, 1651, 1520, 1652,
+		1650, 1649, 1651, 1652, 1649, 1653, 1651, 1518, 1516, 1653, 1518, 1654, 1652, 1651, 1653, 1654,
+		1651, 1655, 1653, 1516, 1514, 1655, 1516, 1656, 1654, 1653, 1655, 1656, 1653, 1657, 1655, 1514,
+		1512, 1657, 1514, 1658, 1656, 1655, 1657, 1658, 1655, 1659, 1657, 1512, 1510, 1659, 1512, 1660,
+		1658, 1657, 1659, 1660, 1657, 1661, 1659, 1510, 1508, 1661, 1510, 1662, 1660, 1659, 1661, 1662,
+		1659, 1663, 1661, 1508, 1506, 1663, 1508, 1664, 1662, 1661, 1663, 1664, 1661, 1665, 1663, 1506,
+		1504, 1665, 1506, 1666, 1664, 1663, 1665, 1666, 1663, 1667, 1665, 1504, 1502, 1667, 1504, 1668,
+		1666, 1665, 1667, 1668, 1665, 1669, 1667, 1502, 1500, 1669, 1502, 1670, 1668, 1667, 1669, 1670,
+		1667, 1671, 1669, 1500, 1498, 1671, 1500, 1672, 1670, 1669, 1671, 1672, 1669, 1673, 1671, 1498,
+		1496, 1673, 1498, 1674, 1672, 1671, 1673, 1674, 1671, 1675, 1673, 1496, 1495, 1675, 1496, 1676,
+		1674, 1673, 1675, 1676, 1673, 1677, 1675, 1495, 1493, 1677, 1495, 1587, 1677, 1493, 1677, 1678,
+		1675, 1678, 1676, 1675, 1587, 1679, 1677, 1679, 1678, 1677, 1680, 1679, 1587, 1586, 1680, 1587,
+		1589, 1680, 1586, 1679, 1681, 1678, 1680, 1682, 1679, 1682, 1681, 1679, 1589, 1683, 1680, 1683,
+		1682, 1680, 1681, 1684, 1678, 1678, 1684, 1676, 1682, 1685, 1681, 1684, 1686, 1676, 1676, 1686,
+		1674, 1681, 1687, 1684, 1685, 1687, 1681, 1684, 1688, 1686, 1687, 1688, 1684, 1686, 1689, 1674,
+		1674, 1689, 1672, 1688, 1690, 1686, 1686, 1690, 1689, 1689, 1691, 1672, 1672, 1691, 1670, 1690,
+		1692, 1689, 1689, 1692, 1691, 1691, 1693, 1670, 1670, 1693, 1668, 1692, 1694, 1691, 1691, 1694,
+		1693, 1693, 1695, 1668, 1668, 1695, 1666, 1694, 1696, 1693, 1693, 1696, 1695, 1695, 1697, 1666,
+		1666, 1697, 1664, 1696, 1698, 1695, 1695, 1698, 1697, 1697, 1699, 1664, 1664, 1699, 1662, 1698,
+		1700, 1697, 1697, 1700, 1699, 1699, 1701, 1662, 1662, 1701, 1660, 1700, 1702, 1699, 1699, 1702,
+		1701, 1701, 1703, 1660, 1660, 1703, 1658, 1702, 1704, 1701, 1701, 1704, 1703, 1703, 1705, 1658,
+		1658, 1705, 1656, 1704, 1706, 1703, 1703, 1706, 1705, 1705, 1707, 1656, 1656, 1707, 1654, 1706,
+		1708, 1705, 1705, 1708, 1707, 1707, 1709, 1654, 1654, 1709, 1652, 1708, 1710, 1707, 1707, 1710,
+		1709, 1709, 1711, 1652, 1652, 1711, 1650, 1710, 1712, 1709, 1709, 1712, 1711, 1711, 1713, 1650,
+		1650, 1713, 1648, 1712, 1714, 1711, 1711, 1714, 1713, 1713, 1715, 1648, 1648, 1715, 1646, 1714,
+		1716, 1713, 1713, 1716, 1715, 1715, 1717, 1646, 1646, 1717, 1644, 1716, 1718, 1715, 1715, 1718,
+		1717, 1717, 1719, 1644, 1644, 1719, 1642, 1718, 1720, 1717, 1717, 1720, 1719, 1719, 1721, 1642,
+		1642, 1721, 1640, 1720, 1722, 1719, 1719, 1722, 1721, 1721, 1723, 1640, 1640, 1723, 1638, 1722,
+		1724, 1721, 1721, 1724, 1723, 1723, 1725, 1638, 1638, 1725, 1636, 1724, 1726, 1723, 1723, 1726,
+		1725, 1725, 1727, 1636, 1636, 1727, 1634, 1726, 1728, 1725, 1725, 1728, 1727, 1727, 1729, 1634,
+		1634, 1729, 1632, 1728, 1730, 1727, 1727, 1730, 1729, 1729, 1731, 1632, 1632, 1731, 1630, 1730,
+		1732, 1729, 1729, 1732, 1731, 1731, 1733, 1630, 1630, 1733, 1628, 1732, 1734, 1731, 1731, 1734,
+		1733, 1733, 1735, 1628, 1628, 1735, 1626, 1734, 1736, 1733, 1733, 1736, 1735, 1735, 1737, 1626,
+		1626, 1737, 1624, 1736, 1738, 1735, 1735, 1738, 1737, 1737, 1739, 1624, 1624, 1739, 1622, 1738,
+		1740, 1737, 1737, 1740, 1739, 1739, 1741, 1622, 1622, 1741, 1620, 1740, 1742, 1739, 1739, 1742,
+		1741, 1741, 1743, 1620, 1620, 1743, 1618, 1742, 1744, 1741, 1741, 1744, 1743, 1743, 1745, 1618,
+		1618, 1745, 1616, 1744, 1746, 1743, 1743, 1746, 1745, 1745, 1747, 1616, 1616, 1747, 1614, 1746,
+		1748, 1745, 1745, 1748, 1747, 1747, 1749, 1614, 1614, 1749, 1612, 1748, 1750, 1747, 1747, 1750,
+		1749, 1749, 1751, 1612, 1612, 1751, 1610, 1750, 1752, 1749, 1749, 1752, 1751, 1751, 1753, 1610,
+		1610, 1753, 1608, 1752, 1754, 1751, 1751, 1754, 1753, 1753, 1755, 1608, 1608, 1755, 1606, 1754,
+		1756, 1753, 1753, 1756, 1755, 1755, 1757, 1606, 1606, 1757, 1604, 1756, 1758, 1755, 1755, 1758,
+		1757, 1757, 1759, 1604, 1604, 1759, 1602, 1758, 1760, 1757, 1757, 1760, 1759, 1759, 1761, 1602,
+		1602, 1761, 1600, 1760, 1762, 1759, 1759, 1762, 1761, 1761, 1763, 1600, 1600, 1763, 1598, 1762,
+		1764, 1761, 1761, 1764, 1763, 1763, 1765, 1598, 1598, 1765, 1596, 1764, 1766, 1763, 1763, 1766,
+		1765, 1765, 1767, 1596, 1596, 1767, 1594, 1766, 1768, 1765, 1765, 1768, 1767, 1767, 1769, 1594,
+		1594, 1769, 1592, 1768, 1770, 1767, 1767, 1770, 1769, 1769, 1771, 1592, 1592, 1771, 1591, 1770,
+		1772, 1769, 1769, 1772, 1771, 1771, 1773, 1591, 1591, 1773, 1589, 1773, 1683, 1589, 1771, 1774,
+		1773, 1772, 1774, 1771, 1773, 1775, 1683, 1774, 1775, 1773, 1775, 1776, 1683, 1683, 1776, 1682,
+		1776, 1685, 1682, 1774, 1777, 1775, 1775, 1778, 1776, 1777, 1778, 1775, 1776, 1779, 1685, 1778,
+		1779, 1776, 1780, 1777, 1774, 1772, 1780, 1774, 1777, 1781, 1778, 1782, 1780, 1772, 1770, 1782,
+		1772, 1780, 1783, 1777, 1783, 1781, 1777, 1782, 1784, 1780, 1784, 1783, 1780, 1785, 1782, 1770,
+		1768, 1785, 1770, 1786, 1784, 1782, 1785, 1786, 1782, 1787, 1785, 1768, 1766, 1787, 1768, 1788,
+		1786, 1785, 1787, 1788, 1785, 1789, 1787, 1766, 1764, 1789, 1766, 1790, 1788, 1787, 1789, 1790,
+		1787, 1791, 1789, 1764, 1762, 1791, 1764, 1792, 1790, 1789, 1791, 1792, 1789, 1793, 1791, 1762,
+		1760, 1793, 1762, 1794, 1792, 1791, 1793, 1794, 1791, 1795, 1793, 1760, 1758, 1795, 1760, 1796,
+		1794, 1793, 1795, 1796, 1793, 1797, 1795, 1758, 1756, 1797, 1758, 1798, 1796, 1795, 1797, 1798,
+		1795, 1799, 1797, 1756, 1754, 1799, 1756, 1800, 1798, 1797, 1799, 1800, 1797, 1801, 1799, 1754,
+		1752, 1801, 1754, 1802, 1800, 1799, 1801, 1802, 1799, 1803, 1801, 1752, 1750, 1803, 1752, 1804,
+		1802, 1801, 1803, 1804, 1801, 1805, 1803, 1750, 1748, 1805, 1750, 1806, 1804, 1803, 1805, 1806,
+		1803, 1807, 1805, 1748, 1746, 1807, 1748, 1808, 1806, 1805, 1807, 1808, 1805, 1809, 1807, 1746,
+		1744, 1809, 1746, 1810, 1808, 1807, 1809, 1810, 1807, 1811, 1809, 1744, 1742, 1811, 1744, 1812,
+		1810, 1809, 1811, 1812, 1809, 1813, 1811, 1742, 1740, 1813, 1742, 1814, 1812, 1811, 1813, 1814,
+		1811, 1815, 1813, 1740, 1738, 1815, 1740, 1816, 1814, 1813, 1815, 1816, 1813, 1817, 1815, 1738,
+		1736, 1817, 1738, 1818, 1816, 1815, 1817, 1818, 1815, 1819, 1817, 1736, 1734, 1819, 1736, 1820,
+		1818, 1817, 1819, 1820, 1817, 1821, 1819, 1734, 1732, 1821, 1734, 1822, 1820, 1819, 1821, 1822,
+		1819, 1823, 1821, 1732, 1730, 1823, 1732, 1824, 1822, 1821, 1823, 1824, 1821, 1825, 1823, 1730,
+		1728, 1825, 1730, 1826, 1824, 1823, 1825, 1826, 1823, 1827, 1825, 1728, 1726, 1827, 1728, 1828,
+		1826, 1825, 1827, 1828, 1825, 1829, 1827, 1726, 1724, 1829, 1726, 1830, 1828, 1827, 1829, 1830,
+		1827, 1831, 1829, 1724, 1722, 1831, 1724, 1832, 1830, 1829, 1831, 1832, 1829, 1833, 1831, 1722,
+		1720, 1833, 1722, 1834, 1832, 1831, 1833, 1834, 1831, 1835, 1833, 1720, 1718, 1835, 1720, 1836,
+		1834, 1833, 1835, 1836, 1833, 1837, 1835, 1718, 1716, 1837, 1718, 1838, 1836, 1835, 1837, 1838,
+		1835, 1839, 1837, 1716, 1714, 1839, 1716, 1840, 1838, 1837, 1839, 1840, 1837, 1841, 1839, 1714,
+		1712, 1841, 1714, 1842, 1840, 1839, 1841, 1842, 1839, 1843, 1841, 1712, 1710, 1843, 1712, 1844,
+		1842, 1841, 1843, 1844, 1841, 1845, 1843, 1710, 1708, 1845, 1710, 1846, 1844, 1843, 1845, 1846,
+		1843, 1847, 1845, 1708, 1706, 1847, 1708, 1848, 1846, 1845, 1847, 1848, 1845, 1849, 1847, 1706,
+		1704, 1849, 1706, 1850, 1848, 1847, 1849, 1850, 1847, 1851, 1849, 1704, 1702, 1851, 1704, 1852,
+		1850, 1849, 1851, 1852, 1849, 1853, 1851, 1702, 1700, 1853, 1702, 1854, 1852, 1851, 1853, 1854,
+		1851, 1855, 1853, 1700, 1698, 1855, 1700, 1856, 1854, 1853, 1855, 1856, 1853, 1857, 1855, 1698,
+		1696, 1857, 1698, 1858, 1856, 1855, 1857, 1858, 1855, 1859, 1857, 1696, 1694, 1859, 1696, 1860,
+		1858, 1857, 1859, 1860, 1857, 1861, 1859, 1694, 1692, 1861, 1694, 1862, 1860, 1859, 1861, 1862,
+		1859, 1863, 1861, 1692, 1690, 1863, 1692, 1864, 1862, 1861, 1863, 1864, 1861, 1865, 1863, 1690,
+		1688, 1865, 1690, 1866, 1864, 1863, 1865, 1866, 1863, 1867, 1865, 1688, 1687, 1867, 1688, 1868,
+		1866, 1865, 1867, 1868, 1865, 1869, 1867, 1687, 1685, 1869, 1687, 1779, 1869, 1685, 1869, 1870,
+		1867, 1870, 1868, 1867, 1779, 1871, 1869, 1871, 1870, 1869, 1872, 1871, 1779, 1778, 1872, 1779,
+		1781, 1872, 1778, 1871, 1873, 1870, 1872, 1874, 1871, 1874, 1873, 1871, 1781, 1875, 1872, 1875,
+		1874, 1872, 1873, 1876, 1870, 1870, 1876, 1868, 1874, 1877, 1873, 1876, 1878, 1868, 1868, 1878,
+		1866, 1873, 1879, 1876, 1877, 1879, 1873, 1876, 1880, 1878, 1879, 1880, 1876, 1878, 1881, 1866,
+		1866, 1881, 1864, 1880, 1882, 1878, 1878, 1882, 1881, 1881, 1883, 1864, 1864, 1883, 1862, 1882,
+		1884, 1881, 1881, 1884, 1883, 1883, 1885, 1862, 1862, 1885, 1860, 1884, 1886, 1883, 1883, 1886,
+		1885, 1885, 1887, 1860, 1860, 1887, 1858, 1886, 1888, 1885, 1885, 1888, 1887, 1887, 1889, 1858,
+		1858, 1889, 1856, 1888, 1890, 1887, 1887, 1890, 1889, 1889, 1891, 1856, 1856, 1891, 1854, 1890,
+		1892, 1889, 1889, 1892, 1891, 1891, 1893, 1854, 1854, 1893, 1852, 1892, 1894, 1891, 1891, 1894,
+		1893, 1893, 1895, 1852, 1852, 1895, 1850, 1894, 1896, 1893, 1893, 1896, 1895, 1895, 1897, 1850,
+		1850, 1897, 1848, 1896, 1898, 1895, 1895, 1898, 1897, 1897, 1899, 1848, 1848, 1899, 1846, 1898,
+		1900, 1897, 1897, 1900, 1899, 1899, 1901, 1846, 1846, 1901, 1844, 1900, 1902, 1899, 1899, 1902,
+		1901, 1901, 1903, 1844, 1844, 1903, 1842, 1902, 1904, 1901, 1901, 1904, 1903, 1903, 1905, 1842,
+		1842, 1905, 1840, 1904, 1906, 1903, 1903, 1906, 1905, 1905, 1907, 1840, 1840, 1907, 1838, 1906,
+		1908, 1905, 1905, 1908, 1907, 1907, 1909, 1838, 1838, 1909, 1836, 1908, 1910, 1907, 1907, 1910,
+		1909, 1909, 1911, 1836, 1836, 1911, 1834, 1910, 1912, 1909, 1909, 1912, 1911, 1911, 1913, 1834,
+		1834, 1913, 1832, 1912, 1914, 1911, 1911, 1914, 1913, 1913, 1915, 1832, 1832, 1915, 1830, 1914,
+		1916, 1913, 1913, 1916, 1915, 1915, 1917, 1830, 1830, 1917, 1828, 1916, 1918, 1915, 1915, 1918,
+		1917, 1917, 1919, 1828, 1828, 1919, 1826, 1918, 1920, 1917, 1917, 1920, 1919, 1919, 1921, 1826,
+		1826, 1921, 1824, 1920, 1922, 1919, 1919, 1922, 1921, 1921, 1923, 1824, 1824, 1923, 1822, 1922,
+		1924, 1921, 1921, 1924, 1923, 1923, 1925, 1822, 1822, 1925, 1820, 1924, 1926, 1923, 1923, 1926,
+		1925, 1925, 1927, 1820, 1820, 1927, 1818, 1926, 1928, 1925, 1925, 1928, 1927, 1927, 1929, 1818,
+		1818, 1929, 1816, 1928, 1930, 1927, 1927, 1930, 1929, 1929, 1931, 1816, 1816, 1931, 1814, 1930,
+		1932, 1929, 1929, 1932, 1931, 1931, 1933, 1814, 1814, 1933, 1812, 1932, 1934, 1931, 1931, 1934,
+		1933, 1933, 1935, 1812, 1812, 1935, 1810, 1934, 1936, 1933, 1933, 1936, 1935, 1935, 1937, 1810,
+		1810, 1937, 1808, 1936, 1938, 1935, 1935, 1938, 1937, 1937, 1939, 1808, 1808, 1939, 1806, 1938,
+		1940, 1937, 1937, 1940, 1939, 1939, 1941, 1806, 1806, 1941, 1804, 1940, 1942, 1939, 1939, 1942,
+		1941, 1941, 1943, 1804, 1804, 1943, 1802, 1942, 1944, 1941, 1941, 1944, 1943, 1943, 1945, 1802,
+		1802, 1945, 1800, 1944, 1946, 1943, 1943, 1946, 1945, 1945, 1947, 1800, 1800, 1947, 1798, 1946,
+		1948, 1945, 1945, 1948, 1947, 1947, 1949, 1798, 1798, 1949, 1796, 1948, 1950, 1947, 1947, 1950,
+		1949, 1949, 1951, 1796, 1796, 1951, 1794, 1950, 1952, 1949, 1949, 1952, 1951, 1951, 1953, 1794,
+		1794, 1953, 1792, 1952, 1954, 1951, 1951, 1954, 1953, 1953, 1955, 1792, 1792, 1955, 1790, 1954,
+		1956, 1953, 1953, 1956, 1955, 1955, 1957, 1790, 1790, 1957, 1788, 1956, 1958, 1955, 1955, 1958,
+		1957, 1957, 1959, 1788, 1788, 1959, 1786, 1958, 1960, 1957, 1957, 1960, 1959, 1959, 1961, 1786,
+		1786, 1961, 1784, 1960, 1962, 1959, 1959, 1962, 1961, 1961, 1963, 1784, 1784, 1963, 1783, 1962,
+		1964, 1961, 1961, 1964, 1963, 1963, 1965, 1783, 1783, 1965, 1781, 1965, 1875, 1781, 1963, 1966,
+		1965, 1964, 1966, 1963, 1965, 1967, 1875, 1966, 1967, 1965, 1967, 1968, 1875, 1875, 1968, 1874,
+		1968, 1877, 1874, 1966, 1969, 1967, 1967, 1970, 1968, 1969, 1970, 1967, 1968, 1971, 1877, 1970,
+		1971, 1968, 1972, 1969, 1966, 1964, 1972, 1966, 1969, 1973, 1970, 1974, 1972, 1964, 1962, 1974,
+		1964, 1972, 1975, 1969, 1975, 1973, 1969, 1974, 1976, 1972, 1976, 1975, 1972, 1977, 1974, 1962,
+		1960, 1977, 1962, 1978, 1976, 1974, 1977, 1978, 1974, 1979, 1977, 1960, 1958, 1979, 1960, 1980,
+		1978, 1977, 1979, 1980, 1977, 1981, 1979, 1958, 1956, 1981, 1958, 1982, 1980, 1979, 1981, 1982,
+		1979, 1983, 1981, 1956, 1954, 1983, 1956, 1984, 1982, 1981, 1983, 1984, 1981, 1985, 1983, 1954,
+		1952, 1985, 1954, 1986, 1984, 1983, 1985, 1986, 1983, 1987, 1985, 1952, 1950, 1987, 1952, 1988,
+		1986, 1985, 1987, 1988, 1985, 1989, 1987, 1950, 1948, 1989, 1950, 1990, 1988, 1987, 1989, 1990,
+		1987, 1991, 1989, 1948, 1946, 1991, 1948, 1992, 1990, 1989, 1991, 1992, 1989, 1993, 1991, 1946,
+		1944, 1993, 1946, 1994, 1992, 1991, 1993, 1994, 1991, 1995, 1993, 1944, 1942, 1995, 1944, 1996,
+		1994, 1993, 1995, 1996, 1993, 1997, 1995, 1942, 1940, 1997, 1942, 1998, 1996, 1995, 1997, 1998,
+		1995, 1999, 1997, 1940, 1938, 1999, 1940, 2000, 1998, 1997, 1999, 2000, 1997, 2001, 1999, 1938,
+		1936, 2001, 1938, 2002, 2000, 1999, 2001, 2002, 1999, 2003, 2001, 1936, 1934, 2003, 1936, 2004,
+		2002, 2001, 2003, 2004, 2001, 2005, 2003, 1934, 1932, 2005, 1934, 2006, 2004, 2003, 2005, 2006,
+		2003, 2007, 2005, 1932, 1930, 2007, 1932, 2008, 2006, 2005, 2007, 2008, 2005, 2009, 2007, 1930,
+		1928, 2009, 1930, 2010, 2008, 2007, 2009, 2010, 2007, 2011, 2009, 1928, 1926, 2011, 1928, 2012,
+		2010, 2009, 2011, 2012, 2009, 2013, 2011, 1926, 1924, 2013, 1926, 2014, 2012, 2011, 2013, 2014,
+		2011, 2015, 2013, 1924, 1922, 2015, 1924, 2016, 2014, 2013, 2015, 2016, 2013, 2017, 2015, 1922,
+		1920, 2017, 1922, 2018, 2016, 2015, 2017, 2018, 2015, 2019, 2017, 1920, 1918, 2019, 1920, 2020,
+		2018, 2017, 2019, 2020, 2017, 2021, 2019, 1918, 1916, 2021, 1918, 2022, 2020, 2019, 2021, 2022,
+		2019, 2023, 2021, 1916, 1914, 2023, 1916, 2024, 2022, 2021, 2023, 2024, 2021, 2025, 2023, 1914,
+		1912, 2025, 1914, 2026, 2024, 2023, 2025, 2026, 2023, 2027, 2025, 1912, 1910, 2027, 1912, 2028,
+		2026, 2025, 2027, 2028, 2025, 2029, 2027, 1910, 1908, 2029, 1910, 2030, 2028, 2027, 2029, 2030,
+		2027, 2031, 2029, 1908, 1906, 2031, 1908, 2032, 2030, 2029, 2031, 2032, 2029, 2033, 2031, 1906,
+		1904, 2033, 1906, 2034, 2032, 2031, 2033, 2034, 2031, 2035, 2033, 1904, 1902, 2035, 1904, 2036,
+		2034, 2033, 2035, 2036, 2033, 2037, 2035, 1902, 1900, 2037, 1902, 2038, 2036, 2035, 2037, 2038,
+		2035, 2039, 2037, 1900, 1898, 2039, 1900, 2040, 2038, 2037, 2039, 2040, 2037, 2041, 2039, 1898,
+		1896, 2041, 1898, 2042, 2040, 2039, 2041, 2042, 2039, 2043, 2041, 1896, 1894, 2043, 1896, 2044,
+		2042, 2041, 2043, 2044, 2041, 2045, 2043, 1894, 1892, 2045, 1894, 2046, 2044, 2043, 2045, 2046,
+		2043, 2047, 2045, 1892, 1890, 2047, 1892, 2048, 2046, 2045, 2047, 2048, 2045, 2049, 2047, 1890,
+		1888, 2049, 1890, 2050, 2048, 2047, 2049, 2050, 2047, 2051, 2049, 1888, 1886, 2051, 1888, 2052,
+		2050, 2049, 2051, 2052, 2049, 2053, 2051, 1886, 1884, 2053, 1886, 2054, 2052, 2051, 2053, 2054,
+		2051, 2055, 2053, 1884, 1882, 2055, 1884, 2056, 2054, 2053, 2055, 2056, 2053, 2057, 2055, 1882,
+		1880, 2057, 1882, 2058, 2056, 2055, 2057, 2058, 2055, 2059, 2057, 1880, 1879, 2059, 1880, 2060,
+		2058, 2057, 2059, 2060, 2057, 2061, 2059, 1879, 1877, 2061, 1879, 1971, 2061, 1877, 2061, 2062,
+		2059, 2062, 2060, 2059, 1971, 2063, 2061, 2063, 2062, 2061, 2064, 2063, 1971, 1970, 2064, 1971,
+		1973, 2064, 1970, 2063, 2065, 2062, 2064, 2066, 2063, 2066, 2065, 2063, 1973, 2067, 2064, 2067,
+		2066, 2064, 2065, 2068, 2062, 2062, 2068, 2060, 2066, 2069, 2065, 2068, 2070, 2060, 2060, 2070,
+		2058, 2065, 2071, 2068, 2069, 2071, 2065, 2068, 2072, 2070, 2071, 2072, 2068, 2070, 2073, 2058,
+		2058, 2073, 2056, 2072, 2074, 2070, 2070, 2074, 2073, 2073, 2075, 2056, 2056, 2075, 2054, 2074,
+		2076, 2073, 2073, 2076, 2075, 2075, 2077, 2054, 2054, 2077, 2052, 2076, 2078, 2075, 2075, 2078,
+		2077, 2077, 2079, 2052, 2052, 2079, 2050, 2078, 2080, 2077, 2077, 2080, 2079, 2079, 2081, 2050,
+		2050, 2081, 2048, 2080, 2082, 2079, 2079, 2082, 2081, 2081, 2083, 2048, 2048, 2083, 2046, 2082,
+		2084, 2081, 2081, 2084, 2083, 2083, 2085, 2046, 2046, 2085, 2044, 2084, 2086, 2083, 2083, 2086,
+		2085, 2085, 2087, 2044, 2044, 2087, 2042, 2086, 2088, 2085, 2085, 2088, 2087, 2087, 2089, 2042,
+		2042, 2089, 2040, 2088, 2090, 2087, 2087, 2090, 2089, 2089, 2091, 2040, 2040, 2091, 2038, 2090,
+		2092, 2089, 2089, 2092, 2091, 2091, 2093, 2038, 2038, 2093, 2036, 2092, 2094, 2091, 2091, 2094,
+		2093, 2093, 2095, 2036, 2036, 2095, 2034, 2094, 2096, 2093, 2093, 2096, 2095, 2095, 2097, 2034,
+		2034, 2097, 2032, 2096, 2098, 2095, 2095, 2098, 2097, 2097, 2099, 2032, 2032, 2099, 2030, 2098,
+		2100, 2097, 2097, 2100, 2099, 2099, 2101, 2030, 2030, 2101, 2028, 2100, 2102, 2099, 2099, 2102,
+		2101, 2101, 2103, 2028, 2028, 2103, 2026, 2102, 2104, 2101, 2101, 2104, 2103, 2103, 2105, 2026,
+		2026, 2105, 2024, 2104, 2106, 2103, 2103, 2106, 2105, 2105, 2107, 2024, 2024, 2107, 2022, 2106,
+		2108, 2105, 2105, 2108, 2107, 2107, 2109, 2022, 2022, 2109, 2020, 2108, 2110, 2107, 2107, 2110,
+		2109, 2109, 2111, 2020, 2020, 2111, 2018, 2110, 2112, 2109, 2109, 2112, 2111, 2111, 2113, 2018,
+		2018, 2113, 2016, 2112, 2114, 2111, 2111, 2114, 2113, 2113, 2115, 2016, 2016, 2115, 2014, 2114,
+		2116, 2113, 2113, 2116, 2115, 2115, 2117, 2014, 2014, 2117, 2012, 2116, 2118, 2115, 2115, 2118,
+		2117, 2117, 2119, 2012, 2012, 2119, 2010, 2118, 2120, 2117, 2117, 2120, 2119, 2119, 2121, 2010,
+		2010, 2121, 2008, 2120, 2122, 2119, 2119, 2122, 2121, 2121, 2123, 2008, 2008, 2123, 2006, 2122,
+		2124, 2121, 2121, 2124, 2123, 2123, 2125, 2006, 2006, 2125, 2004, 2124, 2126, 2123, 2123, 2126,
+		2125, 2125, 2127, 2004, 2004, 2127, 2002, 2126, 2128, 2125, 2125, 2128, 2127, 2127, 2129, 2002,
+		2002, 2129, 2000, 2128, 2130, 2127, 2127, 2130, 2129, 2129, 2131, 2000, 2000, 2131, 1998, 2130,
+		2132, 2129, 2129, 2132, 2131, 2131, 2133, 1998, 1998, 2133, 1996, 2132, 2134, 2131, 2131, 2134,
+		2133, 2133, 2135, 1996, 1996, 2135, 1994, 2134, 2136, 2133, 2133, 2136, 2135, 2135, 2137, 1994,
+		1994, 2137, 1992, 2136, 2138, 2135, 2135, 2138, 2137, 2137, 2139, 1992, 1992, 2139, 1990, 2138,
+		2140, 2137, 2137, 2140, 2139, 2139, 2141, 1990, 1990, 2141, 1988, 2140, 2142, 2139, 2139, 2142,
+		2141, 2141, 2143, 1988, 1988, 2143, 1986, 2142, 2144, 2141, 2141, 2144, 2143, 2143, 2145, 1986,
+		1986, 2145, 1984, 2144, 2146, 2143, 2143, 2146, 2145, 2145, 2147, 1984, 1984, 2147, 1982, 2146,
+		2148, 2145, 2145, 2148, 2147, 2147, 2149, 1982, 1982, 2149, 1980, 2148, 2150, 2147, 2147, 2150,
+		2149, 2149, 2151, 1980, 1980, 2151, 1978, 2150, 2152, 2149, 2149, 2152, 2151, 2151, 2153, 1978,
+		1978, 2153, 1976, 2152, 2154, 2151, 2151, 2154, 2153, 2153, 2155, 1976, 1976, 2155, 1975, 2154,
+		2156, 2153, 2153, 2156, 2155, 2155, 2157, 1975, 1975, 2157, 1973, 2157, 2067, 1973, 2155, 2158,
+		2157, 2156, 2158, 2155, 2157, 2159, 2067, 2158, 2159, 2157, 2159, 2160, 2067, 2067, 2160, 2066,
+		2160, 2069, 2066, 2158, 2161, 2159, 2159, 2162, 2160, 2161, 2162, 2159, 2160, 2163, 2069, 2162,
+		2163, 2160, 2164, 2161, 2158, 2156, 2164, 2158, 2161, 2165, 2162, 2166, 2164, 2156, 2154, 2166,
+		2156, 2164, 2167, 2161, 2167, 2165, 2161, 2166, 2168, 2164, 2168, 2167, 2164, 2169, 2166, 2154,
+		2152, 2169, 2154, 2170, 2168, 2166, 2169, 2170, 2166, 2171, 2169, 2152, 2150, 2171, 2152, 2172,
+		2170, 2169, 2171, 2172, 2169, 2173, 2171, 2150, 2148, 2173, 2150, 2174, 2172, 2171, 2173, 2174,
+		2171, 2175, 2173, 2148, 2146, 2175, 2148, 2176, 2174, 2173, 2175, 2176, 2173, 2177, 2175, 2146,
+		2144, 2177, 2146, 2178, 2176, 2175, 2177, 2178, 2175, 2179, 2177, 2144, 2142, 2179, 2144, 2180,
+		2178, 2177, 2179, 2180, 2177, 2181, 2179, 2142, 2140, 2181, 2142, 2182, 2180, 2179, 2181, 2182,
+		2179, 2183, 2181, 2140, 2138, 2183, 2140, 2184, 2182, 2181, 2183, 2184, 2181, 2185, 2183, 2138,
+		2136, 2185, 2138, 2186, 2184, 2183, 2185, 2186, 2183, 2187, 2185, 2136, 2134, 2187, 2136, 2188,
+		2186, 2185, 2187, 2188, 2185, 2189, 2187, 2134, 2132, 2189, 2134, 2190, 2188, 2187, 2189, 2190,
+		2187, 2191, 2189, 2132, 2130, 2191, 2132, 2192, 2190, 2189, 2191, 2192, 2189, 2193, 2191, 2130,
+		2128, 2193, 2130, 2194, 2192, 2191, 2193, 2194, 2191, 2195, 2193, 2128, 2126, 2195, 2128, 2196,
+		2194, 2193, 2195, 2196, 2193, 2197, 2195, 2126, 2124, 2197, 2126, 2198, 2196, 2195, 2197, 2198,
+		2195, 2199, 2197, 2124, 2122, 2199, 2124, 2200, 2198, 2197, 2199, 2200, 2197, 2201, 2199, 2122,
+		2120, 2201, 2122, 2202, 2200, 2199, 2201, 2202, 2199, 2203, 2201, 2120, 2118, 2203, 2120, 2204,
+		2202, 2201, 2203, 2204, 2201, 2205, 2203, 2118, 2116, 2205, 2118, 2206, 2204, 2203, 2205, 2206,
+		2203, 2207, 2205, 2116, 2114, 2207, 2116, 2208, 2206, 2205, 2207, 2208, 2205, 2209, 2207, 2114,
+		2112, 2209, 2114, 2210, 2208, 2207, 2209, 2210, 2207, 2211, 2209, 2112, 2110, 2211, 2112, 2212,
+		2210, 2209, 2211, 2212, 2209, 2213, 2211, 2110, 2108, 2213, 2110, 2214, 2212, 2211, 2213, 2214,
+		2211, 2215, 2213, 2108, 2106, 2215, 2108, 2216, 2214, 2213, 2215, 2216, 2213, 2217, 2215, 2106,
+		2104, 2217, 2106, 2218, 2216, 2215, 2217, 2218, 2215, 2219, 2217, 2104, 2102, 2219, 2104, 2220,
+		2218, 2217, 2219, 2220, 2217, 2221, 2219, 2102, 2100, 2221, 2102, 2222, 2220, 2219, 2221, 2222,
+		2219, 2223, 2221, 2100, 2098, 2223, 2100, 2224, 2222, 2221, 2223, 2224, 2221, 2225, 2223, 2098,
+		2096, 2225, 2098, 2226, 2224, 2223, 2225, 2226, 2223, 2227, 2225, 2096, 2094, 2227, 2096, 2228,
+		2226, 2225, 2227, 2228, 2225, 2229, 2227, 2094, 2092, 2229, 2094, 2230, 2228, 2227, 2229, 2230,
+		2227, 2231, 2229, 2092, 2090, 2231, 2092, 2232, 2230, 2229, 2231, 2232, 2229, 2233, 2231, 2090,
+		2088, 2233, 2090, 2234, 2232, 2231, 2233, 2234, 2231, 2235, 2233, 2088, 2086, 2235, 2088, 2236,
+		2234, 2233, 2235, 2236, 2233, 2237, 2235, 2086, 2084, 2237, 2086, 2238, 2236, 2235, 2237, 2238,
+		2235, 2239, 2237, 2084, 2082, 2239, 2084, 2240, 2238, 2237, 2239, 2240, 2237, 2241, 2239, 2082,
+		2080, 2241, 2082, 2242, 2240, 2239, 2241, 2242, 2239, 2243, 2241, 2080, 2078, 2243, 2080, 2244,
+		2242, 2241, 2243, 2244, 2241, 2245, 2243, 2078, 2076, 2245, 2078, 2246, 2244, 2243, 2245, 2246,
+		2243, 2247, 2245, 2076, 2074, 2247, 2076, 2248, 2246, 2245, 2247, 2248, 2245, 2249, 2247, 2074,
+		2072, 2249, 2074, 2250, 2248, 2247, 2249, 2250, 2247, 2251, 2249, 2072, 2071, 2251, 2072, 2252,
+		2250, 2249, 2251, 2252, 2249, 2253, 2251, 2071, 2069, 2253, 2071, 2163, 2253, 2069, 2253, 2254,
+		2251, 2254, 2252, 2251, 2163, 2255, 2253, 2255, 2254, 2253, 2256, 2255, 2163, 2162, 2256, 2163,
+		2165, 2256, 2162, 2255, 2257, 2254, 2165, 193, 2256, 2256, 2258, 2255, 193, 2258, 2256, 2258,
+		2257, 2255, 193, 191, 2258, 191, 188, 2258, 2258, 188, 2257, 188, 184, 2257, 2259, 193,
+		2165, 2259, 5, 193, 2167, 2259, 2165, 10, 5, 2259, 2260, 2259, 2167, 2260, 10, 2259,
+		2168, 2260, 2167, 12, 10, 2260, 2261, 2260, 2168, 2261, 12, 2260, 2170, 2261, 2168, 16,
+		12, 2261, 2262, 2261, 2170, 2262, 16, 2261, 2172, 2262, 2170, 20, 16, 2262, 2263, 2262,
+		2172, 2263, 20, 2262, 2174, 2263, 2172, 24, 20, 2263, 2264, 2263, 2174, 2264, 24, 2263,
+		2176, 2264, 2174, 28, 24, 2264, 2265, 2264, 2176, 2265, 28, 2264, 2178, 2265, 2176, 32,
+		28, 2265, 2266, 2265, 2178, 2266, 32, 2265, 2180, 2266, 2178, 36, 32, 2266, 2267, 2266,
+		2180, 2267, 36, 2266, 2182, 2267, 2180, 40, 36, 2267, 2268, 2267, 2182, 2268, 40, 2267,
+		2184, 2268, 2182, 44, 40, 2268, 2269, 2268, 2184, 2269, 44, 2268, 2186, 2269, 2184, 48,
+		44, 2269, 2270, 2269, 2186, 2270, 48, 2269, 2188, 2270, 2186, 52, 48, 2270, 2271, 2270,
+		2188, 2271, 52, 2270, 2190, 2271, 2188, 56, 52, 2271, 2272, 2271, 2190, 2272, 56, 2271,
+		2192, 2272, 2190, 60, 56, 2272, 2273, 2272, 2192, 2273, 60, 2272, 2194, 2273, 2192, 64,
+		60, 2273, 2274, 2273, 2194, 2274, 64, 2273, 2196, 2274, 2194, 68, 64, 2274, 2275, 2274,
+		2196, 2275, 68, 2274, 2198, 2275, 2196, 72, 68, 2275, 2276, 2275, 2198, 2276, 72, 2275,
+		2200, 2276, 2198, 76, 72, 2276, 2277, 2276, 2200, 2277, 76, 2276, 2202, 2277, 2200, 80,
+		76, 2277, 2278, 2277, 2202, 2278, 80, 2277, 2204, 2278, 2202, 84, 80, 2278, 2279, 2278,
+		2204, 2279, 84, 2278, 2206, 2279, 2204, 88, 84, 2279, 2280, 2279, 2206, 2280, 88, 2279,
+		2208, 2280, 2206, 92, 88, 2280, 2281, 2280, 2208, 2281, 92, 2280, 2210, 2281, 2208, 96,
+		92, 2281, 2282, 2281, 2210, 2282, 96, 2281, 2212, 2282, 2210, 100, 96, 2282, 2283, 2282,
+		2212, 2283, 100, 2282, 2214, 2283, 2212, 104, 100, 2283, 2284, 2283, 2214, 2284, 104, 2283,
+		2216, 2284, 2214, 108, 104, 2284, 2285, 2284, 2216, 2285, 108, 2284, 2218, 2285, 2216, 112,
+		108, 2285, 2286, 2285, 2218, 2286, 112, 2285, 2220, 2286, 2218, 116, 112, 2286, 2287, 2286,
+		2220, 2287, 116, 2286, 2222, 2287, 2220, 120, 116, 2287, 2288, 2287, 2222, 2288, 120, 2287,
+		2224, 2288, 2222, 124, 120, 2288, 2289, 2288, 2224, 2289, 124, 2288, 2226, 2289, 2224, 128,
+		124, 2289, 2290, 2289, 2226, 2290, 128, 2289, 2228, 2290, 2226, 132, 128, 2290, 2291, 2290,
+		2228, 2291, 132, 2290, 2230, 2291, 2228, 136, 132, 2291, 2292, 2291, 2230, 2292, 136, 2291,
+		2232, 2292, 2230, 140, 136, 2292, 2293, 2292, 2232, 2293, 140, 2292, 2234, 2293, 2232, 144,
+		140, 2293, 2294, 2293, 2234, 2294, 144, 2293, 2236, 2294, 2234, 148, 144, 2294, 2295, 2294,
+		2236, 2295, 148, 2294, 2238, 2295, 2236, 152, 148, 2295, 2296, 2295, 2238, 2296, 152, 2295,
+		2240, 2296, 2238, 156, 152, 2296, 2297, 2296, 2240, 2297, 156, 2296, 2242, 2297, 2240, 160,
+		156, 2297, 2298, 2297, 2242, 2298, 160, 2297, 2244, 2298, 2242, 164, 160, 2298, 2299, 2298,
+		2244, 2299, 164, 2298, 2246, 2299, 2244, 168, 164, 2299, 2300, 2299, 2246, 2300, 168, 2299,
+		2248, 2300, 2246, 172, 168, 2300, 2301, 2300, 2248, 2301, 172, 2300, 2250, 2301, 2248, 176,
+		172, 2301, 2302, 2301, 2250, 2302, 176, 2301, 2252, 2302, 2250, 180, 176, 2302, 2303, 2302,
+		2252, 2303, 180, 2302, 2254, 2303, 2252, 184, 180, 2303, 2257, 2303, 2254, 2257, 184, 2303,
+	};
+
+	constexpr Vertex hintRingLevel1Vertices[] = {
+		{{0.0f, 0.47f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.4675528f, 0.01545085f}, {0.0f, 0.95105654f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14523798f, 0.44699657f, 0.0f}, {0.309017f, 0.95105654f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14448176f, 0.4446692f, -0.01545085f}, {0.29389265f, 0.90450853f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14448176f, 0.4446692f, 0.01545085f}, {-0.29389265f, 0.90450853f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27482063f, 0.37825817f, -0.01545085f}, {0.559017f, 0.7694209f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14523798f, 0.44699657f, 0.0f}, {-0.309017f, 0.95105654f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.4675528f, -0.01545085f}, {0.0f, 0.95105654f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14228714f, 0.4379148f, -0.029389262f}, {0.25f, 0.7694209f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14448176f, 0.4446692f, -0.01545085f}, {-0.29389265f, 0.90450853f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2706462f, 0.37251255f, -0.029389262f}, {0.47552827f, 0.65450853f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.46045083f, -0.029389262f}, {0.0f, 0.809017f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.26414436f, 0.36356354f, -0.040450852f}, {0.3454915f, 0.47552827f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.13886891f, 0.4273946f, -0.040450852f}, {0.18163563f, 0.559017f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14228714f, 0.4379148f, -0.029389262f}, {-0.25f, 0.7694209f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.44938925f, -0.040450852f}, {0.0f, 0.58778524f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.25595158f, 0.3522871f, -0.047552828f}, {0.18163563f, 0.25f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.1345617f, 0.41413838f, -0.047552828f}, {0.095491506f, 0.29389265f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.13886891f, 0.4273946f, -0.040450852f}, {-0.18163563f, 0.559017f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.43545085f, -0.047552828f}, {0.0f, 0.309017f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.24686979f, 0.33978713f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.12978713f, 0.39944375f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.1345617f, 0.41413838f, -0.047552828f}, {-0.095491506f, 0.29389265f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.42f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.237788f, 0.32728714f, -0.047552828f}, {-0.18163563f, -0.25f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.12501256f, 0.3847491f, -0.047552828f}, {-0.095491506f, -0.29389265f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.12978713f, 0.39944375f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.40454912f, -0.047552828f}, {0.0f, -0.309017f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22959521f, 0.3160107f, -0.040450852f}, {-0.3454915f, -0.47552827f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.12070535f, 0.3714929f, -0.040450852f}, {-0.18163563f, -0.559017f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.12501256f, 0.3847491f, -0.047552828f}, {0.095491506f, -0.29389265f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.39061072f, -0.040450852f}, {0.0f, -0.58778524f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22309338f, 0.3070617f, -0.029389262f}, {-0.47552827f, -0.65450853f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11728713f, 0.3609727f, -0.029389262f}, {-0.25f, -0.7694209f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.12070535f, 0.3714929f, -0.040450852f}, {0.18163563f, -0.559017f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.37954915f, -0.029389262f}, {0.0f, -0.809017f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.21891893f, 0.30131608f, -0.01545085f}, {-0.559017f, -0.7694209f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.1150925f, 0.3542183f, -0.01545085f}, {-0.29389265f, -0.90450853f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11728713f, 0.3609727f, -0.029389262f}, {0.25f, -0.7694209f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.37244716f, -0.01545085f}, {0.0f, -0.95105654f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.21748053f, 0.29933628f, -8.485931e-15f}, {-0.58778524f, -0.809017f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11433628f, 0.35189092f, -8.485931e-15f}, {-0.309017f, -0.95105654f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.1150925f, 0.3542183f, -0.01545085f}, {0.29389265f, -0.90450853f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.36999997f, -8.485931e-15f}, {0.0f, -1.0f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.21891893f, 0.30131608f, 0.01545085f}, {-0.559017f, -0.7694209f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.1150925f, 0.3542183f, 0.01545085f}, {-0.29389265f, -0.90450853f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11433628f, 0.35189092f, -8.485931e-15f}, {0.309017f, -0.95105654f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.37244716f, 0.01545085f}, {0.0f, -0.95105654f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22309338f, 0.3070617f, 0.029389262f}, {-0.47552827f, -0.65450853f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11728713f, 0.3609727f, 0.029389262f}, {-0.25f, -0.7694209f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.1150925f, 0.3542183f, 0.01545085f}, {0.29389265f, -0.90450853f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.37954915f, 0.029389262f}, {0.0f, -0.809017f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22959521f, 0.3160107f, 0.040450852f}, {-0.3454915f, -0.47552827f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.12070535f, 0.3714929f, 0.040450852f}, {-0.18163563f, -0.559017f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11728713f, 0.3609727f, 0.029389262f}, {0.25f, -0.7694209f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.39061072f, 0.040450852f}, {0.0f, -0.58778524f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.237788f, 0.32728714f, 0.047552828f}, {-0.18163563f, -0.25f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.12501256f, 0.3847491f, 0.047552828f}, {-0.095491506f, -0.29389265f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.12070535f, 0.3714929f, 0.040450852f}, {0.18163563f, -0.559017f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.40454912f, 0.047552828f}, {0.0f, -0.309017f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.24686979f, 0.33978713f, 0.05f}, {-9.97581e-14f, -1.3730525e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.12978713f, 0.39944375f, 0.05f}, {-5.244594e-14f, -1.6141201e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.12501256f, 0.3847491f, 0.047552828f}, {0.095491506f, -0.29389265f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.42f, 0.05f}, {0.0f, -1.6971862e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.25595158f, 0.3522871f, 0.047552828f}, {0.18163563f, 0.25f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.1345617f, 0.41413838f, 0.047552828f}, {0.095491506f, 0.29389265f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.12978713f, 0.39944375f, 0.05f}, {5.244594e-14f, -1.6141201e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.43545085f, 0.047552828f}, {0.0f, 0.309017f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.26414436f, 0.36356354f, 0.040450852f}, {0.3454915f, 0.47552827f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.13886891f, 0.4273946f, 0.040450852f}, {0.18163563f, 0.559017f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.1345617f, 0.41413838f, 0.047552828f}, {-0.095491506f, 0.29389265f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.44938925f, 0.040450852f}, {0.0f, 0.58778524f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2706462f, 0.37251255f, 0.029389262f}, {0.47552827f, 0.65450853f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14228714f, 0.4379148f, 0.029389262f}, {0.25f, 0.7694209f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.13886891f, 0.4273946f, 0.040450852f}, {-0.18163563f, 0.559017f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.46045083f, 0.029389262f}, {0.0f, 0.809017f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27482063f, 0.37825817f, 0.01545085f}, {0.559017f, 0.7694209f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14448176f, 0.4446692f, 0.01545085f}, {0.29389265f, 0.90450853f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14228714f, 0.4379148f, 0.029389262f}, {-0.25f, 0.7694209f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27625906f, 0.38023797f, 0.0f}, {0.58778524f, 0.809017f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2706462f, 0.37251255f, 0.029389262f}, {-0.47552827f, 0.65450853f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37825817f, 0.27482063f, -0.01545085f}, {0.7694209f, 0.559017f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27482063f, 0.37825817f, 0.01545085f}, {-0.559017f, 0.7694209f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.26414436f, 0.36356354f, 0.040450852f}, {-0.3454915f, 0.47552827f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27625906f, 0.38023797f, 0.0f}, {-0.58778524f, 0.809017f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.25595158f, 0.3522871f, 0.047552828f}, {-0.18163563f, 0.25f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27482063f, 0.37825817f, -0.01545085f}, {-0.559017f, 0.7694209f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.24686979f, 0.33978713f, 0.05f}, {9.97581e-14f, -1.3730525e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2706462f, 0.37251255f, -0.029389262f}, {-0.47552827f, 0.65450853f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.237788f, 0.32728714f, 0.047552828f}, {0.18163563f, -0.25f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.26414436f, 0.36356354f, -0.040450852f}, {-0.3454915f, 0.47552827f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22959521f, 0.3160107f, 0.040450852f}, {0.3454915f, -0.47552827f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.25595158f, 0.3522871f, -0.047552828f}, {-0.18163563f, 0.25f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22309338f, 0.3070617f, 0.029389262f}, {0.47552827f, -0.65450853f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.24686979f, 0.33978713f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.21891893f, 0.30131608f, 0.01545085f}, {0.559017f, -0.7694209f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.237788f, 0.32728714f, -0.047552828f}, {0.18163563f, -0.25f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.21748053f, 0.29933628f, -8.485931e-15f}, {0.58778524f, -0.809017f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22959521f, 0.3160107f, -0.040450852f}, {0.3454915f, -0.47552827f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.21891893f, 0.30131608f, -0.01545085f}, {0.559017f, -0.7694209f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22309338f, 0.3070617f, -0.029389262f}, {0.47552827f, -0.65450853f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.30131608f, 0.21891893f, -0.01545085f}, {0.7694209f, -0.559017f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3070617f, 0.22309338f, -0.029389262f}, {0.65450853f, -0.47552827f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3160107f, 0.22959521f, -0.040450852f}, {0.47552827f, -0.3454915f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29933628f, 0.21748053f, -8.485931e-15f}, {0.809017f, -0.58778524f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3609727f, 0.11728713f, -0.029389262f}, {0.7694209f, -0.25f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.30131608f, 0.21891893f, 0.01545085f}, {0.7694209f, -0.559017f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3542183f, 0.1150925f, -0.01545085f}, {0.90450853f, -0.29389265f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.35189092f, 0.11433628f, -8.485931e-15f}, {0.95105654f, -0.309017f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3070617f, 0.22309338f, 0.029389262f}, {0.65450853f, -0.47552827f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3542183f, 0.1150925f, 0.01545085f}, {0.90450853f, -0.29389265f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3160107f, 0.22959521f, 0.040450852f}, {0.47552827f, -0.3454915f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3609727f, 0.11728713f, 0.029389262f}, {0.7694209f, -0.25f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32728714f, 0.237788f, 0.047552828f}, {0.25f, -0.18163563f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3714929f, 0.12070535f, 0.040450852f}, {0.559017f, -0.18163563f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33978713f, 0.24686979f, 0.05f}, {1.3730525e-13f, -9.97581e-14f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3847491f, 0.12501256f, 0.047552828f}, {0.29389265f, -0.095491506f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3522871f, 0.25595158f, 0.047552828f}, {-0.25f, 0.18163563f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39944375f, 0.12978713f, 0.05f}, {1.6141201e-13f, -5.244594e-14f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36356354f, 0.26414436f, 0.040450852f}, {-0.47552827f, 0.3454915f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.41413838f, 0.1345617f, 0.047552828f}, {-0.29389265f, 0.095491506f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37251255f, 0.2706462f, 0.029389262f}, {-0.65450853f, 0.47552827f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4273946f, 0.13886891f, 0.040450852f}, {-0.559017f, 0.18163563f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37825817f, 0.27482063f, 0.01545085f}, {-0.7694209f, 0.559017f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4379148f, 0.14228714f, 0.029389262f}, {-0.7694209f, 0.25f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38023797f, 0.27625906f, 0.0f}, {-0.809017f, 0.58778524f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4446692f, 0.14448176f, 0.01545085f}, {-0.90450853f, 0.29389265f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37825817f, 0.27482063f, -0.01545085f}, {-0.7694209f, 0.559017f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.44699657f, 0.14523798f, 0.0f}, {-0.95105654f, 0.309017f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37251255f, 0.2706462f, -0.029389262f}, {-0.65450853f, 0.47552827f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4446692f, 0.14448176f, -0.01545085f}, {-0.90450853f, 0.29389265f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36356354f, 0.26414436f, -0.040450852f}, {-0.47552827f, 0.3454915f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4379148f, 0.14228714f, -0.029389262f}, {-0.7694209f, 0.25f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3522871f, 0.25595158f, -0.047552828f}, {-0.25f, 0.18163563f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4273946f, 0.13886891f, -0.040450852f}, {-0.559017f, 0.18163563f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33978713f, 0.24686979f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.41413838f, 0.1345617f, -0.047552828f}, {-0.29389265f, 0.095491506f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32728714f, 0.237788f, -0.047552828f}, {0.25f, -0.18163563f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39944375f, 0.12978713f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3847491f, 0.12501256f, -0.047552828f}, {0.29389265f, -0.095491506f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3714929f, 0.12070535f, -0.040450852f}, {0.559017f, -0.18163563f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.42f, 0.0f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40454912f, 0.0f, -0.047552828f}, {0.309017f, 0.0f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39061072f, 0.0f, -0.040450852f}, {0.58778524f, 0.0f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43545085f, 0.0f, -0.047552828f}, {-0.309017f, 0.0f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39944375f, -0.12978713f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.44938925f, 0.0f, -0.040450852f}, {-0.58778524f, 0.0f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.41413838f, -0.1345617f, -0.047552828f}, {-0.29389265f, -0.095491506f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4273946f, -0.13886891f, -0.040450852f}, {-0.559017f, -0.18163563f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.46045083f, 0.0f, -0.029389262f}, {-0.809017f, 0.0f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4379148f, -0.14228714f, -0.029389262f}, {-0.7694209f, -0.25f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4675528f, 0.0f, -0.01545085f}, {-0.95105654f, 0.0f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4446692f, -0.14448176f, -0.01545085f}, {-0.90450853f, -0.29389265f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.47f, 0.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.44699657f, -0.14523798f, 0.0f}, {-0.95105654f, -0.309017f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4675528f, 0.0f, 0.01545085f}, {-0.95105654f, 0.0f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4446692f, -0.14448176f, 0.01545085f}, {-0.90450853f, -0.29389265f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.46045083f, 0.0f, 0.029389262f}, {-0.809017f, 0.0f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4379148f, -0.14228714f, 0.029389262f}, {-0.7694209f, -0.25f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.44938925f, 0.0f, 0.040450852f}, {-0.58778524f, 0.0f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.4273946f, -0.13886891f, 0.040450852f}, {-0.559017f, -0.18163563f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.43545085f, 0.0f, 0.047552828f}, {-0.309017f, 0.0f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.41413838f, -0.1345617f, 0.047552828f}, {-0.29389265f, -0.095491506f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.42f, 0.0f, 0.05f}, {1.6971862e-13f, 0.0f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39944375f, -0.12978713f, 0.05f}, {1.6141201e-13f, 5.244594e-14f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.40454912f, 0.0f, 0.047552828f}, {0.309017f, 0.0f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3847491f, -0.12501256f, 0.047552828f}, {0.29389265f, 0.095491506f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.39061072f, 0.0f, 0.040450852f}, {0.58778524f, 0.0f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3714929f, -0.12070535f, 0.040450852f}, {0.559017f, 0.18163563f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37954915f, 0.0f, 0.029389262f}, {0.809017f, 0.0f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3609727f, -0.11728713f, 0.029389262f}, {0.7694209f, 0.25f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37244716f, 0.0f, 0.01545085f}, {0.95105654f, 0.0f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3542183f, -0.1150925f, 0.01545085f}, {0.90450853f, 0.29389265f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36999997f, 0.0f, -8.485931e-15f}, {1.0f, 0.0f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.35189092f, -0.11433628f, -8.485931e-15f}, {0.95105654f, 0.309017f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37244716f, 0.0f, -0.01545085f}, {0.95105654f, 0.0f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3542183f, -0.1150925f, -0.01545085f}, {0.90450853f, 0.29389265f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37954915f, 0.0f, -0.029389262f}, {0.809017f, 0.0f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3609727f, -0.11728713f, -0.029389262f}, {0.7694209f, 0.25f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3714929f, -0.12070535f, -0.040450852f}, {0.559017f, 0.18163563f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3847491f, -0.12501256f, -0.047552828f}, {0.29389265f, 0.095491506f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3160107f, -0.22959521f, -0.040450852f}, {0.47552827f, 0.3454915f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32728714f, -0.237788f, -0.047552828f}, {0.25f, 0.18163563f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33978713f, -0.24686979f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3070617f, -0.22309338f, -0.029389262f}, {0.65450853f, 0.47552827f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.237788f, -0.32728714f, -0.047552828f}, {0.18163563f, 0.25f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.30131608f, -0.21891893f, -0.01545085f}, {0.7694209f, 0.559017f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22959521f, -0.3160107f, -0.040450852f}, {0.3454915f, 0.47552827f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22309338f, -0.3070617f, -0.029389262f}, {0.47552827f, 0.65450853f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29933628f, -0.21748053f, -8.485931e-15f}, {0.809017f, 0.58778524f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.21891893f, -0.30131608f, -0.01545085f}, {0.559017f, 0.7694209f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.30131608f, -0.21891893f, 0.01545085f}, {0.7694209f, 0.559017f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.21748053f, -0.29933628f, -8.485931e-15f}, {0.58778524f, 0.809017f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3070617f, -0.22309338f, 0.029389262f}, {0.65450853f, 0.47552827f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.21891893f, -0.30131608f, 0.01545085f}, {0.559017f, 0.7694209f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3160107f, -0.22959521f, 0.040450852f}, {0.47552827f, 0.3454915f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22309338f, -0.3070617f, 0.029389262f}, {0.47552827f, 0.65450853f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32728714f, -0.237788f, 0.047552828f}, {0.25f, 0.18163563f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.22959521f, -0.3160107f, 0.040450852f}, {0.3454915f, 0.47552827f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33978713f, -0.24686979f, 0.05f}, {1.3730525e-13f, 9.97581e-14f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.237788f, -0.32728714f, 0.047552828f}, {0.18163563f, 0.25f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3522871f, -0.25595158f, 0.047552828f}, {-0.25f, -0.18163563f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.24686979f, -0.33978713f, 0.05f}, {9.97581e-14f, 1.3730525e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36356354f, -0.26414436f, 0.040450852f}, {-0.47552827f, -0.3454915f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.25595158f, -0.3522871f, 0.047552828f}, {-0.18163563f, -0.25f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37251255f, -0.2706462f, 0.029389262f}, {-0.65450853f, -0.47552827f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.26414436f, -0.36356354f, 0.040450852f}, {-0.3454915f, -0.47552827f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37825817f, -0.27482063f, 0.01545085f}, {-0.7694209f, -0.559017f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2706462f, -0.37251255f, 0.029389262f}, {-0.47552827f, -0.65450853f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38023797f, -0.27625906f, 0.0f}, {-0.809017f, -0.58778524f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27482063f, -0.37825817f, 0.01545085f}, {-0.559017f, -0.7694209f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37825817f, -0.27482063f, -0.01545085f}, {-0.7694209f, -0.559017f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27625906f, -0.38023797f, 0.0f}, {-0.58778524f, -0.809017f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.37251255f, -0.2706462f, -0.029389262f}, {-0.65450853f, -0.47552827f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27482063f, -0.37825817f, -0.01545085f}, {-0.559017f, -0.7694209f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36356354f, -0.26414436f, -0.040450852f}, {-0.47552827f, -0.3454915f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2706462f, -0.37251255f, -0.029389262f}, {-0.47552827f, -0.65450853f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.3522871f, -0.25595158f, -0.047552828f}, {-0.25f, -0.18163563f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.26414436f, -0.36356354f, -0.040450852f}, {-0.3454915f, -0.47552827f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.25595158f, -0.3522871f, -0.047552828f}, {-0.18163563f, -0.25f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.24686979f, -0.33978713f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.13886891f, -0.4273946f, -0.040450852f}, {-0.18163563f, -0.559017f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.1345617f, -0.41413838f, -0.047552828f}, {-0.095491506f, -0.29389265f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.12978713f, -0.39944375f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14228714f, -0.4379148f, -0.029389262f}, {-0.25f, -0.7694209f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.6269726e-14f, -0.44938925f, -0.040450852f}, {-9.97581e-14f, -0.58778524f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14448176f, -0.4446692f, -0.01545085f}, {-0.29389265f, -0.90450853f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.8147084e-14f, -0.46045083f, -0.029389262f}, {-1.3730525e-13f, -0.809017f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.935242e-14f, -0.4675528f, -0.01545085f}, {-1.6141201e-13f, -0.95105654f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14523798f, -0.44699657f, 0.0f}, {-0.309017f, -0.95105654f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.976775e-14f, -0.47f, 0.0f}, {-1.6971862e-13f, -1.0f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14448176f, -0.4446692f, 0.01545085f}, {-0.29389265f, -0.90450853f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.935242e-14f, -0.4675528f, 0.01545085f}, {-1.6141201e-13f, -0.95105654f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.14228714f, -0.4379148f, 0.029389262f}, {-0.25f, -0.7694209f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.8147084e-14f, -0.46045083f, 0.029389262f}, {-1.3730525e-13f, -0.809017f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.13886891f, -0.4273946f, 0.040450852f}, {-0.18163563f, -0.559017f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.6269726e-14f, -0.44938925f, 0.040450852f}, {-9.97581e-14f, -0.58778524f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.1345617f, -0.41413838f, 0.047552828f}, {-0.095491506f, -0.29389265f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.390412e-14f, -0.43545085f, 0.047552828f}, {-5.244594e-14f, -0.309017f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.12978713f, -0.39944375f, 0.05f}, {5.244594e-14f, 1.6141201e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.128182e-14f, -0.42f, 0.05f}, {2.8804412e-26f, 1.6971862e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.12501256f, -0.3847491f, 0.047552828f}, {0.095491506f, 0.29389265f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.865952e-14f, -0.40454912f, 0.047552828f}, {5.244594e-14f, 0.309017f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.12070535f, -0.3714929f, 0.040450852f}, {0.18163563f, 0.559017f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.6293915e-14f, -0.39061072f, 0.040450852f}, {9.97581e-14f, 0.58778524f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11728713f, -0.3609727f, 0.029389262f}, {0.25f, 0.7694209f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.441656e-14f, -0.37954915f, 0.029389262f}, {1.3730525e-13f, 0.809017f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.1150925f, -0.3542183f, 0.01545085f}, {0.29389265f, 0.90450853f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.321122e-14f, -0.37244716f, 0.01545085f}, {1.6141201e-13f, 0.95105654f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11433628f, -0.35189092f, -8.485931e-15f}, {0.309017f, 0.95105654f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.279589e-14f, -0.36999997f, -8.485931e-15f}, {1.6971862e-13f, 1.0f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.1150925f, -0.3542183f, -0.01545085f}, {0.29389265f, 0.90450853f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.321122e-14f, -0.37244716f, -0.01545085f}, {1.6141201e-13f, 0.95105654f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.11728713f, -0.3609727f, -0.029389262f}, {0.25f, 0.7694209f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.441656e-14f, -0.37954915f, -0.029389262f}, {1.3730525e-13f, 0.809017f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.12070535f, -0.3714929f, -0.040450852f}, {0.18163563f, 0.559017f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.6293915e-14f, -0.39061072f, -0.040450852f}, {9.97581e-14f, 0.58778524f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.12501256f, -0.3847491f, -0.047552828f}, {0.095491506f, 0.29389265f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.865952e-14f, -0.40454912f, -0.047552828f}, {5.244594e-14f, 0.309017f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.128182e-14f, -0.42f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.390412e-14f, -0.43545085f, -0.047552828f}, {-5.244594e-14f, -0.309017f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.12978713f, -0.39944375f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.1345617f, -0.41413838f, -0.047552828f}, {0.095491506f, -0.29389265f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.13886891f, -0.4273946f, -0.040450852f}, {0.18163563f, -0.559017f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.12501256f, -0.3847491f, -0.047552828f}, {-0.095491506f, 0.29389265f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.25595158f, -0.3522871f, -0.047552828f}, {0.18163563f, -0.25f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.12070535f, -0.3714929f, -0.040450852f}, {-0.18163563f, 0.559017f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.24686979f, -0.33978713f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.237788f, -0.32728714f, -0.047552828f}, {-0.18163563f, 0.25f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11728713f, -0.3609727f, -0.029389262f}, {-0.25f, 0.7694209f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22959521f, -0.3160107f, -0.040450852f}, {-0.3454915f, 0.47552827f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.1150925f, -0.3542183f, -0.01545085f}, {-0.29389265f, 0.90450853f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22309338f, -0.3070617f, -0.029389262f}, {-0.47552827f, 0.65450853f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11433628f, -0.35189092f, -8.485931e-15f}, {-0.309017f, 0.95105654f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.21891893f, -0.30131608f, -0.01545085f}, {-0.559017f, 0.7694209f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.1150925f, -0.3542183f, 0.01545085f}, {-0.29389265f, 0.90450853f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.21748053f, -0.29933628f, -8.485931e-15f}, {-0.58778524f, 0.809017f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.11728713f, -0.3609727f, 0.029389262f}, {-0.25f, 0.7694209f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.21891893f, -0.30131608f, 0.01545085f}, {-0.559017f, 0.7694209f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.12070535f, -0.3714929f, 0.040450852f}, {-0.18163563f, 0.559017f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22309338f, -0.3070617f, 0.029389262f}, {-0.47552827f, 0.65450853f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.12501256f, -0.3847491f, 0.047552828f}, {-0.095491506f, 0.29389265f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.22959521f, -0.3160107f, 0.040450852f}, {-0.3454915f, 0.47552827f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.12978713f, -0.39944375f, 0.05f}, {-5.244594e-14f, 1.6141201e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.237788f, -0.32728714f, 0.047552828f}, {-0.18163563f, 0.25f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.1345617f, -0.41413838f, 0.047552828f}, {0.095491506f, -0.29389265f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.24686979f, -0.33978713f, 0.05f}, {-9.97581e-14f, 1.3730525e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.13886891f, -0.4273946f, 0.040450852f}, {0.18163563f, -0.559017f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.25595158f, -0.3522871f, 0.047552828f}, {0.18163563f, -0.25f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14228714f, -0.4379148f, 0.029389262f}, {0.25f, -0.7694209f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.26414436f, -0.36356354f, 0.040450852f}, {0.3454915f, -0.47552827f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14448176f, -0.4446692f, 0.01545085f}, {0.29389265f, -0.90450853f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2706462f, -0.37251255f, 0.029389262f}, {0.47552827f, -0.65450853f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14523798f, -0.44699657f, 0.0f}, {0.309017f, -0.95105654f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27482063f, -0.37825817f, 0.01545085f}, {0.559017f, -0.7694209f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14448176f, -0.4446692f, -0.01545085f}, {0.29389265f, -0.90450853f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27625906f, -0.38023797f, 0.0f}, {0.58778524f, -0.809017f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.14228714f, -0.4379148f, -0.029389262f}, {0.25f, -0.7694209f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27482063f, -0.37825817f, -0.01545085f}, {0.559017f, -0.7694209f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2706462f, -0.37251255f, -0.029389262f}, {0.47552827f, -0.65450853f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.26414436f, -0.36356354f, -0.040450852f}, {0.3454915f, -0.47552827f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37825817f, -0.27482063f, -0.01545085f}, {0.7694209f, -0.559017f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37251255f, -0.2706462f, -0.029389262f}, {0.65450853f, -0.47552827f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36356354f, -0.26414436f, -0.040450852f}, {0.47552827f, -0.3454915f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38023797f, -0.27625906f, 0.0f}, {0.809017f, -0.58778524f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4446692f, -0.14448176f, -0.01545085f}, {0.90450853f, -0.29389265f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37825817f, -0.27482063f, 0.01545085f}, {0.7694209f, -0.559017f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.44699657f, -0.14523798f, 0.0f}, {0.95105654f, -0.309017f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4446692f, -0.14448176f, 0.01545085f}, {0.90450853f, -0.29389265f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37251255f, -0.2706462f, 0.029389262f}, {0.65450853f, -0.47552827f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4379148f, -0.14228714f, 0.029389262f}, {0.7694209f, -0.25f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36356354f, -0.26414436f, 0.040450852f}, {0.47552827f, -0.3454915f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4273946f, -0.13886891f, 0.040450852f}, {0.559017f, -0.18163563f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3522871f, -0.25595158f, 0.047552828f}, {0.25f, -0.18163563f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.41413838f, -0.1345617f, 0.047552828f}, {0.29389265f, -0.095491506f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33978713f, -0.24686979f, 0.05f}, {-1.3730525e-13f, 9.97581e-14f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39944375f, -0.12978713f, 0.05f}, {-1.6141201e-13f, 5.244594e-14f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32728714f, -0.237788f, 0.047552828f}, {-0.25f, 0.18163563f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3847491f, -0.12501256f, 0.047552828f}, {-0.29389265f, 0.095491506f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3160107f, -0.22959521f, 0.040450852f}, {-0.47552827f, 0.3454915f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3714929f, -0.12070535f, 0.040450852f}, {-0.559017f, 0.18163563f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3070617f, -0.22309338f, 0.029389262f}, {-0.65450853f, 0.47552827f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3609727f, -0.11728713f, 0.029389262f}, {-0.7694209f, 0.25f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.30131608f, -0.21891893f, 0.01545085f}, {-0.7694209f, 0.559017f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3542183f, -0.1150925f, 0.01545085f}, {-0.90450853f, 0.29389265f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29933628f, -0.21748053f, -8.485931e-15f}, {-0.809017f, 0.58778524f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.35189092f, -0.11433628f, -8.485931e-15f}, {-0.95105654f, 0.309017f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.30131608f, -0.21891893f, -0.01545085f}, {-0.7694209f, 0.559017f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3542183f, -0.1150925f, -0.01545085f}, {-0.90450853f, 0.29389265f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3070617f, -0.22309338f, -0.029389262f}, {-0.65450853f, 0.47552827f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3609727f, -0.11728713f, -0.029389262f}, {-0.7694209f, 0.25f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3160107f, -0.22959521f, -0.040450852f}, {-0.47552827f, 0.3454915f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3714929f, -0.12070535f, -0.040450852f}, {-0.559017f, 0.18163563f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32728714f, -0.237788f, -0.047552828f}, {-0.25f, 0.18163563f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3847491f, -0.12501256f, -0.047552828f}, {-0.29389265f, 0.095491506f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33978713f, -0.24686979f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39944375f, -0.12978713f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3522871f, -0.25595158f, -0.047552828f}, {0.25f, -0.18163563f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.41413838f, -0.1345617f, -0.047552828f}, {0.29389265f, -0.095491506f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4273946f, -0.13886891f, -0.040450852f}, {0.559017f, -0.18163563f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4379148f, -0.14228714f, -0.029389262f}, {0.7694209f, -0.25f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.44938925f, -7.6269726e-14f, -0.040450852f}, {0.58778524f, -9.97581e-14f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.46045083f, -7.8147084e-14f, -0.029389262f}, {0.809017f, -1.3730525e-13f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4675528f, -7.935242e-14f, -0.01545085f}, {0.95105654f, -1.6141201e-13f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43545085f, -7.390412e-14f, -0.047552828f}, {0.309017f, -5.244594e-14f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4379148f, 0.14228714f, -0.029389262f}, {0.7694209f, 0.25f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.42f, -7.128182e-14f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4273946f, 0.13886891f, -0.040450852f}, {0.559017f, 0.18163563f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.41413838f, 0.1345617f, -0.047552828f}, {0.29389265f, 0.095491506f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40454912f, -6.865952e-14f, -0.047552828f}, {-0.309017f, 5.244594e-14f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39944375f, 0.12978713f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39061072f, -6.6293915e-14f, -0.040450852f}, {-0.58778524f, 9.97581e-14f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3847491f, 0.12501256f, -0.047552828f}, {-0.29389265f, -0.095491506f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37954915f, -6.441656e-14f, -0.029389262f}, {-0.809017f, 1.3730525e-13f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3714929f, 0.12070535f, -0.040450852f}, {-0.559017f, -0.18163563f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37244716f, -6.321122e-14f, -0.01545085f}, {-0.95105654f, 1.6141201e-13f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3609727f, 0.11728713f, -0.029389262f}, {-0.7694209f, -0.25f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36999997f, -6.279589e-14f, -8.485931e-15f}, {-1.0f, 1.6971862e-13f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3542183f, 0.1150925f, -0.01545085f}, {-0.90450853f, -0.29389265f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37244716f, -6.321122e-14f, 0.01545085f}, {-0.95105654f, 1.6141201e-13f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.35189092f, 0.11433628f, -8.485931e-15f}, {-0.95105654f, -0.309017f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37954915f, -6.441656e-14f, 0.029389262f}, {-0.809017f, 1.3730525e-13f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3542183f, 0.1150925f, 0.01545085f}, {-0.90450853f, -0.29389265f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39061072f, -6.6293915e-14f, 0.040450852f}, {-0.58778524f, 9.97581e-14f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3609727f, 0.11728713f, 0.029389262f}, {-0.7694209f, -0.25f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.40454912f, -6.865952e-14f, 0.047552828f}, {-0.309017f, 5.244594e-14f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3714929f, 0.12070535f, 0.040450852f}, {-0.559017f, -0.18163563f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.42f, -7.128182e-14f, 0.05f}, {-1.6971862e-13f, 2.8804412e-26f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3847491f, 0.12501256f, 0.047552828f}, {-0.29389265f, -0.095491506f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.43545085f, -7.390412e-14f, 0.047552828f}, {0.309017f, -5.244594e-14f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.39944375f, 0.12978713f, 0.05f}, {-1.6141201e-13f, -5.244594e-14f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.44938925f, -7.6269726e-14f, 0.040450852f}, {0.58778524f, -9.97581e-14f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.41413838f, 0.1345617f, 0.047552828f}, {0.29389265f, 0.095491506f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.46045083f, -7.8147084e-14f, 0.029389262f}, {0.809017f, -1.3730525e-13f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4273946f, 0.13886891f, 0.040450852f}, {0.559017f, 0.18163563f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4675528f, -7.935242e-14f, 0.01545085f}, {0.95105654f, -1.6141201e-13f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4379148f, 0.14228714f, 0.029389262f}, {0.7694209f, 0.25f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.47f, -7.976775e-14f, 0.0f}, {1.0f, -1.6971862e-13f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4446692f, 0.14448176f, 0.01545085f}, {0.90450853f, 0.29389265f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.44699657f, 0.14523798f, 0.0f}, {0.95105654f, 0.309017f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.4446692f, 0.14448176f, -0.01545085f}, {0.90450853f, 0.29389265f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37825817f, 0.27482063f, 0.01545085f}, {0.7694209f, 0.559017f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38023797f, 0.27625906f, 0.0f}, {0.809017f, 0.58778524f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37251255f, 0.2706462f, -0.029389262f}, {0.65450853f, 0.47552827f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36356354f, 0.26414436f, -0.040450852f}, {0.47552827f, 0.3454915f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3522871f, 0.25595158f, -0.047552828f}, {0.25f, 0.18163563f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33978713f, 0.24686979f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32728714f, 0.237788f, -0.047552828f}, {-0.25f, -0.18163563f, -0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3160107f, 0.22959521f, -0.040450852f}, {-0.47552827f, -0.3454915f, -0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3070617f, 0.22309338f, -0.029389262f}, {-0.65450853f, -0.47552827f, -0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.30131608f, 0.21891893f, -0.01545085f}, {-0.7694209f, -0.559017f, -0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29933628f, 0.21748053f, -8.485931e-15f}, {-0.809017f, -0.58778524f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.30131608f, 0.21891893f, 0.01545085f}, {-0.7694209f, -0.559017f, 0.309017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3070617f, 0.22309338f, 0.029389262f}, {-0.65450853f, -0.47552827f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3160107f, 0.22959521f, 0.040450852f}, {-0.47552827f, -0.3454915f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32728714f, 0.237788f, 0.047552828f}, {-0.25f, -0.18163563f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33978713f, 0.24686979f, 0.05f}, {-1.3730525e-13f, -9.97581e-14f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.3522871f, 0.25595158f, 0.047552828f}, {0.25f, 0.18163563f, 0.95105654f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36356354f, 0.26414436f, 0.040450852f}, {0.47552827f, 0.3454915f, 0.809017f}, {0.95f, 0.75f, 0.2f}},
+		{{0.37251255f, 0.2706462f, 0.029389262f}, {0.65450853f, 0.47552827f, 0.58778524f}, {0.95f, 0.75f, 0.2f}},
+	};
+
+	constexpr uint16_t hintRingLevel1Indices[] = {
+		0, 1, 2, 3, 0, 2, 0, 4, 1, 3, 2, 5, 6, 4, 0, 7,
+		0, 3, 7, 6, 0, 8, 7, 3, 9, 6, 7, 8, 3, 10, 10, 3,
+		5, 11, 7, 8, 11, 9, 7, 12, 8, 10, 13, 11, 8, 13, 8, 12,
+		14, 9, 11, 15, 11, 13, 15, 14, 11, 16, 13, 12, 17, 15, 13, 17,
+		13, 16, 18, 14, 15, 19, 15, 17, 19, 18, 15, 20, 17, 16, 21, 19,
+		17, 21, 17, 20, 22, 18, 19, 23, 19, 21, 23, 22, 19, 24, 21, 20,
+		25, 23, 21, 25, 21, 24, 26, 22, 23, 27, 23, 25, 27, 26, 23, 28,
+		25, 24, 29, 27, 25, 29, 25, 28, 30, 26, 27, 31, 27, 29, 31, 30,
+		27, 32, 29, 28, 33, 31, 29, 33, 29, 32, 34, 30, 31, 35, 31, 33,
+		35, 34, 31, 36, 33, 32, 37, 35, 33, 37, 33, 36, 38, 34, 35, 39,
+		35, 37, 39, 38, 35, 40, 37, 36, 41, 39, 37, 41, 37, 40, 42, 38,
+		39, 43, 39, 41, 43, 42, 39, 44, 41, 40, 45, 43, 41, 45, 41, 44,
+		46, 42, 43, 47, 43, 45, 47, 46, 43, 48, 45, 44, 49, 47, 45, 49,
+		45, 48, 50, 46, 47, 51, 47, 49, 51, 50, 47, 52, 49, 48, 53, 51,
+		49, 53, 49, 52, 54, 50, 51, 55, 51, 53, 55, 54, 51, 56, 53, 52,
+		57, 55, 53, 57, 53, 56, 58, 54, 55, 59, 55, 57, 59, 58, 55, 60,
+		57, 56, 61, 59, 57, 61, 57, 60, 62, 58, 59, 63, 59, 61, 63, 62,
+		59, 64, 61, 60, 65, 63, 61, 65, 61, 64, 66, 62, 63, 67, 63, 65,
+		67, 66, 63, 68, 65, 64, 69, 67, 65, 69, 65, 68, 70, 66, 67, 71,
+		67, 69, 71, 70, 67, 72, 69, 68, 73, 71, 69, 73, 69, 72, 74, 70,
+		71, 75, 71, 73, 75, 74, 71, 76, 73, 72, 77, 75, 73, 77, 73, 76,
+		1, 75, 77, 2, 1, 77, 1, 78, 75, 78, 74, 75, 4, 78, 1, 2,
+		77, 79, 79, 77, 76, 5, 2, 79, 4, 80, 78, 5, 79, 81, 82, 80,
+		4, 6, 82, 4, 80, 83, 78, 78, 83, 74, 84, 82, 6, 9, 84, 6,
+		83, 85, 74, 74, 85, 70, 86, 84, 9, 14, 86, 9, 85, 87, 70, 70,
+		87, 66, 88, 86, 14, 18, 88, 14, 87, 89, 66, 66, 89, 62, 90, 88,
+		18, 22, 90, 18, 89, 91, 62, 62, 91, 58, 92, 90, 22, 26, 92, 22,
+		91, 93, 58, 58, 93, 54, 94, 92, 26, 30, 94, 26, 93, 95, 54, 54,
+		95, 50, 96, 94, 30, 34, 96, 30, 95, 97, 50, 50, 97, 46, 98, 96,
+		34, 38, 98, 34, 97, 99, 46, 46, 99, 42, 42, 100, 38, 99, 100, 42,
+		100, 98, 38, 97, 101, 99, 99, 102, 100, 101, 102, 99, 100, 103, 98, 102,
+		103, 100, 104, 101, 97, 95, 104, 97, 101, 105, 102, 106, 104, 95, 93, 106,
+		95, 104, 107, 101, 107, 105, 101, 106, 108, 104, 108, 107, 104, 109, 106, 93,
+		91, 109, 93, 110, 108, 106, 109, 110, 106, 111, 109, 91, 89, 111, 91, 112,
+		110, 109, 111, 112, 109, 113, 111, 89, 87, 113, 89, 114, 112, 111, 113, 114,
+		111, 115, 113, 87, 85, 115, 87, 116, 114, 113, 115, 116, 113, 117, 115, 85,
+		83, 117, 85, 118, 116, 115, 117, 118, 115, 119, 117, 83, 80, 119, 83, 120,
+		118, 117, 119, 120, 117, 121, 119, 80, 82, 121, 80, 122, 120, 119, 121, 122,
+		119, 123, 121, 82, 84, 123, 82, 124, 122, 121, 123, 124, 121, 125, 123, 84,
+		86, 125, 84, 126, 124, 123, 125, 126, 123, 127, 125, 86, 88, 127, 86, 128,
+		126, 125, 127, 128, 125, 129, 127, 88, 90, 129, 88, 130, 128, 127, 129, 130,
+		127, 131, 129, 90, 92, 131, 90, 132, 130, 129, 131, 132, 129, 133, 131, 92,
+		94, 133, 92, 134, 132, 131, 133, 134, 131, 135, 133, 94, 96, 135, 94, 136,
+		134, 133, 135, 136, 133, 137, 135, 96, 98, 137, 96, 103, 137, 98, 137, 138,
+		135, 138, 136, 135, 103, 139, 137, 139, 138, 137, 140, 139, 103, 102, 140, 103,
+		105, 140, 102, 139, 141, 138, 140, 142, 139, 142, 141, 139, 105, 143, 140, 143,
+		142, 140, 141, 144, 138, 138, 144, 136, 142, 145, 141, 144, 146, 136, 136, 146,
+		134, 141, 147, 144, 145, 147, 141, 144, 148, 146, 147, 148, 144, 146, 149, 134,
+		134, 149, 132, 148, 150, 146, 146, 150, 149, 149, 151, 132, 132, 151, 130, 150,
+		152, 149, 149, 152, 151, 151, 153, 130, 130, 153, 128, 152, 154, 151, 151, 154,
+		153, 153, 155, 128, 128, 155, 126, 154, 156, 153, 153, 156, 155, 155, 157, 126,
+		126, 157, 124, 156, 158, 155, 155, 158, 157, 157, 159, 124, 124, 159, 122, 158,
+		160, 157, 157, 160, 159, 159, 161, 122, 122, 161, 120, 160, 162, 159, 159, 162,
+		161, 161, 163, 120, 120, 163, 118, 162, 164, 161, 161, 164, 163, 163, 165, 118,
+		118, 165, 116, 164, 166, 163, 163, 166, 165, 165, 167, 116, 116, 167, 114, 166,
+		168, 165, 165, 168, 167, 167, 169, 114, 114, 169, 112, 168, 170, 167, 167, 170,
+		169, 169, 171, 112, 112, 171, 110, 170, 172, 169, 169, 172, 171, 171, 173, 110,
+		110, 173, 108, 172, 174, 171, 171, 174, 173, 173, 175, 108, 108, 175, 107, 174,
+		176, 173, 173, 176, 175, 175, 177, 107, 107, 177, 105, 177, 143, 105, 175, 178,
+		177, 176, 178, 175, 177, 179, 143, 178, 179, 177, 179, 180, 143, 143, 180, 142,
+		180, 145, 142, 178, 181, 179, 179, 182, 180, 181, 182, 179, 180, 183, 145, 182,
+		183, 180, 184, 181, 178, 176, 184, 178, 181, 185, 182, 186, 184, 176, 174, 186,
+		176, 184, 187, 181, 187, 185, 181, 186, 188, 184, 188, 187, 184, 189, 186, 174,
+		172, 189, 174, 190, 188, 186, 189, 190, 186, 191, 189, 172, 170, 191, 172, 192,
+		190, 189, 191, 192, 189, 193, 191, 170, 168, 193, 170, 194, 192, 191, 193, 194,
+		191, 195, 193, 168, 166, 195, 168, 196, 194, 193, 195, 196, 193, 197, 195, 166,
+		164, 197, 166, 198, 196, 195, 197, 198, 195, 199, 197, 164, 162, 199, 164, 200,
+		198, 197, 199, 200, 197, 201, 199, 162, 160, 201, 162, 202, 200, 199, 201, 202,
+		199, 203, 201, 160, 158, 203, 160, 204, 202, 201, 203, 204, 201, 205, 203, 158,
+		156, 205, 158, 206, 204, 203, 205, 206, 203, 207, 205, 156, 154, 207, 156, 208,
+		206, 205, 207, 208, 205, 209, 207, 154, 152, 209, 154, 210, 208, 207, 209, 210,
+		207, 211, 209, 152, 150, 211, 152, 212, 210, 209, 211, 212, 209, 213, 211, 150,
+		148, 213, 150, 214, 212, 211, 213, 214, 211, 215, 213, 148, 147, 215, 148, 216,
+		214, 213, 215, 216, 213, 217, 215, 147, 145, 217, 147, 183, 217, 145, 217, 218,
+		215, 218, 216, 215, 183, 219, 217, 219, 218, 217, 220, 219, 183, 182, 220, 183,
+		185, 220, 182, 219, 221, 218, 220, 222, 219, 222, 221, 219, 185, 223, 220, 223,
+		222, 220, 221, 224, 218, 218, 224, 216, 222, 225, 221, 224, 226, 216, 216, 226,
+		214, 221, 227, 224, 225, 227, 221, 224, 228, 226, 227, 228, 224, 226, 229, 214,
+		214, 229, 212, 228, 230, 226, 226, 230, 229, 229, 231, 212, 212, 231, 210, 230,
+		232, 229, 229, 232, 231, 231, 233, 210, 210, 233, 208, 232, 234, 231, 231, 234,
+		233, 233, 235, 208, 208, 235, 206, 234, 236, 233, 233, 236, 235, 235, 237, 206,
+		206, 237, 204, 236, 238, 235, 235, 238, 237, 237, 239, 204, 204, 239, 202, 238,
+		240, 237, 237, 240, 239, 239, 241, 202, 202, 241, 200, 240, 242, 239, 239, 242,
+		241, 241, 243, 200, 200, 243, 198, 242, 244, 241, 241, 244, 243, 243, 245, 198,
+		198, 245, 196, 244, 246, 243, 243, 246, 245, 245, 247, 196, 196, 247, 194, 246,
+		248, 245, 245, 248, 247, 247, 249, 194, 194, 249, 192, 248, 250, 247, 247, 250,
+		249, 249, 251, 192, 192, 251, 190, 250, 252, 249, 249, 252, 251, 251, 253, 190,
+		190, 253, 188, 252, 254, 251, 251, 254, 253, 253, 255, 188, 188, 255, 187, 254,
+		256, 253, 253, 256, 255, 255, 257, 187, 187, 257, 185, 257, 223, 185, 255, 258,
+		257, 256, 258, 255, 257, 259, 223, 258, 259, 257, 259, 260, 223, 223, 260, 222,
+		260, 225, 222, 258, 261, 259, 259, 262, 260, 261, 262, 259, 260, 263, 225, 262,
+		263, 260, 264, 261, 258, 256, 264, 258, 261, 265, 262, 266, 264, 256, 254, 266,
+		256, 264, 267, 261, 267, 265, 261, 266, 268, 264, 268, 267, 264, 269, 266, 254,
+		252, 269, 254, 270, 268, 266, 269, 270, 266, 271, 269, 252, 250, 271, 252, 272,
+		270, 269, 271, 272, 269, 273, 271, 250, 248, 273, 250, 274, 272, 271, 273, 274,
+		271, 275, 273, 248, 246, 275, 248, 276, 274, 273, 275, 276, 273, 277, 275, 246,
+		244, 277, 246, 278, 276, 275, 277, 278, 275, 279, 277, 244, 242, 279, 244, 280,
+		278, 277, 279, 280, 277, 281, 279, 242, 240, 281, 242, 282, 280, 279, 281, 282,
+		279, 283, 281, 240, 238, 283, 240, 284, 282, 281, 283, 284, 281, 285, 283, 238,
+		236, 285, 238, 286, 284, 283, 285, 286, 283, 287, 285, 236, 234, 287, 236, 288,
+		286, 285, 287, 288, 285, 289, 287, 234, 232, 289, 234, 290, 288, 287, 289, 290,
+		287, 291, 289, 232, 230, 291, 232, 292, 290, 289, 291, 292, 289, 293, 291, 230,
+		228, 293, 230, 294, 292, 291, 293, 294, 291, 295, 293, 228, 227, 295, 228, 296,
+		294, 293, 295, 296, 293, 297, 295, 227, 225, 297, 227, 263, 297, 225, 297, 298,
+		295, 298, 296, 295, 263, 299, 297, 299, 298, 297, 300, 299, 263, 262, 300, 263,
+		265, 300, 262, 299, 301, 298, 300, 302, 299, 302, 301, 299, 265, 303, 300, 303,
+		302, 300, 301, 304, 298, 298, 304, 296, 302, 305, 301, 304, 306, 296, 296, 306,
+		294, 301, 307, 304, 305, 307, 301, 304, 308, 306, 307, 308, 304, 306, 309, 294,
+		294, 309, 292, 308, 310, 306, 306, 310, 309, 309, 311, 292, 292, 311, 290, 310,
+		312, 309, 309, 312, 311, 311, 313, 290, 290, 313, 288, 312, 314, 311, 311, 314,
+		313, 313, 315, 288, 288, 315, 286, 314, 316, 313, 313, 316, 315, 315, 317, 286,
+		286, 317, 284, 316, 318, 315, 315, 318, 317, 317, 319, 284, 284, 319, 282, 318,
+		320, 317, 317, 320, 319, 319, 321, 282, 282, 321, 280, 320, 322, 319, 319, 322,
+		321, 321, 323, 280, 280, 323, 278, 322, 324, 321, 321, 324, 323, 323, 325, 278,
+		278, 325, 276, 324, 326, 323, 323, 326, 325, 325, 327, 276, 276, 327, 274, 326,
+		328, 325, 325, 328, 327, 327, 329, 274, 274, 329, 272, 328, 330, 327, 327, 330,
+		329, 329, 331, 272, 272, 331, 270, 330, 332, 329, 329, 332, 331, 331, 333, 270,
+		270, 333, 268, 332, 334, 331, 331, 334, 333, 333, 335, 268, 268, 335, 267, 334,
+		336, 333, 333, 336, 335, 335, 337, 267, 267, 337, 265, 337, 303, 265, 335, 338,
+		337, 336, 338, 335, 337, 339, 303, 338, 339, 337, 339, 340, 303, 303, 340, 302,
+		340, 305, 302, 338, 341, 339, 339, 342, 340, 341, 342, 339, 340, 343, 305, 342,
+		343, 340, 344, 341, 338, 336, 344, 338, 341, 345, 342, 346, 344, 336, 334, 346,
+		336, 344, 347, 341, 347, 345, 341, 346, 348, 344, 348, 347, 344, 349, 346, 334,
+		332, 349, 334, 350, 348, 346, 349, 350, 346, 351, 349, 332, 330, 351, 332, 352,
+		350, 349, 351, 352, 349, 353, 351, 330, 328, 353, 330, 354, 352, 351, 353, 354,
+		351, 355, 353, 328, 326, 355, 328, 356, 354, 353, 355, 356, 353, 357, 355, 326,
+		324, 357, 326, 358, 356, 355, 357, 358, 355, 359, 357, 324, 322, 359, 324, 360,
+		358, 357, 359, 360, 357, 361, 359, 322, 320, 361, 322, 362, 360, 359, 361, 362,
+		359, 363, 361, 320, 318, 363, 320, 364, 362, 361, 363, 364, 361, 365, 363, 318,
+		316, 365, 318, 366, 364, 363, 365, 366, 363, 367, 365, 316, 314, 367, 316, 368,
+		366, 365, 367, 368, 365, 369, 367, 314, 312, 369, 314, 370, 368, 367, 369, 370,
+		367, 371, 369, 312, 310, 371, 312, 372, 370, 369, 371, 372, 369, 373, 371, 310,
+		308, 373, 310, 374, 372, 371, 373, 374, 371, 375, 373, 308, 307, 375, 308, 376,
+		374, 373, 375, 376, 373, 377, 375, 307, 305, 377, 307, 343, 377, 305, 377, 378,
+		375, 378, 376, 375, 343, 379, 377, 379, 378, 377, 380, 379, 343, 342, 380, 343,
+		345, 380, 342, 379, 381, 378, 345, 81, 380, 380, 382, 379, 81, 382, 380, 382,
+		381, 379, 81, 79, 382, 79, 76, 382, 382, 76, 381, 76, 72, 381, 383, 81,
+		345, 383, 5, 81, 347, 383, 345, 10, 5, 383, 384, 383, 347, 384, 10, 383,
+		348, 384, 347, 12, 10, 384, 385, 384, 348, 385, 12, 384, 350, 385, 348, 16,
+		12, 385, 386, 385, 350, 386, 16, 385, 352, 386, 350, 20, 16, 386, 387, 386,
+		352, 387, 20, 386, 354, 387, 352, 24, 20, 387, 388, 387, 354, 388, 24, 387,
+		356, 388, 354, 28, 24, 388, 389, 388, 356, 389, 28, 388, 358, 389, 356, 32,
+		28, 389, 390, 389, 358, 390, 32, 389, 360, 390, 358, 36, 32, 390, 391, 390,
+		360, 391, 36, 390, 362, 391, 360, 40, 36, 391, 392, 391, 362, 392, 40, 391,
+		364, 392, 362, 44, 40, 392, 393, 392, 364, 393, 44, 392, 366, 393, 364, 48,
+		44, 393, 394, 393, 366, 394, 48, 393, 368, 394, 366, 52, 48, 394, 395, 394,
+		368, 395, 52, 394, 370, 395, 368, 56, 52, 395, 396, 395, 370, 396, 56, 395,
+		372, 396, 370, 60, 56, 396, 397, 396, 372, 397, 60, 396, 374, 397, 372, 64,
+		60, 397, 398, 397, 374, 398, 64, 397, 376, 398, 374, 68, 64, 398, 399, 398,
+		376, 399, 68, 398, 378, 399, 376, 72, 68, 399, 381, 399, 378, 381, 72, 399,
+	};
+
+	constexpr Vertex hintRingLevel2Vertices[] = {
+		{{0.0f, 0.47f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.45535532f, 0.03535534f}, {0.0f, 0.70710677f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33234015f, 0.33234015f, 0.0f}, {0.70710677f, 0.70710677f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32198483f, 0.32198483f, -0.03535534f}, {0.49999997f, 0.49999997f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32198483f, 0.32198483f, 0.03535534f}, {-0.49999997f, 0.49999997f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45535532f, -7.728228e-14f, -0.03535534f}, {0.70710677f, -1.2000919e-13f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33234015f, 0.33234015f, 0.0f}, {-0.70710677f, 0.70710677f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.45535532f, -0.03535534f}, {0.0f, 0.70710677f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29698482f, 0.29698482f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32198483f, 0.32198483f, -0.03535534f}, {-0.49999997f, 0.49999997f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.42f, -7.128182e-14f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.42f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38464466f, -6.528136e-14f, -0.03535534f}, {-0.70710677f, 1.2000919e-13f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27198482f, 0.27198482f, -0.03535534f}, {-0.49999997f, -0.49999997f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29698482f, 0.29698482f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.38464466f, -0.03535534f}, {0.0f, -0.70710677f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.36999997f, -6.279589e-14f, -8.485931e-15f}, {-1.0f, 1.6971862e-13f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2616295f, 0.2616295f, -8.485931e-15f}, {-0.70710677f, -0.70710677f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27198482f, 0.27198482f, -0.03535534f}, {0.49999997f, -0.49999997f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.36999997f, -8.485931e-15f}, {0.0f, -1.0f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.38464466f, -6.528136e-14f, 0.03535534f}, {-0.70710677f, 1.2000919e-13f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27198482f, 0.27198482f, 0.03535534f}, {-0.49999997f, -0.49999997f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2616295f, 0.2616295f, -8.485931e-15f}, {0.70710677f, -0.70710677f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.38464466f, 0.03535534f}, {0.0f, -0.70710677f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.42f, -7.128182e-14f, 0.05f}, {-1.6971862e-13f, 2.8804412e-26f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29698482f, 0.29698482f, 0.05f}, {-1.2000919e-13f, -1.2000919e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27198482f, 0.27198482f, 0.03535534f}, {0.49999997f, -0.49999997f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.0f, 0.42f, 0.05f}, {0.0f, -1.6971862e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.45535532f, -7.728228e-14f, 0.03535534f}, {0.70710677f, -1.2000919e-13f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32198483f, 0.32198483f, 0.03535534f}, {0.49999997f, 0.49999997f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29698482f, 0.29698482f, 0.05f}, {1.2000919e-13f, -1.2000919e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.47f, -7.976775e-14f, 0.0f}, {1.0f, -1.6971862e-13f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.42f, 0.0f, 0.05f}, {1.6971862e-13f, 0.0f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32198483f, -0.32198483f, -0.03535534f}, {0.49999997f, -0.49999997f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45535532f, 0.0f, 0.03535534f}, {-0.70710677f, 0.0f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38464466f, 0.0f, 0.03535534f}, {0.70710677f, 0.0f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.47f, 0.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.36999997f, 0.0f, -8.485931e-15f}, {1.0f, 0.0f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.45535532f, 0.0f, -0.03535534f}, {-0.70710677f, 0.0f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.38464466f, 0.0f, -0.03535534f}, {0.70710677f, 0.0f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.42f, 0.0f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27198482f, -0.27198482f, -0.03535534f}, {0.49999997f, 0.49999997f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29698482f, -0.29698482f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32198483f, -0.32198483f, -0.03535534f}, {-0.49999997f, -0.49999997f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.2616295f, -0.2616295f, -8.485931e-15f}, {0.70710677f, 0.70710677f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.128182e-14f, -0.42f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.27198482f, -0.27198482f, 0.03535534f}, {0.49999997f, 0.49999997f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.528136e-14f, -0.38464466f, -0.03535534f}, {1.2000919e-13f, 0.70710677f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.279589e-14f, -0.36999997f, -8.485931e-15f}, {1.6971862e-13f, 1.0f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.29698482f, -0.29698482f, 0.05f}, {1.2000919e-13f, 1.2000919e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-6.528136e-14f, -0.38464466f, 0.03535534f}, {1.2000919e-13f, 0.70710677f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.32198483f, -0.32198483f, 0.03535534f}, {-0.49999997f, -0.49999997f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.128182e-14f, -0.42f, 0.05f}, {2.8804412e-26f, 1.6971862e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-0.33234015f, -0.33234015f, 0.0f}, {-0.70710677f, -0.70710677f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.728228e-14f, -0.45535532f, 0.03535534f}, {-1.2000919e-13f, -0.70710677f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.976775e-14f, -0.47f, 0.0f}, {-1.6971862e-13f, -1.0f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{-7.728228e-14f, -0.45535532f, -0.03535534f}, {-1.2000919e-13f, -0.70710677f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.32198483f, -0.32198483f, 0.03535534f}, {0.49999997f, -0.49999997f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.33234015f, -0.33234015f, 0.0f}, {0.70710677f, -0.70710677f, 0.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29698482f, -0.29698482f, -0.05f}, {0.0f, 0.0f, -1.0f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27198482f, -0.27198482f, -0.03535534f}, {-0.49999997f, 0.49999997f, -0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.2616295f, -0.2616295f, -8.485931e-15f}, {-0.70710677f, 0.70710677f, -1.6971862e-13f}, {0.95f, 0.75f, 0.2f}},
+		{{0.27198482f, -0.27198482f, 0.03535534f}, {-0.49999997f, 0.49999997f, 0.70710677f}, {0.95f, 0.75f, 0.2f}},
+		{{0.29698482f, -0.29698482f, 0.05f}, {-1.2000919e-13f, 1.2000919e-13f, 1.0f}, {0.95f, 0.75f, 0.2f}},
+	};
+
+	constexpr uint16_t hintRingLevel2Indices[] = {
+		0, 1, 2, 3, 0, 2, 0, 4, 1, 3, 2, 5, 6, 4, 0, 7,
+		0, 3, 7, 6, 0, 8, 7, 3, 9, 6, 7, 8, 3, 10, 10, 3,
+		5, 11, 7, 8, 11, 9, 7, 12, 8, 10, 13, 11, 8, 13, 8, 12,
+		14, 9, 11, 15, 11, 13, 15, 14, 11, 16, 13, 12, 17, 15, 13, 17,
+		13, 16, 18, 14, 15, 19, 15, 17, 19, 18, 15, 20, 17, 16, 21, 19,
+		17, 21, 17, 20, 22, 18, 19, 23, 19, 21, 23, 22, 19, 24, 21, 20,
+		25, 23, 21, 25, 21, 24, 26, 22, 23, 27, 23, 25, 27, 26, 23, 28,
+		25, 24, 29, 27, 25, 29, 25, 28, 1, 27, 29, 2, 1, 29, 1, 30,
+		27, 30, 26, 27, 4, 30, 1, 2, 29, 31, 31, 29, 28, 5, 2, 31,
+		4, 32, 30, 5, 31, 33, 34, 32, 4, 6, 34, 4, 32, 35, 30, 30,
+		35, 26, 36, 34, 6, 9, 36, 6, 35, 37, 26, 26, 37, 22, 38, 36,
+		9, 14, 38, 9, 37, 39, 22, 22, 39, 18, 18, 40, 14, 39, 40, 18,
+		40, 38, 14, 37, 41, 39, 39, 42, 40, 41, 42, 39, 40, 43, 38, 42,
+		43, 40, 44, 41, 37, 35, 44, 37, 41, 45, 42, 46, 44, 35, 32, 46,
+		35, 44, 47, 41, 47, 45, 41, 46, 48, 44, 48, 47, 44, 49, 46, 32,
+		34, 49, 32, 50, 48, 46, 49, 50, 46, 51, 49, 34, 36, 51, 34, 52,
+		50, 49, 51, 52, 49, 53, 51, 36, 38, 53, 36, 43, 53, 38, 53, 54,
+		51, 54, 52, 51, 43, 55, 53, 55, 54, 53, 56, 55, 43, 42, 56, 43,
+		45, 56, 42, 55, 57, 54, 45, 33, 56, 56, 58, 55, 33, 58, 56, 58,
+		57, 55, 33, 31, 58, 31, 28, 58, 58, 28, 57, 28, 24, 57, 59, 33,
+		45, 59, 5, 33, 47, 59, 45, 10, 5, 59, 60, 59, 47, 60, 10, 59,
+		48, 60, 47, 12, 10, 60, 61, 60, 48, 61, 12, 60, 50, 61, 48, 16,
+		12, 61, 62, 61, 50, 62, 16, 61, 52, 62, 50, 20, 16, 62, 63, 62,
+		52, 63, 20, 62, 54, 63, 52, 24, 20, 63, 57, 63, 54, 57, 24, 63,
+	};
+
+	// Indexed by MeshAsset, then by level of detail, the finest first.
+	constexpr BakedMesh meshes[5][3] = {
+		{{tileOddLevel0Vertices, 4, tileOddLevel0Indices, 6, {{-0.5f, 0.0f, -0.5f}, {0.5f, 0.0f, 0.5f}, {0.0f, 0.0f, 0.0f}, 0.70710677f}}, {}, {}},
+		{{tileEvenLevel0Vertices, 4, tileEvenLevel0Indices, 6, {{-0.5f, 0.0f, -0.5f}, {0.5f, 0.0f, 0.5f}, {0.0f, 0.0f, 0.0f}, 0.70710677f}}, {}, {}},
+		{{tableBorderLevel0Vertices, 4, tableBorderLevel0Indices, 6, {{-0.5f, 0.0f, -0.5f}, {0.5f, 0.0f, 0.5f}, {0.0f, 0.0f, 0.0f}, 0.70710677f}}, {}, {}},
+		{{pieceLevel0Vertices, 194, pieceLevel0Indices, 576, {{-0.35f, -0.1f, -0.35f}, {0.35f, 0.1f, 0.35f}, {0.0f, 0.0f, 0.0f}, 0.36400548f}}, {pieceLevel1Vertices, 82, pieceLevel1Indices, 240, {{-0.35f, -0.1f, -0.35f}, {0.35f, 0.1f, 0.35f}, {0.0f, 0.0f, 0.0f}, 0.3640055f}}, {pieceLevel2Vertices, 34, pieceLevel2Indices, 96, {{-0.35f, -0.1f, -0.35f}, {0.35f, 0.1f, 0.35f}, {0.0f, 0.0f, 0.0f}, 0.36400548f}}},
+		{{hintRingLevel0Vertices, 2304, hintRingLevel0Indices, 13824, {{-0.47f, -0.47f, -0.05f}, {0.47f, 0.47f, 0.05f}, {0.0f, 0.0f, 0.0f}, 0.47000003f}}, {hintRingLevel1Vertices, 400, hintRingLevel1Indices, 2400, {{-0.47f, -0.47f, -0.05f}, {0.47f, 0.47f, 0.05f}, {0.0f, 0.0f, 0.0f}, 0.47f}}, {hintRingLevel2Vertices, 64, hintRingLevel2Indices, 384, {{-0.47f, -0.47f, -0.05f}, {0.47f, 0.47f, 0.05f}, {0.0f, 0.0f, 0.0f}, 0.47f}}}
+	};
+}
@@ -0,0 +1,134 @@
+#include "BoardScene.h"
+
+#include "KingPiece.h"
+#include "ManPiece.h"
+#include "MeshGenerator.h"
+
+BoardScene::BoardScene(const Renderer& renderer, int boardSize)
+	: m_renderer(renderer),
+	  m_boardSize(boardSize)
+{
+	// Two instances per king at most.
+	m_pieceInstances.reserve(m_boardSize * m_boardSize);
+	buildTableMesh();
+}
+
+BoardScene::~BoardScene()
+{
+	m_renderer.releaseMesh(m_tableMesh);
+}
+
+void BoardScene::setPosition(const Position& position)
+{
+	m_pieceInstances.clear();
+	const Bitboard kings = position.getKings();
+	for (const PieceType type : {PieceType::Light, PieceType::Dark})
+	{
+		for (Bitboard pieces = position.getPieces(type); pieces != 0; pieces &= pieces - 1)
+		{
+			const int square = lowestSquare(pieces);
+			const glm::ivec2 coords = Position::coordsFromSquare(square);
+			const glm::vec3 worldPosition = positionFromBoardCoords(coords.y, coords.x, m_boardSize);
+			if ((kings & squareBit(square)) != 0)
+			{
+				KingPiece piece(type, m_animation);
+				piece.setPosition(worldPosition);
+				piece.render(m_pieceInstances, 1.0f);
+			}
+			else
+			{
+				ManPiece piece(type, m_animation);
+				piece.setPosition(worldPosition);
+				piece.render(m_pieceInstances, 1.0f);
+			}
+		}
+	}
+}
+
+void BoardScene::render() const
+{
+	m_renderer.drawMeshInstanced(m_renderer.getAssets().getMesh(PieceMesh), m_pieceInstances);
+	drawTable();
+}
+
+void BoardScene::drawTable() const
+{
+	m_renderer.drawMesh(m_tableMesh);
+}
+
+void BoardScene::setupCamera(Camera& camera, const glm::uvec2& viewportDimensions, PieceType side)
+{
+	camera.setViewportDimensions(viewportDimensions);
+	camera.makePerspective(45.0f, 1.0f, 1000.0f);
+	camera.makeLookAt({0.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 0.0f});
+	camera.setPosition({0.0f, -1.0f, 11.0f});
+	camera.setRotation({-45.0f, side == PieceType::Light ? 0.0f : 180.0f, 0.0f});
+}
+
+void BoardScene::setupLighting(Renderer& renderer)
+{
+	renderer.setClearColor({0.15f, 0.15f, 0.15f});
+	renderer.setLightSource({{0.3f, -1.0f, 0.45f}, 1.0f});
+	renderer.setAmbientLight({0.4f, 0.4f, 0.4f});
+}
+
+bool BoardScene::isDarkTile(int x, int z)
+{
+	return (z % 2 == 0 && x % 2 != 0)
+		|| (z % 2 != 0 && x % 2 == 0);
+}
+
+glm::vec3 BoardScene::positionFromBoardCoords(int x, int z, int boardSize)
+{
+	return {
+		static_cast<float>(x) - static_cast<float>(boardSize) / 2.0f + 0.5f,
+		0.0f,
+		static_cast<float>(z) - static_cast<float>(boardSize) / 2.0f + 0.5f
+	};
+}
+
+void BoardScene::buildTableMesh()
+{
+	const AssetRegistry& assets = m_renderer.getAssets();
+	m_tableMesh.vertices.clear();
+	m_tableMesh.indices.clear();
+
+	Transform transform = {};
+	for (int z = 0; z < m_boardSize; z++)
+	{
+		for (int x = 0; x < m_boardSize; x++)
+		{
+			glm::vec3 position = positionFromBoardCoords(x, z, m_boardSize);
+			position.y = -0.1f;
+			transform.setPosition(position);
+			MeshGenerator::appendTransformed(
+				m_tableMesh,
+				isDarkTile(x, z)
+					? assets.getMesh(TileEvenMesh)
+					: assets.getMesh(TileOddMesh),
+				transform
+			);
+		}
+	}
+
+	const float size = static_cast<float>(m_boardSize);
+	const float offset = (size + tableBorderWidth) / 2.0f;
+	const glm::vec2 borders[4][2] = {
+		{{0.0f, -offset}, {size + tableBorderWidth * 2.0f, tableBorderWidth}},
+		{{0.0f, offset}, {size + tableBorderWidth * 2.0f, tableBorderWidth}},
+		{{-offset, 0.0f}, {tableBorderWidth, size}},
+		{{offset, 0.0f}, {tableBorderWidth, size}}
+	};
+	for (const auto& border : borders)
+	{
+		transform.setPosition({border[0].x, -0.1f, border[0].y});
+		transform.setScale({border[1].x, 1.0f, border[1].y});
+		MeshGenerator::appendTransformed(
+			m_tableMesh,
+			assets.getMesh(TableBorderMesh),
+			transform
+		);
+	}
+
+	m_renderer.uploadMesh(m_tableMesh);
+}
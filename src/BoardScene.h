@@ -0,0 +1,54 @@
+#pragma once
+
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "AnimationSystem.h"
+#include "Camera.h"
+#include "Position.h"
+#include "Renderer.h"
+
+// The board as the game draws it, the baked table plus resting pieces. Checkers
+// draws its table through it, the offscreen tools draw whole positions.
+class BoardScene
+{
+public:
+	BoardScene(const Renderer& renderer, int boardSize);
+	~BoardScene();
+
+	BoardScene(const BoardScene&) = delete;
+	BoardScene& operator=(const BoardScene&) = delete;
+
+public:
+	// Replaces the pieces with the ones of position, standing on their squares.
+	void setPosition(const Position& position);
+
+	// Pieces first and the table last, in the order of Checkers::render.
+	void render() const;
+	void drawTable() const;
+
+	// Camera and lights of a game in progress, looking from the side to move.
+	static void setupCamera(Camera& camera, const glm::uvec2& viewportDimensions, PieceType side);
+	static void setupLighting(Renderer& renderer);
+
+	static bool isDarkTile(int x, int z);
+	static glm::vec3 positionFromBoardCoords(int x, int z, int boardSize);
+
+private:
+	// Bakes every tile and the border into one static mesh, the board layout
+	// is fixed for the lifetime of the scene.
+	void buildTableMesh();
+
+private:
+	static constexpr float tableBorderWidth = 0.4f;
+
+	const Renderer& m_renderer;
+	int m_boardSize;
+
+	Mesh m_tableMesh;
+	std::vector<Instance> m_pieceInstances;
+
+	// Pieces are only placed to render them, one slot is reused for all.
+	AnimationSystem m_animation;
+};
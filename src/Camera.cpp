@@ -1,56 +1,139 @@
-#include "Camera.h"
-
-void Camera::update()
-{
-	m_model = glm::mat4(1.0f);
-	m_model = glm::translate(m_model, -m_position);
-	m_model = glm::rotate(m_model, glm::radians(-m_rotation.x), {1.0f, 0.0f, 0.0f});
-	m_model = glm::rotate(m_model, glm::radians(-m_rotation.y), {0.0f, 1.0f, 0.0f});
-	m_model = glm::rotate(m_model, glm::radians(-m_rotation.z), {0.0f, 0.0f, 1.0f});
-}
-
-glm::vec3 Camera::unProject(const glm::vec2& mousePos, float depth) const
-{
-	depth = glm::clamp(depth, 0.0f, 1.0f);
-	const float x = mousePos.x / (static_cast<float>(m_viewportDimensions.x) * 0.5f) - 1.0f;
-	const float y = mousePos.y / (static_cast<float>(m_viewportDimensions.y) * 0.5f) - 1.0f;
-	const float z = 2.0f * depth - 1.0f;
-
-	const glm::mat4 inverse = glm::inverse(m_proj * m_view * m_model);
-	glm::vec4 pos = inverse * glm::vec4(x, -y, z, 1.0f);
-
-	pos.w = 1.0f / pos.w;
-	pos.x *= pos.w;
-	pos.y *= pos.w;
-	pos.z *= pos.w;
-
-	return {pos.x, pos.y, pos.z};
-}
-
-glm::vec3 Camera::forwardVec(const glm::vec2& mousePos) const
-{
-	return glm::normalize(unProject(mousePos, 1.0f) - unProject(mousePos, 0.0f));
-}
-
-void Camera::makePerspective(const float& fov, const float& zNear, const float& zFar)
-{
-	const float aspect = static_cast<float>(m_viewportDimensions.x) / static_cast<float>(m_viewportDimensions.y);
-	setProj(glm::perspective(glm::radians(fov), aspect, zNear, zFar));
-}
-
-void Camera::makeLookAt(const glm::vec3& forward, const glm::vec3& up)
-{
-	setView(glm::lookAt(glm::vec3(0.0f), -forward, up));
-}
-
-void Camera::setPosition(const glm::vec3& position)
-{
-	m_position = position;
-	update();
-}
-
-void Camera::setRotation(const glm::vec3& rotation)
-{
-	m_rotation = rotation;
-	update();
-}
+#include "Camera.h"
+
+#include "Transform.h"
+
+void Camera::update()
+{
+	rebuildModel();
+	m_isViewProjDirty = true;
+}
+
+const glm::mat4& Camera::getModel() const
+{
+	if (m_isModelDirty)
+	{
+		rebuildModel();
+	}
+	return m_model;
+}
+
+void Camera::rebuildModel() const
+{
+	m_model = glm::mat4_cast(m_orientation);
+	m_model[3] = glm::vec4(-m_position, 1.0f);
+	m_isModelDirty = false;
+}
+
+const glm::mat4& Camera::getViewProj() const
+{
+	if (m_isModelDirty || m_isViewProjDirty)
+	{
+		rebuildViewProj();
+	}
+	return m_viewProj;
+}
+
+const glm::mat4& Camera::getInverseViewProj() const
+{
+	if (m_isModelDirty || m_isViewProjDirty)
+	{
+		rebuildViewProj();
+	}
+	return m_inverseViewProj;
+}
+
+void Camera::rebuildViewProj() const
+{
+	m_viewProj = m_proj * m_view * getModel();
+	m_inverseViewProj = glm::inverse(m_viewProj);
+	m_isViewProjDirty = false;
+}
+
+Frustum Camera::getFrustum() const
+{
+	// Rows of the view projection added to and subtracted from the w row give
+	// the left, right, bottom, top, near and far planes.
+	const glm::mat4 rows = glm::transpose(getViewProj());
+	Frustum frustum;
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		frustum.planes[axis * 2] = rows[3] + rows[axis];
+		frustum.planes[axis * 2 + 1] = rows[3] - rows[axis];
+	}
+	for (auto& plane : frustum.planes)
+	{
+		plane /= glm::length(glm::vec3(plane));
+	}
+	return frustum;
+}
+
+bool Frustum::intersectsSphere(const glm::vec3& center, float radius) const
+{
+	for (const auto& plane : planes)
+	{
+		if (glm::dot(glm::vec3(plane), center) + plane.w < -radius)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+glm::vec3 Camera::unProject(const glm::vec2& mousePos, float depth) const
+{
+	return unProject(mousePos, depth, getInverseViewProj());
+}
+
+Ray Camera::screenRay(const glm::vec2& mousePos) const
+{
+	const glm::mat4& inverse = getInverseViewProj();
+	const glm::vec3 origin = unProject(mousePos, 0.0f, inverse);
+	return {origin, glm::normalize(unProject(mousePos, 1.0f, inverse) - origin)};
+}
+
+glm::vec3 Camera::unProject(const glm::vec2& mousePos, float depth, const glm::mat4& inverse) const
+{
+	depth = glm::clamp(depth, 0.0f, 1.0f);
+	const float x = mousePos.x / (static_cast<float>(m_viewportDimensions.x) * 0.5f) - 1.0f;
+	const float y = mousePos.y / (static_cast<float>(m_viewportDimensions.y) * 0.5f) - 1.0f;
+	const float z = 2.0f * depth - 1.0f;
+
+	glm::vec4 pos = inverse * glm::vec4(x, -y, z, 1.0f);
+
+	pos.w = 1.0f / pos.w;
+	pos.x *= pos.w;
+	pos.y *= pos.w;
+	pos.z *= pos.w;
+
+	return {pos.x, pos.y, pos.z};
+}
+
+void Camera::makePerspective(const float& fov, const float& zNear, const float& zFar)
+{
+	const float aspect = static_cast<float>(m_viewportDimensions.x) / static_cast<float>(m_viewportDimensions.y);
+	setProj(glm::perspective(glm::radians(fov), aspect, zNear, zFar));
+}
+
+void Camera::makeLookAt(const glm::vec3& forward, const glm::vec3& up)
+{
+	setView(glm::lookAt(glm::vec3(0.0f), -forward, up));
+}
+
+void Camera::setPosition(const glm::vec3& position)
+{
+	if (position != m_position)
+	{
+		m_position = position;
+		m_isModelDirty = true;
+	}
+}
+
+void Camera::setRotation(const glm::vec3& rotation)
+{
+	if (rotation != m_rotation)
+	{
+		m_rotation = rotation;
+		m_orientation = Transform::makeRotation(-rotation);
+		m_isModelDirty = true;
+	}
+}
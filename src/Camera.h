@@ -1,50 +1,97 @@
-#pragma once
-
-#include <glm/glm.hpp>
-#include <glm/gtc/matrix_transform.hpp>
-
-class Camera
-{
-public:
-	Camera() = default;
-
-public:
-	void update();
-
-	glm::vec3 unProject(const glm::vec2& mousePos, float depth = 0.0f) const;
-	glm::vec3 forwardVec(const glm::vec2& mousePos) const;
-
-	void makePerspective(const float& fov, const float& zNear, const float& zFar);
-	void makeLookAt(const glm::vec3& forward, const glm::vec3& up);
-
-public:
-	const glm::uvec2& getViewportDimensions() const { return m_viewportDimensions; }
-	void setViewportDimensions(const glm::uvec2 viewportDimensions) { m_viewportDimensions = viewportDimensions; }
-
-	const glm::vec3& getPosition() const { return m_position; }
-	void setPosition(const glm::vec3& position);
-
-	const glm::vec3& getRotation() const { return m_rotation; }
-	void setRotation(const glm::vec3& rotation);
-
-	const glm::mat4& getModel() const { return m_model; }
-	void setModel(const glm::mat4& model) { m_model = model; }
-
-	const glm::mat4& getView() const { return m_view; }
-	void setView(const glm::mat4& view) { m_view = view; }
-
-	const glm::mat4& getProj() const { return m_proj; }
-	void setProj(const glm::mat4& proj) { m_proj = proj; }
-
-	glm::mat4 getModelView() const { return m_view * m_model; }
-
-
-private:
-	glm::uvec2 m_viewportDimensions{0.0f, 0.0f};
-	glm::vec3 m_position{0.0f, 0.0f, 0.0f};
-	glm::vec3 m_rotation{0.0f, 0.0f, 0.0f};
-
-	glm::mat4 m_model{glm::mat4(1.0f)};
-	glm::mat4 m_view{glm::mat4(1.0f)};
-	glm::mat4 m_proj{glm::mat4(1.0f)};
-};
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+struct Ray
+{
+	glm::vec3 origin;
+	glm::vec3 direction;
+};
+
+// Planes facing inwards, normalised so the plane equation gives distances.
+struct Frustum
+{
+	glm::vec4 planes[6];
+
+	bool intersectsSphere(const glm::vec3& center, float radius) const;
+};
+
+class Camera
+{
+public:
+	Camera() = default;
+
+public:
+	void update();
+
+	glm::vec3 unProject(const glm::vec2& mousePos, float depth = 0.0f) const;
+
+	// Ray from the near plane through the given window position.
+	Ray screenRay(const glm::vec2& mousePos) const;
+
+	void makePerspective(const float& fov, const float& zNear, const float& zFar);
+	void makeLookAt(const glm::vec3& forward, const glm::vec3& up);
+
+public:
+	const glm::uvec2& getViewportDimensions() const { return m_viewportDimensions; }
+	void setViewportDimensions(const glm::uvec2 viewportDimensions) { m_viewportDimensions = viewportDimensions; }
+
+	const glm::vec3& getPosition() const { return m_position; }
+	void setPosition(const glm::vec3& position);
+
+	const glm::vec3& getRotation() const { return m_rotation; }
+	void setRotation(const glm::vec3& rotation);
+
+	const glm::mat4& getModel() const;
+	void setModel(const glm::mat4& model)
+	{
+		m_model = model;
+		m_isModelDirty = false;
+		m_isViewProjDirty = true;
+	}
+
+	const glm::mat4& getView() const { return m_view; }
+	void setView(const glm::mat4& view)
+	{
+		m_view = view;
+		m_isViewProjDirty = true;
+	}
+
+	const glm::mat4& getProj() const { return m_proj; }
+	void setProj(const glm::mat4& proj)
+	{
+		m_proj = proj;
+		m_isViewProjDirty = true;
+	}
+
+	glm::mat4 getModelView() const { return m_view * getModel(); }
+
+	// Projection, view and model combined, and the inverse of that product.
+	const glm::mat4& getViewProj() const;
+	const glm::mat4& getInverseViewProj() const;
+
+	// Volume seen by the camera in world space.
+	Frustum getFrustum() const;
+
+private:
+	void rebuildModel() const;
+	void rebuildViewProj() const;
+	glm::vec3 unProject(const glm::vec2& mousePos, float depth, const glm::mat4& inverse) const;
+
+private:
+	glm::uvec2 m_viewportDimensions{0.0f, 0.0f};
+	glm::vec3 m_position{0.0f, 0.0f, 0.0f};
+	glm::vec3 m_rotation{0.0f, 0.0f, 0.0f};
+	glm::quat m_orientation{1.0f, 0.0f, 0.0f, 0.0f};
+
+	mutable glm::mat4 m_model{glm::mat4(1.0f)};
+	mutable bool m_isModelDirty = false;
+	glm::mat4 m_view{glm::mat4(1.0f)};
+	glm::mat4 m_proj{glm::mat4(1.0f)};
+
+	mutable glm::mat4 m_viewProj{glm::mat4(1.0f)};
+	mutable glm::mat4 m_inverseViewProj{glm::mat4(1.0f)};
+	mutable bool m_isViewProjDirty = false;
+};
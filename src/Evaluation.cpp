@@ -0,0 +1,150 @@
+#include "Evaluation.h"
+
+#include <fstream>
+
+namespace
+{
+	struct EvalMasks
+	{
+		Bitboard rows[Position::boardSize] = {};
+		Bitboard center = 0;
+		Bitboard edge = 0;
+		Bitboard mainDiagonal = 0;
+
+		EvalMasks()
+		{
+			for (int square = 0; square < Position::squareCount; ++square)
+			{
+				const glm::ivec2 coords = Position::coordsFromSquare(square);
+				const Bitboard bit = squareBit(square);
+				rows[coords.x] |= bit;
+				if (coords.x >= 4 && coords.x <= 5 && coords.y >= 2 && coords.y <= 7)
+					center |= bit;
+				if (coords.y == 0 || coords.y == Position::boardSize - 1)
+					edge |= bit;
+				if (coords.x + coords.y == Position::boardSize - 1)
+					mainDiagonal |= bit;
+			}
+		}
+	};
+
+	const EvalMasks& masks()
+	{
+		static const EvalMasks instance;
+		return instance;
+	}
+
+	constexpr const char* featureNames[EvalFeature::FeatureCount] = {
+		"Man",
+		"King",
+		"ManAdvance",
+		"ManCenter",
+		"ManEdge",
+		"BackRank",
+		"KingDiagonal",
+		"Tempo"
+	};
+}
+
+EvalWeights EvalWeights::defaults()
+{
+	EvalWeights weights;
+	weights.values[EvalFeature::Man] = 100;
+	weights.values[EvalFeature::King] = 300;
+	weights.values[EvalFeature::ManAdvance] = 3;
+	weights.values[EvalFeature::ManCenter] = 8;
+	weights.values[EvalFeature::ManEdge] = -4;
+	weights.values[EvalFeature::BackRank] = 6;
+	weights.values[EvalFeature::KingDiagonal] = 20;
+	weights.values[EvalFeature::Tempo] = 5;
+	return weights;
+}
+
+void Evaluation::extractFeatures(const Position& position, EvalFeatures& features)
+{
+	const EvalMasks& mask = masks();
+	const Bitboard kings = position.getKings();
+	const Bitboard lightMen = position.getPieces(PieceType::Light) & ~kings;
+	const Bitboard darkMen = position.getPieces(PieceType::Dark) & ~kings;
+	const Bitboard lightKings = position.getPieces(PieceType::Light) & kings;
+	const Bitboard darkKings = position.getPieces(PieceType::Dark) & kings;
+
+	int advance = 0;
+	for (int row = 0; row < Position::boardSize; ++row)
+	{
+		advance += popCount(lightMen & mask.rows[row]) * (Position::boardSize - 1 - row);
+		advance -= popCount(darkMen & mask.rows[row]) * row;
+	}
+
+	features[EvalFeature::Man] = static_cast<int16_t>(popCount(lightMen) - popCount(darkMen));
+	features[EvalFeature::King] = static_cast<int16_t>(popCount(lightKings) - popCount(darkKings));
+	features[EvalFeature::ManAdvance] = static_cast<int16_t>(advance);
+	features[EvalFeature::ManCenter] = static_cast<int16_t>(
+		popCount(lightMen & mask.center) - popCount(darkMen & mask.center));
+	features[EvalFeature::ManEdge] = static_cast<int16_t>(
+		popCount(lightMen & mask.edge) - popCount(darkMen & mask.edge));
+	features[EvalFeature::BackRank] = static_cast<int16_t>(
+		popCount(lightMen & mask.rows[Position::boardSize - 1]) - popCount(darkMen & mask.rows[0]));
+	features[EvalFeature::KingDiagonal] = static_cast<int16_t>(
+		popCount(lightKings & mask.mainDiagonal) - popCount(darkKings & mask.mainDiagonal));
+	features[EvalFeature::Tempo] = static_cast<int16_t>(
+		position.getSideToMove() == PieceType::Light ? 1 : -1);
+}
+
+int Evaluation::evaluate(const Position& position, const EvalWeights& weights)
+{
+	EvalFeatures features;
+	extractFeatures(position, features);
+	return evaluate(features, weights);
+}
+
+int Evaluation::evaluate(const EvalFeatures& features, const EvalWeights& weights)
+{
+	int score = 0;
+	for (int i = 0; i < EvalFeature::FeatureCount; ++i)
+	{
+		score += features[i] * weights.values[i];
+	}
+	return score;
+}
+
+const char* Evaluation::getFeatureName(int feature)
+{
+	return feature >= 0 && feature < EvalFeature::FeatureCount ? featureNames[feature] : "";
+}
+
+bool Evaluation::readWeights(const std::string& path, EvalWeights& weights)
+{
+	std::ifstream file(path);
+	if (!file)
+	{
+		return false;
+	}
+	std::string name;
+	int value = 0;
+	while (file >> name >> value)
+	{
+		for (int i = 0; i < EvalFeature::FeatureCount; ++i)
+		{
+			if (name == featureNames[i])
+			{
+				weights.values[i] = value;
+			}
+		}
+	}
+	return true;
+}
+
+bool Evaluation::writeWeights(const std::string& path, const EvalWeights& weights)
+{
+	std::ofstream file(path);
+	if (!file)
+	{
+		return false;
+	}
+	for (int i = 0; i < EvalFeature::FeatureCount; ++i)
+	{
+		file << featureNames[i] << ' ' << weights.values[i] << '\n';
+	}
+	return static_cast<bool>(file);
+}
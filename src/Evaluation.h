@@ -0,0 +1,48 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+#include "Position.h"
+
+enum EvalFeature
+{
+	Man,
+	King,
+	ManAdvance,
+	ManCenter,
+	ManEdge,
+	BackRank,
+	KingDiagonal,
+	Tempo,
+	FeatureCount
+};
+
+using EvalFeatures = std::array<int16_t, EvalFeature::FeatureCount>;
+
+struct EvalWeights
+{
+	std::array<int, EvalFeature::FeatureCount> values = {};
+
+	static EvalWeights defaults();
+};
+
+// Linear evaluation: every feature is counted as Light minus Dark, so the
+// score is always from Light's point of view. Weights are in hundredths of a man.
+class Evaluation
+{
+private:
+	Evaluation() = default;
+
+public:
+	static void extractFeatures(const Position& position, EvalFeatures& features);
+	static int evaluate(const Position& position, const EvalWeights& weights);
+	static int evaluate(const EvalFeatures& features, const EvalWeights& weights);
+
+	static const char* getFeatureName(int feature);
+
+	// Plain text, one "name value" pair per line.
+	static bool readWeights(const std::string& path, EvalWeights& weights);
+	static bool writeWeights(const std::string& path, const EvalWeights& weights);
+};
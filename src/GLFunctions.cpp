@@ -0,0 +1,90 @@
+#include "GLFunctions.h"
+
+#include <sdl/SDL.h>
+
+PFNGLGENBUFFERSPROC GLFunctions::genBuffers = nullptr;
+PFNGLDELETEBUFFERSPROC GLFunctions::deleteBuffers = nullptr;
+PFNGLBINDBUFFERPROC GLFunctions::bindBuffer = nullptr;
+PFNGLBUFFERDATAPROC GLFunctions::bufferData = nullptr;
+
+PFNGLCREATESHADERPROC GLFunctions::createShader = nullptr;
+PFNGLDELETESHADERPROC GLFunctions::deleteShader = nullptr;
+PFNGLSHADERSOURCEPROC GLFunctions::shaderSource = nullptr;
+PFNGLCOMPILESHADERPROC GLFunctions::compileShader = nullptr;
+PFNGLGETSHADERIVPROC GLFunctions::getShaderiv = nullptr;
+PFNGLGETSHADERINFOLOGPROC GLFunctions::getShaderInfoLog = nullptr;
+PFNGLCREATEPROGRAMPROC GLFunctions::createProgram = nullptr;
+PFNGLDELETEPROGRAMPROC GLFunctions::deleteProgram = nullptr;
+PFNGLATTACHSHADERPROC GLFunctions::attachShader = nullptr;
+PFNGLBINDATTRIBLOCATIONPROC GLFunctions::bindAttribLocation = nullptr;
+PFNGLLINKPROGRAMPROC GLFunctions::linkProgram = nullptr;
+PFNGLGETPROGRAMIVPROC GLFunctions::getProgramiv = nullptr;
+PFNGLGETPROGRAMINFOLOGPROC GLFunctions::getProgramInfoLog = nullptr;
+PFNGLUSEPROGRAMPROC GLFunctions::useProgram = nullptr;
+PFNGLGETUNIFORMLOCATIONPROC GLFunctions::getUniformLocation = nullptr;
+PFNGLUNIFORM1FPROC GLFunctions::uniform1f = nullptr;
+PFNGLUNIFORM3FVPROC GLFunctions::uniform3fv = nullptr;
+PFNGLUNIFORMMATRIX3FVPROC GLFunctions::uniformMatrix3fv = nullptr;
+PFNGLUNIFORMMATRIX4FVPROC GLFunctions::uniformMatrix4fv = nullptr;
+PFNGLENABLEVERTEXATTRIBARRAYPROC GLFunctions::enableVertexAttribArray = nullptr;
+PFNGLVERTEXATTRIBPOINTERPROC GLFunctions::vertexAttribPointer = nullptr;
+PFNGLDISABLEVERTEXATTRIBARRAYPROC GLFunctions::disableVertexAttribArray = nullptr;
+PFNGLVERTEXATTRIB1FPROC GLFunctions::vertexAttrib1f = nullptr;
+PFNGLVERTEXATTRIB4FVPROC GLFunctions::vertexAttrib4fv = nullptr;
+
+PFNGLVERTEXATTRIBDIVISORPROC GLFunctions::vertexAttribDivisor = nullptr;
+PFNGLDRAWELEMENTSINSTANCEDPROC GLFunctions::drawElementsInstanced = nullptr;
+
+namespace
+{
+	template<typename T>
+	bool loadFunction(T& function, const char* name)
+	{
+		function = reinterpret_cast<T>(SDL_GL_GetProcAddress(name));
+		return function != nullptr;
+	}
+}
+
+bool GLFunctions::load()
+{
+	bool loaded = true;
+	loaded &= loadFunction(genBuffers, "glGenBuffers");
+	loaded &= loadFunction(deleteBuffers, "glDeleteBuffers");
+	loaded &= loadFunction(bindBuffer, "glBindBuffer");
+	loaded &= loadFunction(bufferData, "glBufferData");
+
+	loaded &= loadFunction(createShader, "glCreateShader");
+	loaded &= loadFunction(deleteShader, "glDeleteShader");
+	loaded &= loadFunction(shaderSource, "glShaderSource");
+	loaded &= loadFunction(compileShader, "glCompileShader");
+	loaded &= loadFunction(getShaderiv, "glGetShaderiv");
+	loaded &= loadFunction(getShaderInfoLog, "glGetShaderInfoLog");
+	loaded &= loadFunction(createProgram, "glCreateProgram");
+	loaded &= loadFunction(deleteProgram, "glDeleteProgram");
+	loaded &= loadFunction(attachShader, "glAttachShader");
+	loaded &= loadFunction(bindAttribLocation, "glBindAttribLocation");
+	loaded &= loadFunction(linkProgram, "glLinkProgram");
+	loaded &= loadFunction(getProgramiv, "glGetProgramiv");
+	loaded &= loadFunction(getProgramInfoLog, "glGetProgramInfoLog");
+	loaded &= loadFunction(useProgram, "glUseProgram");
+	loaded &= loadFunction(getUniformLocation, "glGetUniformLocation");
+	loaded &= loadFunction(uniform1f, "glUniform1f");
+	loaded &= loadFunction(uniform3fv, "glUniform3fv");
+	loaded &= loadFunction(uniformMatrix3fv, "glUniformMatrix3fv");
+	loaded &= loadFunction(uniformMatrix4fv, "glUniformMatrix4fv");
+	loaded &= loadFunction(enableVertexAttribArray, "glEnableVertexAttribArray");
+	loaded &= loadFunction(vertexAttribPointer, "glVertexAttribPointer");
+	loaded &= loadFunction(disableVertexAttribArray, "glDisableVertexAttribArray");
+	loaded &= loadFunction(vertexAttrib1f, "glVertexAttrib1f");
+	loaded &= loadFunction(vertexAttrib4fv, "glVertexAttrib4fv");
+
+	if (!loadFunction(vertexAttribDivisor, "glVertexAttribDivisor"))
+	{
+		loadFunction(vertexAttribDivisor, "glVertexAttribDivisorARB");
+	}
+	if (!loadFunction(drawElementsInstanced, "glDrawElementsInstanced"))
+	{
+		loadFunction(drawElementsInstanced, "glDrawElementsInstancedARB");
+	}
+	return loaded;
+}
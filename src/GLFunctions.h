@@ -0,0 +1,51 @@
+#pragma once
+
+#include <sdl/SDL_opengl.h>
+
+// Entry points newer than OpenGL 1.1 are not exported by every platform's GL
+// library, so they are fetched from the driver once a context is current.
+class GLFunctions
+{
+private:
+	GLFunctions() = default;
+
+public:
+	static bool load();
+
+	// Instanced drawing is optional (GL 3.3 or ARB_instanced_arrays).
+	static bool hasInstancing() { return vertexAttribDivisor != nullptr && drawElementsInstanced != nullptr; }
+
+public:
+	static PFNGLGENBUFFERSPROC genBuffers;
+	static PFNGLDELETEBUFFERSPROC deleteBuffers;
+	static PFNGLBINDBUFFERPROC bindBuffer;
+	static PFNGLBUFFERDATAPROC bufferData;
+
+	static PFNGLCREATESHADERPROC createShader;
+	static PFNGLDELETESHADERPROC deleteShader;
+	static PFNGLSHADERSOURCEPROC shaderSource;
+	static PFNGLCOMPILESHADERPROC compileShader;
+	static PFNGLGETSHADERIVPROC getShaderiv;
+	static PFNGLGETSHADERINFOLOGPROC getShaderInfoLog;
+	static PFNGLCREATEPROGRAMPROC createProgram;
+	static PFNGLDELETEPROGRAMPROC deleteProgram;
+	static PFNGLATTACHSHADERPROC attachShader;
+	static PFNGLBINDATTRIBLOCATIONPROC bindAttribLocation;
+	static PFNGLLINKPROGRAMPROC linkProgram;
+	static PFNGLGETPROGRAMIVPROC getProgramiv;
+	static PFNGLGETPROGRAMINFOLOGPROC getProgramInfoLog;
+	static PFNGLUSEPROGRAMPROC useProgram;
+	static PFNGLGETUNIFORMLOCATIONPROC getUniformLocation;
+	static PFNGLUNIFORM1FPROC uniform1f;
+	static PFNGLUNIFORM3FVPROC uniform3fv;
+	static PFNGLUNIFORMMATRIX3FVPROC uniformMatrix3fv;
+	static PFNGLUNIFORMMATRIX4FVPROC uniformMatrix4fv;
+	static PFNGLENABLEVERTEXATTRIBARRAYPROC enableVertexAttribArray;
+	static PFNGLVERTEXATTRIBPOINTERPROC vertexAttribPointer;
+	static PFNGLDISABLEVERTEXATTRIBARRAYPROC disableVertexAttribArray;
+	static PFNGLVERTEXATTRIB1FPROC vertexAttrib1f;
+	static PFNGLVERTEXATTRIB4FVPROC vertexAttrib4fv;
+
+	static PFNGLVERTEXATTRIBDIVISORPROC vertexAttribDivisor;
+	static PFNGLDRAWELEMENTSINSTANCEDPROC drawElementsInstanced;
+};
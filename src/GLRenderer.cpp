@@ -0,0 +1,309 @@
+#include "GLRenderer.h"
+
+#include <cstddef>
+
+#include <sdl/SDL_opengl.h>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "GLFunctions.h"
+
+namespace
+{
+	// The model matrix takes four locations, one per column.
+	enum VertexAttribute
+	{
+		PositionAttribute,
+		NormalAttribute,
+		ColorAttribute,
+		PaletteIndexAttribute,
+		ModelAttribute,
+		AttributeCount
+	};
+
+	const char* const attributeNames[AttributeCount] = {
+		"a_position",
+		"a_normal",
+		"a_color",
+		"a_paletteIndex",
+		"a_model"
+	};
+
+	// Per vertex Lambert term scaled by the light intensity, with the ambient
+	// light added and clamped per channel.
+	const char* const vertexSource = R"(
+		#version 120
+
+		uniform mat4 u_viewProjection;
+
+		uniform vec3 u_lightDirection;
+		uniform float u_lightIntensity;
+		uniform vec3 u_ambientLight;
+
+		uniform vec3 u_palette[9];
+
+		attribute vec3 a_position;
+		attribute vec3 a_normal;
+		attribute vec3 a_color;
+		attribute float a_paletteIndex;
+		attribute mat4 a_model;
+
+		varying vec3 v_color;
+
+		void main()
+		{
+			vec3 normal = normalize(mat3(a_model) * a_normal);
+			float intensity = max(0.0, dot(normal, -u_lightDirection)) * u_lightIntensity;
+			vec3 light = clamp(vec3(intensity) + u_ambientLight, 0.0, 1.0);
+			v_color = a_color * u_palette[int(a_paletteIndex)] * light;
+			gl_Position = u_viewProjection * a_model * vec4(a_position, 1.0);
+		}
+	)";
+
+	const char* const fragmentSource = R"(
+		#version 120
+
+		varying vec3 v_color;
+
+		void main()
+		{
+			gl_FragColor = vec4(v_color, 1.0);
+		}
+	)";
+}
+
+GLRenderer::GLRenderer(const Window* const window)
+{
+	m_glContext = window->createContext();
+	if (!GLFunctions::load())
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_RENDER, "OpenGL vertex buffers are not supported");
+	}
+
+	glEnable(GL_DEPTH_TEST);
+	glEnable(GL_CULL_FACE);
+
+	if (m_shader.compile(vertexSource, fragmentSource, attributeNames, AttributeCount))
+	{
+		m_uniforms.viewProjection = m_shader.getUniformLocation("u_viewProjection");
+		m_uniforms.lightDirection = m_shader.getUniformLocation("u_lightDirection");
+		m_uniforms.lightIntensity = m_shader.getUniformLocation("u_lightIntensity");
+		m_uniforms.ambientLight = m_shader.getUniformLocation("u_ambientLight");
+		m_uniforms.palette = m_shader.getUniformLocation("u_palette");
+		setPalette(AssetRegistry::getPalette().data(), AssetRegistry::paletteSize);
+
+		GLFunctions::enableVertexAttribArray(PositionAttribute);
+		GLFunctions::enableVertexAttribArray(NormalAttribute);
+		GLFunctions::enableVertexAttribArray(ColorAttribute);
+		GLFunctions::genBuffers(1, &m_instanceBuffer);
+	}
+}
+
+GLRenderer::~GLRenderer()
+{
+	m_assets.release();
+	if (m_instanceBuffer != 0)
+	{
+		GLFunctions::deleteBuffers(1, &m_instanceBuffer);
+	}
+	m_shader.release();
+	SDL_GL_DeleteContext(m_glContext);
+}
+
+void GLRenderer::onBeginFrame(const SceneState& scene) const
+{
+	// Frames may be submitted on another thread than the window events, the
+	// viewport follows the camera instead of resize events.
+	const glm::uvec2& viewport = scene.camera.getViewportDimensions();
+	glViewport(0, 0, static_cast<int>(viewport.x), static_cast<int>(viewport.y));
+
+	glClearColor(scene.clearColor.r, scene.clearColor.g, scene.clearColor.b, 1.0f);
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+	// Uploads between frames rebind the buffers.
+	m_boundMesh = nullptr;
+
+	m_shader.bind();
+	m_shader.setMat4(m_uniforms.viewProjection, scene.camera.getViewProj());
+	m_shader.setVec3(m_uniforms.lightDirection, scene.lightSource.direction);
+	m_shader.setFloat(m_uniforms.lightIntensity, scene.lightSource.intensity);
+	m_shader.setVec3(m_uniforms.ambientLight, scene.ambientLight);
+}
+
+void GLRenderer::uploadMesh(Mesh& mesh) const
+{
+	if (GLFunctions::genBuffers == nullptr)
+	{
+		return;
+	}
+	if (mesh.handle.vertexBuffer == 0)
+	{
+		GLFunctions::genBuffers(1, &mesh.handle.vertexBuffer);
+		GLFunctions::genBuffers(1, &mesh.handle.indexBuffer);
+	}
+	GLFunctions::bindBuffer(GL_ARRAY_BUFFER, mesh.handle.vertexBuffer);
+	GLFunctions::bufferData(
+		GL_ARRAY_BUFFER,
+		static_cast<GLsizeiptr>(mesh.getVertexCount() * sizeof(Vertex)),
+		mesh.getVertices(),
+		GL_STATIC_DRAW
+	);
+	GLFunctions::bindBuffer(GL_ARRAY_BUFFER, 0);
+	GLFunctions::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.handle.indexBuffer);
+	GLFunctions::bufferData(
+		GL_ELEMENT_ARRAY_BUFFER,
+		static_cast<GLsizeiptr>(mesh.getIndexCount() * sizeof(uint16_t)),
+		mesh.getIndices(),
+		GL_STATIC_DRAW
+	);
+	GLFunctions::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	mesh.handle.indexCount = static_cast<int>(mesh.getIndexCount());
+}
+
+void GLRenderer::releaseMesh(Mesh& mesh) const
+{
+	if (&mesh == m_boundMesh)
+	{
+		m_boundMesh = nullptr;
+	}
+	if (mesh.handle.vertexBuffer != 0)
+	{
+		GLFunctions::deleteBuffers(1, &mesh.handle.vertexBuffer);
+		GLFunctions::deleteBuffers(1, &mesh.handle.indexBuffer);
+	}
+	mesh.handle = {};
+}
+
+void GLRenderer::drawBatch(const Mesh& mesh, const Instance* instances, int count) const
+{
+	if (&mesh != m_boundMesh)
+	{
+		bindMesh(mesh);
+		countStateChange();
+	}
+
+	// A single instance is cheaper as constant attributes than as a buffer.
+	if (count == 1 || !GLFunctions::hasInstancing())
+	{
+		if (m_instanceArraysEnabled)
+		{
+			setInstanceArraysEnabled(false);
+			countStateChange();
+		}
+		for (int i = 0; i < count; ++i)
+		{
+			setInstanceAttributes(instances[i]);
+			glDrawElements(GL_TRIANGLES, mesh.handle.indexCount, GL_UNSIGNED_SHORT, nullptr);
+		}
+		return;
+	}
+
+	// The attribute pointers keep referring to the instance buffer, refilling
+	// it needs no new setup.
+	GLFunctions::bindBuffer(GL_ARRAY_BUFFER, m_instanceBuffer);
+	GLFunctions::bufferData(
+		GL_ARRAY_BUFFER,
+		static_cast<GLsizeiptr>(count * sizeof(Instance)),
+		instances,
+		GL_STREAM_DRAW
+	);
+	if (!m_instanceArraysEnabled)
+	{
+		setInstanceArraysEnabled(true);
+		countStateChange();
+	}
+
+	GLFunctions::drawElementsInstanced(
+		GL_TRIANGLES,
+		mesh.handle.indexCount,
+		GL_UNSIGNED_SHORT,
+		nullptr,
+		static_cast<GLsizei>(count)
+	);
+}
+
+void GLRenderer::setInstanceArraysEnabled(bool enabled) const
+{
+	// Expects the instance buffer to be bound when enabling.
+	if (enabled)
+	{
+		GLFunctions::vertexAttribPointer(
+			PaletteIndexAttribute,
+			1,
+			GL_FLOAT,
+			GL_FALSE,
+			sizeof(Instance),
+			reinterpret_cast<const void*>(offsetof(Instance, paletteIndex))
+		);
+		for (int column = 0; column < 4; ++column)
+		{
+			GLFunctions::vertexAttribPointer(
+				ModelAttribute + column,
+				4,
+				GL_FLOAT,
+				GL_FALSE,
+				sizeof(Instance),
+				reinterpret_cast<const void*>(offsetof(Instance, model) + column * sizeof(glm::vec4))
+			);
+		}
+	}
+	for (int attribute = PaletteIndexAttribute; attribute < ModelAttribute + 4; ++attribute)
+	{
+		if (enabled)
+		{
+			GLFunctions::enableVertexAttribArray(attribute);
+		}
+		else
+		{
+			GLFunctions::disableVertexAttribArray(attribute);
+		}
+		GLFunctions::vertexAttribDivisor(attribute, enabled ? 1 : 0);
+	}
+	m_instanceArraysEnabled = enabled;
+}
+
+void GLRenderer::bindMesh(const Mesh& mesh) const
+{
+	m_boundMesh = &mesh;
+	GLFunctions::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.handle.indexBuffer);
+	GLFunctions::bindBuffer(GL_ARRAY_BUFFER, mesh.handle.vertexBuffer);
+	GLFunctions::vertexAttribPointer(
+		PositionAttribute,
+		3,
+		GL_FLOAT,
+		GL_FALSE,
+		sizeof(Vertex),
+		reinterpret_cast<const void*>(offsetof(Vertex, position))
+	);
+	GLFunctions::vertexAttribPointer(
+		NormalAttribute,
+		3,
+		GL_FLOAT,
+		GL_FALSE,
+		sizeof(Vertex),
+		reinterpret_cast<const void*>(offsetof(Vertex, normal))
+	);
+	GLFunctions::vertexAttribPointer(
+		ColorAttribute,
+		3,
+		GL_FLOAT,
+		GL_FALSE,
+		sizeof(Vertex),
+		reinterpret_cast<const void*>(offsetof(Vertex, color))
+	);
+}
+
+void GLRenderer::setInstanceAttributes(const Instance& instance) const
+{
+	// Attributes without an enabled array read these constant values.
+	GLFunctions::vertexAttrib1f(PaletteIndexAttribute, instance.paletteIndex);
+	for (int column = 0; column < 4; ++column)
+	{
+		GLFunctions::vertexAttrib4fv(ModelAttribute + column, glm::value_ptr(instance.model[column]));
+	}
+}
+
+void GLRenderer::setPalette(const glm::vec3* colors, int count) const
+{
+	m_shader.bind();
+	GLFunctions::uniform3fv(m_uniforms.palette, count, glm::value_ptr(colors[0]));
+}
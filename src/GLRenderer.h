@@ -0,0 +1,52 @@
+#pragma once
+
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Window.h"
+#include "Renderer.h"
+#include "Shader.h"
+
+class GLRenderer : public Renderer
+{
+public:
+	explicit GLRenderer(const Window* const window);
+	~GLRenderer() override;
+
+public:
+	void uploadMesh(Mesh& mesh) const override;
+	void releaseMesh(Mesh& mesh) const override;
+
+	// The shader holds 9 palette entries.
+	void setPalette(const glm::vec3* colors, int count) const override;
+
+protected:
+	void onBeginFrame(const SceneState& scene) const override;
+	void drawBatch(const Mesh& mesh, const Instance* instances, int count) const override;
+
+private:
+	void bindMesh(const Mesh& mesh) const;
+	void setInstanceAttributes(const Instance& instance) const;
+	void setInstanceArraysEnabled(bool enabled) const;
+
+private:
+	SDL_GLContext m_glContext;
+
+	unsigned int m_instanceBuffer = 0;
+
+	// Bindings left by the last batch, so the next one only changes what
+	// differs. The bound mesh is forgotten at the start of every frame.
+	mutable const Mesh* m_boundMesh = nullptr;
+	mutable bool m_instanceArraysEnabled = false;
+
+	Shader m_shader;
+	struct
+	{
+		int viewProjection = -1;
+		int lightDirection = -1;
+		int lightIntensity = -1;
+		int ambientLight = -1;
+		int palette = -1;
+	} m_uniforms;
+};
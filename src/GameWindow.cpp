@@ -1,57 +1,122 @@
-#include "GameWindow.h"
-
-#include "Checkers.h"
-
-GameWindow::GameWindow(const char* title, const glm::uvec2& dimensions)
-	: Window(title, dimensions),
-	  m_renderer(this)
-{
-	m_game = new Checkers(this, 10);
-}
-
-GameWindow::~GameWindow()
-{
-	delete m_game;
-}
-
-void GameWindow::init()
-{
-	const glm::uvec2& windowDimensions = getDimensions();
-	m_camera.setViewportDimensions({windowDimensions.x, windowDimensions.y});
-	m_camera.makePerspective(45.0f, 1.0f, 1000.0f);
-	m_camera.makeLookAt({0.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 0.0f});
-	m_camera.setPosition({0.0f, -1.0f, 11.0f});
-	m_camera.setRotation({-45.0f, 0.0f, 0.0f});
-
-	const LightSource light = {{0.3f, -1.0f, 0.45f}, 1.0f};
-
-	m_renderer.setClearColor({0.15f, 0.15f, 0.15f});
-	m_renderer.setLightSource(light);
-	m_renderer.setAmbientLight({0.4f, 0.4f, 0.4f});
-
-	m_game->reset();
-}
-
-void GameWindow::update(const float& deltaTime)
-{
-	m_elapsed = m_elapsed + deltaTime;
-
-	const LightSource light = {
-		{glm::cos(m_elapsed) * 0.3f, -1.0f, glm::sin(m_elapsed) * 0.45f},
-		1.0f
-	};
-	m_renderer.setLightSource(light);
-
-	m_game->update(deltaTime);
-
-	m_renderer.beginFrame(&m_camera);
-	m_game->render(m_renderer);
-}
-
-void GameWindow::onResize(const glm::uvec2& windowDimensions)
-{
-	Window::onResize(windowDimensions);
-	m_camera.setViewportDimensions({windowDimensions.x, windowDimensions.y});
-	m_camera.makePerspective(45.0f, 1.0f, 1000.0f);
-	m_camera.makeLookAt({0.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 0.0f});
-}
+#include "GameWindow.h"
+
+#include <cstdio>
+
+#include "AllocationCounter.h"
+#include "BoardScene.h"
+#include "Checkers.h"
+
+GameWindow::GameWindow(const char* title, const glm::uvec2& dimensions)
+	: Window(title, dimensions),
+	  m_renderer(this),
+	  m_baseTitle(title)
+{
+	m_game = new Checkers(this, 10);
+}
+
+GameWindow::~GameWindow()
+{
+	delete m_game;
+#ifdef _DEBUG
+	getAssets().logMemoryReport();
+#endif
+}
+
+void GameWindow::init()
+{
+	BoardScene::setupCamera(m_camera, getDimensions(), PieceType::Light);
+	m_previousCamera = m_camera;
+	BoardScene::setupLighting(m_renderer);
+
+	// Drawing happens off the render thread, nothing may upload later.
+	getAssets().loadAll();
+	m_game->reset();
+}
+
+void GameWindow::update(const float& deltaTime)
+{
+	m_elapsed = m_elapsed + deltaTime;
+	m_previousCamera = m_camera;
+	m_game->update(deltaTime);
+
+	m_statsTimer += deltaTime;
+	if (m_statsTimer >= 1.0f)
+	{
+		m_statsTimer = 0.0f;
+		const RenderStats stats = m_renderer.getFrameStats();
+		char text[128];
+		std::snprintf(
+			text,
+			sizeof(text),
+			" - %d commands, %d draw calls, %d state changes, %llu triangles, %d culled",
+			stats.commands,
+			stats.drawCalls,
+			stats.stateChanges,
+			static_cast<unsigned long long>(stats.triangles),
+			stats.culledInstances
+		);
+		setTitle(m_baseTitle + text);
+	}
+}
+
+void GameWindow::setCamera(const Camera& camera, bool snap)
+{
+	m_camera = camera;
+	if (snap)
+	{
+		m_previousCamera = camera;
+	}
+}
+
+void GameWindow::draw(const float& alpha)
+{
+	m_renderTime = m_elapsed - (1.0f - alpha) * simulationStep;
+
+	// The drifting light alone would keep on demand pacing drawing, it stays
+	// where the scene put it then.
+	if (!isOnDemand())
+	{
+		const LightSource light = {
+			{glm::cos(m_renderTime) * 0.3f, -1.0f, glm::sin(m_renderTime) * 0.45f},
+			1.0f
+		};
+		m_renderer.setLightSource(light);
+	}
+
+	Camera camera = m_camera;
+	camera.setRotation(glm::mix(m_previousCamera.getRotation(), m_camera.getRotation(), alpha));
+
+	// Only the first use of an asset may allocate while drawing.
+	const uint64_t allocations = AllocationCounter::getCount();
+	const uint64_t assetLoads = getAssets().getLoadCount();
+	m_renderer.beginFrame(&camera);
+	m_game->render(m_renderer, alpha);
+	m_renderer.publishFrame();
+	SDL_assert(
+		AllocationCounter::getCount() == allocations
+		|| getAssets().getLoadCount() != assetLoads
+	);
+}
+
+bool GameWindow::isAnimating() const
+{
+	return m_game->isAnimating();
+}
+
+bool GameWindow::render()
+{
+	return m_renderer.submitFrame();
+}
+
+void GameWindow::stopRendering()
+{
+	m_renderer.stopSubmitting();
+}
+
+void GameWindow::onResize(const glm::uvec2& windowDimensions)
+{
+	Window::onResize(windowDimensions);
+	m_camera.setViewportDimensions({windowDimensions.x, windowDimensions.y});
+	m_camera.makePerspective(45.0f, 1.0f, 1000.0f);
+	m_camera.makeLookAt({0.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 0.0f});
+}
@@ -1,36 +1,48 @@
-#pragma once
-
-#include "Window.h"
-#include "Renderer.h"
-#include "Camera.h"
-#include "MeshPrototypes.h"
-
-class Checkers;
-
-class GameWindow : public Window
-{
-public:
-	GameWindow(const char* title, const glm::uvec2& dimensions);
-	~GameWindow() override;
-
-protected:
-	void init() override;
-	void update(const float& deltaTime) override;
-	void onResize(const glm::uvec2& windowDimensions) override;
-
-public:
-	const float& getElapsedTime() const { return m_elapsed; }
-	const Camera& getCamera() const { return m_camera; }
-	void setCamera(const Camera& camera) { m_camera = camera; }
-	const MeshPrototypes& getPrototypes() const { return m_prototypes; }
-
-private:
-	Renderer m_renderer;
-	Camera m_camera;
-
-	float m_elapsed = 0.0;
-
-	MeshPrototypes m_prototypes;
-
-	Checkers* m_game;
-};
+#pragma once
+
+#include "Window.h"
+#include "GLRenderer.h"
+#include "Camera.h"
+
+class Checkers;
+
+class GameWindow : public Window
+{
+public:
+	GameWindow(const char* title, const glm::uvec2& dimensions);
+	~GameWindow() override;
+
+protected:
+	void init() override;
+	void update(const float& deltaTime) override;
+	void draw(const float& alpha) override;
+	bool isAnimating() const override;
+	bool render() override;
+	void stopRendering() override;
+	void onResize(const glm::uvec2& windowDimensions) override;
+
+public:
+	const float& getElapsedTime() const { return m_elapsed; }
+	// Time of the frame being drawn, between the last two steps.
+	const float& getRenderTime() const { return m_renderTime; }
+	const Camera& getCamera() const { return m_camera; }
+	// Snapping skips the blend from the camera of the previous step, for cuts
+	// rather than motion.
+	void setCamera(const Camera& camera, bool snap = false);
+	const AssetRegistry& getAssets() const { return m_renderer.getAssets(); }
+	const Renderer& getRenderer() const { return m_renderer; }
+
+private:
+	GLRenderer m_renderer;
+	Camera m_camera;
+	Camera m_previousCamera;
+
+	float m_elapsed = 0.0;
+	float m_renderTime = 0.0f;
+
+	// The title shows the render statistics, refreshed once per second.
+	std::string m_baseTitle;
+	float m_statsTimer = 0.0f;
+
+	Checkers* m_game;
+};
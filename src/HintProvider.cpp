@@ -0,0 +1,73 @@
+#include "HintProvider.h"
+
+HintProvider::HintProvider(int timeBudgetMs)
+	: m_timeBudgetMs(timeBudgetMs),
+	  m_search(8)
+{
+}
+
+HintProvider::~HintProvider()
+{
+	cancel();
+}
+
+void HintProvider::request(const Position& position)
+{
+	const uint64_t hash = position.getHash();
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_cache.find(hash) != m_cache.end())
+		{
+			return;
+		}
+	}
+	if (m_searching && m_pendingHash == hash)
+	{
+		return;
+	}
+
+	cancel();
+	m_pendingHash = hash;
+	m_searching = true;
+	m_search.prepare();
+	m_worker = std::thread([this, position, hash]()
+	{
+		SearchLimits limits;
+		limits.timeMs = m_timeBudgetMs;
+		limits.depth = 20;
+		const SearchInfo result = m_search.run(position, limits);
+		// A cancelled search is too shallow to stand as the hint.
+		if (!result.lines.empty() && !m_search.isStopRequested())
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (m_cache.size() >= maxCachedHints)
+			{
+				m_cache.clear();
+			}
+			m_cache[hash] = result.lines.front().move;
+		}
+		m_searching = false;
+	});
+}
+
+bool HintProvider::getHint(uint64_t positionHash, EngineMove& move) const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	const auto found = m_cache.find(positionHash);
+	if (found == m_cache.end())
+	{
+		return false;
+	}
+	move = found->second;
+	return true;
+}
+
+void HintProvider::cancel()
+{
+	if (m_worker.joinable())
+	{
+		m_search.stop();
+		m_worker.join();
+	}
+	m_searching = false;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include "Search.h"
+
+// Runs a short engine search on a worker thread and remembers the best move per
+// position hash, so asking again for a position already seen never searches.
+class HintProvider
+{
+public:
+	explicit HintProvider(int timeBudgetMs = 250);
+	~HintProvider();
+
+	HintProvider(const HintProvider&) = delete;
+	HintProvider& operator=(const HintProvider&) = delete;
+
+public:
+	void request(const Position& position);
+	bool getHint(uint64_t positionHash, EngineMove& move) const;
+
+	bool isSearching() const { return m_searching; }
+
+private:
+	void cancel();
+
+private:
+	static constexpr size_t maxCachedHints = 4096;
+
+	int m_timeBudgetMs;
+	Search m_search;
+	std::thread m_worker;
+	std::atomic<bool> m_searching{false};
+	uint64_t m_pendingHash = 0;
+
+	mutable std::mutex m_mutex;
+	std::unordered_map<uint64_t, EngineMove> m_cache;
+};
@@ -0,0 +1,377 @@
+#include "HubEngine.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+	std::string formatSquares(const std::vector<int>& squares, char separator)
+	{
+		std::string text;
+		for (const int square : squares)
+		{
+			if (!text.empty())
+			{
+				text += separator;
+			}
+			text += std::to_string(square + 1);
+		}
+		return text;
+	}
+}
+
+HubEngine::HubEngine(std::istream& input, std::ostream& output)
+	: m_input(input),
+	  m_output(output),
+	  m_search(64)
+{
+}
+
+HubEngine::~HubEngine()
+{
+	stopSearch();
+}
+
+void HubEngine::run()
+{
+	std::string line;
+	while (std::getline(m_input, line))
+	{
+		if (!line.empty() && line.back() == '\r')
+		{
+			line.pop_back();
+		}
+		if (!handleCommand(line))
+		{
+			break;
+		}
+	}
+	stopSearch();
+}
+
+bool HubEngine::parsePosition(const std::string& text, Position& position)
+{
+	if (text.size() != 1 + Position::squareCount)
+	{
+		return false;
+	}
+	position = Position();
+	for (int square = 0; square < Position::squareCount; ++square)
+	{
+		switch (text[square + 1])
+		{
+		case 'w':
+			position.setPiece(square, PieceType::Light, false);
+			break;
+		case 'W':
+			position.setPiece(square, PieceType::Light, true);
+			break;
+		case 'b':
+			position.setPiece(square, PieceType::Dark, false);
+			break;
+		case 'B':
+			position.setPiece(square, PieceType::Dark, true);
+			break;
+		case 'e':
+			break;
+		default:
+			return false;
+		}
+	}
+	if (text[0] == 'W')
+		position.setSideToMove(PieceType::Light);
+	else if (text[0] == 'B')
+		position.setSideToMove(PieceType::Dark);
+	else
+		return false;
+	return true;
+}
+
+std::string HubEngine::formatPosition(const Position& position)
+{
+	std::string text = position.getSideToMove() == PieceType::Light ? "W" : "B";
+	for (int square = 0; square < Position::squareCount; ++square)
+	{
+		const Bitboard bit = squareBit(square);
+		const bool king = (position.getKings() & bit) != 0;
+		if ((position.getPieces(PieceType::Light) & bit) != 0)
+			text += king ? 'W' : 'w';
+		else if ((position.getPieces(PieceType::Dark) & bit) != 0)
+			text += king ? 'B' : 'b';
+		else
+			text += 'e';
+	}
+	return text;
+}
+
+std::string HubEngine::formatMove(const EngineMove& move)
+{
+	if (!move.isCapture())
+	{
+		return Position::formatMove(move);
+	}
+	std::vector<int> squares = {move.from, move.to};
+	for (Bitboard captured = move.captures; captured != 0; captured &= captured - 1)
+	{
+		squares.push_back(lowestSquare(captured));
+	}
+	return formatSquares(squares, 'x');
+}
+
+bool HubEngine::parseMove(const Position& position, const std::string& text, EngineMove& move)
+{
+	MoveList moves;
+	position.generateMoves(moves);
+	for (const auto& candidate : moves)
+	{
+		// Short capture notation is accepted when it is unambiguous.
+		if (text == formatMove(candidate) || text == Position::formatMove(candidate))
+		{
+			move = candidate;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool HubEngine::handleCommand(const std::string& line)
+{
+	std::string command;
+	const auto arguments = parseArguments(line, command);
+	const auto argument = [&arguments](const std::string& name) -> std::string
+	{
+		const auto found = arguments.find(name);
+		return found != arguments.end() ? found->second : std::string();
+	};
+
+	if (command == "hub")
+	{
+		send("id name=sdl-checkers version=1.0");
+		send("param name=hash value=64 type=int min=1 max=4096");
+		send("wait");
+	}
+	else if (command == "init")
+	{
+		send("ready");
+	}
+	else if (command == "ping")
+	{
+		send("pong");
+	}
+	else if (command == "new-game")
+	{
+		stopSearch();
+		m_search.clear();
+		m_position = Position::initial();
+	}
+	else if (command == "set-param")
+	{
+		if (argument("name") == "hash")
+		{
+			stopSearch();
+			m_search.getTable().resize(static_cast<size_t>(std::max(1, std::atoi(argument("value").c_str()))));
+		}
+	}
+	else if (command == "pos")
+	{
+		stopSearch();
+		Position position = Position::initial();
+		if (arguments.count("pos") != 0 && !parsePosition(argument("pos"), position))
+		{
+			send("error bad position");
+			return true;
+		}
+		std::stringstream moves(argument("moves"));
+		std::string text;
+		while (moves >> text)
+		{
+			EngineMove move;
+			if (!parseMove(position, text, move))
+			{
+				send("error illegal move " + text);
+				return true;
+			}
+			position.makeMove(move);
+		}
+		m_position = position;
+	}
+	else if (command == "level")
+	{
+		m_depthLimit = std::atoi(argument("depth").c_str());
+		m_moveTime = std::atof(argument("move-time").c_str());
+		m_timeLeft = std::atof(argument("time").c_str());
+		m_increment = std::atof(argument("inc").c_str());
+		m_movesToGo = std::atoi(argument("moves").c_str());
+		m_infinite = arguments.count("infinite") != 0;
+	}
+	else if (command == "go")
+	{
+		stopSearch();
+		startSearch(m_infinite || arguments.count("think") == 0);
+	}
+	else if (command == "ponder-hit")
+	{
+		// The expected move was played, the ponder search goes on as if it
+		// had been started with "go think".
+		if (m_thinker.joinable())
+		{
+			m_search.setTimeLimit(allocateTimeMs());
+		}
+	}
+	else if (command == "stop")
+	{
+		stopSearch();
+	}
+	else if (command == "quit")
+	{
+		stopSearch();
+		return false;
+	}
+	else if (!command.empty())
+	{
+		send("error unknown command " + command);
+	}
+	return true;
+}
+
+void HubEngine::startSearch(bool infinite)
+{
+	SearchLimits limits;
+	if (m_depthLimit > 0)
+	{
+		limits.depth = m_depthLimit;
+	}
+	if (!infinite)
+	{
+		limits.timeMs = allocateTimeMs();
+	}
+
+	const Position position = m_position;
+	m_search.prepare();
+	m_thinker = std::thread([this, position, limits]()
+	{
+		const SearchInfo result = m_search.run(position, limits, [this](const SearchInfo& info)
+		{
+			if (info.lines.empty())
+			{
+				return;
+			}
+			const SearchLine& line = info.lines.front();
+			std::string pv;
+			for (const auto& move : line.pv)
+			{
+				pv += (pv.empty() ? "" : " ") + formatMove(move);
+			}
+			char buffer[160];
+			std::snprintf(
+				buffer,
+				sizeof(buffer),
+				"info depth=%d score=%.2f nodes=%llu time=%.3f nps=%llu",
+				info.depth,
+				static_cast<double>(line.score) / 100.0,
+				static_cast<unsigned long long>(info.nodes),
+				static_cast<double>(info.elapsedMs) / 1000.0,
+				static_cast<unsigned long long>(info.nodesPerSecond)
+			);
+			send(std::string(buffer) + " pv=\"" + pv + "\"");
+		});
+
+		if (result.lines.empty())
+		{
+			send("done");
+			return;
+		}
+		const SearchLine& best = result.lines.front();
+		std::string done = "done move=" + formatMove(best.move);
+		if (best.pv.size() > 1)
+		{
+			done += " ponder=" + formatMove(best.pv[1]);
+		}
+		send(done);
+	});
+}
+
+void HubEngine::stopSearch()
+{
+	if (m_thinker.joinable())
+	{
+		m_search.stop();
+		m_thinker.join();
+	}
+}
+
+int HubEngine::allocateTimeMs() const
+{
+	if (m_moveTime > 0.0)
+	{
+		return std::max(1, static_cast<int>(m_moveTime * 950.0));
+	}
+	if (m_timeLeft > 0.0)
+	{
+		const int moves = m_movesToGo > 0 ? m_movesToGo : 30;
+		const double budget = std::min(m_timeLeft / moves + m_increment * 0.8, m_timeLeft * 0.5);
+		return std::max(1, static_cast<int>(budget * 1000.0));
+	}
+	return 1000;
+}
+
+void HubEngine::send(const std::string& line)
+{
+	std::lock_guard<std::mutex> lock(m_outputMutex);
+	m_output << line << std::endl;
+}
+
+std::map<std::string, std::string> HubEngine::parseArguments(const std::string& line, std::string& command)
+{
+	std::map<std::string, std::string> arguments;
+	command.clear();
+
+	size_t i = 0;
+	while (i < line.size())
+	{
+		while (i < line.size() && line[i] == ' ')
+		{
+			++i;
+		}
+		if (i >= line.size())
+		{
+			break;
+		}
+
+		std::string name;
+		while (i < line.size() && line[i] != ' ' && line[i] != '=')
+		{
+			name += line[i++];
+		}
+		std::string value;
+		if (i < line.size() && line[i] == '=')
+		{
+			++i;
+			if (i < line.size() && line[i] == '"')
+			{
+				++i;
+				while (i < line.size() && line[i] != '"')
+				{
+					value += line[i++];
+				}
+				++i;
+			}
+			else
+			{
+				while (i < line.size() && line[i] != ' ')
+				{
+					value += line[i++];
+				}
+			}
+		}
+
+		if (command.empty())
+			command = name;
+		else
+			arguments[name] = value;
+	}
+	return arguments;
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <istream>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+
+#include "Search.h"
+
+// Line based Hub protocol front-end (as used by draughts GUIs and match
+// managers) for the engine. Searches run on a worker thread so "stop" is
+// handled while thinking.
+class HubEngine
+{
+public:
+	HubEngine(std::istream& input, std::ostream& output);
+	~HubEngine();
+
+public:
+	void run();
+
+	// 51 characters: side to move followed by squares 1..50 as w, b, W, B or e.
+	static bool parsePosition(const std::string& text, Position& position);
+	static std::string formatPosition(const Position& position);
+
+	// "32-28", captures as "from x to x captured squares" in ascending order.
+	static std::string formatMove(const EngineMove& move);
+	static bool parseMove(const Position& position, const std::string& text, EngineMove& move);
+
+private:
+	bool handleCommand(const std::string& line);
+
+	void startSearch(bool infinite);
+	void stopSearch();
+	int allocateTimeMs() const;
+
+	void send(const std::string& line);
+
+	static std::map<std::string, std::string> parseArguments(const std::string& line, std::string& command);
+
+private:
+	std::istream& m_input;
+	std::ostream& m_output;
+	std::mutex m_outputMutex;
+
+	Search m_search;
+	std::thread m_thinker;
+	Position m_position = Position::initial();
+
+	int m_depthLimit = 0;
+	double m_moveTime = 0.0;
+	double m_timeLeft = 0.0;
+	double m_increment = 0.0;
+	int m_movesToGo = 0;
+	bool m_infinite = false;
+};
@@ -0,0 +1,296 @@
+#include "ImageWriter.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+	constexpr int minMatch = 3;
+	constexpr int maxMatch = 258;
+	constexpr int windowSize = 32768;
+	constexpr int hashBits = 15;
+
+	constexpr uint16_t lengthBase[29] = {
+		3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+		35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+	};
+	constexpr uint8_t lengthExtra[29] = {
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+		3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+	};
+	constexpr uint16_t distanceBase[30] = {
+		1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+		257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+	};
+	constexpr uint8_t distanceExtra[30] = {
+		0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+		7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+	};
+
+	class BitWriter
+	{
+	public:
+		explicit BitWriter(std::vector<uint8_t>& output) : m_output(output) {}
+
+		// Values go out least significant bit first.
+		void write(uint32_t value, int count)
+		{
+			m_buffer |= value << m_count;
+			m_count += count;
+			while (m_count >= 8)
+			{
+				m_output.push_back(static_cast<uint8_t>(m_buffer));
+				m_buffer >>= 8;
+				m_count -= 8;
+			}
+		}
+
+		// Huffman codes go out most significant bit first.
+		void writeCode(uint32_t code, int length)
+		{
+			uint32_t reversed = 0;
+			for (int i = 0; i < length; ++i)
+			{
+				reversed = (reversed << 1) | ((code >> i) & 1u);
+			}
+			write(reversed, length);
+		}
+
+		void flush()
+		{
+			if (m_count > 0)
+			{
+				m_output.push_back(static_cast<uint8_t>(m_buffer));
+			}
+			m_buffer = 0;
+			m_count = 0;
+		}
+
+	private:
+		std::vector<uint8_t>& m_output;
+		uint32_t m_buffer = 0;
+		int m_count = 0;
+	};
+
+	void writeLiteral(BitWriter& bits, int symbol)
+	{
+		if (symbol < 144)
+			bits.writeCode(0x30 + symbol, 8);
+		else if (symbol < 256)
+			bits.writeCode(0x190 + symbol - 144, 9);
+		else if (symbol < 280)
+			bits.writeCode(symbol - 256, 7);
+		else
+			bits.writeCode(0xC0 + symbol - 280, 8);
+	}
+
+	void writeMatch(BitWriter& bits, int length, int distance)
+	{
+		int code = 28;
+		while (lengthBase[code] > length)
+		{
+			--code;
+		}
+		writeLiteral(bits, 257 + code);
+		bits.write(length - lengthBase[code], lengthExtra[code]);
+
+		code = 29;
+		while (distanceBase[code] > distance)
+		{
+			--code;
+		}
+		bits.writeCode(code, 5);
+		bits.write(distance - distanceBase[code], distanceExtra[code]);
+	}
+
+	uint32_t hash(const uint8_t* data)
+	{
+		const uint32_t value = data[0] | (data[1] << 8) | (data[2] << 16);
+		return (value * 2654435761u) >> (32 - hashBits);
+	}
+
+	uint32_t adler32(const std::vector<uint8_t>& data)
+	{
+		uint32_t a = 1;
+		uint32_t b = 0;
+		for (const uint8_t byte : data)
+		{
+			a = (a + byte) % 65521;
+			b = (b + a) % 65521;
+		}
+		return (b << 16) | a;
+	}
+
+	uint32_t crc32(const uint8_t* data, size_t size, uint32_t crc = 0)
+	{
+		static const std::array<uint32_t, 256> table = []()
+		{
+			std::array<uint32_t, 256> values = {};
+			for (uint32_t i = 0; i < 256; ++i)
+			{
+				uint32_t value = i;
+				for (int bit = 0; bit < 8; ++bit)
+				{
+					value = (value & 1u) != 0 ? 0xEDB88320u ^ (value >> 1) : value >> 1;
+				}
+				values[i] = value;
+			}
+			return values;
+		}();
+
+		crc = ~crc;
+		for (size_t i = 0; i < size; ++i)
+		{
+			crc = table[(crc ^ data[i]) & 0xFFu] ^ (crc >> 8);
+		}
+		return ~crc;
+	}
+
+	void appendBigEndian(std::vector<uint8_t>& output, uint32_t value)
+	{
+		output.push_back(static_cast<uint8_t>(value >> 24));
+		output.push_back(static_cast<uint8_t>(value >> 16));
+		output.push_back(static_cast<uint8_t>(value >> 8));
+		output.push_back(static_cast<uint8_t>(value));
+	}
+
+	void appendChunk(std::vector<uint8_t>& output, const char* type, const std::vector<uint8_t>& data)
+	{
+		appendBigEndian(output, static_cast<uint32_t>(data.size()));
+		const size_t start = output.size();
+		output.insert(output.end(), type, type + 4);
+		output.insert(output.end(), data.begin(), data.end());
+		appendBigEndian(output, crc32(output.data() + start, output.size() - start));
+	}
+
+	bool writeFile(const std::string& path, const std::vector<uint8_t>& data)
+	{
+		std::ofstream file(path, std::ios::binary);
+		if (!file)
+		{
+			return false;
+		}
+		file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+		return static_cast<bool>(file);
+	}
+}
+
+std::vector<uint8_t> ImageWriter::compress(const std::vector<uint8_t>& data)
+{
+	std::vector<uint8_t> output = {0x78, 0x01};
+	output.reserve(data.size() / 4 + 64);
+
+	// A single final block with the fixed codes, matches come from the most
+	// recent position with the same three byte hash.
+	BitWriter bits(output);
+	bits.write(1, 1);
+	bits.write(1, 2);
+
+	std::vector<int> head(1 << hashBits, -1);
+	const int size = static_cast<int>(data.size());
+	int position = 0;
+	while (position < size)
+	{
+		int length = 0;
+		int distance = 0;
+		if (position + minMatch <= size)
+		{
+			const uint32_t key = hash(&data[position]);
+			const int candidate = head[key];
+			head[key] = position;
+			if (candidate >= 0 && position - candidate <= windowSize)
+			{
+				const int limit = std::min(maxMatch, size - position);
+				while (length < limit && data[candidate + length] == data[position + length])
+				{
+					++length;
+				}
+				distance = position - candidate;
+			}
+		}
+
+		if (length >= minMatch)
+		{
+			writeMatch(bits, length, distance);
+			for (int i = position + 1; i < position + length && i + minMatch <= size; ++i)
+			{
+				head[hash(&data[i])] = i;
+			}
+			position += length;
+		}
+		else
+		{
+			writeLiteral(bits, data[position]);
+			++position;
+		}
+	}
+	writeLiteral(bits, 256);
+	bits.flush();
+
+	appendBigEndian(output, adler32(data));
+	return output;
+}
+
+bool ImageWriter::writePng(
+	const std::string& path,
+	const uint32_t* pixels,
+	unsigned int width,
+	unsigned int height,
+	unsigned int stride
+)
+{
+	const size_t rowSize = static_cast<size_t>(width) * 4;
+	std::vector<uint8_t> filtered((rowSize + 1) * height);
+	for (unsigned int y = 0; y < height; ++y)
+	{
+		const uint8_t* const row = reinterpret_cast<const uint8_t*>(pixels + static_cast<size_t>(y) * stride);
+		uint8_t* const target = &filtered[(rowSize + 1) * y];
+		if (y == 0)
+		{
+			target[0] = 0;
+			std::memcpy(target + 1, row, rowSize);
+			continue;
+		}
+
+		const uint8_t* const above = reinterpret_cast<const uint8_t*>(pixels + static_cast<size_t>(y - 1) * stride);
+		target[0] = 2;
+		for (size_t i = 0; i < rowSize; ++i)
+		{
+			target[i + 1] = static_cast<uint8_t>(row[i] - above[i]);
+		}
+	}
+
+	std::vector<uint8_t> header;
+	appendBigEndian(header, width);
+	appendBigEndian(header, height);
+	header.push_back(8);
+	header.push_back(6);
+	header.push_back(0);
+	header.push_back(0);
+	header.push_back(0);
+
+	std::vector<uint8_t> file = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+	appendChunk(file, "IHDR", header);
+	appendChunk(file, "IDAT", compress(filtered));
+	appendChunk(file, "IEND", {});
+	return writeFile(path, file);
+}
+
+bool ImageWriter::writeRaw(
+	const std::string& path,
+	const uint32_t* pixels,
+	unsigned int width,
+	unsigned int height,
+	unsigned int stride
+)
+{
+	const size_t rowSize = static_cast<size_t>(width) * 4;
+	std::vector<uint8_t> data(rowSize * height);
+	for (unsigned int y = 0; y < height; ++y)
+	{
+		std::memcpy(&data[rowSize * y], pixels + static_cast<size_t>(y) * stride, rowSize);
+	}
+	return writeFile(path, data);
+}
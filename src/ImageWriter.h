@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Writes RGBA8 pixel rows, as kept by the SoftwareRenderer, to image files.
+// PNG output is self-contained: rows use the Up filter and are compressed
+// with greedy LZ77 and the fixed Huffman codes of deflate, which suits
+// flat rendered images well and needs no zlib.
+class ImageWriter
+{
+private:
+	ImageWriter() = default;
+
+public:
+	static bool writePng(
+		const std::string& path,
+		const uint32_t* pixels,
+		unsigned int width,
+		unsigned int height,
+		unsigned int stride
+	);
+
+	// Bare rows of width * 4 bytes, top row first.
+	static bool writeRaw(
+		const std::string& path,
+		const uint32_t* pixels,
+		unsigned int width,
+		unsigned int height,
+		unsigned int stride
+	);
+
+	// Complete zlib stream of data.
+	static std::vector<uint8_t> compress(const std::vector<uint8_t>& data);
+};
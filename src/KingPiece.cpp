@@ -1,66 +1,60 @@
-#include "KingPiece.h"
-
-#include "VectorMath.hpp"
-
-KingPiece::KingPiece(PieceType type) : ManPiece(type)
-{
-}
-
-KingPiece::KingPiece(const Piece& other) : ManPiece(other)
-{
-}
-
-void KingPiece::update(float deltaTime)
-{
-	ManPiece::update(deltaTime);
-}
-
-void KingPiece::render(const Renderer& renderer) const
-{
-	ManPiece::render(renderer);
-	const std::vector<Triangle> mesh = renderer.getMeshPrototypes()
-	                                           .getPiece(getType(), getState());
-
-	Transform transform = getTransform();
-	const glm::vec3 up = VectorMath::rotate(
-		{0.0f, 1.0f, 0.0f},
-		transform.rotation
-	);
-	const glm::vec3 pieceUp = glm::normalize(up) * 0.2f;
-	transform.position += pieceUp;
-	renderer.drawTriangles(mesh, transform);
-}
-
-void KingPiece::recalculateMoves(
-	const glm::ivec2& coords,
-	Piece*** board,
-	int boardSize
-)
-{
-	Piece::recalculateMoves(coords, board, boardSize);
-	const int forward = getType() == PieceType::Light ? -1 : 1;
-
-	calculateMovesDiagonal(coords, board, boardSize, forward, 1, 99);
-	calculateMovesDiagonal(coords, board, boardSize, forward, -1, 99);
-	calculateMovesDiagonal(coords, board, boardSize, -forward, 1, 99);
-	calculateMovesDiagonal(coords, board, boardSize, -forward, -1, 99);
-
-	calculateCapturesDiagonal(coords, board, boardSize, forward, 1, 99);
-	calculateCapturesDiagonal(coords, board, boardSize, forward, -1, 99);
-	calculateCapturesDiagonal(coords, board, boardSize, -forward, 1, 99);
-	calculateCapturesDiagonal(coords, board, boardSize, -forward, -1, 99);
-
-	if (getCapturesCount() > 0)
-	{
-		m_viableMoves.erase(
-			std::remove_if(
-				m_viableMoves.begin(),
-				m_viableMoves.end(),
-				[](const Move& move) -> bool
-				{
-					return !move.captures;
-				}),
-			m_viableMoves.end()
-		);
-	}
-}
+#include "KingPiece.h"
+
+#include <algorithm>
+
+KingPiece::KingPiece(PieceType type, AnimationSystem& animation) : ManPiece(type, animation)
+{
+}
+
+KingPiece::KingPiece(const Piece& other) : ManPiece(other)
+{
+}
+
+void KingPiece::render(std::vector<Instance>& instances, float alpha) const
+{
+	ManPiece::render(instances, alpha);
+
+	// The second disc sits on the piece's own up axis, which is the y column of
+	// the model matrix.
+	glm::mat4 model = getTransform(alpha).getModelMatrix();
+	const glm::vec3 pieceUp = glm::normalize(glm::vec3(model[1])) * 0.2f;
+	model[3] += glm::vec4(pieceUp, 0.0f);
+	instances.push_back({
+		model,
+		static_cast<float>(AssetRegistry::getPaletteIndex(getType(), getState()))
+	});
+}
+
+void KingPiece::recalculateMoves(
+	const glm::ivec2& coords,
+	Piece*** board,
+	int boardSize
+)
+{
+	Piece::recalculateMoves(coords, board, boardSize);
+	const int forward = getType() == PieceType::Light ? -1 : 1;
+
+	calculateMovesDiagonal(coords, board, boardSize, forward, 1, 99);
+	calculateMovesDiagonal(coords, board, boardSize, forward, -1, 99);
+	calculateMovesDiagonal(coords, board, boardSize, -forward, 1, 99);
+	calculateMovesDiagonal(coords, board, boardSize, -forward, -1, 99);
+
+	calculateCapturesDiagonal(coords, board, boardSize, forward, 1, 99);
+	calculateCapturesDiagonal(coords, board, boardSize, forward, -1, 99);
+	calculateCapturesDiagonal(coords, board, boardSize, -forward, 1, 99);
+	calculateCapturesDiagonal(coords, board, boardSize, -forward, -1, 99);
+
+	if (getCapturesCount() > 0)
+	{
+		m_viableMoves.erase(
+			std::remove_if(
+				m_viableMoves.begin(),
+				m_viableMoves.end(),
+				[](const Move& move) -> bool
+				{
+					return !move.captures;
+				}),
+			m_viableMoves.end()
+		);
+	}
+}
@@ -1,158 +1,452 @@
-#include "MeshGenerator.h"
-
-#include <glm/ext/scalar_constants.hpp>
-
-std::vector<Triangle> MeshGenerator::makeQuad(const float& width, const float& height) const
-{
-	std::vector<Triangle> triangles;
-	const float halfWidth = width / 2.0f;
-	const float halfHeight = height / 2.0f;
-
-	Vertex vertices[4];
-
-	for (auto& vertex : vertices)
-	{
-		vertex.color = m_color;
-		vertex.normal = {0.0f, 1.0f, 0.0f};
-	}
-
-	vertices[0].position = {-halfWidth, 0.0f, -halfHeight};
-	vertices[1].position = {halfWidth, 0.0f, -halfHeight};
-	vertices[2].position = {halfWidth, 0.0f, halfHeight};
-	vertices[3].position = {-halfWidth, 0.0f, halfHeight};
-
-	triangles.push_back({vertices[0], vertices[1], vertices[2]});
-	triangles.push_back({vertices[0], vertices[2], vertices[3]});
-
-	return triangles;
-}
-
-std::vector<Triangle> MeshGenerator::makeCylinder(const float& radius, const float& height) const
-{
-	std::vector<Triangle> triangles;
-	constexpr float step = glm::pi<float>() / 10.0f;
-	const float h = height / 2.0f;
-
-	for (float i = 0.0; i < glm::pi<float>() * 2.0f; i += step)
-	{
-		const float x = glm::sin(i);
-		const float y = glm::cos(i);
-
-		const float xN = glm::sin(i + step);
-		const float yN = glm::cos(i + step);
-
-		Vertex vertices[10];
-
-		for (auto& vertex : vertices)
-		{
-			vertex.color = m_color;
-		}
-
-		// TOP
-		vertices[0].position = {0.0f, h, 0.0f};
-		vertices[1].position = {x * radius, h, y * radius};
-		vertices[2].position = {xN * radius, h, yN * radius};
-
-		vertices[0].normal = {0.0f, 1.0f, 0.0f};
-		vertices[1].normal = {0.0f, 1.0f, 0.0f};
-		vertices[2].normal = {0.0f, 1.0f, 0.0f};
-
-		triangles.push_back({vertices[0], vertices[1], vertices[2]});
-
-		// SIDE
-		vertices[3].position = {x * radius, h, y * radius};
-		vertices[4].position = {x * radius, -h, y * radius};
-		vertices[5].position = {xN * radius, -h, yN * radius};
-		vertices[6].position = {xN * radius, h, yN * radius};
-
-		vertices[3].normal = {x * radius, 0.0f, y * radius};
-		vertices[4].normal = {x * radius, 0.0f, y * radius};
-		vertices[5].normal = {xN * radius, 0.0f, yN * radius};
-		vertices[6].normal = {xN * radius, 0.0f, yN * radius};
-
-		triangles.push_back({vertices[3], vertices[4], vertices[6]});
-		triangles.push_back({vertices[4], vertices[5], vertices[6]});
-
-
-		// BOTTOM
-		vertices[7].position = {0.0f, -h, 0.0f};
-		vertices[8].position = {x * radius, -h, y * radius};
-		vertices[9].position = {xN * radius, -h, yN * radius};
-
-		vertices[7].normal = {0.0f, -1.0f, 0.0f};
-		vertices[8].normal = {0.0f, -1.0f, 0.0f};
-		vertices[9].normal = {0.0f, -1.0f, 0.0f};
-
-		triangles.push_back({vertices[7], vertices[8], vertices[9]});
-	}
-	return triangles;
-}
-
-std::vector<Triangle> MeshGenerator::makeDonut(const float& R, const float& r) const
-{
-	std::vector<Triangle> triangles;
-	constexpr float step = glm::pi<float>() / 10.0f;
-
-	for (float i = 0.0; i < glm::pi<float>() * 2.0f; i += step)
-	{
-		for (float j = 0.0; j < glm::pi<float>() * 2.0f; j += step)
-		{
-			const float Rx = R * glm::sin(i);
-			const float Ry = R * glm::cos(i);
-
-			const float x = Rx + r * glm::cos(j) * glm::sin(i);
-			const float y = Ry + r * glm::cos(j) * glm::cos(i);
-			const float z = r * glm::sin(j);
-
-			const float xN = Rx + r * glm::cos(j + step) * glm::sin(i);
-			const float yN = Ry + r * glm::cos(j + step) * glm::cos(i);
-			const float zN = r * glm::sin(j + step);
-
-			const float R_x = R * glm::sin(i + step);
-			const float R_y = R * glm::cos(i + step);
-
-			const float _x = R_x + r * glm::cos(j) * glm::sin(i + step);
-			const float _y = R_y + r * glm::cos(j) * glm::cos(i + step);
-			const float _z = r * glm::sin(j);
-
-			const float _xN = R_x + r * glm::cos(j + step) * glm::sin(i + step);
-			const float _yN = R_y + r * glm::cos(j + step) * glm::cos(i + step);
-			const float _zN = r * glm::sin(j + step);
-
-			Vertex vertices[4];
-			for (auto& vertex : vertices)
-			{
-				vertex.color = m_color;
-			}
-			vertices[0].position = {x, y, z};
-			vertices[1].position = {xN, yN, zN};
-			vertices[2].position = {_x, _y, _z};
-			vertices[3].position = {_xN, _yN, _zN};
-
-			vertices[0].normal = {
-				glm::cos(j) * glm::sin(i),
-				glm::cos(j) * glm::cos(i),
-				glm::sin(j)
-			};
-			vertices[1].normal = {
-				glm::cos(j + step) * glm::sin(i),
-				glm::cos(j + step) * glm::cos(i),
-				glm::sin(j + step)
-			};
-			vertices[2].normal = {
-				glm::cos(j) * glm::sin(i + step),
-				glm::cos(j) * glm::cos(i + step),
-				glm::sin(j)
-			};
-			vertices[3].normal = {
-				glm::cos(j + step) * glm::sin(i + step),
-				glm::cos(j + step) * glm::cos(i + step),
-				glm::sin(j + step)
-			};
-
-			triangles.push_back({vertices[0], vertices[1], vertices[2]});
-			triangles.push_back({vertices[2], vertices[1], vertices[3]});
-		}
-	}
-	return triangles;
-}
+#include "MeshGenerator.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <map>
+
+#include <glm/ext/scalar_constants.hpp>
+
+namespace
+{
+	constexpr int vertexCacheSize = 32;
+
+	// Vertices used by the last triangle score the same so the order inside a
+	// triangle does not matter, vertices with few triangles left get a boost
+	// so that lone triangles are not left behind.
+	float vertexScore(int cachePosition, int remainingTriangles)
+	{
+		if (remainingTriangles == 0)
+		{
+			return -1.0f;
+		}
+
+		float score = 0.0f;
+		if (cachePosition >= 0)
+		{
+			if (cachePosition < 3)
+			{
+				score = 0.75f;
+			}
+			else
+			{
+				const float scale = 1.0f / static_cast<float>(vertexCacheSize - 3);
+				score = std::pow(1.0f - static_cast<float>(cachePosition - 3) * scale, 1.5f);
+			}
+		}
+		return score + 2.0f / std::sqrt(static_cast<float>(remainingTriangles));
+	}
+
+	std::array<int32_t, 9> weldKey(const Vertex& vertex)
+	{
+		const auto quantize = [](float value)
+		{
+			return static_cast<int32_t>(std::lround(value * 10000.0f));
+		};
+		return {
+			quantize(vertex.position.x), quantize(vertex.position.y), quantize(vertex.position.z),
+			quantize(vertex.normal.x), quantize(vertex.normal.y), quantize(vertex.normal.z),
+			quantize(vertex.color.r), quantize(vertex.color.g), quantize(vertex.color.b)
+		};
+	}
+
+	// Taylor series of sin around zero, x within [-pi, pi]. Twelve terms are
+	// exact to double precision there.
+	constexpr double constexprSin(double x)
+	{
+		double term = x;
+		double sum = x;
+		for (int n = 1; n < 12; ++n)
+		{
+			term *= -x * x / static_cast<double>((2 * n) * (2 * n + 1));
+			sum += term;
+		}
+		return sum;
+	}
+
+	constexpr std::array<float, MeshGenerator::circleSteps> makeSineTable()
+	{
+		constexpr double pi = 3.14159265358979323846;
+		std::array<float, MeshGenerator::circleSteps> table = {};
+		for (int step = 0; step < MeshGenerator::circleSteps; ++step)
+		{
+			// Folded into [-pi, pi], where the series converges quickly.
+			const int folded = step <= MeshGenerator::circleSteps / 2 ? step : step - MeshGenerator::circleSteps;
+			table[step] = static_cast<float>(constexprSin(2.0 * pi * folded / MeshGenerator::circleSteps));
+		}
+		return table;
+	}
+
+	constexpr std::array<float, MeshGenerator::circleSteps> sineTable = makeSineTable();
+
+	// Sine and cosine of the angles splitting a full turn into segments, the
+	// last point repeats the first.
+	std::vector<glm::vec2> makeCirclePoints(int segments)
+	{
+		std::vector<glm::vec2> points(segments + 1);
+		if (MeshGenerator::circleSteps % segments == 0)
+		{
+			const int stride = MeshGenerator::circleSteps / segments;
+			const int quarter = MeshGenerator::circleSteps / 4;
+			for (int segment = 0; segment < segments; ++segment)
+			{
+				const int step = segment * stride;
+				points[segment] = {
+					sineTable[step],
+					sineTable[(step + quarter) % MeshGenerator::circleSteps]
+				};
+			}
+		}
+		else
+		{
+			const float step = glm::pi<float>() * 2.0f / static_cast<float>(segments);
+			for (int segment = 0; segment < segments; ++segment)
+			{
+				const float angle = static_cast<float>(segment) * step;
+				points[segment] = {glm::sin(angle), glm::cos(angle)};
+			}
+		}
+		points[segments] = points[0];
+		return points;
+	}
+}
+
+Mesh MeshGenerator::makeQuad(const float& width, const float& height) const
+{
+	std::vector<Triangle> triangles;
+	const float halfWidth = width / 2.0f;
+	const float halfHeight = height / 2.0f;
+
+	Vertex vertices[4];
+
+	for (auto& vertex : vertices)
+	{
+		vertex.color = m_color;
+		vertex.normal = {0.0f, 1.0f, 0.0f};
+	}
+
+	vertices[0].position = {-halfWidth, 0.0f, -halfHeight};
+	vertices[1].position = {halfWidth, 0.0f, -halfHeight};
+	vertices[2].position = {halfWidth, 0.0f, halfHeight};
+	vertices[3].position = {-halfWidth, 0.0f, halfHeight};
+
+	triangles.push_back({vertices[0], vertices[2], vertices[1]});
+	triangles.push_back({vertices[0], vertices[3], vertices[2]});
+
+	return makeIndexed(triangles);
+}
+
+Mesh MeshGenerator::makeCylinder(const float& radius, const float& height, int segments) const
+{
+	std::vector<Triangle> triangles;
+	const std::vector<glm::vec2> circle = makeCirclePoints(segments);
+	const float h = height / 2.0f;
+
+	for (int segment = 0; segment < segments; ++segment)
+	{
+		const float x = circle[segment].x;
+		const float y = circle[segment].y;
+
+		const float xN = circle[segment + 1].x;
+		const float yN = circle[segment + 1].y;
+
+		Vertex vertices[10];
+
+		for (auto& vertex : vertices)
+		{
+			vertex.color = m_color;
+		}
+
+		// TOP
+		vertices[0].position = {0.0f, h, 0.0f};
+		vertices[1].position = {x * radius, h, y * radius};
+		vertices[2].position = {xN * radius, h, yN * radius};
+
+		vertices[0].normal = {0.0f, 1.0f, 0.0f};
+		vertices[1].normal = {0.0f, 1.0f, 0.0f};
+		vertices[2].normal = {0.0f, 1.0f, 0.0f};
+
+		triangles.push_back({vertices[0], vertices[1], vertices[2]});
+
+		// SIDE
+		vertices[3].position = {x * radius, h, y * radius};
+		vertices[4].position = {x * radius, -h, y * radius};
+		vertices[5].position = {xN * radius, -h, yN * radius};
+		vertices[6].position = {xN * radius, h, yN * radius};
+
+		vertices[3].normal = {x * radius, 0.0f, y * radius};
+		vertices[4].normal = {x * radius, 0.0f, y * radius};
+		vertices[5].normal = {xN * radius, 0.0f, yN * radius};
+		vertices[6].normal = {xN * radius, 0.0f, yN * radius};
+
+		triangles.push_back({vertices[3], vertices[4], vertices[6]});
+		triangles.push_back({vertices[4], vertices[5], vertices[6]});
+
+
+		// BOTTOM
+		vertices[7].position = {0.0f, -h, 0.0f};
+		vertices[8].position = {x * radius, -h, y * radius};
+		vertices[9].position = {xN * radius, -h, yN * radius};
+
+		vertices[7].normal = {0.0f, -1.0f, 0.0f};
+		vertices[8].normal = {0.0f, -1.0f, 0.0f};
+		vertices[9].normal = {0.0f, -1.0f, 0.0f};
+
+		triangles.push_back({vertices[7], vertices[9], vertices[8]});
+	}
+	return makeIndexed(triangles);
+}
+
+Mesh MeshGenerator::makeDonut(const float& R, const float& r, int segments, int sides) const
+{
+	std::vector<Triangle> triangles;
+	const std::vector<glm::vec2> ring = makeCirclePoints(segments);
+	const std::vector<glm::vec2> tube = makeCirclePoints(sides);
+
+	for (int segment = 0; segment < segments; ++segment)
+	{
+		const glm::vec2 i = ring[segment];
+		const glm::vec2 iN = ring[segment + 1];
+		for (int side = 0; side < sides; ++side)
+		{
+			// Sine in x and cosine in y, as on the cross section of the tube.
+			const glm::vec2 j = tube[side];
+			const glm::vec2 jN = tube[side + 1];
+
+			Vertex vertices[4];
+			for (auto& vertex : vertices)
+			{
+				vertex.color = m_color;
+			}
+
+			vertices[0].normal = {j.y * i.x, j.y * i.y, j.x};
+			vertices[1].normal = {jN.y * i.x, jN.y * i.y, jN.x};
+			vertices[2].normal = {j.y * iN.x, j.y * iN.y, j.x};
+			vertices[3].normal = {jN.y * iN.x, jN.y * iN.y, jN.x};
+
+			vertices[0].position = glm::vec3(R * i.x, R * i.y, 0.0f) + r * vertices[0].normal;
+			vertices[1].position = glm::vec3(R * i.x, R * i.y, 0.0f) + r * vertices[1].normal;
+			vertices[2].position = glm::vec3(R * iN.x, R * iN.y, 0.0f) + r * vertices[2].normal;
+			vertices[3].position = glm::vec3(R * iN.x, R * iN.y, 0.0f) + r * vertices[3].normal;
+
+			triangles.push_back({vertices[0], vertices[1], vertices[2]});
+			triangles.push_back({vertices[2], vertices[1], vertices[3]});
+		}
+	}
+	return makeIndexed(triangles);
+}
+
+Mesh MeshGenerator::makeIndexed(const std::vector<Triangle>& triangles)
+{
+	Mesh mesh;
+	std::map<std::array<int32_t, 9>, uint16_t> welded;
+	const auto addVertex = [&mesh, &welded](const Vertex& vertex)
+	{
+		const auto inserted = welded.emplace(
+			weldKey(vertex),
+			static_cast<uint16_t>(mesh.vertices.size())
+		);
+		if (inserted.second)
+		{
+			mesh.vertices.push_back(vertex);
+		}
+		return inserted.first->second;
+	};
+
+	mesh.indices.reserve(triangles.size() * 3);
+	for (const auto& triangle : triangles)
+	{
+		const uint16_t a = addVertex(triangle.v1);
+		const uint16_t b = addVertex(triangle.v2);
+		const uint16_t c = addVertex(triangle.v3);
+		if (a != b && b != c && a != c)
+		{
+			mesh.indices.insert(mesh.indices.end(), {a, b, c});
+		}
+	}
+	assert(mesh.vertices.size() <= 0xFFFF);
+
+	optimizeVertexCache(mesh.indices, mesh.vertices.size());
+
+	// Store vertices in the order they are first used.
+	std::vector<int> remap(mesh.vertices.size(), -1);
+	std::vector<Vertex> vertices;
+	vertices.reserve(mesh.vertices.size());
+	for (auto& index : mesh.indices)
+	{
+		if (remap[index] < 0)
+		{
+			remap[index] = static_cast<int>(vertices.size());
+			vertices.push_back(mesh.vertices[index]);
+		}
+		index = static_cast<uint16_t>(remap[index]);
+	}
+	mesh.vertices = std::move(vertices);
+	mesh.bounds = computeBounds(mesh.vertices);
+	return mesh;
+}
+
+Bounds MeshGenerator::computeBounds(const std::vector<Vertex>& vertices)
+{
+	Bounds bounds;
+	if (vertices.empty())
+	{
+		return bounds;
+	}
+
+	bounds.min = bounds.max = vertices.front().position;
+	for (const auto& vertex : vertices)
+	{
+		bounds.min = glm::min(bounds.min, vertex.position);
+		bounds.max = glm::max(bounds.max, vertex.position);
+	}
+	bounds.center = (bounds.min + bounds.max) * 0.5f;
+	for (const auto& vertex : vertices)
+	{
+		bounds.radius = glm::max(bounds.radius, glm::distance(bounds.center, vertex.position));
+	}
+	return bounds;
+}
+
+void MeshGenerator::optimizeVertexCache(std::vector<uint16_t>& indices, size_t vertexCount)
+{
+	const size_t triangleCount = indices.size() / 3;
+
+	// Triangles using each vertex, the first remaining[v] entries of a vertex
+	// are the ones not emitted yet.
+	std::vector<int> remaining(vertexCount, 0);
+	for (const auto index : indices)
+	{
+		remaining[index]++;
+	}
+	std::vector<int> offsets(vertexCount + 1, 0);
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		offsets[v + 1] = offsets[v] + remaining[v];
+	}
+	std::vector<int> adjacency(indices.size());
+	{
+		std::vector<int> fill(offsets.begin(), offsets.end() - 1);
+		for (size_t i = 0; i < indices.size(); ++i)
+		{
+			adjacency[fill[indices[i]]++] = static_cast<int>(i / 3);
+		}
+	}
+
+	std::vector<int> cachePosition(vertexCount, -1);
+	std::vector<float> scores(vertexCount);
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		scores[v] = vertexScore(-1, remaining[v]);
+	}
+	std::vector<float> triangleScores(triangleCount);
+	for (size_t t = 0; t < triangleCount; ++t)
+	{
+		triangleScores[t] = scores[indices[t * 3]] + scores[indices[t * 3 + 1]] + scores[indices[t * 3 + 2]];
+	}
+
+	std::vector<bool> emitted(triangleCount, false);
+	std::vector<uint16_t> output;
+	output.reserve(indices.size());
+	std::vector<int> cache;
+	std::vector<int> nextCache;
+
+	int best = -1;
+	for (size_t count = 0; count < triangleCount; ++count)
+	{
+		if (best < 0)
+		{
+			float bestScore = -1.0f;
+			for (size_t t = 0; t < triangleCount; ++t)
+			{
+				if (!emitted[t] && triangleScores[t] > bestScore)
+				{
+					bestScore = triangleScores[t];
+					best = static_cast<int>(t);
+				}
+			}
+		}
+
+		emitted[best] = true;
+		nextCache.clear();
+		for (int k = 0; k < 3; ++k)
+		{
+			const uint16_t v = indices[best * 3 + k];
+			output.push_back(v);
+			nextCache.push_back(v);
+
+			int* const begin = &adjacency[offsets[v]];
+			int* const end = begin + remaining[v];
+			int* const found = std::find(begin, end, best);
+			std::swap(*found, *(end - 1));
+			remaining[v]--;
+		}
+		for (const int v : cache)
+		{
+			if (std::find(nextCache.begin(), nextCache.begin() + 3, v) == nextCache.begin() + 3)
+			{
+				nextCache.push_back(v);
+			}
+		}
+
+		for (size_t i = 0; i < nextCache.size(); ++i)
+		{
+			const int v = nextCache[i];
+			cachePosition[v] = i < static_cast<size_t>(vertexCacheSize) ? static_cast<int>(i) : -1;
+			scores[v] = vertexScore(cachePosition[v], remaining[v]);
+		}
+
+		best = -1;
+		float bestScore = -1.0f;
+		for (const int v : nextCache)
+		{
+			for (int a = offsets[v]; a < offsets[v] + remaining[v]; ++a)
+			{
+				const int t = adjacency[a];
+				triangleScores[t] = scores[indices[t * 3]] + scores[indices[t * 3 + 1]] + scores[indices[t * 3 + 2]];
+				if (triangleScores[t] > bestScore)
+				{
+					bestScore = triangleScores[t];
+					best = t;
+				}
+			}
+		}
+
+		if (nextCache.size() > static_cast<size_t>(vertexCacheSize))
+		{
+			nextCache.resize(vertexCacheSize);
+		}
+		std::swap(cache, nextCache);
+	}
+
+	indices = std::move(output);
+}
+
+void MeshGenerator::appendTransformed(
+	Mesh& target,
+	const Mesh& mesh,
+	const Transform& transform
+)
+{
+	const glm::mat4& model = transform.getModelMatrix();
+	const glm::mat3& normalMat = transform.getNormalMatrix();
+	const size_t base = target.vertices.size();
+	assert(base + mesh.getVertexCount() <= 0xFFFF);
+
+	target.vertices.reserve(base + mesh.getVertexCount());
+	for (size_t i = 0; i < mesh.getVertexCount(); ++i)
+	{
+		Vertex vertex = mesh.getVertices()[i];
+		vertex.position = glm::vec3(model * glm::vec4(vertex.position, 1.0f));
+		vertex.normal = glm::normalize(normalMat * vertex.normal);
+		target.vertices.push_back(vertex);
+	}
+
+	target.indices.reserve(target.indices.size() + mesh.getIndexCount());
+	for (size_t i = 0; i < mesh.getIndexCount(); ++i)
+	{
+		target.indices.push_back(static_cast<uint16_t>(base + mesh.getIndices()[i]));
+	}
+	target.bounds = computeBounds(target.vertices);
+}
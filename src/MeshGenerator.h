@@ -1,24 +1,48 @@
-#pragma once
-
-#include <vector>
-
-#include <glm/glm.hpp>
-
-#include "RenderTypes.h"
-
-class MeshGenerator
-{
-public:
-	MeshGenerator() = default;
-
-public:
-	std::vector<Triangle> makeQuad(const float& width, const float& height) const;
-	std::vector<Triangle> makeCylinder(const float& radius, const float& height) const;
-	std::vector<Triangle> makeDonut(const float& R, const float& r) const;
-
-public:
-	void setColor(const glm::vec3& color) { m_color = color; }
-
-private:
-	glm::vec3 m_color = glm::vec3(1.0f);
-};
+#pragma once
+
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "RenderTypes.h"
+#include "Transform.h"
+
+// Shapes are wound counterclockwise seen from outside, the renderers cull
+// triangles facing away.
+class MeshGenerator
+{
+public:
+	MeshGenerator() = default;
+
+public:
+	// Round shapes whose segment counts divide this read their sines and
+	// cosines from a table computed at compile time.
+	static constexpr int circleSteps = 240;
+
+	Mesh makeQuad(const float& width, const float& height) const;
+	// Segments split the round sides, sides the cross section of the donut.
+	Mesh makeCylinder(const float& radius, const float& height, int segments = 20) const;
+	Mesh makeDonut(const float& R, const float& r, int segments = 20, int sides = 20) const;
+
+	// Welds equal vertices of a triangle soup and orders the result for the
+	// post-transform vertex cache and for linear vertex fetches.
+	static Mesh makeIndexed(const std::vector<Triangle>& triangles);
+
+	// Reorders triangles with Forsyth's linear-speed vertex cache optimisation.
+	static void optimizeVertexCache(std::vector<uint16_t>& indices, size_t vertexCount);
+
+	static Bounds computeBounds(const std::vector<Vertex>& vertices);
+
+	// Appends a copy of mesh with positions and normals moved by transform.
+	static void appendTransformed(
+		Mesh& target,
+		const Mesh& mesh,
+		const Transform& transform
+	);
+
+public:
+	void setColor(const glm::vec3& color) { m_color = color; }
+
+private:
+	glm::vec3 m_color = glm::vec3(1.0f);
+};
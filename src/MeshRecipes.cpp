@@ -0,0 +1,68 @@
+#include "MeshRecipes.h"
+
+#include "MeshGenerator.h"
+
+int MeshRecipes::getLevelCount(MeshAsset asset)
+{
+	return asset == PieceMesh || asset == HintRingMesh ? maxLevelCount : 1;
+}
+
+Mesh MeshRecipes::generate(MeshAsset asset, int level)
+{
+	static_assert([]
+	{
+		for (const DetailLevel& detail : roundDetailLevels)
+		{
+			if (MeshGenerator::circleSteps % detail.segments != 0)
+			{
+				return false;
+			}
+		}
+		return true;
+	}(), "Round meshes would compute their angles at runtime");
+
+	const int segments = roundDetailLevels[level].segments;
+	MeshGenerator generator;
+	switch (asset)
+	{
+	case TileOddMesh:
+		generator.setColor(tableTileColorOdd);
+		return generator.makeQuad(1.0f, 1.0f);
+	case TileEvenMesh:
+		generator.setColor(tableTileColorEven);
+		return generator.makeQuad(1.0f, 1.0f);
+	case TableBorderMesh:
+		generator.setColor(tableBorderColor);
+		return generator.makeQuad(1.0f, 1.0f);
+	case PieceMesh:
+		// White geometry, tinted by the palette entry of the piece at draw time.
+		generator.setColor(glm::vec3(1.0f));
+		return generator.makeCylinder(0.35f, 0.2f, segments);
+	case HintRingMesh:
+		generator.setColor(hintColor);
+		return generator.makeDonut(0.42f, 0.05f, segments, segments);
+	case MeshAssetCount:
+		break;
+	}
+	return {};
+}
+
+const char* MeshRecipes::getAssetName(MeshAsset asset)
+{
+	switch (asset)
+	{
+	case TileOddMesh:
+		return "TileOdd";
+	case TileEvenMesh:
+		return "TileEven";
+	case TableBorderMesh:
+		return "TableBorder";
+	case PieceMesh:
+		return "Piece";
+	case HintRingMesh:
+		return "HintRing";
+	case MeshAssetCount:
+		break;
+	}
+	return "Unknown";
+}
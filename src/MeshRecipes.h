@@ -0,0 +1,54 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include "RenderTypes.h"
+
+enum MeshAsset
+{
+	TileOddMesh,
+	TileEvenMesh,
+	TableBorderMesh,
+	PieceMesh,
+	HintRingMesh,
+	MeshAssetCount
+};
+
+// How every shared mesh is built from the MeshGenerator shapes. The game never
+// runs the recipes, tools/meshgen bakes their results into BakedMeshes.h and
+// AssetRegistry uploads those.
+class MeshRecipes
+{
+public:
+	// Levels of detail, the finest first.
+	static constexpr int maxLevelCount = 3;
+	static int getLevelCount(MeshAsset asset);
+
+	// Screen radius in pixels below which the next level is drawn.
+	static float getLowerDetailBelow(int level) { return roundDetailLevels[level].lowerDetailBelow; }
+
+	static Mesh generate(MeshAsset asset, int level);
+
+	static const char* getAssetName(MeshAsset asset);
+
+protected:
+	static constexpr glm::vec3 tableTileColorOdd = {0.85f, 0.75f, 0.5f};
+	static constexpr glm::vec3 tableTileColorEven = {0.29f, 0.24f, 0.21f};
+	static constexpr glm::vec3 tableBorderColor = {0.36f, 0.22f, 0.13f};
+
+	static constexpr glm::vec3 hintColor = {0.95f, 0.75f, 0.2f};
+
+	// Segments around each round shape per level, and the screen radius in
+	// pixels below which the next level is drawn. At 20 segments the outline
+	// is off by half a pixel at 40 pixels of radius, at 8 by one pixel at 12.
+	struct DetailLevel
+	{
+		int segments;
+		float lowerDetailBelow;
+	};
+	static constexpr DetailLevel roundDetailLevels[maxLevelCount] = {
+		{48, 40.0f},
+		{20, 12.0f},
+		{8, 0.0f}
+	};
+};
@@ -1,76 +1,74 @@
-#pragma once
-
-#include <vector>
-
-#include <glm/glm.hpp>
-
-#include "PieceTypes.h"
-#include "Renderer.h"
-
-class Piece
-{
-public:
-	Piece(PieceType type);
-	Piece(const Piece& other);
-
-	virtual ~Piece() = default;
-
-public:
-	virtual void update(float deltaTime);
-	virtual void render(const Renderer& renderer) const = 0;
-
-	virtual void recalculateMoves(
-		const glm::ivec2& coords,
-		Piece*** board,
-		int boardSize
-	);
-
-private:
-	void interpolatePosition(float speed);
-
-public:
-	const Transform& getTransform() const { return m_transform; }
-
-	void setPosition(const glm::vec3& position)
-	{
-		m_desiredPosition = position;
-		m_transform.position = position;
-	}
-
-	void setDesiredPosition(const glm::vec3& position) { m_desiredPosition = position; }
-
-	void setInterpolationSpeed(const float& interSpeed) { m_interSpeed = interSpeed; }
-
-	const PieceType& getType() const { return m_type; }
-
-	const PieceState& getState() const { return m_state; }
-	void setState(PieceState state) { m_state = state; }
-
-	void setHeld(const bool& held) { m_isHeld = held; }
-
-	const bool& isMovable() const { return m_isMovable; }
-	void setMovable(const bool& movable) { m_isMovable = movable; }
-
-	const bool& isCaptured() const { return m_isCaptured; }
-	void setCaptured(const bool& captured) { m_isCaptured = captured; }
-
-	const std::vector<Move>& getViableMoves() const { return m_viableMoves; }
-	const int& getCapturesCount() const { return m_capturesCount; }
-
-protected:
-	std::vector<Move> m_viableMoves;
-	int m_capturesCount = 0;
-
-private:
-	Transform m_transform = {};
-	glm::vec3 m_desiredPosition = {};
-
-	float m_interSpeed = 1.0f;
-
-	PieceType m_type;
-	PieceState m_state = PieceState::Neutral;
-
-	bool m_isHeld = false;
-	bool m_isMovable = false;
-	bool m_isCaptured = false;
-};
+#pragma once
+
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "AnimationSystem.h"
+#include "PieceTypes.h"
+#include "Renderer.h"
+
+// Movement is kept in an AnimationSystem shared by all pieces of a board, a
+// copy takes a slot of its own.
+class Piece
+{
+public:
+	Piece(PieceType type, AnimationSystem& animation);
+	Piece(const Piece& other);
+
+	virtual ~Piece();
+
+	Piece& operator=(const Piece&) = delete;
+
+public:
+	// Alpha blends between the transforms of the last two animation updates.
+	virtual void render(std::vector<Instance>& instances, float alpha) const = 0;
+
+	virtual bool isKing() const { return false; }
+
+	virtual void recalculateMoves(
+		const glm::ivec2& coords,
+		Piece*** board,
+		int boardSize
+	);
+
+public:
+	glm::vec3 getPosition() const { return m_animation.getPosition(m_slot); }
+	Transform getTransform(float alpha) const { return m_animation.getTransform(m_slot, alpha); }
+
+	void setPosition(const glm::vec3& position) { m_animation.setPosition(m_slot, position); }
+	void setDesiredPosition(const glm::vec3& position) { m_animation.setTarget(m_slot, position); }
+	bool isMoving() const { return m_animation.isMoving(m_slot); }
+
+	void setInterpolationSpeed(const float& interSpeed) { m_animation.setSpeed(m_slot, interSpeed); }
+
+	const PieceType& getType() const { return m_type; }
+
+	const PieceState& getState() const { return m_state; }
+	void setState(PieceState state) { m_state = state; }
+
+	void setHeld(const bool& held) { m_animation.setHeld(m_slot, held); }
+
+	const bool& isMovable() const { return m_isMovable; }
+	void setMovable(const bool& movable) { m_isMovable = movable; }
+
+	const bool& isCaptured() const { return m_isCaptured; }
+	void setCaptured(const bool& captured) { m_isCaptured = captured; }
+
+	const std::vector<Move>& getViableMoves() const { return m_viableMoves; }
+	const int& getCapturesCount() const { return m_capturesCount; }
+
+protected:
+	std::vector<Move> m_viableMoves;
+	int m_capturesCount = 0;
+
+private:
+	AnimationSystem& m_animation;
+	int m_slot;
+
+	PieceType m_type;
+	PieceState m_state = PieceState::Neutral;
+
+	bool m_isMovable = false;
+	bool m_isCaptured = false;
+};
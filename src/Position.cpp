@@ -0,0 +1,507 @@
+#include "Position.h"
+
+#include <sstream>
+
+namespace
+{
+	constexpr int directionSteps[4][2] = {
+		{-1, -1},
+		{-1, 1},
+		{1, -1},
+		{1, 1}
+	};
+
+	struct SquareTables
+	{
+		int neighbours[Position::squareCount][4];
+		Bitboard promotionRow[2];
+		uint64_t keys[4][Position::squareCount];
+		uint64_t sideKey;
+
+		SquareTables()
+		{
+			for (int square = 0; square < Position::squareCount; ++square)
+			{
+				const glm::ivec2 coords = Position::coordsFromSquare(square);
+				for (int direction = 0; direction < 4; ++direction)
+				{
+					const glm::ivec2 next = {
+						coords.x + directionSteps[direction][0],
+						coords.y + directionSteps[direction][1]
+					};
+					neighbours[square][direction] = Position::squareFromCoords(next);
+				}
+			}
+
+			promotionRow[PieceType::Light] = 0;
+			promotionRow[PieceType::Dark] = 0;
+			for (int i = 0; i < 5; ++i)
+			{
+				promotionRow[PieceType::Light] |= squareBit(i);
+				promotionRow[PieceType::Dark] |= squareBit(Position::squareCount - 5 + i);
+			}
+
+			uint64_t seed = 0x9E3779B97F4A7C15ull;
+			const auto next = [&seed]() -> uint64_t
+			{
+				seed += 0x9E3779B97F4A7C15ull;
+				uint64_t z = seed;
+				z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+				z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+				return z ^ (z >> 31);
+			};
+			for (auto& kind : keys)
+			{
+				for (auto& key : kind)
+				{
+					key = next();
+				}
+			}
+			sideKey = next();
+		}
+	};
+
+	const SquareTables& tables()
+	{
+		static const SquareTables instance;
+		return instance;
+	}
+
+	int pieceKind(PieceType type, bool king)
+	{
+		return static_cast<int>(type) * 2 + (king ? 1 : 0);
+	}
+
+	PieceType opponent(PieceType type)
+	{
+		return type == PieceType::Light ? PieceType::Dark : PieceType::Light;
+	}
+
+	bool parseColor(char c, PieceType& type)
+	{
+		if (c == 'W')
+			type = PieceType::Light;
+		else if (c == 'B')
+			type = PieceType::Dark;
+		else
+			return false;
+		return true;
+	}
+
+	// Standard square number 1..50.
+	bool parseSquareNumber(const std::string& text, int& number)
+	{
+		if (text.empty() || text.size() > 2)
+		{
+			return false;
+		}
+		number = 0;
+		for (const char c : text)
+		{
+			if (c < '0' || c > '9')
+			{
+				return false;
+			}
+			number = number * 10 + (c - '0');
+		}
+		return number >= 1 && number <= Position::squareCount;
+	}
+}
+
+bool EngineMove::operator==(const EngineMove& other) const
+{
+	return from == other.from && to == other.to && captures == other.captures;
+}
+
+bool EngineMove::operator!=(const EngineMove& other) const
+{
+	return !(*this == other);
+}
+
+Position Position::initial()
+{
+	Position position;
+	for (int square = 0; square < 20; ++square)
+	{
+		position.setPiece(square, PieceType::Dark, false);
+		position.setPiece(squareCount - 1 - square, PieceType::Light, false);
+	}
+	position.setSideToMove(PieceType::Light);
+	return position;
+}
+
+bool Position::fromFen(const std::string& fen, Position& position)
+{
+	position = Position();
+
+	// Surrounding whitespace, e.g. the '\r' of a CRLF file, is not part of it.
+	const size_t first = fen.find_first_not_of(" \t\r\n");
+	if (first == std::string::npos)
+	{
+		return false;
+	}
+	const size_t last = fen.find_last_not_of(" \t\r\n");
+	std::stringstream stream(fen.substr(first, last - first + 1));
+
+	std::string section;
+	PieceType side;
+	if (!std::getline(stream, section, ':') || section.size() != 1 || !parseColor(section[0], side))
+	{
+		return false;
+	}
+	position.setSideToMove(side);
+
+	while (std::getline(stream, section, ':'))
+	{
+		PieceType type;
+		if (section.empty() || !parseColor(section[0], type))
+		{
+			return false;
+		}
+
+		std::stringstream squares(section.substr(1));
+		std::string token;
+		while (std::getline(squares, token, ','))
+		{
+			const bool king = !token.empty() && token[0] == 'K';
+			if (king)
+			{
+				token = token.substr(1);
+			}
+
+			// A range like 31-35 stands for every square from one to the other.
+			const size_t dash = token.find('-');
+			int from = 0;
+			int to = 0;
+			if (dash == std::string::npos)
+			{
+				if (!parseSquareNumber(token, from))
+				{
+					return false;
+				}
+				to = from;
+			}
+			else if (!parseSquareNumber(token.substr(0, dash), from)
+				|| !parseSquareNumber(token.substr(dash + 1), to)
+				|| from > to)
+			{
+				return false;
+			}
+
+			for (int number = from; number <= to; ++number)
+			{
+				if ((position.getOccupied() & squareBit(number - 1)) != 0)
+				{
+					return false;
+				}
+				position.setPiece(number - 1, type, king);
+			}
+		}
+	}
+	return true;
+}
+
+std::string Position::toFen() const
+{
+	std::string fen = m_sideToMove == PieceType::Light ? "W" : "B";
+	const PieceType types[2] = {PieceType::Light, PieceType::Dark};
+	for (const PieceType type : types)
+	{
+		fen += type == PieceType::Light ? ":W" : ":B";
+		bool first = true;
+		for (Bitboard pieces = getPieces(type); pieces != 0; pieces &= pieces - 1)
+		{
+			const int square = lowestSquare(pieces);
+			if (!first)
+			{
+				fen += ',';
+			}
+			if ((m_kings & squareBit(square)) != 0)
+			{
+				fen += 'K';
+			}
+			fen += std::to_string(square + 1);
+			first = false;
+		}
+	}
+	return fen;
+}
+
+void Position::generateMoves(MoveList& moves) const
+{
+	moves.count = 0;
+	const Bitboard own = getPieces(m_sideToMove);
+	const Bitboard enemies = getPieces(opponent(m_sideToMove));
+	const Bitboard occupied = getOccupied();
+	const Bitboard promotionRow = tables().promotionRow[m_sideToMove];
+
+	for (Bitboard pieces = own; pieces != 0; pieces &= pieces - 1)
+	{
+		const int square = lowestSquare(pieces);
+		EngineMove move = {};
+		move.from = static_cast<uint8_t>(square);
+		generateCaptures(
+			moves,
+			move,
+			square,
+			(m_kings & squareBit(square)) != 0,
+			enemies,
+			occupied & ~squareBit(square)
+		);
+	}
+	if (!moves.empty())
+	{
+		return;
+	}
+
+	const int forward = m_sideToMove == PieceType::Light ? 0 : 2;
+	for (Bitboard pieces = own; pieces != 0; pieces &= pieces - 1)
+	{
+		const int square = lowestSquare(pieces);
+		const bool king = (m_kings & squareBit(square)) != 0;
+		for (int direction = 0; direction < 4; ++direction)
+		{
+			if (!king && direction != forward && direction != forward + 1)
+			{
+				continue;
+			}
+			int target = tables().neighbours[square][direction];
+			while (target >= 0 && (occupied & squareBit(target)) == 0)
+			{
+				EngineMove move = {};
+				move.from = static_cast<uint8_t>(square);
+				move.to = static_cast<uint8_t>(target);
+				move.path[0] = move.to;
+				move.pathLength = 1;
+				move.promotes = !king && (promotionRow & squareBit(target)) != 0;
+				moves.add(move);
+				if (!king)
+				{
+					break;
+				}
+				target = tables().neighbours[target][direction];
+			}
+		}
+	}
+}
+
+bool Position::hasCaptures() const
+{
+	const Bitboard enemies = getPieces(opponent(m_sideToMove));
+	const Bitboard occupied = getOccupied();
+	for (Bitboard pieces = getPieces(m_sideToMove); pieces != 0; pieces &= pieces - 1)
+	{
+		const int square = lowestSquare(pieces);
+		if (canCapture(
+			square,
+			(m_kings & squareBit(square)) != 0,
+			enemies,
+			0,
+			occupied & ~squareBit(square)))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void Position::makeMove(const EngineMove& move)
+{
+	const Bitboard fromBit = squareBit(move.from);
+	const Bitboard toBit = squareBit(move.to);
+	const bool wasKing = (m_kings & fromBit) != 0;
+	const bool isKing = wasKing || move.promotes;
+	const PieceType enemy = opponent(m_sideToMove);
+	const auto& keys = tables().keys;
+
+	Bitboard& own = m_sideToMove == PieceType::Light ? m_light : m_dark;
+	Bitboard& enemies = m_sideToMove == PieceType::Light ? m_dark : m_light;
+
+	own &= ~fromBit;
+	m_kings &= ~fromBit;
+	m_hash ^= keys[pieceKind(m_sideToMove, wasKing)][move.from];
+
+	for (Bitboard captured = move.captures; captured != 0; captured &= captured - 1)
+	{
+		const int square = lowestSquare(captured);
+		m_hash ^= keys[pieceKind(enemy, (m_kings & squareBit(square)) != 0)][square];
+	}
+	enemies &= ~move.captures;
+	m_kings &= ~move.captures;
+
+	own |= toBit;
+	if (isKing)
+	{
+		m_kings |= toBit;
+	}
+	m_hash ^= keys[pieceKind(m_sideToMove, isKing)][move.to];
+
+	m_sideToMove = enemy;
+	m_hash ^= tables().sideKey;
+}
+
+std::string Position::formatMove(const EngineMove& move)
+{
+	return std::to_string(move.from + 1)
+		+ (move.isCapture() ? "x" : "-")
+		+ std::to_string(move.to + 1);
+}
+
+int Position::squareFromCoords(const glm::ivec2& coords)
+{
+	if (coords.x < 0 || coords.x >= boardSize || coords.y < 0 || coords.y >= boardSize)
+	{
+		return -1;
+	}
+	if ((coords.x + coords.y) % 2 == 0)
+	{
+		return -1;
+	}
+	return coords.x * 5 + coords.y / 2;
+}
+
+glm::ivec2 Position::coordsFromSquare(int square)
+{
+	const int z = square / 5;
+	const int x = (square % 5) * 2 + (z % 2 == 0 ? 1 : 0);
+	return {z, x};
+}
+
+int Position::neighbour(int square, int direction)
+{
+	return tables().neighbours[square][direction];
+}
+
+void Position::setPiece(int square, PieceType type, bool king)
+{
+	clearSquare(square);
+	const Bitboard bit = squareBit(square);
+	if (type == PieceType::Light)
+	{
+		m_light |= bit;
+	}
+	else
+	{
+		m_dark |= bit;
+	}
+	if (king)
+	{
+		m_kings |= bit;
+	}
+	m_hash ^= tables().keys[pieceKind(type, king)][square];
+}
+
+void Position::clearSquare(int square)
+{
+	const Bitboard bit = squareBit(square);
+	if ((getOccupied() & bit) == 0)
+	{
+		return;
+	}
+	const PieceType type = (m_light & bit) != 0 ? PieceType::Light : PieceType::Dark;
+	m_hash ^= tables().keys[pieceKind(type, (m_kings & bit) != 0)][square];
+	m_light &= ~bit;
+	m_dark &= ~bit;
+	m_kings &= ~bit;
+}
+
+void Position::setSideToMove(PieceType side)
+{
+	if (side != m_sideToMove)
+	{
+		m_hash ^= tables().sideKey;
+	}
+	m_sideToMove = side;
+}
+
+void Position::generateCaptures(
+	MoveList& moves,
+	EngineMove& move,
+	int square,
+	bool king,
+	Bitboard enemies,
+	Bitboard occupied
+) const
+{
+	bool continued = false;
+	for (int direction = 0; direction < 4; ++direction)
+	{
+		int target = tables().neighbours[square][direction];
+		if (king)
+		{
+			while (target >= 0 && (occupied & squareBit(target)) == 0)
+			{
+				target = tables().neighbours[target][direction];
+			}
+		}
+		if (target < 0
+			|| (enemies & squareBit(target)) == 0
+			|| (move.captures & squareBit(target)) != 0)
+		{
+			continue;
+		}
+		const int landing = tables().neighbours[target][direction];
+		if (landing < 0 || (occupied & squareBit(landing)) != 0)
+		{
+			continue;
+		}
+
+		continued = true;
+		const EngineMove saved = move;
+		const bool promotes = !king && (tables().promotionRow[m_sideToMove] & squareBit(landing)) != 0;
+		move.captures |= squareBit(target);
+		move.to = static_cast<uint8_t>(landing);
+		move.promotes = move.promotes || promotes;
+		if (move.pathLength < EngineMove::maxPathLength)
+		{
+			move.path[move.pathLength++] = move.to;
+		}
+		generateCaptures(moves, move, landing, king || promotes, enemies, occupied);
+		move = saved;
+	}
+
+	if (!continued && move.isCapture())
+	{
+		for (const auto& existing : moves)
+		{
+			if (existing == move)
+			{
+				return;
+			}
+		}
+		moves.add(move);
+	}
+}
+
+bool Position::canCapture(
+	int square,
+	bool king,
+	Bitboard enemies,
+	Bitboard captured,
+	Bitboard occupied
+) const
+{
+	for (int direction = 0; direction < 4; ++direction)
+	{
+		int target = tables().neighbours[square][direction];
+		if (king)
+		{
+			while (target >= 0 && (occupied & squareBit(target)) == 0)
+			{
+				target = tables().neighbours[target][direction];
+			}
+		}
+		if (target < 0
+			|| (enemies & squareBit(target)) == 0
+			|| (captured & squareBit(target)) != 0)
+		{
+			continue;
+		}
+		const int landing = tables().neighbours[target][direction];
+		if (landing >= 0 && (occupied & squareBit(landing)) == 0)
+		{
+			return true;
+		}
+	}
+	return false;
+}
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <glm/glm.hpp>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "PieceTypes.h"
+
+// One bit per playable (dark) tile. Squares are numbered 0..49 in reading order,
+// square = z * 5 + x / 2, which is the standard draughts numbering minus one.
+using Bitboard = uint64_t;
+
+inline int popCount(Bitboard bitboard)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+	return static_cast<int>(__popcnt64(bitboard));
+#elif defined(__GNUC__)
+	return __builtin_popcountll(bitboard);
+#else
+	int count = 0;
+	while (bitboard != 0)
+	{
+		bitboard &= bitboard - 1;
+		++count;
+	}
+	return count;
+#endif
+}
+
+inline int lowestSquare(Bitboard bitboard)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+	unsigned long index;
+	_BitScanForward64(&index, bitboard);
+	return static_cast<int>(index);
+#elif defined(__GNUC__)
+	return __builtin_ctzll(bitboard);
+#else
+	int index = 0;
+	while ((bitboard & 1ull) == 0)
+	{
+		bitboard >>= 1;
+		++index;
+	}
+	return index;
+#endif
+}
+
+inline Bitboard squareBit(int square)
+{
+	return 1ull << square;
+}
+
+struct EngineMove
+{
+	static constexpr int maxPathLength = 20;
+
+	uint8_t from = 0;
+	uint8_t to = 0;
+	uint8_t pathLength = 0;
+	bool promotes = false;
+	Bitboard captures = 0;
+	// Landing square of every jump, the last one equals `to`.
+	uint8_t path[maxPathLength] = {};
+
+	bool isCapture() const { return captures != 0; }
+
+	bool operator==(const EngineMove& other) const;
+	bool operator!=(const EngineMove& other) const;
+};
+
+struct MoveList
+{
+	static constexpr int capacity = 128;
+
+	EngineMove moves[capacity];
+	int count = 0;
+
+	void add(const EngineMove& move)
+	{
+		if (count < capacity)
+			moves[count++] = move;
+	}
+
+	EngineMove* begin() { return moves; }
+	EngineMove* end() { return moves + count; }
+	const EngineMove* begin() const { return moves; }
+	const EngineMove* end() const { return moves + count; }
+	bool empty() const { return count == 0; }
+};
+
+// Compact game position used by the engine and its tools. Move generation
+// follows the rules implemented by ManPiece/KingPiece, so the engine never
+// suggests a move the game would refuse.
+class Position
+{
+public:
+	static constexpr int squareCount = 50;
+	static constexpr int boardSize = 10;
+
+public:
+	Position() = default;
+
+	static Position initial();
+
+	// PDN FEN, e.g. "W:W31-35,K45:B1,2,3". Light plays White. Fails on
+	// anything malformed and on squares given twice.
+	static bool fromFen(const std::string& fen, Position& position);
+	std::string toFen() const;
+
+public:
+	void generateMoves(MoveList& moves) const;
+	bool hasCaptures() const;
+	void makeMove(const EngineMove& move);
+
+	// "32-28" for quiet moves, "19x30" for captures.
+	static std::string formatMove(const EngineMove& move);
+
+public:
+	static int squareFromCoords(const glm::ivec2& coords);
+	static glm::ivec2 coordsFromSquare(int square);
+	static int neighbour(int square, int direction);
+
+public:
+	Bitboard getPieces(PieceType type) const { return type == PieceType::Light ? m_light : m_dark; }
+	Bitboard getKings() const { return m_kings; }
+	Bitboard getOccupied() const { return m_light | m_dark; }
+
+	PieceType getSideToMove() const { return m_sideToMove; }
+	uint64_t getHash() const { return m_hash; }
+
+	void setPiece(int square, PieceType type, bool king);
+	void clearSquare(int square);
+	void setSideToMove(PieceType side);
+
+private:
+	void generateCaptures(
+		MoveList& moves,
+		EngineMove& move,
+		int square,
+		bool king,
+		Bitboard enemies,
+		Bitboard occupied
+	) const;
+	bool canCapture(int square, bool king, Bitboard enemies, Bitboard captured, Bitboard occupied) const;
+
+private:
+	Bitboard m_light = 0;
+	Bitboard m_dark = 0;
+	Bitboard m_kings = 0;
+	PieceType m_sideToMove = PieceType::Light;
+	uint64_t m_hash = 0;
+};
@@ -1,28 +1,100 @@
-#pragma once
-
-#include <glm/glm.hpp>
-
-struct Vertex
-{
-	glm::vec3 position;
-	glm::vec3 normal;
-	glm::vec3 color;
-};
-
-struct Triangle
-{
-	Vertex v1, v2, v3;
-};
-
-struct Transform
-{
-	glm::vec3 position = {0.0f, 0.0f, 0.0f};
-	glm::vec3 rotation = {0.0f, 0.0f, 0.0f};
-	glm::vec3 scale = {1.0f, 1.0f, 1.0f};
-};
-
-struct LightSource
-{
-	glm::vec3 direction;
-	float intensity;
-};
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+struct Vertex
+{
+	glm::vec3 position;
+	glm::vec3 normal;
+	glm::vec3 color;
+};
+
+struct Triangle
+{
+	Vertex v1, v2, v3;
+};
+
+// Box and sphere around the vertices of a mesh in its own space. The sphere is
+// centred on the box and as small as that allows.
+struct Bounds
+{
+	glm::vec3 min = glm::vec3(0.0f);
+	glm::vec3 max = glm::vec3(0.0f);
+	glm::vec3 center = glm::vec3(0.0f);
+	float radius = 0.0f;
+};
+
+// Indexed triangle list compiled into the program as constant data, see
+// BakedMeshes.h.
+struct BakedMesh
+{
+	const Vertex* vertices;
+	uint32_t vertexCount;
+	const uint16_t* indices;
+	uint32_t indexCount;
+	Bounds bounds;
+};
+
+struct MeshHandle
+{
+	unsigned int vertexBuffer = 0;
+	unsigned int indexBuffer = 0;
+	int indexCount = 0;
+};
+
+// Indexed triangle list kept on the CPU side, the handle refers to its copy in
+// GPU memory once the mesh has been uploaded by the Renderer. Baked meshes read
+// their vertices and indices from constant data instead of the vectors, the
+// getters cover both.
+//
+// Meshes may chain to a coarser version of themselves, the Renderer draws that
+// one for instances covering less than lowerDetailBelow pixels of screen
+// radius.
+struct Mesh
+{
+	std::vector<Vertex> vertices;
+	std::vector<uint16_t> indices;
+	Bounds bounds;
+	MeshHandle handle;
+
+	const Mesh* lowerDetail = nullptr;
+	float lowerDetailBelow = 0.0f;
+
+	const BakedMesh* baked = nullptr;
+
+	const Vertex* getVertices() const { return baked != nullptr ? baked->vertices : vertices.data(); }
+	size_t getVertexCount() const { return baked != nullptr ? baked->vertexCount : vertices.size(); }
+	const uint16_t* getIndices() const { return baked != nullptr ? baked->indices : indices.data(); }
+	size_t getIndexCount() const { return baked != nullptr ? baked->indexCount : indices.size(); }
+};
+
+// Per instance attributes of an instanced draw.
+struct Instance
+{
+	glm::mat4 model;
+	float paletteIndex;
+};
+
+// Cost of one frame as submitted by the Renderer. Commands are the recorded
+// draw calls, draw calls the batches executed after sorting. State changes are
+// counted by the backend, whenever a batch needs other buffers or attribute
+// setup than the one before; backends without such state report none. Culled
+// instances were outside the camera frustum and never reached a batch.
+struct RenderStats
+{
+	int commands = 0;
+	int drawCalls = 0;
+	int stateChanges = 0;
+	int instances = 0;
+	int culledInstances = 0;
+	uint64_t triangles = 0;
+};
+
+struct LightSource
+{
+	glm::vec3 direction;
+	float intensity;
+};
@@ -1,142 +1,241 @@
-#include "Renderer.h"
-
-#include <sdl/SDL_opengl.h>
-#include <glm/gtc/type_ptr.hpp>
-
-Renderer::Renderer(const Window* const window)
-{
-	m_glContext = window->createContext();
-	glEnable(GL_DEPTH_TEST);
-}
-
-Renderer::~Renderer()
-{
-	SDL_GL_DeleteContext(m_glContext);
-}
-
-void Renderer::beginFrame(const Camera* const camera) const
-{
-	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
-	glMatrixMode(GL_PROJECTION);
-	glLoadIdentity();
-	glLoadMatrixf(glm::value_ptr(camera->getProj()));
-
-	glMatrixMode(GL_MODELVIEW);
-	glLoadIdentity();
-	glLoadMatrixf(glm::value_ptr(camera->getModelView()));
-}
-
-void Renderer::drawTriangles(
-	const std::vector<Triangle>& triangles,
-	const Transform& transform
-) const
-{
-	glm::mat4 model = glm::mat4(1.0f);
-	model = glm::translate(model, transform.position);
-	model = glm::rotate(
-		model,
-		glm::radians(transform.rotation.x),
-		{1.0f, 0.0f, 0.0f}
-	);
-	model = glm::rotate(
-		model,
-		glm::radians(transform.rotation.y),
-		{0.0f, 1.0f, 0.0f}
-	);
-	model = glm::rotate(
-		model,
-		glm::radians(transform.rotation.z),
-		{0.0f, 0.0f, 1.0f}
-	);
-	model = glm::scale(model, transform.scale);
-
-	glm::mat4 normal = glm::mat4(1.0f);
-	normal = glm::rotate(
-		normal,
-		glm::radians(transform.rotation.x),
-		{1.0f, 0.0f, 0.0f}
-	);
-	normal = glm::rotate(
-		normal,
-		glm::radians(transform.rotation.y),
-		{0.0f, 1.0f, 0.0f}
-	);
-	normal = glm::rotate(
-		normal,
-		glm::radians(transform.rotation.z),
-		{0.0f, 0.0f, 1.0f}
-	);
-
-	for (const auto& triangle : triangles)
-	{
-		drawTriangle(triangle, model, normal);
-	}
-}
-
-void Renderer::drawTriangle(
-	const Triangle& triangle,
-	const glm::mat4& modelMat,
-	const glm::mat4& normalMat
-) const
-{
-	glBegin(GL_TRIANGLES);
-
-	drawVertex(triangle.v1, modelMat, normalMat);
-	drawVertex(triangle.v2, modelMat, normalMat);
-	drawVertex(triangle.v3, modelMat, normalMat);
-
-	glEnd();
-}
-
-void Renderer::drawVertex(
-	const Vertex& vertex,
-	const glm::mat4& modelMat,
-	const glm::mat4& normalMat
-) const
-{
-	glm::vec4 position = {
-		vertex.position.x,
-		vertex.position.y,
-		vertex.position.z,
-		1.0f
-	};
-	glm::vec4 normal = {
-		vertex.normal.x,
-		vertex.normal.y,
-		vertex.normal.z,
-		1.0f
-	};
-	position = modelMat * position;
-	normal = normalMat * normal;
-
-	const glm::vec3 normalized = glm::normalize(glm::vec3(normal.x, normal.y, normal.z));
-	const float dot = glm::dot(normalized, -m_lightSource.direction);
-	const float intensity = glm::max(0.0f, dot) * m_lightSource.intensity;
-	glm::vec3 multi = {intensity, intensity, intensity};
-	multi.x = glm::clamp(multi.x + m_ambientLight.x, 0.0f, 1.0f);
-	multi.y = glm::clamp(multi.y + m_ambientLight.y, 0.0f, 1.0f);
-	multi.z = glm::clamp(multi.z + m_ambientLight.z, 0.0f, 1.0f);
-	const glm::vec3 color = vertex.color * multi;
-
-	glColor3f(color.r, color.g, color.b);
-	glVertex3f(position.x, position.y, position.z);
-}
-
-void Renderer::setClearColor(const glm::vec3 clearColor)
-{
-	m_clearColor = clearColor;
-	glClearColor(
-		m_clearColor.r,
-		m_clearColor.g,
-		m_clearColor.b,
-		1.0f
-	);
-}
-
-void Renderer::setLightSource(const LightSource& lightSource)
-{
-	m_lightSource = lightSource;
-	m_lightSource.direction = glm::normalize(m_lightSource.direction);
-	m_lightSource.intensity = glm::clamp(m_lightSource.intensity, 0.0f, 1.0f);
-}
+#include "Renderer.h"
+
+#include <algorithm>
+
+namespace
+{
+	// Depth below which instances count as touching the camera.
+	constexpr float minDetailDepth = 0.001f;
+
+	// The sphere grows with the longest axis of the model matrix.
+	void getWorldSphere(const Bounds& bounds, const glm::mat4& model, glm::vec3& center, float& radius)
+	{
+		center = glm::vec3(model * glm::vec4(bounds.center, 1.0f));
+		const float scale = glm::sqrt(glm::max(
+			glm::max(glm::dot(glm::vec3(model[0]), glm::vec3(model[0])), glm::dot(glm::vec3(model[1]), glm::vec3(model[1]))),
+			glm::dot(glm::vec3(model[2]), glm::vec3(model[2]))
+		));
+		radius = bounds.radius * scale;
+	}
+}
+
+Renderer::Renderer()
+	: m_assets(*this)
+{
+	for (Frame& frame : m_frames)
+	{
+		frame.commands.reserve(256);
+		frame.instances.reserve(1024);
+		frame.groups.reserve(MeshAssetCount * 2);
+	}
+	m_batchInstances.reserve(1024);
+	m_instanceDetails.reserve(1024);
+	m_localInstances.reserve(256);
+}
+
+void Renderer::beginFrame(const Camera* const camera) const
+{
+	Frame& frame = m_frames[m_recordingFrame];
+	frame.commands.clear();
+	frame.instances.clear();
+	frame.groups.clear();
+	frame.scene = {*camera, m_clearColor, m_lightSource, m_ambientLight};
+	frame.frustum = camera->getFrustum();
+	frame.culledInstances = 0;
+
+	// Clip space w is the view depth, a sphere of radius 1 at depth 1 covers
+	// pixelsPerUnit pixels of screen radius.
+	frame.depthRow = glm::transpose(camera->getViewProj())[3];
+	frame.pixelsPerUnit = camera->getProj()[1][1] * static_cast<float>(camera->getViewportDimensions().y) * 0.5f;
+}
+
+void Renderer::endFrame() const
+{
+	publishFrame();
+	submitFrame();
+}
+
+void Renderer::publishFrame() const
+{
+	std::unique_lock<std::mutex> lock(m_frameMutex);
+	m_frameCondition.wait(lock, [this]() { return !m_isFramePublished || m_isSubmitStopped; });
+	std::swap(m_recordingFrame, m_publishedFrame);
+	m_isFramePublished = true;
+	m_frameCondition.notify_all();
+}
+
+bool Renderer::submitFrame() const
+{
+	{
+		std::unique_lock<std::mutex> lock(m_frameMutex);
+		m_frameCondition.wait(lock, [this]() { return m_isFramePublished || m_isSubmitStopped; });
+		if (m_isSubmitStopped)
+		{
+			return false;
+		}
+		std::swap(m_submittingFrame, m_publishedFrame);
+		m_isFramePublished = false;
+		m_frameCondition.notify_all();
+	}
+	submit(m_frames[m_submittingFrame]);
+	return true;
+}
+
+void Renderer::stopSubmitting() const
+{
+	std::lock_guard<std::mutex> lock(m_frameMutex);
+	m_isSubmitStopped = true;
+	m_frameCondition.notify_all();
+}
+
+RenderStats Renderer::getFrameStats() const
+{
+	std::lock_guard<std::mutex> lock(m_frameMutex);
+	return m_frameStats;
+}
+
+void Renderer::submit(Frame& frame) const
+{
+	RenderStats stats;
+	stats.commands = static_cast<int>(frame.commands.size());
+	stats.culledInstances = frame.culledInstances;
+	m_stateChanges = 0;
+
+	onBeginFrame(frame.scene);
+
+	// Groups follow the first use of each mesh, which keeps the submission
+	// order independent of where meshes live in memory.
+	std::sort(frame.commands.begin(), frame.commands.end(), [](const DrawCommand& a, const DrawCommand& b)
+	{
+		return a.group != b.group ? a.group < b.group : a.order < b.order;
+	});
+
+	for (size_t first = 0; first < frame.commands.size();)
+	{
+		const Mesh& mesh = *frame.commands[first].mesh;
+		m_batchInstances.clear();
+		size_t last = first;
+		for (; last < frame.commands.size() && frame.commands[last].mesh == &mesh; ++last)
+		{
+			const auto begin = frame.instances.begin() + frame.commands[last].firstInstance;
+			m_batchInstances.insert(m_batchInstances.end(), begin, begin + frame.commands[last].instanceCount);
+		}
+		first = last;
+
+		const int count = static_cast<int>(m_batchInstances.size());
+		drawBatch(mesh, m_batchInstances.data(), count);
+		++stats.drawCalls;
+		stats.instances += count;
+		stats.triangles += static_cast<uint64_t>(mesh.handle.indexCount / 3) * count;
+	}
+
+	onEndFrame();
+	stats.stateChanges = m_stateChanges;
+
+	std::lock_guard<std::mutex> lock(m_frameMutex);
+	m_frameStats = stats;
+}
+
+void Renderer::drawMesh(const Mesh& mesh, const Transform& transform, int paletteIndex) const
+{
+	const Instance instance = {transform.getModelMatrix(), static_cast<float>(paletteIndex)};
+	record(mesh, &instance, 1, nullptr);
+}
+
+void Renderer::drawMeshInstanced(const Mesh& mesh, const std::vector<Instance>& instances) const
+{
+	record(mesh, instances.data(), instances.size(), nullptr);
+}
+
+void Renderer::drawMeshInstanced(const Mesh& mesh, const std::vector<Instance>& instances, const glm::mat4& local) const
+{
+	record(mesh, instances.data(), instances.size(), &local);
+}
+
+void Renderer::record(const Mesh& mesh, const Instance* instances, size_t count, const glm::mat4* local) const
+{
+	if (count == 0 || mesh.handle.indexCount == 0)
+	{
+		return;
+	}
+
+	// Culling and the recorded copy both need the final model matrices.
+	if (local != nullptr)
+	{
+		m_localInstances.resize(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			m_localInstances[i] = {instances[i].model * *local, instances[i].paletteIndex};
+		}
+		instances = m_localInstances.data();
+	}
+
+	// Visible instances pick the coarsest level of detail that still covers
+	// enough of the screen, culled ones none.
+	Frame& frame = m_frames[m_recordingFrame];
+	m_instanceDetails.resize(count);
+	for (size_t i = 0; i < count; ++i)
+	{
+		glm::vec3 center;
+		float radius;
+		getWorldSphere(mesh.bounds, instances[i].model, center, radius);
+		if (!frame.frustum.intersectsSphere(center, radius))
+		{
+			m_instanceDetails[i] = nullptr;
+			++frame.culledInstances;
+			continue;
+		}
+
+		const float depth = glm::max(glm::dot(frame.depthRow, glm::vec4(center, 1.0f)), minDetailDepth);
+		const float screenRadius = radius * frame.pixelsPerUnit / depth;
+		const Mesh* detail = &mesh;
+		while (detail->lowerDetail != nullptr && screenRadius < detail->lowerDetailBelow)
+		{
+			detail = detail->lowerDetail;
+		}
+		m_instanceDetails[i] = detail;
+	}
+
+	for (const Mesh* detail = &mesh; detail != nullptr; detail = detail->lowerDetail)
+	{
+		const size_t firstInstance = frame.instances.size();
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (m_instanceDetails[i] == detail)
+			{
+				frame.instances.push_back(instances[i]);
+			}
+		}
+		addCommand(frame, *detail, firstInstance);
+	}
+}
+
+void Renderer::addCommand(Frame& frame, const Mesh& mesh, size_t firstInstance) const
+{
+	const size_t instanceCount = frame.instances.size() - firstInstance;
+	if (instanceCount == 0)
+	{
+		return;
+	}
+
+	const size_t group = std::find(frame.groups.begin(), frame.groups.end(), &mesh) - frame.groups.begin();
+	if (group == frame.groups.size())
+	{
+		frame.groups.push_back(&mesh);
+	}
+
+	frame.commands.push_back({
+		&mesh,
+		static_cast<uint32_t>(firstInstance),
+		static_cast<uint32_t>(instanceCount),
+		static_cast<uint32_t>(group),
+		static_cast<uint32_t>(frame.commands.size())
+	});
+}
+
+void Renderer::setLightSource(const LightSource& lightSource)
+{
+	m_lightSource = lightSource;
+	m_lightSource.direction = glm::normalize(m_lightSource.direction);
+	m_lightSource.intensity = glm::clamp(m_lightSource.intensity, 0.0f, 1.0f);
+}
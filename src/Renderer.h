@@ -1,55 +1,155 @@
-#pragma once
-
-#include <vector>
-
-#include <glm/glm.hpp>
-
-#include "Window.h"
-#include "Camera.h"
-#include "RenderTypes.h"
-#include "MeshPrototypes.h"
-
-class Renderer
-{
-public:
-	explicit Renderer(const Window* const window);
-	~Renderer();
-
-public:
-	void beginFrame(const Camera* const camera) const;
-
-	void drawTriangles(
-		const std::vector<Triangle>& triangles,
-		const Transform& transform = {}
-	) const;
-	void drawTriangle(
-		const Triangle& triangle,
-		const glm::mat4& modelMat = glm::mat4(1.0f),
-		const glm::mat4& normalMat = glm::mat4(1.0f)
-	) const;
-	void drawVertex(
-		const Vertex& vertex,
-		const glm::mat4& modelMat = glm::mat4(1.0f),
-		const glm::mat4& normalMat = glm::mat4(1.0f)
-	) const;
-
-public:
-	void setClearColor(const glm::vec3 clearColor);
-
-	const LightSource& getLightSource() const { return m_lightSource; }
-	void setLightSource(const LightSource& lightSource);
-
-	const glm::vec3& getAmbientLight() const { return m_ambientLight; }
-	void setAmbientLight(const glm::vec3& ambientLight) { m_ambientLight = ambientLight; }
-
-	const MeshPrototypes& getMeshPrototypes() const { return m_prototypes; }
-
-private:
-	SDL_GLContext m_glContext;
-
-	glm::vec3 m_clearColor = {0.0f, 0.0f, 0.0f};
-	LightSource m_lightSource = {{0.0f, -1.0f, 0.0f}, 1.0f};
-	glm::vec3 m_ambientLight = {0.0f, 0.0f, 0.0f};
-
-	MeshPrototypes m_prototypes;
-};
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Camera.h"
+#include "RenderTypes.h"
+#include "Transform.h"
+#include "AssetRegistry.h"
+
+// Camera and lighting as they were when a frame was recorded.
+struct SceneState
+{
+	Camera camera;
+	glm::vec3 clearColor;
+	LightSource lightSource;
+	glm::vec3 ambientLight;
+};
+
+// Interface of the rendering backends. Scene state such as lighting is kept
+// here, backends decide how meshes are stored and drawn.
+//
+// Draw calls only record commands, instances whose bounding sphere lies
+// outside the camera frustum are dropped right away. The others use the
+// coarsest level of detail of their mesh that suits their size on screen.
+// Submitting a frame sorts the commands by mesh, merges all instances of a
+// mesh into one batch and hands the batches to the backend in a single pass.
+//
+// Recorded frames are snapshots, so another thread may submit one while the
+// next is recorded. Three frames rotate between the two threads: one being
+// recorded, one published and one being submitted.
+class Renderer
+{
+public:
+	Renderer();
+	virtual ~Renderer() = default;
+
+	Renderer(const Renderer&) = delete;
+	Renderer& operator=(const Renderer&) = delete;
+
+public:
+	void beginFrame(const Camera* const camera) const;
+
+	// Publishes the recorded frame and submits it on the calling thread.
+	void endFrame() const;
+
+	// Publishes the recorded frame for submitFrame(). Waits while the frame
+	// published before is not taken yet, recording stays one frame ahead of
+	// submitting at most.
+	void publishFrame() const;
+
+	// Waits for a published frame and submits it. Returns false without
+	// submitting once stopSubmitting() was called.
+	bool submitFrame() const;
+	void stopSubmitting() const;
+
+	// Meshes and instances must stay alive until endFrame().
+	void drawMesh(const Mesh& mesh, const Transform& transform = {}, int paletteIndex = 0) const;
+	void drawMeshInstanced(const Mesh& mesh, const std::vector<Instance>& instances) const;
+	// Every instance model is multiplied by local on the right while recording,
+	// so a transform shared by all instances leaves them untouched.
+	void drawMeshInstanced(const Mesh& mesh, const std::vector<Instance>& instances, const glm::mat4& local) const;
+
+	virtual void uploadMesh(Mesh& mesh) const = 0;
+	virtual void releaseMesh(Mesh& mesh) const = 0;
+
+	// Colours instances pick by palette index.
+	virtual void setPalette(const glm::vec3* colors, int count) const = 0;
+
+	// Counters of the last submitted frame.
+	RenderStats getFrameStats() const;
+
+protected:
+	virtual void onBeginFrame(const SceneState& scene) const = 0;
+	virtual void drawBatch(const Mesh& mesh, const Instance* instances, int count) const = 0;
+	virtual void onEndFrame() const {}
+
+	// Called by backends for every state change a batch needs, see RenderStats.
+	void countStateChange() const { ++m_stateChanges; }
+
+public:
+	const glm::vec3& getClearColor() const { return m_clearColor; }
+	void setClearColor(const glm::vec3& clearColor) { m_clearColor = clearColor; }
+
+	const LightSource& getLightSource() const { return m_lightSource; }
+	void setLightSource(const LightSource& lightSource);
+
+	const glm::vec3& getAmbientLight() const { return m_ambientLight; }
+	void setAmbientLight(const glm::vec3& ambientLight) { m_ambientLight = ambientLight; }
+
+	const AssetRegistry& getAssets() const { return m_assets; }
+
+protected:
+	glm::vec3 m_clearColor = {0.0f, 0.0f, 0.0f};
+	LightSource m_lightSource = {{0.0f, -1.0f, 0.0f}, 1.0f};
+	glm::vec3 m_ambientLight = {0.0f, 0.0f, 0.0f};
+
+	// Backends release it in their destructor, releasing meshes needs them.
+	AssetRegistry m_assets;
+
+private:
+	struct DrawCommand
+	{
+		const Mesh* mesh;
+		uint32_t firstInstance;
+		uint32_t instanceCount;
+		// Order of the first command with the same mesh, then of the command.
+		uint32_t group;
+		uint32_t order;
+	};
+
+	struct Frame
+	{
+		SceneState scene;
+		Frustum frustum;
+		int culledInstances;
+		glm::vec4 depthRow;
+		float pixelsPerUnit;
+		std::vector<DrawCommand> commands;
+		std::vector<Instance> instances;
+		std::vector<const Mesh*> groups;
+	};
+
+	void record(const Mesh& mesh, const Instance* instances, size_t count, const glm::mat4* local) const;
+	// Turns the instances appended since firstInstance into one command.
+	void addCommand(Frame& frame, const Mesh& mesh, size_t firstInstance) const;
+	void submit(Frame& frame) const;
+
+private:
+	// Reused every frame, so steady frames do not allocate.
+	mutable std::array<Frame, 3> m_frames;
+	mutable std::vector<Instance> m_batchInstances;
+	// Level of detail per instance of the command being recorded.
+	mutable std::vector<const Mesh*> m_instanceDetails;
+	// Instances of the command being recorded with its local transform applied.
+	mutable std::vector<Instance> m_localInstances;
+
+	// Owned by the recording thread, by nobody and by the submitting thread.
+	mutable int m_recordingFrame = 0;
+	mutable int m_publishedFrame = 1;
+	mutable int m_submittingFrame = 2;
+
+	mutable std::mutex m_frameMutex;
+	mutable std::condition_variable m_frameCondition;
+	mutable bool m_isFramePublished = false;
+	mutable bool m_isSubmitStopped = false;
+
+	mutable RenderStats m_frameStats;
+	// Of the frame being submitted.
+	mutable int m_stateChanges = 0;
+};
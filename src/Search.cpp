@@ -0,0 +1,512 @@
+#include "Search.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+Search::Search(size_t tableMegabytes)
+	: m_table(tableMegabytes)
+{
+}
+
+SearchInfo Search::run(const Position& root, const SearchLimits& limits, const SearchCallback& onIteration)
+{
+	m_limitReached = false;
+	m_limits = limits;
+	m_start = std::chrono::steady_clock::now();
+	if (limits.timeMs > 0)
+	{
+		setTimeLimit(limits.timeMs);
+	}
+	m_nodes = 0;
+	for (auto& killers : m_killers)
+	{
+		killers[0] = {};
+		killers[1] = {};
+	}
+	for (auto& row : m_history)
+	{
+		for (auto& value : row)
+		{
+			value /= 8;
+		}
+	}
+
+	SearchInfo result;
+	MoveList rootMoves;
+	root.generateMoves(rootMoves);
+	if (rootMoves.empty())
+	{
+		return result;
+	}
+
+	const int lineCount = std::max(1, std::min(limits.multiPv, rootMoves.count));
+	const int maxDepth = std::max(1, std::min(limits.depth, maxPly - 1));
+	for (int depth = 1; depth <= maxDepth; ++depth)
+	{
+		// Cutoffs of earlier iterations count less.
+		for (auto& row : m_history)
+		{
+			for (auto& value : row)
+			{
+				value /= 2;
+			}
+		}
+
+		SearchInfo info;
+		info.depth = depth;
+		bool excluded[MoveList::capacity] = {};
+		for (int k = 0; k < lineCount; ++k)
+		{
+			// Every further line scores at most as much as the one before, so
+			// it is searched just below that score and only widened when the
+			// result falls outside.
+			int alpha = -infinity;
+			int beta = infinity;
+			if (k > 0)
+			{
+				beta = info.lines.back().score + 1;
+				alpha = std::max(-infinity, beta - 1 - multiPvWindow);
+			}
+
+			SearchLine line;
+			int index = searchRoot(root, depth, rootMoves, excluded, alpha, beta, line);
+			while (index >= 0 && !isStopped() && (line.score <= alpha || line.score >= beta))
+			{
+				if (line.score <= alpha)
+				{
+					alpha = -infinity;
+				}
+				else
+				{
+					beta = infinity;
+				}
+				line = {};
+				index = searchRoot(root, depth, rootMoves, excluded, alpha, beta, line);
+			}
+			if (index < 0 || (isStopped() && depth > 1))
+			{
+				break;
+			}
+			excluded[index] = true;
+			info.lines.push_back(std::move(line));
+		}
+		if (info.lines.empty() || (isStopped() && depth > 1))
+		{
+			break;
+		}
+
+		// Search the reported lines first at the next depth.
+		for (int k = static_cast<int>(info.lines.size()) - 1; k >= 0; --k)
+		{
+			const auto found = std::find(rootMoves.begin(), rootMoves.end(), info.lines[k].move);
+			std::rotate(rootMoves.begin(), found, found + 1);
+		}
+
+		info.nodes = m_nodes;
+		info.elapsedMs = elapsedMs();
+		info.nodesPerSecond = m_nodes * 1000 / static_cast<uint64_t>(std::max(1, info.elapsedMs));
+		result = std::move(info);
+		if (onIteration)
+		{
+			onIteration(result);
+		}
+
+		if (isStopped()
+			|| (rootMoves.count == 1 && lineCount == 1)
+			|| isTimeUsed(0.5))
+		{
+			break;
+		}
+	}
+	return result;
+}
+
+bool Search::isMateScore(int score)
+{
+	return std::abs(score) >= mateScore - maxPly;
+}
+
+std::string Search::formatScore(int score)
+{
+	char buffer[32];
+	if (isMateScore(score))
+	{
+		std::snprintf(buffer, sizeof(buffer), "%cM%d", score > 0 ? '+' : '-', mateScore - std::abs(score));
+	}
+	else
+	{
+		std::snprintf(buffer, sizeof(buffer), "%+.2f", static_cast<double>(score) / 100.0);
+	}
+	return buffer;
+}
+
+std::string Search::formatLine(const SearchLine& line)
+{
+	std::string text;
+	for (const auto& move : line.pv)
+	{
+		if (!text.empty())
+		{
+			text += ' ';
+		}
+		text += Position::formatMove(move);
+	}
+	return text;
+}
+
+int Search::searchRoot(
+	const Position& root,
+	int depth,
+	const MoveList& rootMoves,
+	const bool* excluded,
+	int alpha,
+	int beta,
+	SearchLine& line
+)
+{
+	int bestIndex = -1;
+	for (int i = 0; i < rootMoves.count; ++i)
+	{
+		if (excluded[i])
+		{
+			continue;
+		}
+		const EngineMove& move = rootMoves.moves[i];
+		Position child = root;
+		child.makeMove(move);
+
+		int score;
+		if (bestIndex < 0)
+		{
+			score = -alphaBeta(child, depth - 1, 1, -beta, -alpha);
+		}
+		else
+		{
+			score = -alphaBeta(child, depth - 1, 1, -alpha - 1, -alpha);
+			if (score > alpha && score < beta && !isStopped())
+			{
+				score = -alphaBeta(child, depth - 1, 1, -beta, -alpha);
+			}
+		}
+		if (isStopped() && bestIndex >= 0)
+		{
+			break;
+		}
+
+		if (bestIndex < 0 || score > line.score)
+		{
+			bestIndex = i;
+			line.move = move;
+			line.score = score;
+			line.pv.assign(1, move);
+			line.pv.insert(line.pv.end(), m_pv[1] + 1, m_pv[1] + m_pvLength[1]);
+		}
+		alpha = std::max(alpha, score);
+		if (isStopped() || alpha >= beta)
+		{
+			break;
+		}
+	}
+	return bestIndex;
+}
+
+int Search::alphaBeta(const Position& position, int depth, int ply, int alpha, int beta)
+{
+	m_pvLength[ply] = ply;
+	if (checkStop())
+	{
+		return 0;
+	}
+	if (ply >= maxPly)
+	{
+		return evaluate(position);
+	}
+	if (depth <= 0)
+	{
+		return quiescence(position, ply, alpha, beta);
+	}
+	++m_nodes;
+
+	const bool pvNode = beta - alpha > 1;
+	const int originalAlpha = alpha;
+	// PV nodes only take exact scores, their line then continues with the
+	// moves stored in the table.
+	const TableEntry* entry = m_table.probe(position.getHash());
+	if (entry != nullptr && entry->depth >= depth)
+	{
+		const int score = scoreFromTable(entry->score, ply);
+		if (entry->bound == TableBound::ExactBound)
+		{
+			if (pvNode)
+			{
+				extendPvFromTable(position, ply);
+			}
+			return score;
+		}
+		if (!pvNode
+			&& ((entry->bound == TableBound::LowerBound && score >= beta)
+				|| (entry->bound == TableBound::UpperBound && score <= alpha)))
+		{
+			return score;
+		}
+	}
+
+	MoveList moves;
+	position.generateMoves(moves);
+	if (moves.empty())
+	{
+		return -mateScore + ply;
+	}
+	// Forced replies (usually captures) do not use up depth.
+	if (moves.count == 1)
+	{
+		++depth;
+	}
+	orderMoves(moves, entry, ply);
+
+	int best = -infinity;
+	const EngineMove* bestMove = nullptr;
+	for (int i = 0; i < moves.count; ++i)
+	{
+		const EngineMove& move = moves.moves[i];
+		Position child = position;
+		child.makeMove(move);
+
+		int score;
+		if (i == 0)
+		{
+			score = -alphaBeta(child, depth - 1, ply + 1, -beta, -alpha);
+		}
+		else
+		{
+			score = -alphaBeta(child, depth - 1, ply + 1, -alpha - 1, -alpha);
+			if (score > alpha && score < beta)
+			{
+				score = -alphaBeta(child, depth - 1, ply + 1, -beta, -alpha);
+			}
+		}
+		if (isStopped())
+		{
+			return 0;
+		}
+
+		if (score > best)
+		{
+			best = score;
+			bestMove = &move;
+			if (score > alpha)
+			{
+				alpha = score;
+				updatePv(ply, move);
+				if (alpha >= beta)
+				{
+					if (!move.isCapture())
+					{
+						if (m_killers[ply][0] != move)
+						{
+							m_killers[ply][1] = m_killers[ply][0];
+							m_killers[ply][0] = move;
+						}
+						int& history = m_history[move.from][move.to];
+						history = std::min(history + depth * depth, maxHistory);
+					}
+					break;
+				}
+			}
+		}
+	}
+
+	const TableBound bound = best >= beta
+		                         ? TableBound::LowerBound
+		                         : best > originalAlpha
+		                         ? TableBound::ExactBound
+		                         : TableBound::UpperBound;
+	m_table.store(position.getHash(), depth, scoreToTable(best, ply), bound, bestMove);
+	return best;
+}
+
+int Search::quiescence(const Position& position, int ply, int alpha, int beta)
+{
+	m_pvLength[ply] = ply;
+	if (checkStop())
+	{
+		return 0;
+	}
+	++m_nodes;
+	if (ply >= maxPly || !position.hasCaptures())
+	{
+		return evaluate(position);
+	}
+
+	// Captures are compulsory, so there is no stand-pat option here.
+	MoveList moves;
+	position.generateMoves(moves);
+	orderMoves(moves, nullptr, ply);
+
+	int best = -infinity;
+	for (const auto& move : moves)
+	{
+		Position child = position;
+		child.makeMove(move);
+		const int score = -quiescence(child, ply + 1, -beta, -alpha);
+		if (isStopped())
+		{
+			return 0;
+		}
+		if (score > best)
+		{
+			best = score;
+			if (score > alpha)
+			{
+				alpha = score;
+				updatePv(ply, move);
+				if (alpha >= beta)
+				{
+					break;
+				}
+			}
+		}
+	}
+	return best;
+}
+
+int Search::evaluate(const Position& position) const
+{
+	const int score = Evaluation::evaluate(position, m_weights);
+	return position.getSideToMove() == PieceType::Light ? score : -score;
+}
+
+void Search::orderMoves(MoveList& moves, const TableEntry* entry, int ply) const
+{
+	int scores[MoveList::capacity];
+	for (int i = 0; i < moves.count; ++i)
+	{
+		const EngineMove& move = moves.moves[i];
+		int score = m_history[move.from][move.to];
+		if (entry != nullptr && entry->matches(move))
+			score += 1 << 30;
+		else if (move.isCapture())
+			score += (1 << 24) + popCount(move.captures) * 1024;
+		else if (move == m_killers[ply][0])
+			score += 1 << 22;
+		else if (move == m_killers[ply][1])
+			score += 1 << 21;
+		if (move.promotes)
+			score += 1 << 20;
+		scores[i] = score;
+	}
+
+	for (int i = 1; i < moves.count; ++i)
+	{
+		const EngineMove move = moves.moves[i];
+		const int score = scores[i];
+		int j = i - 1;
+		while (j >= 0 && scores[j] < score)
+		{
+			moves.moves[j + 1] = moves.moves[j];
+			scores[j + 1] = scores[j];
+			--j;
+		}
+		moves.moves[j + 1] = move;
+		scores[j + 1] = score;
+	}
+}
+
+void Search::updatePv(int ply, const EngineMove& move)
+{
+	m_pv[ply][ply] = move;
+	for (int i = ply + 1; i < m_pvLength[ply + 1]; ++i)
+	{
+		m_pv[ply][i] = m_pv[ply + 1][i];
+	}
+	m_pvLength[ply] = std::max(ply + 1, m_pvLength[ply + 1]);
+}
+
+void Search::extendPvFromTable(const Position& position, int ply)
+{
+	Position current = position;
+	for (int i = ply; i < maxPly; ++i)
+	{
+		const TableEntry* entry = m_table.probe(current.getHash());
+		if (entry == nullptr || !entry->hasMove())
+		{
+			break;
+		}
+		MoveList moves;
+		current.generateMoves(moves);
+		const EngineMove* found = std::find_if(moves.begin(), moves.end(), [entry](const EngineMove& move)
+		{
+			return entry->matches(move);
+		});
+		if (found == moves.end())
+		{
+			break;
+		}
+		m_pv[ply][i] = *found;
+		m_pvLength[ply] = i + 1;
+		current.makeMove(*found);
+	}
+}
+
+bool Search::checkStop()
+{
+	if (isStopped())
+	{
+		return true;
+	}
+	if ((m_nodes & 1023) == 0)
+	{
+		if (isTimeUsed(1.0)
+			|| (m_limits.nodes > 0 && m_nodes >= m_limits.nodes))
+		{
+			m_limitReached = true;
+		}
+	}
+	return m_limitReached;
+}
+
+void Search::setTimeLimit(int timeMs)
+{
+	const int64_t now = std::chrono::steady_clock::now().time_since_epoch().count();
+	const int64_t budget = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+		std::chrono::milliseconds(timeMs)).count();
+	m_budgetStart = now;
+	m_deadline = now + budget;
+}
+
+bool Search::isTimeUsed(double share) const
+{
+	const int64_t deadline = m_deadline;
+	if (deadline == 0)
+	{
+		return false;
+	}
+	const int64_t start = m_budgetStart;
+	const int64_t now = std::chrono::steady_clock::now().time_since_epoch().count();
+	return static_cast<double>(now - start) >= static_cast<double>(deadline - start) * share;
+}
+
+int Search::elapsedMs() const
+{
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::steady_clock::now() - m_start).count());
+}
+
+int Search::scoreToTable(int score, int ply)
+{
+	if (score >= mateScore - maxPly)
+		return score + ply;
+	if (score <= -mateScore + maxPly)
+		return score - ply;
+	return score;
+}
+
+int Search::scoreFromTable(int score, int ply)
+{
+	if (score >= mateScore - maxPly)
+		return score - ply;
+	if (score <= -mateScore + maxPly)
+		return score + ply;
+	return score;
+}
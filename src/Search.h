@@ -0,0 +1,134 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Evaluation.h"
+#include "Position.h"
+#include "TranspositionTable.h"
+
+struct SearchLimits
+{
+	int depth = 64;
+	int multiPv = 1;
+	// Zero means no limit.
+	int timeMs = 0;
+	uint64_t nodes = 0;
+};
+
+struct SearchLine
+{
+	EngineMove move = {};
+	// Hundredths of a man from the side to move's point of view.
+	int score = 0;
+	std::vector<EngineMove> pv;
+};
+
+struct SearchInfo
+{
+	int depth = 0;
+	uint64_t nodes = 0;
+	int elapsedMs = 0;
+	uint64_t nodesPerSecond = 0;
+	// Best root moves first, at most SearchLimits::multiPv of them.
+	std::vector<SearchLine> lines;
+};
+
+using SearchCallback = std::function<void(const SearchInfo&)>;
+
+// Iterative deepening alpha-beta with a shared transposition table. In multi-PV
+// mode each depth searches the root once per line, excluding the moves already
+// reported, in a window just below the score of the line before.
+class Search
+{
+public:
+	static constexpr int maxPly = 64;
+	static constexpr int infinity = 1000000;
+	static constexpr int mateScore = 100000;
+
+public:
+	explicit Search(size_t tableMegabytes = 16);
+
+public:
+	// Clears a stop() or time limit left over from an earlier run. Threads
+	// running the search call it before they start the worker, so a stop() sent
+	// right after that is never lost; run() itself leaves a pending stop alone.
+	void prepare()
+	{
+		m_stop = false;
+		m_deadline = 0;
+	}
+	SearchInfo run(const Position& root, const SearchLimits& limits, const SearchCallback& onIteration = {});
+	void stop() { m_stop = true; }
+	// Ends the search timeMs from now, also while it is running. A ponder hit
+	// turns an infinite search into a timed one this way.
+	void setTimeLimit(int timeMs);
+	// Whether stop() was called since prepare(), as opposed to a limit ending the run.
+	bool isStopRequested() const { return m_stop; }
+	void clear() { m_table.clear(); }
+
+	static bool isMateScore(int score);
+	static std::string formatScore(int score);
+	static std::string formatLine(const SearchLine& line);
+
+public:
+	const EvalWeights& getWeights() const { return m_weights; }
+	void setWeights(const EvalWeights& weights) { m_weights = weights; }
+
+	TranspositionTable& getTable() { return m_table; }
+
+private:
+	int searchRoot(
+		const Position& root,
+		int depth,
+		const MoveList& rootMoves,
+		const bool* excluded,
+		int alpha,
+		int beta,
+		SearchLine& line
+	);
+	int alphaBeta(const Position& position, int depth, int ply, int alpha, int beta);
+	int quiescence(const Position& position, int ply, int alpha, int beta);
+	int evaluate(const Position& position) const;
+
+	void orderMoves(MoveList& moves, const TableEntry* entry, int ply) const;
+	void updatePv(int ply, const EngineMove& move);
+	void extendPvFromTable(const Position& position, int ply);
+	bool checkStop();
+	// Whether share of the time budget has passed, never without a time limit.
+	bool isTimeUsed(double share) const;
+	bool isStopped() const { return m_stop || m_limitReached; }
+	int elapsedMs() const;
+
+	static int scoreToTable(int score, int ply);
+	static int scoreFromTable(int score, int ply);
+
+private:
+	// How far below the previous line the next one is searched first.
+	static constexpr int multiPvWindow = 50;
+	// History scores stay below the killer bonus of orderMoves(), so they
+	// never overflow it however long an infinite analysis runs.
+	static constexpr int maxHistory = (1 << 20) - 1;
+
+	TranspositionTable m_table;
+	EvalWeights m_weights = EvalWeights::defaults();
+
+	std::atomic<bool> m_stop{false};
+	// Set by the search itself once the time or node limit is used up.
+	bool m_limitReached = false;
+	// Steady clock ticks, a zero deadline means no time limit.
+	std::atomic<int64_t> m_budgetStart{0};
+	std::atomic<int64_t> m_deadline{0};
+	SearchLimits m_limits = {};
+	std::chrono::steady_clock::time_point m_start;
+	uint64_t m_nodes = 0;
+
+	EngineMove m_pv[maxPly + 1][maxPly + 1] = {};
+	int m_pvLength[maxPly + 1] = {};
+	EngineMove m_killers[maxPly + 1][2] = {};
+	int m_history[Position::squareCount][Position::squareCount] = {};
+};
@@ -0,0 +1,117 @@
+#include "Shader.h"
+
+#include <sdl/SDL.h>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "GLFunctions.h"
+
+Shader::~Shader()
+{
+	release();
+}
+
+bool Shader::compile(
+	const char* vertexSource,
+	const char* fragmentSource,
+	const char* const* attributes,
+	int attributeCount
+)
+{
+	release();
+	if (GLFunctions::createProgram == nullptr)
+	{
+		return false;
+	}
+
+	const GLuint vertexShader = compileStage(GL_VERTEX_SHADER, vertexSource);
+	const GLuint fragmentShader = compileStage(GL_FRAGMENT_SHADER, fragmentSource);
+	if (vertexShader == 0 || fragmentShader == 0)
+	{
+		GLFunctions::deleteShader(vertexShader);
+		GLFunctions::deleteShader(fragmentShader);
+		return false;
+	}
+
+	const GLuint program = GLFunctions::createProgram();
+	GLFunctions::attachShader(program, vertexShader);
+	GLFunctions::attachShader(program, fragmentShader);
+	for (int i = 0; i < attributeCount; ++i)
+	{
+		GLFunctions::bindAttribLocation(program, static_cast<GLuint>(i), attributes[i]);
+	}
+	GLFunctions::linkProgram(program);
+	GLFunctions::deleteShader(vertexShader);
+	GLFunctions::deleteShader(fragmentShader);
+
+	GLint linked = GL_FALSE;
+	GLFunctions::getProgramiv(program, GL_LINK_STATUS, &linked);
+	if (linked != GL_TRUE)
+	{
+		char log[1024] = {};
+		GLFunctions::getProgramInfoLog(program, sizeof(log), nullptr, log);
+		SDL_LogError(SDL_LOG_CATEGORY_RENDER, "shader link failed: %s", log);
+		GLFunctions::deleteProgram(program);
+		return false;
+	}
+
+	m_program = program;
+	return true;
+}
+
+void Shader::release()
+{
+	if (m_program != 0)
+	{
+		GLFunctions::deleteProgram(m_program);
+		m_program = 0;
+	}
+}
+
+void Shader::bind() const
+{
+	GLFunctions::useProgram(m_program);
+}
+
+int Shader::getUniformLocation(const char* name) const
+{
+	return m_program != 0 ? GLFunctions::getUniformLocation(m_program, name) : -1;
+}
+
+void Shader::setFloat(int location, float value) const
+{
+	GLFunctions::uniform1f(location, value);
+}
+
+void Shader::setVec3(int location, const glm::vec3& value) const
+{
+	GLFunctions::uniform3fv(location, 1, glm::value_ptr(value));
+}
+
+void Shader::setMat3(int location, const glm::mat3& value) const
+{
+	GLFunctions::uniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(value));
+}
+
+void Shader::setMat4(int location, const glm::mat4& value) const
+{
+	GLFunctions::uniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(value));
+}
+
+unsigned int Shader::compileStage(unsigned int type, const char* source)
+{
+	const GLuint shader = GLFunctions::createShader(type);
+	GLFunctions::shaderSource(shader, 1, &source, nullptr);
+	GLFunctions::compileShader(shader);
+
+	GLint compiled = GL_FALSE;
+	GLFunctions::getShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+	if (compiled != GL_TRUE)
+	{
+		char log[1024] = {};
+		GLFunctions::getShaderInfoLog(shader, sizeof(log), nullptr, log);
+		SDL_LogError(SDL_LOG_CATEGORY_RENDER, "shader compile failed: %s", log);
+		GLFunctions::deleteShader(shader);
+		return 0;
+	}
+	return shader;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+class Shader
+{
+public:
+	Shader() = default;
+	~Shader();
+
+	Shader(const Shader&) = delete;
+	Shader& operator=(const Shader&) = delete;
+
+public:
+	// Attribute names are bound to locations in array order before linking.
+	bool compile(
+		const char* vertexSource,
+		const char* fragmentSource,
+		const char* const* attributes,
+		int attributeCount
+	);
+	void release();
+
+	void bind() const;
+	int getUniformLocation(const char* name) const;
+
+	void setFloat(int location, float value) const;
+	void setVec3(int location, const glm::vec3& value) const;
+	void setMat3(int location, const glm::mat3& value) const;
+	void setMat4(int location, const glm::mat4& value) const;
+
+public:
+	bool isValid() const { return m_program != 0; }
+
+private:
+	static unsigned int compileStage(unsigned int type, const char* source);
+
+private:
+	unsigned int m_program = 0;
+};
@@ -0,0 +1,475 @@
+#include "SoftwareRenderer.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SOFTWARE_RENDERER_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+	uint32_t packColor(const glm::vec3& color)
+	{
+		const glm::uvec3 bytes = glm::uvec3(glm::clamp(color, 0.0f, 1.0f) * 255.0f + 0.5f);
+		return bytes.r | (bytes.g << 8) | (bytes.b << 16) | 0xFF000000u;
+	}
+}
+
+SoftwareRenderer::SoftwareRenderer(const glm::uvec2& dimensions, unsigned int threadCount)
+	: m_threadPool(threadCount)
+{
+	setDimensions(dimensions);
+	setPalette(AssetRegistry::getPalette().data(), AssetRegistry::paletteSize);
+}
+
+SoftwareRenderer::~SoftwareRenderer()
+{
+	m_assets.release();
+}
+
+void SoftwareRenderer::onBeginFrame(const SceneState& scene) const
+{
+	m_scene = scene;
+	m_viewProj = scene.camera.getViewProj();
+	m_triangles.clear();
+	for (auto& bin : m_bins)
+	{
+		bin.clear();
+	}
+}
+
+void SoftwareRenderer::onEndFrame() const
+{
+	m_threadPool.run(static_cast<int>(m_bins.size()), [this](int tile)
+	{
+		rasterizeTile(tile);
+	});
+}
+
+void SoftwareRenderer::uploadMesh(Mesh& mesh) const
+{
+	// Meshes are drawn straight from their CPU side copy.
+	mesh.handle.indexCount = static_cast<int>(mesh.getIndexCount());
+}
+
+void SoftwareRenderer::releaseMesh(Mesh& mesh) const
+{
+	mesh.handle = {};
+}
+
+void SoftwareRenderer::drawBatch(const Mesh& mesh, const Instance* instances, int count) const
+{
+	for (int i = 0; i < count; ++i)
+	{
+		drawInstance(mesh, instances[i]);
+	}
+}
+
+void SoftwareRenderer::setPalette(const glm::vec3* colors, int count) const
+{
+	std::copy(colors, colors + std::min(count, AssetRegistry::paletteSize), m_palette.begin());
+}
+
+void SoftwareRenderer::setDimensions(const glm::uvec2& dimensions)
+{
+	// Rows are padded to whole groups of four pixels for the SIMD loops.
+	m_dimensions = dimensions;
+	m_stride = (dimensions.x + 3u) & ~3u;
+	m_tileCountX = (static_cast<int>(dimensions.x) + tileSize - 1) / tileSize;
+	m_tileCountY = (static_cast<int>(dimensions.y) + tileSize - 1) / tileSize;
+
+	m_colorBuffer.assign(static_cast<size_t>(m_stride) * dimensions.y, packColor(m_clearColor));
+	m_depthBuffer.assign(static_cast<size_t>(m_stride) * dimensions.y, 1.0f);
+	m_bins.assign(static_cast<size_t>(m_tileCountX) * m_tileCountY, {});
+}
+
+void SoftwareRenderer::drawInstance(const Mesh& mesh, const Instance& instance) const
+{
+	// Same lighting as the vertex shader of the OpenGL backend.
+	const glm::mat4 modelViewProj = m_viewProj * instance.model;
+	const glm::mat3 normalMat = glm::mat3(instance.model);
+	const glm::vec3& tint = m_palette[static_cast<int>(instance.paletteIndex)];
+
+	m_clipVertices.clear();
+	const Vertex* vertices = mesh.getVertices();
+	for (size_t i = 0; i < mesh.getVertexCount(); ++i)
+	{
+		const Vertex& vertex = vertices[i];
+		const glm::vec3 normal = glm::normalize(normalMat * vertex.normal);
+		const float intensity = glm::max(0.0f, glm::dot(normal, -m_scene.lightSource.direction)) * m_scene.lightSource.intensity;
+		const glm::vec3 light = glm::clamp(glm::vec3(intensity) + m_scene.ambientLight, 0.0f, 1.0f);
+		m_clipVertices.push_back({
+			modelViewProj * glm::vec4(vertex.position, 1.0f),
+			vertex.color * tint * light
+		});
+	}
+
+	const uint16_t* indices = mesh.getIndices();
+	for (size_t i = 0; i + 2 < mesh.getIndexCount(); i += 3)
+	{
+		clipTriangle(
+			m_clipVertices[indices[i]],
+			m_clipVertices[indices[i + 1]],
+			m_clipVertices[indices[i + 2]]
+		);
+	}
+}
+
+void SoftwareRenderer::clipTriangle(const ClipVertex& v1, const ClipVertex& v2, const ClipVertex& v3) const
+{
+	// Triangles entirely outside one of the frustum planes are dropped, the
+	// others are clipped against the near plane and the guard band. Everything
+	// else is left to the screen bounds and the edge functions.
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		if (v1.position[axis] > v1.position.w
+			&& v2.position[axis] > v2.position.w
+			&& v3.position[axis] > v3.position.w)
+		{
+			return;
+		}
+		if (v1.position[axis] < -v1.position.w
+			&& v2.position[axis] < -v2.position.w
+			&& v3.position[axis] < -v3.position.w)
+		{
+			return;
+		}
+	}
+
+	constexpr int planeCount = 5;
+	const auto distanceTo = [](int plane, const glm::vec4& position)
+	{
+		switch (plane)
+		{
+		case 0:
+			return position.z + position.w;
+		case 1:
+			return guardBand * position.w - position.x;
+		case 2:
+			return guardBand * position.w + position.x;
+		case 3:
+			return guardBand * position.w - position.y;
+		default:
+			return guardBand * position.w + position.y;
+		}
+	};
+
+	// Each plane cuts off at most one more corner.
+	ClipVertex polygons[2][3 + planeCount] = {{v1, v2, v3}};
+	int count = 3;
+	int current = 0;
+	for (int plane = 0; plane < planeCount; ++plane)
+	{
+		const ClipVertex* const input = polygons[current];
+		float distances[3 + planeCount];
+		bool isInside = true;
+		for (int i = 0; i < count; ++i)
+		{
+			distances[i] = distanceTo(plane, input[i].position);
+			isInside &= distances[i] >= 0.0f;
+		}
+		if (isInside)
+		{
+			continue;
+		}
+
+		ClipVertex* const output = polygons[1 - current];
+		int outputCount = 0;
+		for (int i = 0; i < count; ++i)
+		{
+			const int next = (i + 1) % count;
+			if (distances[i] >= 0.0f)
+			{
+				output[outputCount++] = input[i];
+			}
+			if ((distances[i] >= 0.0f) != (distances[next] >= 0.0f))
+			{
+				const float t = distances[i] / (distances[i] - distances[next]);
+				output[outputCount++] = {
+					glm::mix(input[i].position, input[next].position, t),
+					glm::mix(input[i].color, input[next].color, t)
+				};
+			}
+		}
+		if (outputCount < 3)
+		{
+			return;
+		}
+		count = outputCount;
+		current = 1 - current;
+	}
+
+	const ClipVertex* const polygon = polygons[current];
+	for (int i = 2; i < count; ++i)
+	{
+		addTriangle(polygon[0], polygon[i - 1], polygon[i]);
+	}
+}
+
+void SoftwareRenderer::addTriangle(const ClipVertex& v1, const ClipVertex& v2, const ClipVertex& v3) const
+{
+	const ClipVertex* const vertices[3] = {&v1, &v2, &v3};
+	const glm::vec2 halfDimensions = glm::vec2(m_dimensions) * 0.5f;
+	constexpr float subPixelScale = static_cast<float>(1 << subPixelBits);
+	constexpr int64_t pixel = int64_t(1) << subPixelBits;
+	constexpr int64_t halfPixel = pixel / 2;
+
+	// Snapped positions make the edge functions exact, the two triangles
+	// sharing an edge evaluate it to exactly opposite values.
+	int64_t x[3];
+	int64_t y[3];
+	float depth[3];
+	float inverseW[3];
+	for (int i = 0; i < 3; ++i)
+	{
+		const glm::vec4& position = vertices[i]->position;
+		inverseW[i] = 1.0f / position.w;
+		x[i] = std::llround((position.x * inverseW[i] + 1.0f) * halfDimensions.x * subPixelScale);
+		y[i] = std::llround((1.0f - position.y * inverseW[i]) * halfDimensions.y * subPixelScale);
+		depth[i] = position.z * inverseW[i] * 0.5f + 0.5f;
+	}
+
+	const int64_t width = static_cast<int64_t>(m_dimensions.x) << subPixelBits;
+	const int64_t height = static_cast<int64_t>(m_dimensions.y) << subPixelBits;
+	const int64_t lowX = std::min({x[0], x[1], x[2]});
+	const int64_t lowY = std::min({y[0], y[1], y[2]});
+	const int64_t highX = std::max({x[0], x[1], x[2]});
+	const int64_t highY = std::max({y[0], y[1], y[2]});
+	if (highX < 0 || highY < 0 || lowX >= width || lowY >= height)
+	{
+		return;
+	}
+
+	// Twice the area, positive when the triangle is counterclockwise on screen
+	// like the default front face of the OpenGL backend, with y pointing
+	// down. The rest faces away and is culled.
+	const int64_t area = (x[2] - x[0]) * (y[1] - y[0]) - (x[1] - x[0]) * (y[2] - y[0]);
+	if (area <= 0)
+	{
+		return;
+	}
+
+	// Edge i runs between the other two vertices and is zero on them. Pixel
+	// centres exactly on an edge belong to the triangle only if it is a top
+	// edge or a left edge.
+	RasterTriangle triangle;
+	Plane weights[3];
+	const double scale = 1.0 / static_cast<double>(area);
+	for (int i = 0; i < 3; ++i)
+	{
+		const int from = (i + 1) % 3;
+		const int to = (i + 2) % 3;
+		const int64_t dx = x[to] - x[from];
+		const int64_t dy = y[to] - y[from];
+		const bool isTopLeft = (dy == 0 && dx < 0) || dy > 0;
+
+		Edge& edge = triangle.edges[i];
+		edge.stepX = dy * pixel;
+		edge.stepY = -dx * pixel;
+		edge.origin = dy * (halfPixel - x[from]) - dx * (halfPixel - y[from]) - (isTopLeft ? 0 : 1);
+
+		weights[i] = {
+			static_cast<float>(static_cast<double>(edge.stepX) * scale),
+			static_cast<float>(static_cast<double>(edge.stepY) * scale),
+			static_cast<float>(static_cast<double>(dx * y[from] - dy * x[from]) * scale)
+		};
+	}
+
+	const auto makePlane = [&weights](float a1, float a2, float a3) -> Plane
+	{
+		return {
+			weights[0].a * a1 + weights[1].a * a2 + weights[2].a * a3,
+			weights[0].b * a1 + weights[1].b * a2 + weights[2].b * a3,
+			weights[0].c * a1 + weights[1].c * a2 + weights[2].c * a3
+		};
+	};
+	triangle.depth = makePlane(depth[0], depth[1], depth[2]);
+	triangle.inverseW = makePlane(inverseW[0], inverseW[1], inverseW[2]);
+	for (int channel = 0; channel < 3; ++channel)
+	{
+		triangle.color[channel] = makePlane(
+			v1.color[channel] * inverseW[0],
+			v2.color[channel] * inverseW[1],
+			v3.color[channel] * inverseW[2]
+		);
+	}
+
+	const glm::ivec2 lastPixel = glm::ivec2(m_dimensions) - 1;
+	triangle.min = {
+		static_cast<int>(std::max(lowX, int64_t(0)) >> subPixelBits),
+		static_cast<int>(std::max(lowY, int64_t(0)) >> subPixelBits)
+	};
+	triangle.max = {
+		static_cast<int>(std::min(highX >> subPixelBits, static_cast<int64_t>(lastPixel.x))),
+		static_cast<int>(std::min(highY >> subPixelBits, static_cast<int64_t>(lastPixel.y)))
+	};
+
+	const uint32_t index = static_cast<uint32_t>(m_triangles.size());
+	m_triangles.push_back(triangle);
+	for (int tileY = triangle.min.y / tileSize; tileY <= triangle.max.y / tileSize; ++tileY)
+	{
+		for (int tileX = triangle.min.x / tileSize; tileX <= triangle.max.x / tileSize; ++tileX)
+		{
+			m_bins[tileY * m_tileCountX + tileX].push_back(index);
+		}
+	}
+}
+
+void SoftwareRenderer::rasterizeTile(int tile) const
+{
+	const int x0 = (tile % m_tileCountX) * tileSize;
+	const int y0 = (tile / m_tileCountX) * tileSize;
+	const int x1 = std::min(x0 + tileSize, static_cast<int>(m_stride));
+	const int y1 = std::min(y0 + tileSize, static_cast<int>(m_dimensions.y));
+
+	const uint32_t clearColor = packColor(m_scene.clearColor);
+	for (int y = y0; y < y1; ++y)
+	{
+		const size_t row = static_cast<size_t>(y) * m_stride;
+		std::fill(m_colorBuffer.begin() + row + x0, m_colorBuffer.begin() + row + x1, clearColor);
+		std::fill(m_depthBuffer.begin() + row + x0, m_depthBuffer.begin() + row + x1, 1.0f);
+	}
+
+#ifdef SOFTWARE_RENDERER_SSE2
+	const __m128 laneCenters = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 maxByte = _mm_set1_ps(255.0f);
+	const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+	const __m128i minusOne = _mm_set1_epi32(-1);
+#endif
+
+	// Bins keep submission order, so equal depths resolve like on the GPU.
+	for (const uint32_t index : m_bins[tile])
+	{
+		const RasterTriangle& triangle = m_triangles[index];
+		const int minY = std::max(triangle.min.y, y0);
+		const int maxY = std::min(triangle.max.y, y1 - 1);
+		const int maxX = std::min(triangle.max.x, x1 - 1);
+
+		for (int y = minY; y <= maxY; ++y)
+		{
+			float* const depthRow = &m_depthBuffer[static_cast<size_t>(y) * m_stride];
+			uint32_t* const colorRow = &m_colorBuffer[static_cast<size_t>(y) * m_stride];
+			const float pixelY = static_cast<float>(y) + 0.5f;
+
+#ifdef SOFTWARE_RENDERER_SSE2
+			// Four pixels at a time, tiles start on multiples of four so a
+			// group never reaches into a neighbouring tile. Every edge keeps
+			// its values for the group in two registers of 64-bit lanes.
+			const int startX = std::max(triangle.min.x, x0) & ~3;
+			__m128i edgeLow[3];
+			__m128i edgeHigh[3];
+			__m128i edgeStep[3];
+			for (int i = 0; i < 3; ++i)
+			{
+				const Edge& edge = triangle.edges[i];
+				const int64_t value = edge.origin + edge.stepY * y + edge.stepX * startX;
+				edgeLow[i] = _mm_set_epi64x(value + edge.stepX, value);
+				edgeHigh[i] = _mm_set_epi64x(value + 3 * edge.stepX, value + 2 * edge.stepX);
+				edgeStep[i] = _mm_set1_epi64x(4 * edge.stepX);
+			}
+
+			for (int x = startX; x <= maxX; x += 4)
+			{
+				const __m128 pixelX = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), laneCenters);
+				const auto evaluate = [&pixelX, pixelY](const Plane& plane)
+				{
+					return _mm_add_ps(
+						_mm_mul_ps(_mm_set1_ps(plane.a), pixelX),
+						_mm_set1_ps(plane.b * pixelY + plane.c)
+					);
+				};
+
+				// The upper halves of the values carry their signs, a pixel is
+				// covered when none of its three is negative.
+				__m128i signs = _mm_setzero_si128();
+				for (int i = 0; i < 3; ++i)
+				{
+					const __m128 upper = _mm_shuffle_ps(
+						_mm_castsi128_ps(edgeLow[i]),
+						_mm_castsi128_ps(edgeHigh[i]),
+						_MM_SHUFFLE(3, 1, 3, 1)
+					);
+					signs = _mm_or_si128(signs, _mm_castps_si128(upper));
+					edgeLow[i] = _mm_add_epi64(edgeLow[i], edgeStep[i]);
+					edgeHigh[i] = _mm_add_epi64(edgeHigh[i], edgeStep[i]);
+				}
+				__m128 mask = _mm_castsi128_ps(_mm_cmpgt_epi32(signs, minusOne));
+				if (_mm_movemask_ps(mask) == 0)
+				{
+					continue;
+				}
+
+				const __m128 depth = evaluate(triangle.depth);
+				const __m128 oldDepth = _mm_loadu_ps(depthRow + x);
+				mask = _mm_and_ps(mask, _mm_cmplt_ps(depth, oldDepth));
+				if (_mm_movemask_ps(mask) == 0)
+				{
+					continue;
+				}
+				_mm_storeu_ps(depthRow + x, _mm_or_ps(_mm_and_ps(mask, depth), _mm_andnot_ps(mask, oldDepth)));
+
+				const __m128 w = _mm_div_ps(one, evaluate(triangle.inverseW));
+				const auto toByte = [&](const Plane& plane)
+				{
+					const __m128 value = _mm_min_ps(_mm_max_ps(_mm_mul_ps(evaluate(plane), w), zero), one);
+					return _mm_cvtps_epi32(_mm_mul_ps(value, maxByte));
+				};
+				__m128i color = alpha;
+				color = _mm_or_si128(color, toByte(triangle.color[0]));
+				color = _mm_or_si128(color, _mm_slli_epi32(toByte(triangle.color[1]), 8));
+				color = _mm_or_si128(color, _mm_slli_epi32(toByte(triangle.color[2]), 16));
+
+				__m128i* const pixels = reinterpret_cast<__m128i*>(colorRow + x);
+				const __m128i colorMask = _mm_castps_si128(mask);
+				const __m128i oldColor = _mm_loadu_si128(pixels);
+				_mm_storeu_si128(pixels, _mm_or_si128(_mm_and_si128(colorMask, color), _mm_andnot_si128(colorMask, oldColor)));
+			}
+#else
+			const int startX = std::max(triangle.min.x, x0);
+			int64_t edgeValues[3];
+			for (int i = 0; i < 3; ++i)
+			{
+				const Edge& edge = triangle.edges[i];
+				edgeValues[i] = edge.origin + edge.stepY * y + edge.stepX * startX;
+			}
+
+			for (int x = startX; x <= maxX; ++x)
+			{
+				const bool isCovered = edgeValues[0] >= 0 && edgeValues[1] >= 0 && edgeValues[2] >= 0;
+				for (int i = 0; i < 3; ++i)
+				{
+					edgeValues[i] += triangle.edges[i].stepX;
+				}
+				if (!isCovered)
+				{
+					continue;
+				}
+
+				const float pixelX = static_cast<float>(x) + 0.5f;
+				const auto evaluate = [pixelX, pixelY](const Plane& plane)
+				{
+					return plane.a * pixelX + plane.b * pixelY + plane.c;
+				};
+
+				const float depth = evaluate(triangle.depth);
+				if (!(depth < depthRow[x]))
+				{
+					continue;
+				}
+				depthRow[x] = depth;
+
+				const float w = 1.0f / evaluate(triangle.inverseW);
+				colorRow[x] = packColor({
+					evaluate(triangle.color[0]) * w,
+					evaluate(triangle.color[1]) * w,
+					evaluate(triangle.color[2]) * w
+				});
+			}
+#endif
+		}
+	}
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Renderer.h"
+#include "ThreadPool.h"
+
+// Renderer backend drawing into an RGBA framebuffer in memory, it needs no
+// window, OpenGL or GPU. Batches shade vertices like the GLSL shader and bin
+// the resulting screen space triangles into tiles, the end of the frame
+// rasterizes the tiles in parallel. Until then the framebuffer holds the last
+// frame.
+class SoftwareRenderer : public Renderer
+{
+public:
+	// Zero threads picks one per hardware thread.
+	explicit SoftwareRenderer(const glm::uvec2& dimensions, unsigned int threadCount = 0);
+	~SoftwareRenderer() override;
+
+public:
+	void uploadMesh(Mesh& mesh) const override;
+	void releaseMesh(Mesh& mesh) const override;
+
+	void setPalette(const glm::vec3* colors, int count) const override;
+
+protected:
+	void onBeginFrame(const SceneState& scene) const override;
+	void drawBatch(const Mesh& mesh, const Instance* instances, int count) const override;
+	void onEndFrame() const override;
+
+public:
+	static constexpr int tileSize = 64;
+
+	const glm::uvec2& getDimensions() const { return m_dimensions; }
+	void setDimensions(const glm::uvec2& dimensions);
+
+	// Pixels are RGBA8 in memory order from the top left corner, rows are
+	// getStride() pixels apart.
+	const std::vector<uint32_t>& getColorBuffer() const { return m_colorBuffer; }
+	unsigned int getStride() const { return m_stride; }
+
+private:
+	// Screen positions snap to 1 / 256 of a pixel. Triangles are clipped to a
+	// guard band this many times the NDC range, far enough out to never show
+	// and close enough to keep the fixed point edge functions within 64 bits.
+	static constexpr int subPixelBits = 8;
+	static constexpr float guardBand = 8.0f;
+
+	// a * x + b * y + c evaluated at pixel centres.
+	struct Plane
+	{
+		float a, b, c;
+	};
+
+	// origin + stepX * x + stepY * y is the edge function at the centre of
+	// pixel (x, y) in fixed point, biased so that only pixels covered by the
+	// fill rule give values of zero or more.
+	struct Edge
+	{
+		int64_t stepX;
+		int64_t stepY;
+		int64_t origin;
+	};
+
+	// Coverage comes from the integer edge functions, every attribute is a
+	// plane built from the barycentric weights. Colours are divided by w for
+	// perspective correction.
+	struct RasterTriangle
+	{
+		Edge edges[3];
+		Plane depth;
+		Plane inverseW;
+		Plane color[3];
+		glm::ivec2 min;
+		glm::ivec2 max;
+	};
+
+	struct ClipVertex
+	{
+		glm::vec4 position;
+		glm::vec3 color;
+	};
+
+	void drawInstance(const Mesh& mesh, const Instance& instance) const;
+	void clipTriangle(const ClipVertex& v1, const ClipVertex& v2, const ClipVertex& v3) const;
+	void addTriangle(const ClipVertex& v1, const ClipVertex& v2, const ClipVertex& v3) const;
+	void rasterizeTile(int tile) const;
+
+private:
+	glm::uvec2 m_dimensions = {0u, 0u};
+	unsigned int m_stride = 0;
+	int m_tileCountX = 0;
+	int m_tileCountY = 0;
+
+	mutable std::vector<uint32_t> m_colorBuffer;
+	mutable std::vector<float> m_depthBuffer;
+
+	mutable std::array<glm::vec3, AssetRegistry::paletteSize> m_palette = {};
+	mutable SceneState m_scene = {};
+	mutable glm::mat4 m_viewProj = glm::mat4(1.0f);
+
+	// Per frame scratch, cleared but never shrunk so steady frames do not
+	// allocate.
+	mutable std::vector<ClipVertex> m_clipVertices;
+	mutable std::vector<RasterTriangle> m_triangles;
+	mutable std::vector<std::vector<uint32_t>> m_bins;
+
+	mutable ThreadPool m_threadPool;
+};
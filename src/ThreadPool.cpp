@@ -0,0 +1,93 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+ThreadPool::ThreadPool(unsigned int threadCount)
+{
+	if (threadCount == 0)
+	{
+		threadCount = std::max(1u, std::thread::hardware_concurrency());
+	}
+	m_workers.reserve(threadCount - 1);
+	for (unsigned int i = 1; i < threadCount; ++i)
+	{
+		m_workers.emplace_back(&ThreadPool::workerLoop, this);
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stopping = true;
+	}
+	m_wake.notify_all();
+	for (auto& worker : m_workers)
+	{
+		worker.join();
+	}
+}
+
+void ThreadPool::run(int taskCount, const std::function<void(int)>& task)
+{
+	if (m_workers.empty() || taskCount <= 1)
+	{
+		for (int index = 0; index < taskCount; ++index)
+		{
+			task(index);
+		}
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_task = &task;
+		m_taskCount = taskCount;
+		m_nextTask = 0;
+		m_busyWorkers = m_workers.size();
+		++m_generation;
+	}
+	m_wake.notify_all();
+
+	runTasks();
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_done.wait(lock, [this]() { return m_busyWorkers == 0; });
+	m_task = nullptr;
+}
+
+void ThreadPool::workerLoop()
+{
+	uint64_t generation = 0;
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_wake.wait(lock, [this, generation]()
+			{
+				return m_stopping || m_generation != generation;
+			});
+			if (m_stopping)
+			{
+				return;
+			}
+			generation = m_generation;
+		}
+
+		runTasks();
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (--m_busyWorkers == 0)
+		{
+			m_done.notify_one();
+		}
+	}
+}
+
+void ThreadPool::runTasks()
+{
+	for (int index = m_nextTask++; index < m_taskCount; index = m_nextTask++)
+	{
+		(*m_task)(index);
+	}
+}
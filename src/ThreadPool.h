@@ -0,0 +1,49 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads for data parallel loops. The threads are started
+// once and sleep between runs, so a run costs no thread creation.
+class ThreadPool
+{
+public:
+	// The calling thread counts as one of threadCount, zero picks one thread
+	// per hardware thread.
+	explicit ThreadPool(unsigned int threadCount = 0);
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+public:
+	// Calls task once for every index below taskCount and returns when all
+	// calls have finished. Indices are handed out one at a time, so uneven
+	// tasks still balance.
+	void run(int taskCount, const std::function<void(int)>& task);
+
+	unsigned int getThreadCount() const { return static_cast<unsigned int>(m_workers.size()) + 1; }
+
+private:
+	void workerLoop();
+	void runTasks();
+
+private:
+	std::vector<std::thread> m_workers;
+
+	std::mutex m_mutex;
+	std::condition_variable m_wake;
+	std::condition_variable m_done;
+
+	const std::function<void(int)>* m_task = nullptr;
+	int m_taskCount = 0;
+	std::atomic<int> m_nextTask{0};
+	size_t m_busyWorkers = 0;
+	uint64_t m_generation = 0;
+	bool m_stopping = false;
+};
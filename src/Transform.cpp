@@ -0,0 +1,76 @@
+#include "Transform.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+const glm::mat4& Transform::getModelMatrix() const
+{
+	if (m_isDirty)
+	{
+		rebuild();
+	}
+	return m_model;
+}
+
+const glm::mat3& Transform::getNormalMatrix() const
+{
+	if (m_isDirty)
+	{
+		rebuild();
+	}
+	return m_normal;
+}
+
+glm::quat Transform::makeRotation(const glm::vec3& eulerDegrees)
+{
+	return glm::angleAxis(glm::radians(eulerDegrees.x), glm::vec3(1.0f, 0.0f, 0.0f))
+		* glm::angleAxis(glm::radians(eulerDegrees.y), glm::vec3(0.0f, 1.0f, 0.0f))
+		* glm::angleAxis(glm::radians(eulerDegrees.z), glm::vec3(0.0f, 0.0f, 1.0f));
+}
+
+void Transform::setPosition(const glm::vec3& position)
+{
+	if (position != m_position)
+	{
+		m_position = position;
+		m_isDirty = true;
+	}
+}
+
+void Transform::setRotation(const glm::quat& rotation)
+{
+	if (rotation != m_rotation)
+	{
+		m_rotation = rotation;
+		m_isDirty = true;
+	}
+}
+
+void Transform::setScale(const glm::vec3& scale)
+{
+	if (scale != m_scale)
+	{
+		m_scale = scale;
+		m_isDirty = true;
+	}
+}
+
+void Transform::rebuild() const
+{
+	const glm::mat3 rotation = glm::mat3_cast(m_rotation);
+
+	m_model = glm::mat4(
+		glm::vec4(rotation[0] * m_scale.x, 0.0f),
+		glm::vec4(rotation[1] * m_scale.y, 0.0f),
+		glm::vec4(rotation[2] * m_scale.z, 0.0f),
+		glm::vec4(m_position, 1.0f)
+	);
+
+	// The inverse transpose of rotation * scale is rotation * inverse(scale).
+	m_normal = glm::mat3(
+		rotation[0] / m_scale.x,
+		rotation[1] / m_scale.y,
+		rotation[2] / m_scale.z
+	);
+
+	m_isDirty = false;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+// Position, rotation and scale of an object together with the model and normal
+// matrices built from them. The matrices are rebuilt lazily, only after one of
+// the components has actually changed.
+class Transform
+{
+public:
+	Transform() = default;
+
+public:
+	const glm::mat4& getModelMatrix() const;
+	const glm::mat3& getNormalMatrix() const;
+
+	// Builds the rotation that the old Euler angle path applied as three
+	// consecutive rotations around x, y and z, angles in degrees.
+	static glm::quat makeRotation(const glm::vec3& eulerDegrees);
+
+public:
+	const glm::vec3& getPosition() const { return m_position; }
+	void setPosition(const glm::vec3& position);
+
+	const glm::quat& getRotation() const { return m_rotation; }
+	void setRotation(const glm::quat& rotation);
+	void setRotation(const glm::vec3& eulerDegrees) { setRotation(makeRotation(eulerDegrees)); }
+
+	const glm::vec3& getScale() const { return m_scale; }
+	void setScale(const glm::vec3& scale);
+
+private:
+	void rebuild() const;
+
+private:
+	glm::vec3 m_position{0.0f, 0.0f, 0.0f};
+	glm::quat m_rotation{1.0f, 0.0f, 0.0f, 0.0f};
+	glm::vec3 m_scale{1.0f, 1.0f, 1.0f};
+
+	mutable glm::mat4 m_model{glm::mat4(1.0f)};
+	mutable glm::mat3 m_normal{glm::mat3(1.0f)};
+	mutable bool m_isDirty = false;
+};
@@ -0,0 +1,62 @@
+#include "TranspositionTable.h"
+
+#include <algorithm>
+
+bool TableEntry::matches(const EngineMove& move) const
+{
+	return move.from == moveFrom && move.to == moveTo && move.captures == moveCaptures;
+}
+
+TranspositionTable::TranspositionTable(size_t megabytes)
+{
+	resize(megabytes);
+}
+
+void TranspositionTable::resize(size_t megabytes)
+{
+	const size_t wanted = megabytes * 1024 * 1024 / sizeof(TableEntry);
+	size_t count = 1;
+	while (count * 2 <= wanted)
+	{
+		count *= 2;
+	}
+	m_entries.assign(count, TableEntry{});
+	m_mask = count - 1;
+}
+
+void TranspositionTable::clear()
+{
+	std::fill(m_entries.begin(), m_entries.end(), TableEntry{});
+}
+
+const TableEntry* TranspositionTable::probe(uint64_t key) const
+{
+	const TableEntry& entry = m_entries[key & m_mask];
+	return entry.key == key && entry.bound != TableBound::NoBound ? &entry : nullptr;
+}
+
+void TranspositionTable::store(uint64_t key, int depth, int score, TableBound bound, const EngineMove* move)
+{
+	TableEntry& entry = m_entries[key & m_mask];
+	if (entry.key == key && entry.depth > depth && bound != TableBound::ExactBound)
+	{
+		return;
+	}
+	const bool keepMove = move == nullptr && entry.key == key;
+	entry.key = key;
+	entry.depth = static_cast<int8_t>(depth);
+	entry.score = score;
+	entry.bound = bound;
+	if (move != nullptr)
+	{
+		entry.moveFrom = move->from;
+		entry.moveTo = move->to;
+		entry.moveCaptures = move->captures;
+	}
+	else if (!keepMove)
+	{
+		entry.moveFrom = 0;
+		entry.moveTo = 0;
+		entry.moveCaptures = 0;
+	}
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Position.h"
+
+enum TableBound : uint8_t
+{
+	NoBound,
+	ExactBound,
+	LowerBound,
+	UpperBound
+};
+
+struct TableEntry
+{
+	uint64_t key = 0;
+	Bitboard moveCaptures = 0;
+	int32_t score = 0;
+	int8_t depth = 0;
+	TableBound bound = TableBound::NoBound;
+	uint8_t moveFrom = 0;
+	uint8_t moveTo = 0;
+
+	bool hasMove() const { return moveFrom != moveTo || moveCaptures != 0; }
+	bool matches(const EngineMove& move) const;
+};
+
+// Depth-preferred hash table keyed by Position::getHash(). It outlives single
+// searches so repeated and multi-PV searches start from previous results.
+class TranspositionTable
+{
+public:
+	explicit TranspositionTable(size_t megabytes = 16);
+
+public:
+	void resize(size_t megabytes);
+	void clear();
+
+	const TableEntry* probe(uint64_t key) const;
+	void store(uint64_t key, int depth, int score, TableBound bound, const EngineMove* move);
+
+public:
+	size_t getEntryCount() const { return m_entries.size(); }
+
+private:
+	std::vector<TableEntry> m_entries;
+	size_t m_mask = 0;
+};
@@ -0,0 +1,374 @@
+#include "Tuner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+	constexpr size_t blockSize = 256;
+
+	// Features of a position followed by its result as a float.
+	constexpr size_t cacheHeaderSize = 3 * sizeof(uint32_t) + sizeof(uint64_t);
+	constexpr size_t cacheRecordSize = sizeof(EvalFeatures) + sizeof(float);
+
+	bool parseResult(const std::string& token, float& result)
+	{
+		if (token == "1-0" || token == "2-0")
+			result = 1.0f;
+		else if (token == "0-1" || token == "0-2")
+			result = 0.0f;
+		else if (token == "1/2-1/2" || token == "1-1")
+			result = 0.5f;
+		else
+		{
+			char* end = nullptr;
+			result = std::strtof(token.c_str(), &end);
+			if (end == token.c_str() || result < 0.0f || result > 1.0f)
+				return false;
+		}
+		return true;
+	}
+}
+
+Tuner::Tuner(unsigned threadCount)
+	: m_threadPool(threadCount)
+{
+}
+
+bool Tuner::loadPositions(const std::string& path)
+{
+	m_invalidLine.clear();
+	std::ifstream file(path);
+	if (!file)
+	{
+		return false;
+	}
+
+	std::vector<EvalFeatures> features;
+	std::vector<float> results;
+	std::string line;
+	while (std::getline(file, line))
+	{
+		std::stringstream stream(line);
+		std::string fen;
+		std::string token;
+		std::string last;
+		if (!(stream >> fen))
+		{
+			continue;
+		}
+		while (stream >> token)
+		{
+			last = token;
+		}
+
+		Position position;
+		float result = 0.0f;
+		if (!parseResult(last, result) || !Position::fromFen(fen, position))
+		{
+			m_invalidLine = line;
+			return false;
+		}
+		if (position.hasCaptures())
+		{
+			continue;
+		}
+
+		features.emplace_back();
+		Evaluation::extractFeatures(position, features.back());
+		results.push_back(result);
+	}
+	setPositions(features, std::move(results));
+	return true;
+}
+
+bool Tuner::loadCache(const std::string& path)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file)
+	{
+		return false;
+	}
+
+	file.seekg(0, std::ios::end);
+	const uint64_t fileSize = static_cast<uint64_t>(file.tellg());
+	file.seekg(0, std::ios::beg);
+
+	uint32_t header[3] = {};
+	uint64_t count = 0;
+	file.read(reinterpret_cast<char*>(header), sizeof(header));
+	file.read(reinterpret_cast<char*>(&count), sizeof(count));
+	if (!file
+		|| header[0] != cacheMagic
+		|| header[1] != cacheVersion
+		|| header[2] != EvalFeature::FeatureCount)
+	{
+		return false;
+	}
+	// A truncated or corrupt file must not size the buffers below.
+	if (count != (fileSize - cacheHeaderSize) / cacheRecordSize
+		|| (fileSize - cacheHeaderSize) % cacheRecordSize != 0)
+	{
+		return false;
+	}
+
+	std::vector<EvalFeatures> features(static_cast<size_t>(count));
+	std::vector<float> results(static_cast<size_t>(count));
+	for (size_t i = 0; i < count; ++i)
+	{
+		file.read(reinterpret_cast<char*>(features[i].data()), sizeof(EvalFeatures));
+		file.read(reinterpret_cast<char*>(&results[i]), sizeof(float));
+	}
+	if (!file)
+	{
+		return false;
+	}
+	setPositions(features, std::move(results));
+	return true;
+}
+
+bool Tuner::saveCache(const std::string& path) const
+{
+	std::ofstream file(path, std::ios::binary);
+	if (!file)
+	{
+		return false;
+	}
+
+	const uint32_t header[3] = {cacheMagic, cacheVersion, EvalFeature::FeatureCount};
+	const uint64_t count = m_count;
+	file.write(reinterpret_cast<const char*>(header), sizeof(header));
+	file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+
+	EvalFeatures features;
+	for (size_t i = 0; i < m_count; ++i)
+	{
+		for (int f = 0; f < EvalFeature::FeatureCount; ++f)
+		{
+			features[f] = m_features[f * m_count + i];
+		}
+		file.write(reinterpret_cast<const char*>(features.data()), sizeof(EvalFeatures));
+		file.write(reinterpret_cast<const char*>(&m_results[i]), sizeof(float));
+	}
+	return static_cast<bool>(file);
+}
+
+double Tuner::computeError(const TunerWeights& weights, double scale) const
+{
+	return evaluateAll(weights, scale, nullptr);
+}
+
+double Tuner::findScale(const EvalWeights& weights) const
+{
+	TunerWeights initial;
+	for (int f = 0; f < EvalFeature::FeatureCount; ++f)
+	{
+		initial[f] = weights.values[f];
+	}
+
+	// Golden-section search, the error is unimodal in the scale.
+	constexpr double ratio = 0.6180339887498949;
+	double low = 0.01;
+	double high = 10.0;
+	double a = high - (high - low) * ratio;
+	double b = low + (high - low) * ratio;
+	double errorA = computeError(initial, a);
+	double errorB = computeError(initial, b);
+	for (int i = 0; i < 40; ++i)
+	{
+		if (errorA < errorB)
+		{
+			high = b;
+			b = a;
+			errorB = errorA;
+			a = high - (high - low) * ratio;
+			errorA = computeError(initial, a);
+		}
+		else
+		{
+			low = a;
+			a = b;
+			errorA = errorB;
+			b = low + (high - low) * ratio;
+			errorB = computeError(initial, b);
+		}
+	}
+	return (low + high) * 0.5;
+}
+
+EvalWeights Tuner::tune(
+	const EvalWeights& initial,
+	double scale,
+	int iterations,
+	double learningRate,
+	const std::function<void(int, double)>& onIteration
+) const
+{
+	constexpr double beta1 = 0.9;
+	constexpr double beta2 = 0.999;
+	constexpr double epsilon = 1e-8;
+
+	TunerWeights weights;
+	TunerWeights momentum = {};
+	TunerWeights velocity = {};
+	for (int f = 0; f < EvalFeature::FeatureCount; ++f)
+	{
+		weights[f] = initial.values[f];
+	}
+
+	for (int iteration = 1; iteration <= iterations; ++iteration)
+	{
+		TunerWeights gradient = {};
+		const double error = evaluateAll(weights, scale, &gradient);
+
+		const double correction1 = 1.0 - std::pow(beta1, iteration);
+		const double correction2 = 1.0 - std::pow(beta2, iteration);
+		for (int f = 0; f < EvalFeature::FeatureCount; ++f)
+		{
+			// The man value anchors the scale of every other weight.
+			if (f == EvalFeature::Man)
+			{
+				continue;
+			}
+			momentum[f] = beta1 * momentum[f] + (1.0 - beta1) * gradient[f];
+			velocity[f] = beta2 * velocity[f] + (1.0 - beta2) * gradient[f] * gradient[f];
+			const double m = momentum[f] / correction1;
+			const double v = velocity[f] / correction2;
+			weights[f] -= learningRate * m / (std::sqrt(v) + epsilon);
+		}
+
+		if (onIteration)
+		{
+			onIteration(iteration, error);
+		}
+	}
+
+	EvalWeights result;
+	for (int f = 0; f < EvalFeature::FeatureCount; ++f)
+	{
+		result.values[f] = static_cast<int>(std::lround(weights[f]));
+	}
+	return result;
+}
+
+void Tuner::setPositions(const std::vector<EvalFeatures>& features, std::vector<float> results)
+{
+	m_count = features.size();
+	m_results = std::move(results);
+	m_features.assign(EvalFeature::FeatureCount * m_count, 0);
+	for (size_t i = 0; i < m_count; ++i)
+	{
+		for (int f = 0; f < EvalFeature::FeatureCount; ++f)
+		{
+			m_features[f * m_count + i] = features[i][f];
+		}
+	}
+}
+
+double Tuner::evaluateRange(
+	size_t begin,
+	size_t end,
+	const TunerWeights& weights,
+	double scale,
+	TunerWeights* gradient
+) const
+{
+	// Works in fixed-size blocks of contiguous floats so the per-feature loops
+	// below compile to packed SIMD multiply-adds.
+	float evals[blockSize];
+	float deltas[blockSize];
+	float floatWeights[EvalFeature::FeatureCount];
+	for (int f = 0; f < EvalFeature::FeatureCount; ++f)
+	{
+		floatWeights[f] = static_cast<float>(weights[f]);
+	}
+	const float exponent = static_cast<float>(-scale * std::log(10.0) / 400.0);
+
+	double error = 0.0;
+	for (size_t block = begin; block < end; block += blockSize)
+	{
+		const size_t size = std::min(blockSize, end - block);
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			evals[i] = 0.0f;
+		}
+		for (int f = 0; f < EvalFeature::FeatureCount; ++f)
+		{
+			const int16_t* column = m_features.data() + f * m_count + block;
+			const float weight = floatWeights[f];
+			for (size_t i = 0; i < size; ++i)
+			{
+				evals[i] += weight * static_cast<float>(column[i]);
+			}
+		}
+
+		const float* results = m_results.data() + block;
+		for (size_t i = 0; i < size; ++i)
+		{
+			const float sigmoid = 1.0f / (1.0f + std::exp(exponent * evals[i]));
+			const float difference = results[i] - sigmoid;
+			error += difference * difference;
+			deltas[i] = difference * sigmoid * (1.0f - sigmoid);
+		}
+
+		if (gradient == nullptr)
+		{
+			continue;
+		}
+		for (int f = 0; f < EvalFeature::FeatureCount; ++f)
+		{
+			const int16_t* column = m_features.data() + f * m_count + block;
+			float sum = 0.0f;
+			for (size_t i = 0; i < size; ++i)
+			{
+				sum += deltas[i] * static_cast<float>(column[i]);
+			}
+			(*gradient)[f] += sum;
+		}
+	}
+	return error;
+}
+
+double Tuner::evaluateAll(const TunerWeights& weights, double scale, TunerWeights* gradient) const
+{
+	if (m_count == 0)
+	{
+		return 0.0;
+	}
+
+	const unsigned threadCount = m_threadPool.getThreadCount();
+	const size_t chunk = (m_count + threadCount - 1) / threadCount;
+	std::vector<double> errors(threadCount, 0.0);
+	std::vector<TunerWeights> gradients(threadCount, TunerWeights{});
+	m_threadPool.run(static_cast<int>(threadCount), [&](int t)
+	{
+		const size_t begin = std::min(m_count, t * chunk);
+		const size_t end = std::min(m_count, begin + chunk);
+		errors[t] = evaluateRange(begin, end, weights, scale, gradient ? &gradients[t] : nullptr);
+	});
+
+	double error = 0.0;
+	for (unsigned t = 0; t < threadCount; ++t)
+	{
+		error += errors[t];
+	}
+	if (gradient != nullptr)
+	{
+		// d/dw (r - s)^2 = -2 (r - s) s (1 - s) * k * x, with k = scale * ln(10) / 400.
+		const double factor = -2.0 * scale * std::log(10.0) / 400.0 / static_cast<double>(m_count);
+		for (int f = 0; f < EvalFeature::FeatureCount; ++f)
+		{
+			double sum = 0.0;
+			for (unsigned t = 0; t < threadCount; ++t)
+			{
+				sum += gradients[t][f];
+			}
+			(*gradient)[f] = sum * factor;
+		}
+	}
+	return error / static_cast<double>(m_count);
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Evaluation.h"
+#include "ThreadPool.h"
+
+using TunerWeights = std::array<double, EvalFeature::FeatureCount>;
+
+// Texel-style tuner: minimises the squared error between game results and
+// sigmoid(scale * eval) over a set of quiet positions.
+class Tuner
+{
+public:
+	explicit Tuner(unsigned threadCount = 0);
+
+public:
+	// Text dataset, one "<fen> <result>" per line with the result from Light's
+	// side ("1-0", "0-1", "1/2-1/2", "2-0", "1-1", "0-2" or 0.0..1.0).
+	// Positions where the side to move has a capture are skipped. Fails on
+	// the first malformed line, which getInvalidLine() then reports.
+	bool loadPositions(const std::string& path);
+	const std::string& getInvalidLine() const { return m_invalidLine; }
+
+	// Binary cache of already extracted features and results, see saveCache().
+	bool loadCache(const std::string& path);
+	bool saveCache(const std::string& path) const;
+
+	double computeError(const TunerWeights& weights, double scale) const;
+	double findScale(const EvalWeights& weights) const;
+
+	EvalWeights tune(
+		const EvalWeights& initial,
+		double scale,
+		int iterations,
+		double learningRate,
+		const std::function<void(int, double)>& onIteration = {}
+	) const;
+
+public:
+	size_t getPositionCount() const { return m_count; }
+	unsigned getThreadCount() const { return m_threadPool.getThreadCount(); }
+
+private:
+	void setPositions(const std::vector<EvalFeatures>& features, std::vector<float> results);
+
+	double evaluateRange(
+		size_t begin,
+		size_t end,
+		const TunerWeights& weights,
+		double scale,
+		TunerWeights* gradient
+	) const;
+	double evaluateAll(const TunerWeights& weights, double scale, TunerWeights* gradient) const;
+
+private:
+	static constexpr uint32_t cacheMagic = 0x43544B43; // "CKTC"
+	static constexpr uint32_t cacheVersion = 2;
+
+	size_t m_count = 0;
+	std::string m_invalidLine;
+
+	// Feature-major so that every per-feature pass walks contiguous memory.
+	std::vector<int16_t> m_features;
+	std::vector<float> m_results;
+
+	// Started once, every tuning iteration runs on the same threads.
+	mutable ThreadPool m_threadPool;
+};
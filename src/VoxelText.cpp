@@ -0,0 +1,182 @@
+#include "VoxelText.h"
+
+#include <algorithm>
+#include <cctype>
+
+namespace
+{
+	// Rows from the top, the highest of the three bits is the left column.
+	struct Glyph
+	{
+		char character;
+		uint8_t rows[VoxelText::glyphHeight];
+	};
+
+	constexpr Glyph glyphs[] = {
+		{'A', {0b111, 0b101, 0b111, 0b101}},
+		{'B', {0b110, 0b111, 0b101, 0b111}},
+		{'C', {0b111, 0b100, 0b100, 0b111}},
+		{'D', {0b110, 0b101, 0b101, 0b110}},
+		{'E', {0b111, 0b100, 0b110, 0b111}},
+		{'F', {0b111, 0b100, 0b110, 0b100}},
+		{'G', {0b111, 0b100, 0b101, 0b111}},
+		{'H', {0b101, 0b101, 0b111, 0b101}},
+		{'I', {0b111, 0b010, 0b010, 0b111}},
+		{'J', {0b001, 0b001, 0b101, 0b111}},
+		{'K', {0b101, 0b110, 0b110, 0b101}},
+		{'L', {0b100, 0b100, 0b100, 0b111}},
+		{'M', {0b101, 0b111, 0b101, 0b101}},
+		{'N', {0b111, 0b101, 0b101, 0b101}},
+		{'O', {0b111, 0b101, 0b101, 0b111}},
+		{'P', {0b111, 0b101, 0b111, 0b100}},
+		{'Q', {0b111, 0b101, 0b111, 0b001}},
+		{'R', {0b111, 0b101, 0b110, 0b101}},
+		{'S', {0b011, 0b100, 0b001, 0b110}},
+		{'T', {0b111, 0b010, 0b010, 0b010}},
+		{'U', {0b101, 0b101, 0b101, 0b111}},
+		{'V', {0b101, 0b101, 0b101, 0b010}},
+		{'W', {0b101, 0b101, 0b111, 0b111}},
+		{'X', {0b101, 0b010, 0b010, 0b101}},
+		{'Y', {0b101, 0b101, 0b010, 0b010}},
+		{'Z', {0b111, 0b001, 0b100, 0b111}},
+		{'0', {0b111, 0b101, 0b101, 0b111}},
+		{'1', {0b010, 0b110, 0b010, 0b111}},
+		{'2', {0b110, 0b001, 0b010, 0b111}},
+		{'3', {0b111, 0b011, 0b001, 0b111}},
+		{'4', {0b101, 0b101, 0b111, 0b001}},
+		{'5', {0b111, 0b110, 0b001, 0b110}},
+		{'6', {0b100, 0b111, 0b101, 0b111}},
+		{'7', {0b111, 0b001, 0b010, 0b010}},
+		{'8', {0b111, 0b111, 0b101, 0b111}},
+		{'9', {0b111, 0b101, 0b111, 0b001}},
+		{'!', {0b010, 0b010, 0b000, 0b010}},
+		{'?', {0b111, 0b001, 0b000, 0b010}},
+		{'-', {0b000, 0b111, 0b000, 0b000}},
+		{'.', {0b000, 0b000, 0b000, 0b010}}
+	};
+
+	const Glyph* findGlyph(char character)
+	{
+		const char upper = static_cast<char>(std::toupper(static_cast<unsigned char>(character)));
+		for (const Glyph& glyph : glyphs)
+		{
+			if (glyph.character == upper)
+			{
+				return &glyph;
+			}
+		}
+		return nullptr;
+	}
+}
+
+VoxelText::VoxelText(const std::string& text)
+{
+	setText(text);
+}
+
+void VoxelText::setText(const std::string& text)
+{
+	m_text = text;
+	m_cells.clear();
+	m_instances.clear();
+	m_isDirty = true;
+
+	// Line widths in characters, lines are centred once the widest is known.
+	std::vector<int> lineLengths = {0};
+	for (const char character : text)
+	{
+		if (character == '\n')
+		{
+			lineLengths.push_back(0);
+		}
+		else
+		{
+			++lineLengths.back();
+		}
+	}
+
+	const auto columnsOf = [](int length)
+	{
+		return length > 0 ? length * (glyphWidth + 1) - 1 : 0;
+	};
+
+	const int lineCount = static_cast<int>(lineLengths.size());
+	const int longest = *std::max_element(lineLengths.begin(), lineLengths.end());
+	m_dimensions = {columnsOf(longest), lineCount * (glyphHeight + 1) - 1};
+	if (m_dimensions.x == 0)
+	{
+		m_dimensions = {0, 0};
+		return;
+	}
+
+	const glm::vec2 center = glm::vec2(m_dimensions) / 2.0f;
+	int line = 0;
+	int character = 0;
+	for (const char c : text)
+	{
+		if (c == '\n')
+		{
+			++line;
+			character = 0;
+			continue;
+		}
+
+		const Glyph* glyph = findGlyph(c);
+		if (glyph != nullptr)
+		{
+			const float lineIndent = static_cast<float>(m_dimensions.x - columnsOf(lineLengths[line])) / 2.0f;
+			const int left = character * (glyphWidth + 1);
+			const int top = line * (glyphHeight + 1);
+			for (int row = 0; row < glyphHeight; ++row)
+			{
+				for (int column = 0; column < glyphWidth; ++column)
+				{
+					if ((glyph->rows[row] >> (glyphWidth - 1 - column) & 1) != 0)
+					{
+						m_cells.push_back({
+							lineIndent + static_cast<float>(left + column) - center.x,
+							0.0f,
+							static_cast<float>(top + row) - center.y
+						});
+					}
+				}
+			}
+		}
+		++character;
+	}
+
+	m_instances.resize(m_cells.size());
+}
+
+void VoxelText::render(
+	const Renderer& renderer,
+	const glm::mat4& placement,
+	const glm::mat4& cellTransform,
+	int paletteIndex
+) const
+{
+	if (m_cells.empty())
+	{
+		return;
+	}
+
+	if (m_isDirty
+		|| placement != m_placement
+		|| paletteIndex != m_paletteIndex)
+	{
+		// Each instance moves to its cell, the renderer applies the shared
+		// cell transform on the right.
+		for (size_t i = 0; i < m_cells.size(); ++i)
+		{
+			Instance& instance = m_instances[i];
+			instance.model = glm::mat4(1.0f);
+			instance.model[3] = placement * glm::vec4(m_cells[i], 1.0f);
+			instance.paletteIndex = static_cast<float>(paletteIndex);
+		}
+		m_placement = placement;
+		m_paletteIndex = paletteIndex;
+		m_isDirty = false;
+	}
+
+	renderer.drawMeshInstanced(renderer.getAssets().getMesh(PieceMesh), m_instances, cellTransform);
+}
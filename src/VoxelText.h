@@ -0,0 +1,52 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Renderer.h"
+
+// Text spelled with one piece per lit cell of blocky glyphs. The cells are laid
+// out once per text and their instances only hold the cell positions, so a
+// spinning cell transform is applied while drawing and leaves them untouched.
+// All cells are drawn in a single instanced call.
+class VoxelText
+{
+public:
+	explicit VoxelText(const std::string& text = {});
+
+public:
+	static constexpr int glyphWidth = 3;
+	static constexpr int glyphHeight = 4;
+
+	// Lines break at '\n' and are centred on each other. Letters ignore case,
+	// characters without a glyph are left blank.
+	void setText(const std::string& text);
+	const std::string& getText() const { return m_text; }
+
+	// Columns and rows of cells, glyphs and lines are one empty cell apart.
+	const glm::ivec2& getDimensions() const { return m_dimensions; }
+	int getCellCount() const { return static_cast<int>(m_cells.size()); }
+
+	// Placement maps the layout into the world, one unit per cell with the
+	// text centred on the origin of its x/z plane. Every piece is turned and
+	// scaled by cellTransform around its own centre.
+	void render(
+		const Renderer& renderer,
+		const glm::mat4& placement,
+		const glm::mat4& cellTransform,
+		int paletteIndex
+	) const;
+
+private:
+	std::string m_text;
+	glm::ivec2 m_dimensions = {0, 0};
+	std::vector<glm::vec3> m_cells;
+
+	// Rewritten only when the placement or the palette index change.
+	mutable std::vector<Instance> m_instances;
+	mutable glm::mat4 m_placement = glm::mat4(1.0f);
+	mutable int m_paletteIndex = 0;
+	mutable bool m_isDirty = true;
+};
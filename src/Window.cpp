@@ -1,162 +1,260 @@
-#include "Window.h"
-
-#include <sdl/SDL_opengl.h>
-
-Window::Window(const char* title, const glm::uvec2& dimensions)
-	: m_title(title),
-	  m_dimensions(dimensions)
-{
-	SDL_Init(SDL_INIT_EVERYTHING);
-	m_sdlWindow = SDL_CreateWindow(
-		m_title.c_str(),
-		SDL_WINDOWPOS_CENTERED,
-		SDL_WINDOWPOS_CENTERED,
-		static_cast<int>(m_dimensions.x),
-		static_cast<int>(m_dimensions.y),
-		SDL_WINDOW_RESIZABLE | SDL_WINDOW_SHOWN | SDL_WINDOW_OPENGL
-	);
-	m_frameCount = SDL_GetPerformanceCounter();
-}
-
-Window::~Window()
-{
-	SDL_DestroyWindow(m_sdlWindow);
-	SDL_Quit();
-}
-
-SDL_GLContext Window::createContext() const
-{
-	const auto glContext = SDL_GL_CreateContext(m_sdlWindow);
-	SDL_GL_MakeCurrent(m_sdlWindow, glContext);
-	return glContext;
-}
-
-void Window::run()
-{
-	init();
-	while (!m_shouldClose)
-	{
-		handleEvents();
-		update(calcDeltaTime());
-		SDL_GL_SwapWindow(m_sdlWindow);
-	}
-}
-
-void Window::close()
-{
-	m_shouldClose = true;
-}
-
-void Window::onResize(const glm::uvec2& windowDimensions)
-{
-	m_dimensions = windowDimensions;
-	glViewport(
-		0,
-		0,
-		static_cast<int>(m_dimensions.x),
-		static_cast<int>(m_dimensions.y)
-	);
-}
-
-bool Window::isKeyDown(SDL_Keycode keycode)
-{
-	return m_keyboardState[keycode];
-}
-
-bool Window::isKeyPressed(SDL_Keycode keycode)
-{
-	return m_keyboardState[keycode] && !m_lastKeyboardState[keycode];
-}
-
-bool Window::isKeyReleased(SDL_Keycode keycode)
-{
-	return !m_keyboardState[keycode] && m_lastKeyboardState[keycode];
-}
-
-bool Window::isMouseButtonDown(uint8_t mouseButton)
-{
-	return m_mouseState[mouseButton];
-}
-
-bool Window::isMouseButtonPressed(uint8_t mouseButton)
-{
-	return m_mouseState[mouseButton] && !m_lastMouseState[mouseButton];
-}
-
-bool Window::isMouseButtonReleased(uint8_t mouseButton)
-{
-	return !m_mouseState[mouseButton] && m_lastMouseState[mouseButton];
-}
-
-const glm::vec2& Window::getMousePosition() const
-{
-	return m_mousePosition;
-}
-
-glm::vec2 Window::getMouseDelta() const
-{
-	return m_mousePositionLastFrame - m_mousePosition;
-}
-
-void Window::handleEvents()
-{
-	m_lastKeyboardState = m_keyboardState;
-	m_lastMouseState = m_mouseState;
-	m_mousePositionLastFrame = m_mousePosition;
-	SDL_Event m_event;
-	while (SDL_PollEvent(&m_event))
-	{
-		switch (m_event.type)
-		{
-		case SDL_QUIT:
-			close();
-			break;
-		case SDL_WINDOWEVENT:
-			if (m_event.window.event == SDL_WINDOWEVENT_RESIZED)
-				onResize({m_event.window.data1, m_event.window.data2});
-			break;
-		case SDL_KEYDOWN:
-			m_keyboardState[m_event.key.keysym.sym] = true;
-			break;
-		case SDL_KEYUP:
-			m_keyboardState[m_event.key.keysym.sym] = false;
-			break;
-		case SDL_MOUSEBUTTONDOWN:
-			m_mouseState[m_event.button.button] = true;
-			break;
-		case SDL_MOUSEBUTTONUP:
-			m_mouseState[m_event.button.button] = false;
-			break;
-		case SDL_MOUSEMOTION:
-			m_mousePosition = {m_event.button.x, m_event.button.y};
-			break;
-		default:
-			break;
-		}
-	}
-}
-
-float Window::calcDeltaTime()
-{
-	const uint64_t lastFrameCount = m_frameCount;
-	m_frameCount = SDL_GetPerformanceCounter();
-	const double deltaTime = (m_frameCount - lastFrameCount)
-		/ static_cast<double>(SDL_GetPerformanceFrequency());
-	return static_cast<float>(glm::max(deltaTime, 0.0001));
-}
-
-void Window::setTitle(const std::string& title)
-{
-	m_title = title;
-	SDL_SetWindowTitle(m_sdlWindow, m_title.c_str());
-}
-
-void Window::setDimensions(const glm::uvec2& dimensions)
-{
-	m_dimensions = dimensions;
-	SDL_SetWindowSize(
-		m_sdlWindow,
-		static_cast<int>(m_dimensions.x),
-		static_cast<int>(m_dimensions.y)
-	);
-}
+#include "Window.h"
+
+#include <thread>
+
+namespace
+{
+	// SDL_Delay may wake up a scheduler tick late, the end of a frame is spun.
+	constexpr double frameSpinSeconds = 0.002;
+
+	// Idle waits wake up now and then for work finishing in the background.
+	constexpr int idleTimeoutMs = 100;
+
+	// Time beyond this many steps is dropped, a long stall slows the game
+	// down instead of making the next frame even longer.
+	constexpr int maxStepsPerFrame = 8;
+}
+
+Window::Window(const char* title, const glm::uvec2& dimensions)
+	: m_title(title),
+	  m_dimensions(dimensions)
+{
+	SDL_Init(SDL_INIT_EVERYTHING);
+	m_sdlWindow = SDL_CreateWindow(
+		m_title.c_str(),
+		SDL_WINDOWPOS_CENTERED,
+		SDL_WINDOWPOS_CENTERED,
+		static_cast<int>(m_dimensions.x),
+		static_cast<int>(m_dimensions.y),
+		SDL_WINDOW_RESIZABLE | SDL_WINDOW_SHOWN | SDL_WINDOW_OPENGL
+	);
+	m_frameCount = SDL_GetPerformanceCounter();
+}
+
+Window::~Window()
+{
+	SDL_DestroyWindow(m_sdlWindow);
+	SDL_Quit();
+}
+
+SDL_GLContext Window::createContext() const
+{
+	const auto glContext = SDL_GL_CreateContext(m_sdlWindow);
+	SDL_GL_MakeCurrent(m_sdlWindow, glContext);
+	return glContext;
+}
+
+void Window::run()
+{
+	init();
+
+	const SDL_GLContext glContext = SDL_GL_GetCurrentContext();
+	SDL_GL_MakeCurrent(m_sdlWindow, nullptr);
+	std::thread renderThread(&Window::renderLoop, this, glContext);
+
+	bool wasAnimating = true;
+	float accumulator = 0.0f;
+	while (!m_shouldClose)
+	{
+		const bool hasEvents = handleEvents();
+
+		accumulator = glm::min(accumulator + calcDeltaTime(), maxStepsPerFrame * simulationStep);
+		while (accumulator >= simulationStep && !m_shouldClose)
+		{
+			update(simulationStep);
+			consumeInput();
+			accumulator -= simulationStep;
+		}
+
+		// The frame after an animation stops still shows its final state.
+		const bool isAnimatingNow = isAnimating();
+		const bool isFrameNeeded = !m_isOnDemand || hasEvents || wasAnimating || isAnimatingNow;
+		wasAnimating = isAnimatingNow;
+		if (isFrameNeeded)
+		{
+			draw(accumulator / simulationStep);
+			waitForNextFrame();
+		}
+		else
+		{
+			SDL_WaitEventTimeout(nullptr, idleTimeoutMs);
+		}
+	}
+
+	stopRendering();
+	renderThread.join();
+	SDL_GL_MakeCurrent(m_sdlWindow, glContext);
+}
+
+void Window::close()
+{
+	m_shouldClose = true;
+}
+
+void Window::onResize(const glm::uvec2& windowDimensions)
+{
+	m_dimensions = windowDimensions;
+}
+
+void Window::renderLoop(SDL_GLContext glContext)
+{
+	SDL_GL_MakeCurrent(m_sdlWindow, glContext);
+	int swapInterval = -1;
+	while (render())
+	{
+		if (swapInterval != m_swapInterval)
+		{
+			swapInterval = m_swapInterval;
+			SDL_GL_SetSwapInterval(swapInterval);
+		}
+		SDL_GL_SwapWindow(m_sdlWindow);
+	}
+	SDL_GL_MakeCurrent(m_sdlWindow, nullptr);
+}
+
+bool Window::isKeyDown(SDL_Keycode keycode)
+{
+	const SDL_Scancode scancode = SDL_GetScancodeFromKey(keycode);
+	return m_keyboardState[scancode];
+}
+
+bool Window::isKeyPressed(SDL_Keycode keycode)
+{
+	const SDL_Scancode scancode = SDL_GetScancodeFromKey(keycode);
+	return m_keyboardState[scancode] && !m_lastKeyboardState[scancode];
+}
+
+bool Window::isKeyReleased(SDL_Keycode keycode)
+{
+	const SDL_Scancode scancode = SDL_GetScancodeFromKey(keycode);
+	return !m_keyboardState[scancode] && m_lastKeyboardState[scancode];
+}
+
+bool Window::isMouseButtonDown(uint8_t mouseButton)
+{
+	return m_mouseState[mouseButton];
+}
+
+bool Window::isMouseButtonPressed(uint8_t mouseButton)
+{
+	return m_mouseState[mouseButton] && !m_lastMouseState[mouseButton];
+}
+
+bool Window::isMouseButtonReleased(uint8_t mouseButton)
+{
+	return !m_mouseState[mouseButton] && m_lastMouseState[mouseButton];
+}
+
+const glm::vec2& Window::getMousePosition() const
+{
+	return m_mousePosition;
+}
+
+glm::vec2 Window::getMouseDelta() const
+{
+	return m_mousePositionLastFrame - m_mousePosition;
+}
+
+void Window::consumeInput()
+{
+	m_lastKeyboardState = m_keyboardState;
+	m_lastMouseState = m_mouseState;
+	m_mousePositionLastFrame = m_mousePosition;
+}
+
+bool Window::handleEvents()
+{
+	bool hasEvents = false;
+	SDL_Event m_event;
+	while (SDL_PollEvent(&m_event))
+	{
+		hasEvents = true;
+		switch (m_event.type)
+		{
+		case SDL_QUIT:
+			close();
+			break;
+		case SDL_WINDOWEVENT:
+			if (m_event.window.event == SDL_WINDOWEVENT_RESIZED)
+				onResize({m_event.window.data1, m_event.window.data2});
+			break;
+		case SDL_KEYDOWN:
+			m_keyboardState[m_event.key.keysym.scancode] = true;
+			break;
+		case SDL_KEYUP:
+			m_keyboardState[m_event.key.keysym.scancode] = false;
+			break;
+		case SDL_MOUSEBUTTONDOWN:
+			m_mouseState[m_event.button.button] = true;
+			break;
+		case SDL_MOUSEBUTTONUP:
+			m_mouseState[m_event.button.button] = false;
+			break;
+		case SDL_MOUSEMOTION:
+			m_mousePosition = {m_event.button.x, m_event.button.y};
+			break;
+		default:
+			break;
+		}
+	}
+	return hasEvents;
+}
+
+float Window::calcDeltaTime()
+{
+	const uint64_t lastFrameCount = m_frameCount;
+	m_frameCount = SDL_GetPerformanceCounter();
+	const double deltaTime = (m_frameCount - lastFrameCount)
+		/ static_cast<double>(SDL_GetPerformanceFrequency());
+	return static_cast<float>(glm::max(deltaTime, 0.0001));
+}
+
+void Window::waitForNextFrame()
+{
+	if (m_targetFrameRate <= 0.0f)
+	{
+		return;
+	}
+
+	// Deadlines advance by whole frames so rounding never adds up, a late
+	// frame starts over from now instead of hurrying to catch up.
+	const double frequency = static_cast<double>(SDL_GetPerformanceFrequency());
+	const uint64_t frameLength = static_cast<uint64_t>(frequency / m_targetFrameRate);
+	const uint64_t spinLength = static_cast<uint64_t>(frequency * frameSpinSeconds);
+	m_nextFrameCount += frameLength;
+	uint64_t now = SDL_GetPerformanceCounter();
+	if (m_nextFrameCount < now)
+	{
+		m_nextFrameCount = now;
+		return;
+	}
+
+	while (m_nextFrameCount - now > spinLength)
+	{
+		SDL_Delay(static_cast<uint32_t>((m_nextFrameCount - now - spinLength) * 1000.0 / frequency));
+		now = SDL_GetPerformanceCounter();
+		if (now >= m_nextFrameCount)
+		{
+			return;
+		}
+	}
+	while (SDL_GetPerformanceCounter() < m_nextFrameCount)
+	{
+	}
+}
+
+void Window::setTitle(const std::string& title)
+{
+	m_title = title;
+	SDL_SetWindowTitle(m_sdlWindow, m_title.c_str());
+}
+
+void Window::setDimensions(const glm::uvec2& dimensions)
+{
+	m_dimensions = dimensions;
+	SDL_SetWindowSize(
+		m_sdlWindow,
+		static_cast<int>(m_dimensions.x),
+		static_cast<int>(m_dimensions.y)
+	);
+}
@@ -1,65 +1,105 @@
-#pragma once
-
-#include <string>
-#include <map>
-
-#include <sdl/SDL.h>
-#include <glm/glm.hpp>
-
-class Window
-{
-public:
-	Window(const char* title, const glm::uvec2& dimensions);
-	virtual ~Window();
-
-public:
-	SDL_GLContext createContext() const;
-
-	void run();
-	void close();
-
-protected:
-	virtual void init() = 0;
-	virtual void update(const float& deltaTime) = 0;
-
-protected:
-	virtual void onResize(const glm::uvec2& windowDimensions);
-
-public:
-	bool isKeyDown(SDL_Keycode keycode);
-	bool isKeyPressed(SDL_Keycode keycode);
-	bool isKeyReleased(SDL_Keycode keycode);
-	bool isMouseButtonDown(uint8_t mouseButton);
-	bool isMouseButtonPressed(uint8_t mouseButton);
-	bool isMouseButtonReleased(uint8_t mouseButton);
-	const glm::vec2& getMousePosition() const;
-	glm::vec2 getMouseDelta() const;
-
-private:
-	void handleEvents();
-	float calcDeltaTime();
-
-public:
-	const std::string& getTitle() const { return m_title; }
-	void setTitle(const std::string& title);
-
-	const glm::uvec2& getDimensions() const { return m_dimensions; }
-	void setDimensions(const glm::uvec2& dimensions);
-
-private:
-	SDL_Window* m_sdlWindow = nullptr;
-	std::string m_title = "Window";
-	glm::uvec2 m_dimensions = {800u, 600u};
-
-	bool m_shouldClose = false;
-	uint64_t m_frameCount = 0;
-
-	std::map<SDL_Keycode, bool> m_lastKeyboardState;
-	std::map<SDL_Keycode, bool> m_keyboardState;
-
-	std::map<uint8_t, bool> m_lastMouseState;
-	std::map<uint8_t, bool> m_mouseState;
-
-	glm::vec2 m_mousePosition = {};
-	glm::vec2 m_mousePositionLastFrame = {};
-};
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <string>
+
+#include <sdl/SDL.h>
+#include <glm/glm.hpp>
+
+class Window
+{
+public:
+	Window(const char* title, const glm::uvec2& dimensions);
+	virtual ~Window();
+
+public:
+	SDL_GLContext createContext() const;
+
+	void run();
+	void close();
+
+protected:
+	// init(), update() and draw() run on the calling thread of run(), which
+	// owns the events. Frames are submitted and swapped on a render thread that
+	// takes over the OpenGL context of the calling thread after init().
+	//
+	// update() always advances by simulationStep, as many steps as the elapsed
+	// time holds. Input edges last until a step has seen them. draw() gets how
+	// far the frame lies between the last two steps.
+	virtual void init() = 0;
+	virtual void update(const float& deltaTime) = 0;
+	virtual void draw(const float& alpha) = 0;
+
+	// Whether frames change without input, on demand pacing only draws then
+	// or after events.
+	virtual bool isAnimating() const { return true; }
+
+	// Draws the next frame on the render thread, false stops the thread.
+	virtual bool render() = 0;
+	virtual void stopRendering() = 0;
+
+protected:
+	virtual void onResize(const glm::uvec2& windowDimensions);
+
+public:
+	bool isKeyDown(SDL_Keycode keycode);
+	bool isKeyPressed(SDL_Keycode keycode);
+	bool isKeyReleased(SDL_Keycode keycode);
+	bool isMouseButtonDown(uint8_t mouseButton);
+	bool isMouseButtonPressed(uint8_t mouseButton);
+	bool isMouseButtonReleased(uint8_t mouseButton);
+	const glm::vec2& getMousePosition() const;
+	glm::vec2 getMouseDelta() const;
+
+private:
+	void renderLoop(SDL_GLContext glContext);
+	bool handleEvents();
+	void consumeInput();
+	float calcDeltaTime();
+	void waitForNextFrame();
+
+public:
+	static constexpr float simulationStep = 1.0f / 60.0f;
+
+	const std::string& getTitle() const { return m_title; }
+	void setTitle(const std::string& title);
+
+	const glm::uvec2& getDimensions() const { return m_dimensions; }
+	void setDimensions(const glm::uvec2& dimensions);
+
+	// Takes effect on the next swap.
+	bool isVsync() const { return m_swapInterval != 0; }
+	void setVsync(bool vsync) { m_swapInterval = vsync ? 1 : 0; }
+
+	// Frames per second the loop is held to, zero leaves it unlimited.
+	const float& getTargetFrameRate() const { return m_targetFrameRate; }
+	void setTargetFrameRate(const float& frameRate) { m_targetFrameRate = glm::max(frameRate, 0.0f); }
+
+	// Sleeps until input arrives while nothing animates.
+	const bool& isOnDemand() const { return m_isOnDemand; }
+	void setOnDemand(const bool& onDemand) { m_isOnDemand = onDemand; }
+
+private:
+	SDL_Window* m_sdlWindow = nullptr;
+	std::string m_title = "Window";
+	glm::uvec2 m_dimensions = {800u, 600u};
+
+	bool m_shouldClose = false;
+	uint64_t m_frameCount = 0;
+
+	std::atomic<int> m_swapInterval{1};
+	float m_targetFrameRate = 0.0f;
+	bool m_isOnDemand = false;
+	uint64_t m_nextFrameCount = 0;
+
+	// Indexed by scancode and button, copying them each frame never allocates.
+	std::array<bool, SDL_NUM_SCANCODES> m_lastKeyboardState = {};
+	std::array<bool, SDL_NUM_SCANCODES> m_keyboardState = {};
+
+	std::array<bool, 256> m_lastMouseState = {};
+	std::array<bool, 256> m_mouseState = {};
+
+	glm::vec2 m_mousePosition = {};
+	glm::vec2 m_mousePositionLastFrame = {};
+};
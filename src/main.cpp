@@ -1,13 +1,27 @@
-#include "Window.h"
-#include "GameWindow.h"
-
-int main(int argc, char* argv[])
-{
-	constexpr glm::uvec2 windowDimensions{1280u, 720u};
-	Window* const window = new GameWindow("SDL-Checkers", windowDimensions);
-
-	window->run();
-
-	delete window;
-	return 0;
-}
+#include <cstdlib>
+#include <string>
+
+#include "Window.h"
+#include "GameWindow.h"
+
+int main(int argc, char* argv[])
+{
+	constexpr glm::uvec2 windowDimensions{1280u, 720u};
+	Window* const window = new GameWindow("SDL-Checkers", windowDimensions);
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string option = argv[i];
+		if (option == "-novsync")
+			window->setVsync(false);
+		else if (option == "-ondemand")
+			window->setOnDemand(true);
+		else if (option == "-fps" && i + 1 < argc)
+			window->setTargetFrameRate(static_cast<float>(std::atof(argv[++i])));
+	}
+
+	window->run();
+
+	delete window;
+	return 0;
+}
@@ -0,0 +1,88 @@
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "Search.h"
+
+namespace
+{
+	void printUsage()
+	{
+		std::printf(
+			"usage: analyze [fen] [options]\n"
+			"  -multipv <n>   number of best moves to report (default 3)\n"
+			"  -depth <n>     maximum depth (default 64)\n"
+			"  -time <ms>     time limit in milliseconds (default 5000)\n"
+			"  -hash <mb>     transposition table size (default 64)\n"
+		);
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	Position position = Position::initial();
+	SearchLimits limits;
+	limits.multiPv = 3;
+	limits.timeMs = 5000;
+	size_t hashMegabytes = 64;
+
+	int i = 1;
+	if (argc > 1 && argv[1][0] != '-')
+	{
+		if (!Position::fromFen(argv[1], position))
+		{
+			std::fprintf(stderr, "invalid fen: %s\n", argv[1]);
+			return 1;
+		}
+		i = 2;
+	}
+	for (; i + 1 < argc; i += 2)
+	{
+		const std::string option = argv[i];
+		const int value = std::atoi(argv[i + 1]);
+		if (option == "-multipv")
+			limits.multiPv = value;
+		else if (option == "-depth")
+			limits.depth = value;
+		else if (option == "-time")
+			limits.timeMs = value;
+		else if (option == "-hash")
+			hashMegabytes = static_cast<size_t>(value);
+		else
+		{
+			printUsage();
+			return 1;
+		}
+	}
+
+	Search search(hashMegabytes);
+	std::printf("%s\n", position.toFen().c_str());
+	const SearchInfo result = search.run(position, limits, [](const SearchInfo& info)
+	{
+		std::printf(
+			"depth %d nodes %llu nps %llu time %d\n",
+			info.depth,
+			static_cast<unsigned long long>(info.nodes),
+			static_cast<unsigned long long>(info.nodesPerSecond),
+			info.elapsedMs
+		);
+		for (size_t k = 0; k < info.lines.size(); ++k)
+		{
+			std::printf(
+				"  %zu. %6s  %s\n",
+				k + 1,
+				Search::formatScore(info.lines[k].score).c_str(),
+				Search::formatLine(info.lines[k]).c_str()
+			);
+		}
+		std::fflush(stdout);
+	});
+
+	if (result.lines.empty())
+	{
+		std::printf("no legal moves\n");
+		return 0;
+	}
+	std::printf("best %s\n", Position::formatMove(result.lines.front().move).c_str());
+	return 0;
+}
@@ -0,0 +1,39 @@
+#!/bin/sh
+# Scripted Hub protocol session checks for the engine binary, e.g.
+# tools/engine/check.sh ./engine
+# Each session is fed with pauses in between and the order of the "done" and
+# "pong" replies is compared, a ping marks how far the session had got.
+
+engine=${1:-./engine}
+failed=0
+
+check()
+{
+	name=$1
+	expected=$2
+	actual=$( (eval "$3") | timeout 20 "$engine" | grep -E -o '^(done|pong)' | tr '\n' ' ' | sed 's/ $//')
+	if [ "$actual" = "$expected" ]; then
+		echo "ok   $name"
+	else
+		echo "FAIL $name: expected '$expected', got '$actual'"
+		failed=1
+	fi
+}
+
+# A stop right after go ends the search, no matter how early it arrives.
+check "go analyze, stop" "done pong" \
+	"printf 'go analyze\nstop\n'; sleep 1; printf 'ping\nquit\n'"
+
+# A timed search ends on its own.
+check "go think" "done pong" \
+	"printf 'level move-time=0.3\ngo think\n'; sleep 1.5; printf 'ping\nquit\n'"
+
+# Pondering goes on until the ponder hit, which then gives it the move time.
+check "go ponder, ponder-hit" "pong pong done pong" \
+	"printf 'level move-time=1\ngo ponder\n'; sleep 0.5; printf 'ping\nponder-hit\n'; sleep 0.2; printf 'ping\n'; sleep 2; printf 'ping\nquit\n'"
+
+# A stop while pondering ends the search at once.
+check "go ponder, stop" "done pong" \
+	"printf 'go ponder\n'; sleep 0.3; printf 'stop\n'; sleep 0.3; printf 'ping\nquit\n'"
+
+exit $failed
@@ -0,0 +1,11 @@
+#include <iostream>
+
+#include "HubEngine.h"
+
+int main()
+{
+	std::ios::sync_with_stdio(false);
+	HubEngine engine(std::cin, std::cout);
+	engine.run();
+	return 0;
+}
@@ -0,0 +1,188 @@
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "MeshRecipes.h"
+
+// Bakes every level of every MeshRecipes recipe into constant arrays, so the
+// game uploads them without generating anything at startup.
+namespace
+{
+	void printUsage()
+	{
+		std::printf(
+			"usage: meshgen <output> [options]\n"
+			"  output is the header to write, normally src/BakedMeshes.h\n"
+			"  -check           compare with the existing output instead of writing it,\n"
+			"                   fails when the recipes have changed since it was baked\n"
+		);
+	}
+
+	// Shortest text that reads back as the same float, always with a decimal
+	// point so it stays a float literal.
+	std::string formatFloat(float value)
+	{
+		if (value == 0.0f)
+		{
+			// Also folds -0.0f.
+			return "0.0f";
+		}
+
+		char text[32];
+		for (int precision = 1; precision <= 9; ++precision)
+		{
+			std::snprintf(text, sizeof(text), "%.*g", precision, value);
+			if (std::strtof(text, nullptr) == value)
+			{
+				break;
+			}
+		}
+		std::string result = text;
+		if (result.find_first_of(".e") == std::string::npos)
+		{
+			result += ".0";
+		}
+		return result + "f";
+	}
+
+	std::string formatVec3(const glm::vec3& value)
+	{
+		return "{" + formatFloat(value.x) + ", " + formatFloat(value.y) + ", " + formatFloat(value.z) + "}";
+	}
+
+	std::string getArrayName(MeshAsset asset, int level, const char* suffix)
+	{
+		std::string name = MeshRecipes::getAssetName(asset);
+		name[0] = static_cast<char>(std::tolower(static_cast<unsigned char>(name[0])));
+		return name + "Level" + std::to_string(level) + suffix;
+	}
+
+	std::string bake()
+	{
+		std::ostringstream out;
+		out << "#pragma once\n"
+			<< "\n"
+			<< "// Generated by tools/meshgen from MeshRecipes, do not edit.\n"
+			<< "// Include it from AssetRegistry.cpp only.\n"
+			<< "\n"
+			<< "#include \"RenderTypes.h\"\n"
+			<< "\n"
+			<< "namespace BakedMeshes\n"
+			<< "{\n";
+
+		std::ostringstream table;
+		table << "\t// Indexed by MeshAsset, then by level of detail, the finest first.\n"
+			<< "\tconstexpr BakedMesh meshes[" << MeshAssetCount << "][" << MeshRecipes::maxLevelCount << "] = {\n";
+
+		for (int a = 0; a < MeshAssetCount; ++a)
+		{
+			const MeshAsset asset = static_cast<MeshAsset>(a);
+			table << "\t\t{";
+			for (int level = 0; level < MeshRecipes::maxLevelCount; ++level)
+			{
+				if (level > 0)
+				{
+					table << ", ";
+				}
+				if (level >= MeshRecipes::getLevelCount(asset))
+				{
+					table << "{}";
+					continue;
+				}
+
+				const Mesh mesh = MeshRecipes::generate(asset, level);
+				const std::string vertices = getArrayName(asset, level, "Vertices");
+				const std::string indices = getArrayName(asset, level, "Indices");
+
+				out << "\tconstexpr Vertex " << vertices << "[] = {\n";
+				for (const Vertex& vertex : mesh.vertices)
+				{
+					out << "\t\t{" << formatVec3(vertex.position)
+						<< ", " << formatVec3(vertex.normal)
+						<< ", " << formatVec3(vertex.color) << "},\n";
+				}
+				out << "\t};\n"
+					<< "\n"
+					<< "\tconstexpr uint16_t " << indices << "[] = {";
+				for (size_t i = 0; i < mesh.indices.size(); ++i)
+				{
+					out << (i % 16 == 0 ? "\n\t\t" : " ") << mesh.indices[i] << ",";
+				}
+				out << "\n\t};\n"
+					<< "\n";
+
+				table << "{" << vertices << ", " << mesh.vertices.size()
+					<< ", " << indices << ", " << mesh.indices.size()
+					<< ", {" << formatVec3(mesh.bounds.min)
+					<< ", " << formatVec3(mesh.bounds.max)
+					<< ", " << formatVec3(mesh.bounds.center)
+					<< ", " << formatFloat(mesh.bounds.radius) << "}}";
+			}
+			table << "}" << (a + 1 < MeshAssetCount ? "," : "") << "\n";
+		}
+		table << "\t};\n";
+
+		out << table.str()
+			<< "}\n";
+		return out.str();
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2 || argv[1][0] == '-')
+	{
+		printUsage();
+		return 1;
+	}
+
+	const std::string path = argv[1];
+	bool check = false;
+	for (int i = 2; i < argc; ++i)
+	{
+		const std::string option = argv[i];
+		if (option == "-check")
+		{
+			check = true;
+		}
+		else
+		{
+			printUsage();
+			return 1;
+		}
+	}
+
+	const std::string baked = bake();
+	if (check)
+	{
+		std::ifstream file(path, std::ios::binary);
+		std::ostringstream existing;
+		existing << file.rdbuf();
+		// The checkout may have turned the line endings into CRLF.
+		std::string text = existing.str();
+		text.erase(std::remove(text.begin(), text.end(), '\r'), text.end());
+		if (!file || text != baked)
+		{
+			// In the form Visual Studio lists as a build error.
+			std::fprintf(stderr, "%s : error : out of date, run meshgen %s\n", path.c_str(), path.c_str());
+			return 1;
+		}
+		std::printf("%s is up to date\n", path.c_str());
+		return 0;
+	}
+
+	std::ofstream file(path, std::ios::binary);
+	file << baked;
+	if (!file)
+	{
+		std::fprintf(stderr, "cannot write %s\n", path.c_str());
+		return 1;
+	}
+	std::printf("wrote %s\n", path.c_str());
+	return 0;
+}
@@ -0,0 +1,275 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BoardScene.h"
+#include "ImageWriter.h"
+#include "SoftwareRenderer.h"
+
+namespace
+{
+	void printUsage()
+	{
+		std::printf(
+			"usage: render <input> [options]\n"
+			"  input is a file with one fen per line, or a recorded game with -game\n"
+			"  -game            input holds an optional fen line followed by the moves,\n"
+			"                   one frame is rendered per position of the game\n"
+			"  -width <n>       image width (default 1280)\n"
+			"  -height <n>      image height (default 720)\n"
+			"  -format <f>      png or raw (default png)\n"
+			"  -out <prefix>    output file prefix (default frame)\n"
+			"  -threads <n>     worker threads (default: all cores)\n"
+		);
+	}
+
+	bool readPositions(const std::string& path, std::vector<Position>& positions)
+	{
+		std::ifstream file(path);
+		if (!file)
+		{
+			std::fprintf(stderr, "cannot open %s\n", path.c_str());
+			return false;
+		}
+
+		std::string line;
+		while (std::getline(file, line))
+		{
+			if (line.empty() || line[0] == '#')
+				continue;
+			Position position;
+			if (!Position::fromFen(line, position))
+			{
+				std::fprintf(stderr, "invalid fen: %s\n", line.c_str());
+				return false;
+			}
+			positions.push_back(position);
+		}
+		return true;
+	}
+
+	bool isMoveToken(const std::string& token)
+	{
+		return token.find_first_of("-x") != std::string::npos
+			&& token != "2-0" && token != "0-2" && token != "1-1";
+	}
+
+	// Squares of "32-28", "19x30" or "19x28x37", numbered from 1.
+	bool parseSquares(const std::string& token, std::vector<int>& squares)
+	{
+		size_t start = 0;
+		while (start <= token.size())
+		{
+			const size_t end = std::min(token.find_first_of("-x", start), token.size());
+			const std::string number = token.substr(start, end - start);
+			if (number.empty() || number.size() > 2 || number.find_first_not_of("0123456789") != std::string::npos)
+				return false;
+			const int square = std::atoi(number.c_str());
+			if (square < 1 || square > Position::squareCount)
+				return false;
+			squares.push_back(square - 1);
+			start = end + 1;
+		}
+		return squares.size() >= 2;
+	}
+
+	bool matchesSquares(const EngineMove& move, const std::vector<int>& squares)
+	{
+		if (move.from != squares.front() || move.to != squares.back())
+			return false;
+		if (squares.size() == 2)
+			return true;
+		if (squares.size() != move.pathLength + 1u)
+			return false;
+		return std::equal(squares.begin() + 1, squares.end(), move.path);
+	}
+
+	bool readGame(const std::string& path, std::vector<Position>& positions)
+	{
+		std::ifstream file(path);
+		if (!file)
+		{
+			std::fprintf(stderr, "cannot open %s\n", path.c_str());
+			return false;
+		}
+
+		// Only a fen has ':' separators, a first line without them already
+		// holds moves.
+		Position position = Position::initial();
+		std::string line;
+		if (std::getline(file, line) && line.find(':') != std::string::npos)
+		{
+			if (!Position::fromFen(line, position))
+			{
+				std::fprintf(stderr, "invalid fen: %s\n", line.c_str());
+				return false;
+			}
+		}
+		else
+		{
+			file.clear();
+			file.seekg(0);
+		}
+		positions.push_back(position);
+
+		std::string token;
+		while (file >> token)
+		{
+			if (!isMoveToken(token))
+				continue;
+
+			std::vector<int> squares;
+			if (!parseSquares(token, squares))
+			{
+				std::fprintf(stderr, "invalid move %s after %zu positions\n", token.c_str(), positions.size());
+				return false;
+			}
+
+			// A full capture lists every landing square, the short form only
+			// the first and last and has to pick out a single capture.
+			MoveList moves;
+			position.generateMoves(moves);
+			const bool capture = token.find('x') != std::string::npos;
+			const EngineMove* played = nullptr;
+			bool ambiguous = false;
+			for (const auto& move : moves)
+			{
+				if (!matchesSquares(move, squares) || move.isCapture() != capture)
+					continue;
+				if (played != nullptr && *played != move)
+					ambiguous = true;
+				played = &move;
+			}
+			if (ambiguous)
+			{
+				std::fprintf(stderr, "ambiguous move %s after %zu positions, give every landing square\n", token.c_str(), positions.size());
+				return false;
+			}
+			if (played == nullptr)
+			{
+				std::fprintf(stderr, "illegal move %s after %zu positions\n", token.c_str(), positions.size());
+				return false;
+			}
+			position.makeMove(*played);
+			positions.push_back(position);
+		}
+		return true;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2)
+	{
+		printUsage();
+		return 1;
+	}
+
+	const std::string input = argv[1];
+	bool game = false;
+	glm::uvec2 dimensions = {1280u, 720u};
+	std::string format = "png";
+	std::string outPrefix = "frame";
+	unsigned threads = 0;
+
+	for (int i = 2; i < argc; ++i)
+	{
+		const std::string option = argv[i];
+		if (option == "-game")
+		{
+			game = true;
+			continue;
+		}
+		if (i + 1 >= argc)
+		{
+			printUsage();
+			return 1;
+		}
+		const char* value = argv[++i];
+		if (option == "-width")
+			dimensions.x = static_cast<unsigned>(std::atoi(value));
+		else if (option == "-height")
+			dimensions.y = static_cast<unsigned>(std::atoi(value));
+		else if (option == "-format")
+			format = value;
+		else if (option == "-out")
+			outPrefix = value;
+		else if (option == "-threads")
+			threads = static_cast<unsigned>(std::atoi(value));
+		else
+		{
+			printUsage();
+			return 1;
+		}
+	}
+	if (dimensions.x == 0 || dimensions.y == 0 || (format != "png" && format != "raw"))
+	{
+		printUsage();
+		return 1;
+	}
+
+	std::vector<Position> positions;
+	if (!(game ? readGame(input, positions) : readPositions(input, positions)))
+	{
+		return 1;
+	}
+	if (threads == 0)
+	{
+		threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+	threads = std::min(threads, static_cast<unsigned>(positions.size()));
+
+	// Every worker owns a whole render context and takes the next frame, the
+	// renderers rasterize on the worker thread alone.
+	std::atomic<size_t> nextFrame{0};
+	std::atomic<int> failures{0};
+	const auto work = [&]()
+	{
+		SoftwareRenderer renderer(dimensions, 1);
+		BoardScene::setupLighting(renderer);
+		BoardScene scene(renderer, Position::boardSize);
+		Camera camera;
+
+		for (size_t frame = nextFrame++; frame < positions.size(); frame = nextFrame++)
+		{
+			const Position& position = positions[frame];
+			BoardScene::setupCamera(camera, dimensions, position.getSideToMove());
+			scene.setPosition(position);
+
+			renderer.beginFrame(&camera);
+			scene.render();
+			renderer.endFrame();
+
+			char name[32];
+			std::snprintf(name, sizeof(name), "_%05zu.%s", frame, format == "png" ? "png" : "rgba");
+			const std::string path = outPrefix + name;
+			const bool written = format == "png"
+				? ImageWriter::writePng(path, renderer.getColorBuffer().data(), dimensions.x, dimensions.y, renderer.getStride())
+				: ImageWriter::writeRaw(path, renderer.getColorBuffer().data(), dimensions.x, dimensions.y, renderer.getStride());
+			if (!written)
+			{
+				std::fprintf(stderr, "cannot write %s\n", path.c_str());
+				++failures;
+			}
+		}
+	};
+
+	std::vector<std::thread> workers;
+	for (unsigned i = 1; i < threads; ++i)
+	{
+		workers.emplace_back(work);
+	}
+	work();
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+
+	std::printf("rendered %zu frames to %s_*.%s\n", positions.size(), outPrefix.c_str(), format == "png" ? "png" : "rgba");
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,111 @@
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "Tuner.h"
+
+namespace
+{
+	void printUsage()
+	{
+		std::printf(
+			"usage: tuner <positions.txt | cache.bin> [options]\n"
+			"  -cache <file>       write extracted features to a binary cache\n"
+			"  -weights <file>     initial weights (defaults to the built-in ones)\n"
+			"  -out <file>         where to write the tuned weights\n"
+			"  -iterations <n>     gradient descent iterations (default 500)\n"
+			"  -rate <r>           learning rate (default 1.0)\n"
+			"  -threads <n>        worker threads (default: all cores)\n"
+		);
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2)
+	{
+		printUsage();
+		return 1;
+	}
+
+	const std::string input = argv[1];
+	std::string cachePath;
+	std::string weightsPath;
+	std::string outPath = "weights.txt";
+	int iterations = 500;
+	double learningRate = 1.0;
+	unsigned threads = 0;
+
+	for (int i = 2; i + 1 < argc; i += 2)
+	{
+		const std::string option = argv[i];
+		const char* value = argv[i + 1];
+		if (option == "-cache")
+			cachePath = value;
+		else if (option == "-weights")
+			weightsPath = value;
+		else if (option == "-out")
+			outPath = value;
+		else if (option == "-iterations")
+			iterations = std::atoi(value);
+		else if (option == "-rate")
+			learningRate = std::atof(value);
+		else if (option == "-threads")
+			threads = static_cast<unsigned>(std::atoi(value));
+		else
+		{
+			printUsage();
+			return 1;
+		}
+	}
+
+	Tuner tuner(threads);
+	if (!tuner.loadCache(input) && !tuner.loadPositions(input))
+	{
+		if (!tuner.getInvalidLine().empty())
+		{
+			std::fprintf(stderr, "invalid line in %s: %s\n", input.c_str(), tuner.getInvalidLine().c_str());
+		}
+		else
+		{
+			std::fprintf(stderr, "cannot read %s\n", input.c_str());
+		}
+		return 1;
+	}
+	std::printf("%zu positions, %u threads\n", tuner.getPositionCount(), tuner.getThreadCount());
+
+	if (!cachePath.empty() && !tuner.saveCache(cachePath))
+	{
+		std::fprintf(stderr, "cannot write %s\n", cachePath.c_str());
+		return 1;
+	}
+
+	EvalWeights weights = EvalWeights::defaults();
+	if (!weightsPath.empty() && !Evaluation::readWeights(weightsPath, weights))
+	{
+		std::fprintf(stderr, "cannot read %s\n", weightsPath.c_str());
+		return 1;
+	}
+
+	const double scale = tuner.findScale(weights);
+	std::printf("scale %.4f\n", scale);
+
+	weights = tuner.tune(weights, scale, iterations, learningRate, [](int iteration, double error)
+	{
+		if (iteration % 50 == 0)
+		{
+			std::printf("iteration %d error %.8f\n", iteration, error);
+		}
+	});
+
+	for (int f = 0; f < EvalFeature::FeatureCount; ++f)
+	{
+		std::printf("%-14s %d\n", Evaluation::getFeatureName(f), weights.values[f]);
+	}
+	if (!Evaluation::writeWeights(outPath, weights))
+	{
+		std::fprintf(stderr, "cannot write %s\n", outPath.c_str());
+		return 1;
+	}
+	return 0;
+}